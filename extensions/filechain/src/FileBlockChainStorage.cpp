@@ -37,13 +37,23 @@ namespace catapult { namespace filechain {
 			CATAPULT_LOG(info) << "loaded block chain from " << source << " (height = " << height << ", score = " << score << ")";
 		}
 
+		StateStorageOptions CreateStateStorageOptions(const config::NodeConfiguration& config) {
+			StateStorageOptions options;
+			options.NumWorkerThreads = config.StateStorageWorkerThreads;
+			return options;
+		}
+
 		class FileBlockChainStorage : public extensions::BlockChainStorage {
 		public:
 			void loadFromStorage(const extensions::LocalNodeStateRef& stateRef, const plugins::PluginManager& pluginManager) override {
 				cache::SupplementalData supplementalData;
 				bool isStateLoaded = false;
 				try {
-					isStateLoaded = LoadState(stateRef.Config.User.DataDirectory, stateRef.Cache, supplementalData);
+					isStateLoaded = LoadState(
+							stateRef.Config.User.DataDirectory,
+							stateRef.Cache,
+							supplementalData,
+							CreateStateStorageOptions(stateRef.Config.Node));
 				} catch (...) {
 					CATAPULT_LOG(error) << "error when loading state, remove state directories and start again";
 					throw;
@@ -117,13 +127,21 @@ namespace catapult { namespace filechain {
 					const BlockDependentEntityObserverFactory& observerFactory,
 					const extensions::LocalNodeStateRef& stateRef,
 					Height startHeight) {
-				auto score = LoadBlockChain(observerFactory, stateRef, startHeight);
+				BlockChainLoadOptions options;
+				options.PrefetchDepth = stateRef.Config.Node.BlockLoadPrefetchDepth;
+				options.CommitInterval = stateRef.Config.Node.BlockLoadCommitInterval;
+
+				auto score = LoadBlockChain(observerFactory, stateRef, startHeight, options);
 				stateRef.Score += score;
 			}
 
 		public:
 			void saveToStorage(const extensions::LocalNodeStateConstRef& stateRef) override {
-				SaveState(stateRef.Config.User.DataDirectory, stateRef.Cache, { stateRef.State, stateRef.Score.get() });
+				SaveState(
+						stateRef.Config.User.DataDirectory,
+						stateRef.Cache,
+						{ stateRef.State, stateRef.Score.get() },
+						CreateStateStorageOptions(stateRef.Config.Node));
 			}
 		};
 	}
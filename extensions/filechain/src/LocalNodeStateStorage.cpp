@@ -25,9 +25,13 @@
 #include "catapult/cache/SupplementalDataStorage.h"
 #include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/FileLock.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <atomic>
+#include <mutex>
 
 namespace catapult { namespace filechain {
 
@@ -66,9 +70,63 @@ namespace catapult { namespace filechain {
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		template<typename TStoragePointer, typename TAction>
+		void ProcessStorage(
+				const char* operation,
+				const TStoragePointer& pStorage,
+				std::atomic<size_t>& numProcessed,
+				size_t numTotal,
+				TAction action) {
+			{
+				auto message = std::string(operation) + " " + pStorage->name();
+				utils::StackLogger stopwatch(message.c_str(), utils::LogLevel::Debug);
+				action(*pStorage);
+			}
+
+			CATAPULT_LOG(info) << operation << " " << pStorage->name() << " completed (" << ++numProcessed << " / " << numTotal << ")";
+		}
+
+		template<typename TStorages, typename TAction>
+		void ProcessStorages(const char* operation, TStorages& storages, uint32_t numWorkerThreads, TAction action) {
+			std::atomic<size_t> numProcessed(0);
+			auto numThreads = std::min<size_t>(numWorkerThreads, storages.size());
+			if (numThreads <= 1) {
+				for (const auto& pStorage : storages)
+					ProcessStorage(operation, pStorage, numProcessed, storages.size(), action);
+
+				return;
+			}
+
+			// every storage is backed by an independent sub-cache and file, so all storages can be processed concurrently
+			auto pPool = thread::CreateIoServiceThreadPool(numThreads, "state storage");
+			pPool->start();
+
+			std::mutex exceptionMutex;
+			std::exception_ptr pException;
+			thread::ParallelFor(pPool->service(), storages, storages.size(), [&](const auto& pStorage, auto) {
+				try {
+					ProcessStorage(operation, pStorage, numProcessed, storages.size(), action);
+				} catch (...) {
+					std::lock_guard<std::mutex> lock(exceptionMutex);
+					if (!pException)
+						pException = std::current_exception();
+				}
+
+				return true;
+			}).get();
+			pPool->join();
+
+			if (pException)
+				std::rethrow_exception(pException);
+		}
 	}
 
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData) {
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options) {
 		auto lockFilePath = GetStatePath(dataDirectory, State_Lock_Filename);
 		io::FileLock stateLock(lockFilePath);
 		if (!stateLock.try_lock()) {
@@ -81,8 +139,10 @@ namespace catapult { namespace filechain {
 
 		utils::StackLogger stopwatch("load state", utils::LogLevel::Warning);
 
-		for (const auto& pStorage : cache.storages())
-			LoadCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		auto storages = cache.storages();
+		ProcessStorages("load cache", storages, options.NumWorkerThreads, [&dataDirectory](auto& storage) {
+			LoadCache(dataDirectory, GetStorageFilename(storage), storage);
+		});
 
 		Height chainHeight;
 		{
@@ -108,7 +168,11 @@ namespace catapult { namespace filechain {
 		}
 	}
 
-	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData) {
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options) {
 		// 1. if the previous SaveState crashed, an orphaned lock file will be present, which would have caused LoadState to be bypassed
 		//    and instead triggered a rebuild of the cache by reloading all blocks
 		// 2. in the current SaveState, delete any existing lock file (state is not written incrementally) and create a new one
@@ -120,8 +184,12 @@ namespace catapult { namespace filechain {
 		else
 			CATAPULT_LOG(warning) << "lock file could not be removed and must be removed manually";
 
-		for (const auto& pStorage : cache.storages())
-			SaveCache(dataDirectory, GetStorageFilename(*pStorage), *pStorage);
+		utils::StackLogger stopwatch("save state", utils::LogLevel::Warning);
+
+		auto storages = cache.storages();
+		ProcessStorages("save cache", storages, options.NumWorkerThreads, [&dataDirectory](const auto& storage) {
+			SaveCache(dataDirectory, GetStorageFilename(storage), storage);
+		});
 
 		{
 			auto path = GetStatePath(dataDirectory, Supplemental_Data_Filename);
@@ -20,6 +20,7 @@
 
 #pragma once
 #include <string>
+#include <stdint.h>
 
 namespace catapult {
 	namespace cache {
@@ -30,10 +31,26 @@ namespace catapult {
 
 namespace catapult { namespace filechain {
 
-	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory.
-	void SaveState(const std::string& dataDirectory, const cache::CatapultCache& cache, const cache::SupplementalData& supplementalData);
+	/// Options for loading and saving state.
+	struct StateStorageOptions {
+		/// Number of worker threads used to load and save sub-cache storages (\c 0 or \c 1 processes them sequentially).
+		uint32_t NumWorkerThreads = 1;
+	};
 
-	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory.
+	/// Save catapult \a cache state along with \a supplementalData into state directory inside \a dataDirectory
+	/// using \a options.
+	void SaveState(
+			const std::string& dataDirectory,
+			const cache::CatapultCache& cache,
+			const cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options = StateStorageOptions());
+
+	/// Load catapult \a cache state and \a supplementalData from state directory inside \a dataDirectory using \a options.
 	/// Returns \c true if data has been loaded, \c false if there was nothing to load.
-	bool LoadState(const std::string& dataDirectory, cache::CatapultCache& cache, cache::SupplementalData& supplementalData);
+	/// \note Each sub-cache is committed independently.
+	bool LoadState(
+			const std::string& dataDirectory,
+			cache::CatapultCache& cache,
+			cache::SupplementalData& supplementalData,
+			const StateStorageOptions& options = StateStorageOptions());
 }}
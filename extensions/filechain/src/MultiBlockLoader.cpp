@@ -28,6 +28,9 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/StackLogger.h"
+#include <condition_variable>
+#include <deque>
+#include <thread>
 
 namespace catapult { namespace filechain {
 
@@ -98,6 +101,84 @@ namespace catapult { namespace filechain {
 			const utils::StackLogger& m_stopwatch;
 			size_t m_numLogs;
 		};
+
+		class BlockElementReader {
+		public:
+			BlockElementReader(const io::BlockStorageView& storage, Height startHeight, Height endHeight, size_t prefetchDepth)
+					: m_storage(storage)
+					, m_nextHeight(startHeight)
+					, m_prefetchDepth(prefetchDepth)
+					, m_isStopped(false) {
+				if (0 != m_prefetchDepth)
+					m_thread = std::thread([this, startHeight, endHeight]() { prefetchAll(startHeight, endHeight); });
+			}
+
+			~BlockElementReader() {
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopped = true;
+				}
+
+				m_condition.notify_all();
+				if (m_thread.joinable())
+					m_thread.join();
+			}
+
+		public:
+			std::shared_ptr<const model::BlockElement> next() {
+				if (0 == m_prefetchDepth) {
+					auto pBlockElement = m_storage.loadBlockElement(m_nextHeight);
+					m_nextHeight = m_nextHeight + Height(1);
+					return pBlockElement;
+				}
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return !m_blockElements.empty() || m_pException; });
+
+				// only surface a prefetch error after all blocks preceding the failure have been consumed
+				if (m_blockElements.empty())
+					std::rethrow_exception(m_pException);
+
+				auto pBlockElement = std::move(m_blockElements.front());
+				m_blockElements.pop_front();
+				m_condition.notify_all();
+				return pBlockElement;
+			}
+
+		private:
+			void prefetchAll(Height startHeight, Height endHeight) {
+				try {
+					for (auto height = startHeight; height <= endHeight; height = height + Height(1)) {
+						// load outside of the lock so that loading overlaps with execution
+						auto pBlockElement = m_storage.loadBlockElement(height);
+
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_condition.wait(lock, [this]() { return m_blockElements.size() < m_prefetchDepth || m_isStopped; });
+						if (m_isStopped)
+							return;
+
+						m_blockElements.push_back(std::move(pBlockElement));
+						m_condition.notify_all();
+					}
+				} catch (...) {
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_pException = std::current_exception();
+					m_condition.notify_all();
+				}
+			}
+
+		private:
+			const io::BlockStorageView& m_storage;
+			Height m_nextHeight;
+			size_t m_prefetchDepth;
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			std::deque<std::shared_ptr<const model::BlockElement>> m_blockElements;
+			std::exception_ptr m_pException;
+			bool m_isStopped;
+			std::thread m_thread;
+		};
 	}
 
 	class BlockChainLoader {
@@ -108,10 +189,12 @@ namespace catapult { namespace filechain {
 		BlockChainLoader(
 				const BlockDependentEntityObserverFactory& observerFactory,
 				const extensions::LocalNodeStateRef& stateRef,
-				Height startHeight)
+				Height startHeight,
+				const BlockChainLoadOptions& options)
 				: m_observerFactory(observerFactory)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
+				, m_options(options)
 		{}
 
 	public:
@@ -123,41 +206,43 @@ namespace catapult { namespace filechain {
 
 			model::ChainScore score;
 			auto chainHeight = storage.chainHeight();
+			auto commitInterval = std::max<uint32_t>(1, m_options.CommitInterval);
+			BlockElementReader reader(storage, height, chainHeight, m_options.PrefetchDepth);
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
-				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
-
-				execute(*pBlockElement);
-				notifyProgress(height, chainHeight);
-
-				pParentBlockElement = std::move(pBlockElement);
-				height = height + Height(1);
+				// execute up to commitInterval blocks on top of the same delta before committing
+				auto cacheDelta = m_stateRef.Cache.createDelta();
+				auto observerState = observers::ObserverState(cacheDelta, m_stateRef.State);
+				for (auto i = 0u; i < commitInterval && chainHeight >= height; ++i) {
+					auto pBlockElement = reader.next();
+					score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
+
+					const auto& block = pBlockElement->Block;
+					chain::ExecuteBlock(*pBlockElement, m_observerFactory(block), observerState);
+					notifyProgress(height, chainHeight);
+
+					pParentBlockElement = std::move(pBlockElement);
+					height = height + Height(1);
+				}
+
+				m_stateRef.Cache.commit(height - Height(1));
 			}
 
 			return score;
 		}
 
-	private:
-		void execute(const model::BlockElement& blockElement) const {
-			auto cacheDelta = m_stateRef.Cache.createDelta();
-			auto observerState = observers::ObserverState(cacheDelta, m_stateRef.State);
-
-			const auto& block = blockElement.Block;
-			chain::ExecuteBlock(blockElement, m_observerFactory(block), observerState);
-			m_stateRef.Cache.commit(block.Height);
-		}
-
 	private:
 		const BlockDependentEntityObserverFactory& m_observerFactory;
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
+		BlockChainLoadOptions m_options;
 	};
 
 	model::ChainScore LoadBlockChain(
 			const BlockDependentEntityObserverFactory& observerFactory,
 			const extensions::LocalNodeStateRef& stateRef,
-			Height startHeight) {
-		BlockChainLoader loader(observerFactory, stateRef, startHeight);
+			Height startHeight,
+			const BlockChainLoadOptions& options) {
+		BlockChainLoader loader(observerFactory, stateRef, startHeight, options);
 
 		utils::StackLogger stopwatch("load block chain", utils::LogLevel::Warning);
 		return loader.loadAll(AnalyzeProgressLogger(stopwatch));
@@ -45,10 +45,20 @@ namespace catapult { namespace filechain {
 			const observers::EntityObserver& transientObserver,
 			const observers::EntityObserver& permanentObserver);
 
+	/// Options for loading a block chain from storage.
+	struct BlockChainLoadOptions {
+		/// Number of blocks that are loaded by a background reader ahead of execution (\c 0 disables prefetching).
+		uint32_t PrefetchDepth = 0;
+
+		/// Number of blocks that are executed between cache commits.
+		uint32_t CommitInterval = 1;
+	};
+
 	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and updating \a stateRef
-	/// starting with the block at \a startHeight.
+	/// starting with the block at \a startHeight according to \a options.
 	model::ChainScore LoadBlockChain(
 			const BlockDependentEntityObserverFactory& observerFactory,
 			const extensions::LocalNodeStateRef& stateRef,
-			Height startHeight);
+			Height startHeight,
+			const BlockChainLoadOptions& options = BlockChainLoadOptions());
 }}
@@ -72,7 +72,16 @@ namespace catapult { namespace filechain {
 			EXPECT_EQ(expectedView.sub<cache::BlockDifficultyCache>().size(), actualView.sub<cache::BlockDifficultyCache>().size());
 		}
 
-		cache::SupplementalData SaveState(const std::string& dataDirectory, cache::CatapultCache& cache) {
+		StateStorageOptions CreateOptions(uint32_t numWorkerThreads) {
+			StateStorageOptions options;
+			options.NumWorkerThreads = numWorkerThreads;
+			return options;
+		}
+
+		cache::SupplementalData SaveState(
+				const std::string& dataDirectory,
+				cache::CatapultCache& cache,
+				const StateStorageOptions& options = StateStorageOptions()) {
 			cache::SupplementalData supplementalData;
 			{
 				auto delta = cache.createDelta();
@@ -86,30 +95,85 @@ namespace catapult { namespace filechain {
 
 			supplementalData.ChainScore = model::ChainScore(0x1234567890ABCDEF, 0xFEDCBA0987654321);
 			supplementalData.State.LastRecalculationHeight = model::ImportanceHeight(12345);
-			filechain::SaveState(dataDirectory, cache, supplementalData);
+			filechain::SaveState(dataDirectory, cache, supplementalData, options);
 			return supplementalData;
 		}
 	}
 
+	// region save and load
+
+	namespace {
+		void AssertCanSaveAndLoadState(uint32_t numSaveWorkerThreads, uint32_t numLoadWorkerThreads) {
+			// Arrange: seed and save the cache state
+			test::TempDirectoryGuard tempDir;
+			auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			auto originalSupplementalData = SaveState(tempDir.name(), originalCache, CreateOptions(numSaveWorkerThreads));
+
+			// Act: load the cache
+			auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
+			cache::SupplementalData supplementalData;
+			auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData, CreateOptions(numLoadWorkerThreads));
+
+			// Assert:
+			EXPECT_TRUE(isStateLoaded);
+			AssertSubCaches(originalCache, cache);
+			EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
+			EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
+			EXPECT_EQ(Height(54321), cache.createView().height());
+		}
+	}
+
 	TEST(TEST_CLASS, CanSaveAndLoadState) {
+		// Assert:
+		AssertCanSaveAndLoadState(1, 1);
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateWithZeroWorkerThreads) {
+		// Assert:
+		AssertCanSaveAndLoadState(0, 0);
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateInParallel) {
+		// Assert:
+		AssertCanSaveAndLoadState(4, 4);
+	}
+
+	TEST(TEST_CLASS, CanLoadStateInParallelWhenSavedSequentially) {
+		// Assert:
+		AssertCanSaveAndLoadState(1, 4);
+	}
+
+	TEST(TEST_CLASS, CanLoadStateSequentiallyWhenSavedInParallel) {
+		// Assert:
+		AssertCanSaveAndLoadState(4, 1);
+	}
+
+	TEST(TEST_CLASS, CanSaveAndLoadStateWithMoreWorkerThreadsThanCaches) {
+		// Assert:
+		AssertCanSaveAndLoadState(100, 100);
+	}
+
+	TEST(TEST_CLASS, LoadStateInParallelPropagatesCacheLoadException) {
 		// Arrange: seed and save the cache state
 		test::TempDirectoryGuard tempDir;
 		auto originalCache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
-		auto originalSupplementalData = SaveState(tempDir.name(), originalCache);
+		SaveState(tempDir.name(), originalCache, CreateOptions(4));
 
-		// Act: load the cache
+		// - truncate all cache files (but not the supplemental data file)
+		auto statePath = boost::filesystem::path(tempDir.name()) / "state";
+		for (const auto& entry : boost::filesystem::directory_iterator(statePath)) {
+			if (".dat" == entry.path().extension() && "supplemental.dat" != entry.path().filename())
+				boost::filesystem::resize_file(entry.path(), 0);
+		}
+
+		// Act + Assert:
 		auto cache = test::CoreSystemCacheFactory::Create(model::BlockChainConfiguration::Uninitialized());
 		cache::SupplementalData supplementalData;
-		auto isStateLoaded = LoadState(tempDir.name(), cache, supplementalData);
-
-		// Assert:
-		EXPECT_TRUE(isStateLoaded);
-		AssertSubCaches(originalCache, cache);
-		EXPECT_EQ(originalSupplementalData.ChainScore, supplementalData.ChainScore);
-		EXPECT_EQ(originalSupplementalData.State.LastRecalculationHeight, supplementalData.State.LastRecalculationHeight);
-		EXPECT_EQ(Height(54321), cache.createView().height());
+		EXPECT_THROW(LoadState(tempDir.name(), cache, supplementalData, CreateOptions(4)), catapult_file_io_error);
 	}
 
+	// endregion
+
 	namespace {
 		template<typename TAction>
 		void AssertLoadStateFailure(const std::string& dataDirectory, TAction corruptSavedState) {
@@ -19,6 +19,7 @@
 **/
 
 #include "filechain/src/MultiBlockLoader.h"
+#include "catapult/cache/CatapultCache.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "tests/test/core/BlockTestUtils.h"
@@ -221,5 +222,66 @@ namespace catapult { namespace filechain {
 		EXPECT_EQ(expectedHeights, factoryHeights);
 	}
 
+	namespace {
+		void AssertCanLoadMultipleBlocksWithOptions(uint32_t prefetchDepth, uint32_t commitInterval) {
+			// Arrange: create a storage with 7 blocks
+			mocks::MockEntityObserver observer;
+			std::vector<Height> factoryHeights;
+			test::LocalNodeTestState state;
+			SetStorageChainHeight(state.ref().Storage.modifier(), 7);
+
+			BlockChainLoadOptions options;
+			options.PrefetchDepth = prefetchDepth;
+			options.CommitInterval = commitInterval;
+
+			// Act:
+			auto score = LoadBlockChain(MakeObserverFactory(observer, factoryHeights), state.ref(), Height(2), options);
+
+			// Assert: all blocks were executed in order and the last block was committed
+			auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4), Height(5), Height(6), Height(7) };
+			EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+			EXPECT_EQ(expectedHeights, observer.blockHeights());
+			EXPECT_EQ(expectedHeights, factoryHeights);
+			EXPECT_EQ(Height(7), state.ref().Cache.createView().height());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCanPrefetchBlocks) {
+		// Assert: prefetch depths smaller than, equal to and larger than the number of blocks
+		for (auto prefetchDepth : { 1u, 2u, 6u, 100u })
+			AssertCanLoadMultipleBlocksWithOptions(prefetchDepth, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCanBatchCacheCommits) {
+		// Assert: commit intervals that do and do not evenly divide the number of blocks
+		for (auto commitInterval : { 0u, 2u, 4u, 6u, 100u })
+			AssertCanLoadMultipleBlocksWithOptions(0, commitInterval);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCanPrefetchBlocksAndBatchCacheCommits) {
+		// Assert:
+		AssertCanLoadMultipleBlocksWithOptions(3, 4);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainPropagatesObserverExceptionWhenPrefetching) {
+		// Arrange:
+		mocks::MockEntityObserver observer;
+		test::LocalNodeTestState state;
+		SetStorageChainHeight(state.ref().Storage.modifier(), 7);
+
+		BlockChainLoadOptions options;
+		options.PrefetchDepth = 2;
+		auto observerFactory = [&observer](const auto& block) -> const observers::EntityObserver& {
+			if (Height(4) == block.Height)
+				CATAPULT_THROW_RUNTIME_ERROR("observer factory failure");
+
+			return observer;
+		};
+
+		// Act + Assert: the reader is stopped and the exception is propagated
+		EXPECT_THROW(LoadBlockChain(observerFactory, state.ref(), Height(2), options), catapult_runtime_error);
+		EXPECT_EQ(std::vector<Height>({ Height(2), Height(3) }), observer.blockHeights());
+	}
+
 	// endregion
 }}
@@ -112,7 +112,7 @@ namespace catapult { namespace harvesting {
 		if (!pHarvesterKeyPair)
 			return nullptr;
 
-		auto transactionsInfo = m_transactionsInfoSupplier(m_config.MaxTransactionsPerBlock);
+		auto transactionsInfo = m_transactionsInfoSupplier(context.Height, context.Timestamp, m_config.MaxTransactionsPerBlock);
 		return CreateBlock(context, m_config.Network.Identifier, *pHarvesterKeyPair, transactionsInfo);
 	}
 }}
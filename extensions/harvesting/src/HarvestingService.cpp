@@ -28,6 +28,7 @@
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
+#include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace harvesting {
 
@@ -70,16 +71,25 @@ namespace catapult { namespace harvesting {
 			});
 		}
 
+		chain::ExecutionConfiguration CreateExecutionConfiguration(const plugins::PluginManager& pluginManager) {
+			chain::ExecutionConfiguration executionConfig;
+			executionConfig.Network = pluginManager.config().Network;
+			executionConfig.pObserver = pluginManager.createObserver();
+			executionConfig.pValidator = pluginManager.createStatefulValidator();
+			executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+			return executionConfig;
+		}
+
 		thread::Task CreateHarvestingTask(extensions::ServiceState& state, UnlockedAccounts& unlockedAccounts) {
 			const auto& cache = state.cache();
 			const auto& blockChainConfig = state.config().BlockChain;
+			auto transactionsInfoSupplier = CreateTransactionsInfoSupplier(
+					state.utCache(),
+					cache,
+					CreateExecutionConfiguration(state.pluginManager()));
 			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
 					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(
-							cache,
-							blockChainConfig,
-							unlockedAccounts,
-							CreateTransactionsInfoSupplier(state.utCache())));
+					std::make_unique<Harvester>(cache, blockChainConfig, unlockedAccounts, transactionsInfoSupplier));
 
 			auto minHarvesterBalance = blockChainConfig.MinHarvesterBalance;
 			return thread::CreateNamedTask("harvesting task", [&cache, &unlockedAccounts, pHarvesterTask, minHarvesterBalance]() {
@@ -19,22 +19,94 @@
 **/
 
 #include "TransactionsInfo.h"
+#include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/chain/ProcessingNotificationSubscriber.h"
+#include "catapult/utils/HexFormatter.h"
 
 namespace catapult { namespace harvesting {
 
-	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache) {
-		return [&utCache](auto count) {
+	namespace {
+		class TransactionsExecutor {
+		public:
+			TransactionsExecutor(
+					cache::CatapultCacheDelta& cacheDelta,
+					Height height,
+					Timestamp currentTime,
+					const chain::ExecutionConfiguration& executionConfig)
+					: m_readOnlyCache(cacheDelta.toReadOnly())
+					, m_validatorContext(height, currentTime, executionConfig.Network, m_readOnlyCache)
+					, m_observerContext(cacheDelta, m_dummyState, height, observers::NotifyMode::Commit)
+					, m_executionConfig(executionConfig)
+			{}
+
+		public:
+			bool tryExecute(const model::TransactionInfo& transactionInfo) {
+				// notice that subscriber is created for each transaction because aggregate result needs to be reset
+				chain::ProcessingNotificationSubscriber sub(
+						*m_executionConfig.pValidator,
+						m_validatorContext,
+						*m_executionConfig.pObserver,
+						m_observerContext);
+				sub.enableUndo();
+
+				auto entityInfo = model::WeakEntityInfo(*transactionInfo.pEntity, transactionInfo.EntityHash);
+				m_executionConfig.pNotificationPublisher->publish(entityInfo, sub);
+				if (IsValidationResultSuccess(sub.result()))
+					return true;
+
+				CATAPULT_LOG(debug)
+						<< "skipping transaction " << utils::HexFormat(transactionInfo.EntityHash)
+						<< " during harvesting: " << sub.result();
+				sub.undo();
+				return false;
+			}
+
+		private:
+			cache::ReadOnlyCatapultCache m_readOnlyCache;
+			validators::ValidatorContext m_validatorContext;
+
+			// note that the "real" state is currently only required by block observers, so a dummy state can be used
+			state::CatapultState m_dummyState;
+			observers::ObserverContext m_observerContext;
+
+			const chain::ExecutionConfiguration& m_executionConfig;
+		};
+	}
+
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			const cache::MemoryUtCache& utCache,
+			const cache::CatapultCache& cache,
+			const chain::ExecutionConfiguration& executionConfig) {
+		return [&utCache, &cache, executionConfig](auto height, auto timestamp, auto count) {
 			TransactionsInfo info;
 			std::vector<const model::TransactionInfo*> transactionInfos;
 
 			auto view = utCache.view();
 			if (0 != count) {
-				view.forEach([count, &info, &transactionInfos](const auto& transactionInfo) {
-					info.Transactions.push_back(transactionInfo.pEntity);
-					transactionInfos.push_back(&transactionInfo);
-					return info.Transactions.size() != count;
-				});
+				// execute transactions on a detached delta, which is never committed, so that only transactions
+				// that are valid when executed in block order are selected
+				// (the detachable delta holds a cache reader lock, so the detached delta can always be locked)
+				auto detachableDelta = cache.createDetachableDelta();
+				auto cacheHeight = detachableDelta.height();
+				if (cacheHeight + Height(1) != height) {
+					// the chain changed after the block was started, so the block cannot be appended to it
+					CATAPULT_LOG(debug) << "supplying no transactions for block at " << height << " with cache at " << cacheHeight;
+				} else {
+					auto detachedDelta = detachableDelta.detach();
+					auto pCacheDelta = detachedDelta.lock();
+
+					TransactionsExecutor executor(*pCacheDelta, height, timestamp, executionConfig);
+					view.forEachByFee([count, &info, &transactionInfos, &executor](const auto& transactionInfo) {
+						if (!executor.tryExecute(transactionInfo))
+							return true;
+
+						info.Transactions.push_back(transactionInfo.pEntity);
+						transactionInfos.push_back(&transactionInfo);
+						return info.Transactions.size() != count;
+					});
+				}
 			}
 
 			CalculateBlockTransactionsHash(transactionInfos, info.TransactionsHash);
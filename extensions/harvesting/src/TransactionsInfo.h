@@ -19,9 +19,15 @@
 **/
 
 #pragma once
+#include "catapult/chain/ExecutionConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 
-namespace catapult { namespace cache { class MemoryUtCache; } }
+namespace catapult {
+	namespace cache {
+		class CatapultCache;
+		class MemoryUtCache;
+	}
+}
 
 namespace catapult { namespace harvesting {
 
@@ -34,9 +40,16 @@ namespace catapult { namespace harvesting {
 		Hash256 TransactionsHash;
 	};
 
-	/// Supplies a transactions info composed of a maximum number of transactions.
-	using TransactionsInfoSupplier = std::function<TransactionsInfo (uint32_t)>;
+	/// Supplies a transactions info composed of a maximum number of transactions for a block with a height and a timestamp.
+	using TransactionsInfoSupplier = std::function<TransactionsInfo (Height, Timestamp, uint32_t)>;
 
-	/// Creates a default transactions info supplier around \a utCache.
-	TransactionsInfoSupplier CreateTransactionsInfoSupplier(const cache::MemoryUtCache& utCache);
+	/// Creates a default transactions info supplier around \a utCache that executes candidate transactions on top of \a cache
+	/// using \a executionConfig.
+	/// \note Transactions with the highest fee per byte are considered first. Each candidate is only supplied when it is valid
+	///       after all previously supplied transactions, so transactions depending on ones that are not supplied are skipped.
+	/// \note No transactions are supplied when the requested height does not directly follow the cache height.
+	TransactionsInfoSupplier CreateTransactionsInfoSupplier(
+			const cache::MemoryUtCache& utCache,
+			const cache::CatapultCache& cache,
+			const chain::ExecutionConfiguration& executionConfig);
 }}
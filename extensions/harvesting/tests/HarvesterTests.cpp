@@ -120,7 +120,7 @@ namespace catapult { namespace harvesting {
 			}
 
 			auto CreateHarvester(const model::BlockChainConfiguration& config) {
-				return CreateHarvester(config, [](size_t) { return TransactionsInfo(); });
+				return CreateHarvester(config, [](auto, auto, auto) { return TransactionsInfo(); });
 			}
 
 			auto CreateHarvester() {
@@ -419,7 +419,7 @@ namespace catapult { namespace harvesting {
 			auto info = CreateTransactionsInfo(numAvailableTransactions);
 			auto config = CreateConfiguration();
 			config.MaxTransactionsPerBlock = maxTransactionsPerBlock;
-			auto pHarvester = context.CreateHarvester(config, [&, info](auto count) mutable {
+			auto pHarvester = context.CreateHarvester(config, [&, info](auto, auto, auto count) mutable {
 				++counter;
 				numRequestedInfos = count;
 				if (info.Transactions.size() > count)
@@ -451,19 +451,26 @@ namespace catapult { namespace harvesting {
 		// Arrange:
 		HarvesterContext context;
 		size_t counter = 0u;
+		Height suppliedHeight;
+		Timestamp suppliedTimestamp;
 		auto pHarvester = context.CreateHarvester(
 				CreateConfiguration(),
-				[&counter](size_t) {
+				[&counter, &suppliedHeight, &suppliedTimestamp](auto height, auto timestamp, auto) {
 					++counter;
+					suppliedHeight = height;
+					suppliedTimestamp = timestamp;
 					return TransactionsInfo();
 				});
 
 		// Act:
 		auto pBlock = pHarvester->harvest(context.LastBlockElement, Max_Time);
 
-		// Assert:
-		EXPECT_TRUE(!!pBlock);
+		// Assert: the supplier is called with the height and timestamp of the harvested block
+		ASSERT_TRUE(!!pBlock);
 		EXPECT_EQ(1u, counter);
+		EXPECT_EQ(pBlock->Height, suppliedHeight);
+		EXPECT_EQ(pBlock->Timestamp, suppliedTimestamp);
+		EXPECT_EQ(Max_Time, suppliedTimestamp);
 	}
 
 	TEST(TEST_CLASS, HarvestPutsNoTransactionsInBlockIfCacheIsEmpty) {
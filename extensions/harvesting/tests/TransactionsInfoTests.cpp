@@ -20,6 +20,10 @@
 
 #include "harvesting/src/TransactionsInfo.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/cache_core/BlockDifficultyCache.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/validators/ValidatorContext.h"
+#include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/cache/UtTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -28,30 +32,209 @@ namespace catapult { namespace harvesting {
 #define TEST_CLASS TransactionsInfoTests
 
 	namespace {
-		auto PrepareCache(size_t count) {
-			auto pCache = std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1000, 1000));
-			auto transactionInfos = test::CreateTransactionInfos(count);
-			test::AddAll(*pCache, transactionInfos);
-			return pCache;
+		// region mock execution
+
+		struct TransactionNotification : public model::Notification {
+		public:
+			explicit TransactionNotification(const Hash256& hash)
+					: Notification(static_cast<model::NotificationType>(-1), sizeof(TransactionNotification))
+					, Hash(hash)
+			{}
+
+		public:
+			Hash256 Hash;
+		};
+
+		// executed transaction hashes and validation rules shared by all mocks
+		struct ExecutionState {
+			std::set<Hash256> ExecutedHashes;
+			std::set<Hash256> InvalidHashes;
+			std::map<Hash256, Hash256> Dependencies;
+			std::vector<std::pair<Height, Timestamp>> ValidationContexts;
+		};
+
+		class MockNotificationPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& subscriber) const override {
+				subscriber.notify(TransactionNotification(entityInfo.hash()));
+			}
+		};
+
+		class MockAggregateNotificationObserver : public observers::AggregateNotificationObserver {
+		public:
+			explicit MockAggregateNotificationObserver(ExecutionState& state)
+					: m_state(state)
+					, m_name("MockAggregateNotificationObserver")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			void notify(const model::Notification& notification, const observers::ObserverContext& context) const override {
+				const auto& hash = static_cast<const TransactionNotification&>(notification).Hash;
+				auto& difficultyCache = context.Cache.sub<cache::BlockDifficultyCache>();
+				if (observers::NotifyMode::Commit == context.Mode) {
+					m_state.ExecutedHashes.insert(hash);
+					difficultyCache.insert(state::BlockDifficultyInfo(Height(difficultyCache.size() + 1)));
+				} else {
+					m_state.ExecutedHashes.erase(hash);
+					difficultyCache.remove(Height(difficultyCache.size()));
+				}
+			}
+
+		private:
+			ExecutionState& m_state;
+			std::string m_name;
+		};
+
+		class MockAggregateNotificationValidator : public validators::stateful::AggregateNotificationValidator {
+		public:
+			explicit MockAggregateNotificationValidator(ExecutionState& state)
+					: m_state(state)
+					, m_name("MockAggregateNotificationValidator")
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				return { name() };
+			}
+
+			validators::ValidationResult validate(
+					const model::Notification& notification,
+					const validators::ValidatorContext& context) const override {
+				m_state.ValidationContexts.emplace_back(context.Height, context.BlockTime);
+
+				const auto& hash = static_cast<const TransactionNotification&>(notification).Hash;
+				if (m_state.InvalidHashes.cend() != m_state.InvalidHashes.find(hash))
+					return validators::ValidationResult::Failure;
+
+				// a dependent transaction is only valid after the transaction it depends on
+				auto iter = m_state.Dependencies.find(hash);
+				if (m_state.Dependencies.cend() != iter && m_state.ExecutedHashes.cend() == m_state.ExecutedHashes.find(iter->second))
+					return validators::ValidationResult::Failure;
+
+				return validators::ValidationResult::Success;
+			}
+
+		private:
+			ExecutionState& m_state;
+			std::string m_name;
+		};
+
+		// endregion
+
+		class TestContext {
+		public:
+			explicit TestContext(size_t count)
+					: m_cache(test::CreateEmptyCatapultCache())
+					, m_pUtCache(std::make_unique<cache::MemoryUtCache>(cache::MemoryCacheOptions(1000, 1000))) {
+				// assign fees so that fee order is different from arrival order
+				auto transactionInfos = test::CreateTransactionInfos(count);
+				for (auto i = 0u; i < count; ++i) {
+					auto& transaction = const_cast<model::Transaction&>(*transactionInfos[i].pEntity);
+					transaction.Fee = Amount((i * 7) % count + 1);
+					m_feeHashes.emplace(transaction.Fee, transactionInfos[i].EntityHash);
+				}
+
+				test::AddAll(*m_pUtCache, transactionInfos);
+
+				m_executionConfig.pObserver = std::make_shared<MockAggregateNotificationObserver>(m_state);
+				m_executionConfig.pValidator = std::make_shared<MockAggregateNotificationValidator>(m_state);
+				m_executionConfig.pNotificationPublisher = std::make_shared<MockNotificationPublisher>();
+			}
+
+		public:
+			const auto& cache() const {
+				return m_cache;
+			}
+
+			const auto& utCache() const {
+				return *m_pUtCache;
+			}
+
+			const Hash256& hashWithFee(uint64_t fee) const {
+				return m_feeHashes.at(Amount(fee));
+			}
+
+			void setInvalid(uint64_t fee) {
+				m_state.InvalidHashes.insert(hashWithFee(fee));
+			}
+
+			void setDependency(uint64_t fee, uint64_t dependencyFee) {
+				m_state.Dependencies.emplace(hashWithFee(fee), hashWithFee(dependencyFee));
+			}
+
+			const auto& validationContexts() const {
+				return m_state.ValidationContexts;
+			}
+
+		public:
+			TransactionsInfo supply(uint32_t count) {
+				// the empty cache is at height zero, so the next block is at height one
+				return supply(Height(1), Timestamp(123), count);
+			}
+
+			TransactionsInfo supply(Height height, Timestamp timestamp, uint32_t count) {
+				return CreateTransactionsInfoSupplier(*m_pUtCache, m_cache, m_executionConfig)(height, timestamp, count);
+			}
+
+		private:
+			cache::CatapultCache m_cache;
+			std::unique_ptr<cache::MemoryUtCache> m_pUtCache;
+			std::map<Amount, Hash256> m_feeHashes;
+			ExecutionState m_state;
+			chain::ExecutionConfiguration m_executionConfig;
+		};
+
+		std::vector<const model::TransactionInfo*> ExtractTransactionInfosByFee(const cache::MemoryUtCacheView& view, size_t count) {
+			std::vector<const model::TransactionInfo*> transactionInfos;
+			if (0 != count) {
+				view.forEachByFee([count, &transactionInfos](const auto& transactionInfo) {
+					transactionInfos.push_back(&transactionInfo);
+					return count != transactionInfos.size();
+				});
+			}
+
+			return transactionInfos;
+		}
+
+		std::vector<Amount> ExtractFees(const TransactionsInfo& info) {
+			std::vector<Amount> fees;
+			for (const auto& pTransaction : info.Transactions)
+				fees.push_back(pTransaction->Fee);
+
+			return fees;
 		}
 
 		void AssertSupplierBehavior(uint32_t count, uint32_t numRequested, uint32_t expectedCount) {
 			// Arrange:
-			auto pCache = PrepareCache(count);
+			TestContext context(count);
 
 			// Act:
-			auto info = CreateTransactionsInfoSupplier(*pCache)(numRequested);
+			auto info = context.supply(numRequested);
 
 			// Assert:
+			auto view = context.utCache().view();
+			auto expectedTransactionInfos = ExtractTransactionInfosByFee(view, expectedCount);
+
 			// - check transactions
-			auto expectedTransactions = test::ExtractTransactions(*pCache, expectedCount);
 			ASSERT_EQ(expectedCount, info.Transactions.size());
 			for (auto i = 0u; i < expectedCount; ++i)
-				EXPECT_EQ(*expectedTransactions[i], *info.Transactions[i]) << "transaction at " << i;
+				EXPECT_EQ(*expectedTransactionInfos[i]->pEntity, *info.Transactions[i]) << "transaction at " << i;
 
 			// - check hash
 			Hash256 expectedHash;
-			CalculateBlockTransactionsHash(test::ExtractTransactionInfos(pCache->view(), expectedCount), expectedHash);
+			CalculateBlockTransactionsHash(expectedTransactionInfos, expectedHash);
 			EXPECT_EQ(expectedHash, info.TransactionsHash);
 		}
 	}
@@ -66,7 +249,7 @@ namespace catapult { namespace harvesting {
 		AssertSupplierBehavior(10, 0, 0);
 	}
 
-	TEST(TEST_CLASS, SupplierReturnsFirstCountTransactionInfosIfCacheHasEnoughTransactions) {
+	TEST(TEST_CLASS, SupplierReturnsHighestFeeTransactionInfosIfCacheHasEnoughTransactions) {
 		// Assert:
 		AssertSupplierBehavior(10, 3, 3);
 	}
@@ -80,4 +263,102 @@ namespace catapult { namespace harvesting {
 		// Assert:
 		AssertSupplierBehavior(10, 15, 10);
 	}
+
+	TEST(TEST_CLASS, SupplierReturnsTransactionInfosOrderedByDecreasingFee) {
+		// Arrange: fees are { 1, 8, 5, 2, 9, 6, 3, 10, 7, 4 }
+		TestContext context(10);
+
+		// Act:
+		auto info = context.supply(4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Amount>({ Amount(10), Amount(9), Amount(8), Amount(7) }), ExtractFees(info));
+	}
+
+	TEST(TEST_CLASS, SupplierSkipsInvalidTransactions) {
+		// Arrange:
+		TestContext context(10);
+		context.setInvalid(9);
+		context.setInvalid(7);
+
+		// Act:
+		auto info = context.supply(4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Amount>({ Amount(10), Amount(8), Amount(6), Amount(5) }), ExtractFees(info));
+	}
+
+	TEST(TEST_CLASS, SupplierSkipsTransactionsDependingOnTransactionsThatAreNotSupplied) {
+		// Arrange: the transaction with fee 10 depends on the (unsupplied) transaction with fee 1
+		TestContext context(10);
+		context.setDependency(10, 1);
+
+		// Act:
+		auto info = context.supply(4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Amount>({ Amount(9), Amount(8), Amount(7), Amount(6) }), ExtractFees(info));
+	}
+
+	TEST(TEST_CLASS, SupplierSuppliesTransactionsDependingOnPreviouslySuppliedTransactions) {
+		// Arrange: the transaction with fee 8 depends on the transaction with fee 9
+		TestContext context(10);
+		context.setDependency(8, 9);
+
+		// Act:
+		auto info = context.supply(4);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Amount>({ Amount(10), Amount(9), Amount(8), Amount(7) }), ExtractFees(info));
+	}
+
+	TEST(TEST_CLASS, SupplierExecutesTransactionsAtRequestedHeightAndTimestamp) {
+		// Arrange:
+		TestContext context(10);
+
+		// Act:
+		auto info = context.supply(Height(1), Timestamp(987), 3);
+
+		// Assert:
+		EXPECT_EQ(3u, info.Transactions.size());
+
+		const auto& validationContexts = context.validationContexts();
+		ASSERT_EQ(3u, validationContexts.size());
+		for (const auto& pair : validationContexts) {
+			EXPECT_EQ(Height(1), pair.first);
+			EXPECT_EQ(Timestamp(987), pair.second);
+		}
+	}
+
+	TEST(TEST_CLASS, SupplierReturnsNoTransactionInfosIfHeightDoesNotFollowCacheHeight) {
+		// Arrange:
+		TestContext context(10);
+
+		for (auto height : { Height(0), Height(2) }) {
+			// Act:
+			auto info = context.supply(height, Timestamp(987), 3);
+
+			// Assert:
+			EXPECT_TRUE(info.Transactions.empty()) << height;
+
+			Hash256 expectedHash;
+			model::CalculateBlockTransactionsHash({}, expectedHash);
+			EXPECT_EQ(expectedHash, info.TransactionsHash) << height;
+		}
+
+		EXPECT_TRUE(context.validationContexts().empty());
+	}
+
+	TEST(TEST_CLASS, SupplierDoesNotModifyCache) {
+		// Arrange:
+		TestContext context(10);
+		context.setInvalid(9);
+
+		// Act:
+		auto info = context.supply(4);
+
+		// Assert: transactions were executed on a delta that was not committed
+		EXPECT_EQ(4u, info.Transactions.size());
+		EXPECT_EQ(0u, context.cache().sub<cache::BlockDifficultyCache>().createView()->size());
+	}
 }}
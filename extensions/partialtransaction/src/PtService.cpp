@@ -46,15 +46,26 @@ namespace catapult { namespace partialtransaction {
 			return task;
 		}
 
+		chain::RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
+				const extensions::ServiceLocator& locator,
+				const extensions::ServiceState& state) {
+			const auto& ptCache = GetMemoryPtCache(locator);
+			const auto& serverHooks = GetPtServerHooks(locator);
+			auto shortHashPairsSupplier = [&ptCache]() { return ptCache.view().shortHashPairs(); };
+			if (!state.config().Node.ShouldReconcileTransactions)
+				return chain::CreatePtSynchronizer(shortHashPairsSupplier, serverHooks.cosignedTransactionInfosConsumer());
+
+			return chain::CreatePtSketchSynchronizer(
+					[&ptCache](auto numCells) { return ptCache.view().sketch(numCells); },
+					shortHashPairsSupplier,
+					serverHooks.cosignedTransactionInfosConsumer());
+		}
+
 		thread::Task CreatePullPtTask(
 				extensions::ServiceLocator& locator,
 				const extensions::ServiceState& state,
 				net::PacketWriters& packetWriters) {
-			const auto& ptCache = GetMemoryPtCache(locator);
-			const auto& serverHooks = GetPtServerHooks(locator);
-			auto ptSynchronizer = chain::CreatePtSynchronizer(
-					[&ptCache]() { return ptCache.view().shortHashPairs(); },
-					serverHooks.cosignedTransactionInfosConsumer());
+			auto ptSynchronizer = CreatePtSynchronizer(locator, state);
 
 			thread::Task task;
 			task.Name = "pull partial transactions task";
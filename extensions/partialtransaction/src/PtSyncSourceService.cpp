@@ -53,6 +53,14 @@ namespace catapult { namespace partialtransaction {
 					return ptCache.view().unknownTransactions(shortHashPairs);
 				});
 
+				handlers::RegisterPullPartialTransactionInfosByHashHandler(state.packetHandlers(), [&ptCache](const auto& hashes) {
+					return ptCache.view().transactionInfos(hashes);
+				});
+
+				handlers::RegisterPullPartialTransactionInfosSketchHandler(state.packetHandlers(), [&ptCache](auto numCells) {
+					return ptCache.view().sketch(numCells);
+				});
+
 				handlers::RegisterPushCosignaturesHandler(state.packetHandlers(), hooks.cosignatureRangeConsumer());
 			}
 		};
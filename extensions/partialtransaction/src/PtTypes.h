@@ -20,7 +20,9 @@
 
 #pragma once
 #include "catapult/cache/ShortHashPair.h"
+#include "catapult/cache/TransactionSketches.h"
 #include "catapult/model/CosignedTransactionInfo.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/functions.h"
 #include <vector>
 
@@ -32,6 +34,12 @@ namespace catapult { namespace partialtransaction {
 	/// Prototype for a function that retrieves partial transaction infos given a set of short hash pairs.
 	using CosignedTransactionInfosRetriever = std::function<CosignedTransactionInfos (const cache::ShortHashPairMap&)>;
 
+	/// Prototype for a function that retrieves partial transaction infos given a set of transaction hashes.
+	using CosignedTransactionInfosHashRetriever = std::function<CosignedTransactionInfos (const utils::HashSet&)>;
+
+	/// Prototype for a function that retrieves a reconciliation sketch of partial transactions with a given number of cells.
+	using PtSketchRetriever = std::function<cache::PtSketch (uint32_t)>;
+
 	/// Function signature for consuming a vector of cosigned transaction infos.
 	using CosignedTransactionInfosConsumer = consumer<CosignedTransactionInfos&&>;
 
@@ -22,6 +22,8 @@
 #include "CosignedTransactionInfoParser.h"
 #include "catapult/api/RemoteApiUtils.h"
 #include "catapult/api/RemoteRequestDispatcher.h"
+#include "catapult/api/SketchPackets.h"
+#include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 
 namespace catapult { namespace api {
@@ -48,6 +50,51 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct TransactionInfosByHashTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = partialtransaction::CosignedTransactionInfos;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash; }
+			static constexpr auto FriendlyName() { return "pull partial transaction infos by hash"; }
+
+			static auto CreateRequestPacketPayload(model::HashRange&& hashes) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(hashes));
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ExtractCosignedTransactionInfosFromPacket(packet, *this);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
+		struct TransactionInfosSketchTraits {
+		public:
+			using ResultType = cache::PtSketchCellRange;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Partial_Transaction_Infos_Sketch; }
+			static constexpr auto FriendlyName() { return "pull partial transaction infos sketch"; }
+
+			static auto CreateRequestPacketPayload(uint32_t numCells) {
+				auto pPacket = ionet::CreateSharedPacket<PullPartialTransactionInfosSketchRequest>();
+				pPacket->NumCells = numCells;
+				return ionet::PacketPayload(pPacket);
+			}
+
+		public:
+			explicit TransactionInfosSketchTraits(uint32_t numCells) : m_numCells(numCells)
+			{}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<cache::PtSketch::Cell>(packet);
+				return m_numCells == result.size();
+			}
+
+		private:
+			uint32_t m_numCells;
+		};
+
 		// endregion
 
 		class DefaultRemotePtApi : public RemotePtApi {
@@ -66,6 +113,14 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(TransactionInfosTraits(m_registry), std::move(knownShortHashPairs));
 			}
 
+			FutureType<TransactionInfosByHashTraits> transactionInfosByHash(model::HashRange&& hashes) const override {
+				return m_impl.dispatch(TransactionInfosByHashTraits(m_registry), std::move(hashes));
+			}
+
+			FutureType<TransactionInfosSketchTraits> transactionInfosSketch(uint32_t numCells) const override {
+				return m_impl.dispatch(TransactionInfosSketchTraits(numCells), numCells);
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
@@ -21,6 +21,7 @@
 #pragma once
 #include "partialtransaction/src/PtTypes.h"
 #include "catapult/cache/ShortHashPair.h"
+#include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
 namespace catapult { namespace ionet { class PacketIo; } }
@@ -36,6 +37,13 @@ namespace catapult { namespace api {
 		/// Gets all partial transaction infos from the remote excluding those with all hashes in \a knownShortHashPairs.
 		virtual thread::future<partialtransaction::CosignedTransactionInfos> transactionInfos(
 				cache::ShortHashPairRange&& knownShortHashPairs) const = 0;
+
+		/// Gets all partial transaction infos from the remote with transaction hashes in \a hashes.
+		virtual thread::future<partialtransaction::CosignedTransactionInfos> transactionInfosByHash(
+				model::HashRange&& hashes) const = 0;
+
+		/// Gets the cells of a reconciliation sketch of all partial transaction infos from the remote with \a numCells cells.
+		virtual thread::future<cache::PtSketchCellRange> transactionInfosSketch(uint32_t numCells) const = 0;
 	};
 
 	/// Creates a partial transaction api for interacting with a remote node with the specified \a io
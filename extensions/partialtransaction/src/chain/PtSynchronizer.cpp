@@ -21,6 +21,7 @@
 #include "PtSynchronizer.h"
 #include "partialtransaction/src/api/RemotePtApi.h"
 #include "catapult/chain/EntitiesSynchronizer.h"
+#include "catapult/chain/SketchSynchronizer.h"
 
 namespace catapult { namespace chain {
 
@@ -51,6 +52,48 @@ namespace catapult { namespace chain {
 			partialtransaction::ShortHashPairsSupplier m_shortHashPairsSupplier;
 			partialtransaction::CosignedTransactionInfosConsumer m_transactionInfosConsumer;
 		};
+
+		struct PtSketchTraits : public PtTraits {
+		public:
+			using SketchType = cache::PtSketch;
+
+		public:
+			explicit PtSketchTraits(
+					const partialtransaction::PtSketchRetriever& sketchSupplier,
+					const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+					const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer)
+					: PtTraits(shortHashPairsSupplier, transactionInfosConsumer)
+					, m_sketchSupplier(sketchSupplier)
+			{}
+
+		public:
+			thread::future<cache::PtSketchCellRange> sketchApiCall(const RemoteApiType& api, uint32_t numCells) const {
+				return api.transactionInfosSketch(numCells);
+			}
+
+			cache::PtSketch localSketch(uint32_t numCells) const {
+				return m_sketchSupplier(numCells);
+			}
+
+			thread::future<partialtransaction::CosignedTransactionInfos> differenceApiCall(
+					const RemoteApiType& api,
+					const std::vector<cache::PtSketchKey>& keys) const {
+				// a key difference can be caused by different cosignatures only, but the full transaction info is pulled anyway
+				auto hashes = model::HashRange::PrepareFixed(keys.size());
+				auto hashesIter = hashes.begin();
+				for (const auto& key : keys)
+					*hashesIter++ = key.TransactionHash;
+
+				return api.transactionInfosByHash(std::move(hashes));
+			}
+
+			thread::future<partialtransaction::CosignedTransactionInfos> fallbackApiCall(const RemoteApiType& api) const {
+				return apiCall(api);
+			}
+
+		private:
+			partialtransaction::PtSketchRetriever m_sketchSupplier;
+		};
 	}
 
 	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
@@ -60,4 +103,14 @@ namespace catapult { namespace chain {
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<PtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
+
+	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSketchSynchronizer(
+			const partialtransaction::PtSketchRetriever& sketchSupplier,
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer) {
+		auto traits = PtSketchTraits(sketchSupplier, shortHashPairsSupplier, transactionInfosConsumer);
+		auto options = SketchSynchronizerOptions{ cache::Min_Sketch_Num_Cells, cache::Max_Sketch_Num_Cells };
+		auto pSynchronizer = std::make_shared<SketchSynchronizer<PtSketchTraits>>(std::move(traits), options);
+		return CreateRemoteNodeSynchronizer(pSynchronizer);
+	}
 }}
@@ -32,4 +32,12 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSynchronizer(
 			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
 			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer);
+
+	/// Creates a partial transactions synchronizer that reconciles the local sketch supplied by \a sketchSupplier with a remote
+	/// sketch and forwards the missing partial transaction infos to \a transactionInfosConsumer.
+	/// \note When the sketch difference cannot be decoded, \a shortHashPairsSupplier is used to pull all unknown infos.
+	RemoteNodeSynchronizer<api::RemotePtApi> CreatePtSketchSynchronizer(
+			const partialtransaction::PtSketchRetriever& sketchSupplier,
+			const partialtransaction::ShortHashPairsSupplier& shortHashPairsSupplier,
+			const partialtransaction::CosignedTransactionInfosConsumer& transactionInfosConsumer);
 }}
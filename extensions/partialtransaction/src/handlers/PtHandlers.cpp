@@ -20,6 +20,7 @@
 
 #include "PtHandlers.h"
 #include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "catapult/api/SketchPackets.h"
 #include "catapult/handlers/HandlerUtils.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadBuilder.h"
@@ -86,8 +87,8 @@ namespace catapult { namespace handlers {
 			builder.appendRange(CosignatureRange::CopyFixed(pCosignaturesData, transactionInfo.Cosignatures.size()));
 		}
 
-		auto BuildPacket(const CosignedTransactionInfos& transactionInfos) {
-			ionet::PacketPayloadBuilder builder(ionet::PacketType::Pull_Partial_Transaction_Infos);
+		auto BuildPacket(ionet::PacketType packetType, const CosignedTransactionInfos& transactionInfos) {
+			ionet::PacketPayloadBuilder builder(packetType);
 			for (const auto& transactionInfo : transactionInfos)
 				AppendTransactionInfo(builder, transactionInfo);
 
@@ -101,7 +102,45 @@ namespace catapult { namespace handlers {
 					return;
 
 				auto transactionInfos = transactionInfosRetriever(info.ShortHashPairs);
-				context.response(BuildPacket(transactionInfos));
+				context.response(BuildPacket(ionet::PacketType::Pull_Partial_Transaction_Infos, transactionInfos));
+			};
+		}
+
+		struct PullTransactionsByHashInfo {
+		public:
+			PullTransactionsByHashInfo() : IsValid(false)
+			{}
+
+		public:
+			utils::HashSet Hashes;
+			bool IsValid;
+		};
+
+		auto ProcessPullTransactionsByHashRequest(const ionet::Packet& packet) {
+			if (ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash != packet.Type)
+				return PullTransactionsByHashInfo();
+
+			auto range = ionet::ExtractFixedSizeStructuresFromPacket<Hash256>(packet);
+			if (range.empty() && sizeof(ionet::Packet) != packet.Size)
+				return PullTransactionsByHashInfo();
+
+			PullTransactionsByHashInfo info;
+			info.Hashes.reserve(range.size());
+			for (const auto& hash : range)
+				info.Hashes.insert(hash);
+
+			info.IsValid = true;
+			return info;
+		}
+
+		auto CreatePullTransactionsByHashHandler(const CosignedTransactionInfosHashRetriever& transactionInfosHashRetriever) {
+			return [transactionInfosHashRetriever](const auto& packet, auto& context) {
+				auto info = ProcessPullTransactionsByHashRequest(packet);
+				if (!info.IsValid)
+					return;
+
+				auto transactionInfos = transactionInfosHashRetriever(info.Hashes);
+				context.response(BuildPacket(ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash, transactionInfos));
 			};
 		}
 	}
@@ -124,4 +163,18 @@ namespace catapult { namespace handlers {
 				ionet::PacketType::Pull_Partial_Transaction_Infos,
 				CreatePullTransactionsHandler(transactionInfosRetriever));
 	}
+
+	void RegisterPullPartialTransactionInfosByHashHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const CosignedTransactionInfosHashRetriever& transactionInfosHashRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash,
+				CreatePullTransactionsByHashHandler(transactionInfosHashRetriever));
+	}
+
+	void RegisterPullPartialTransactionInfosSketchHandler(ionet::ServerPacketHandlers& handlers, const PtSketchRetriever& ptSketchRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Partial_Transaction_Infos_Sketch,
+				CreatePullSketchHandler<api::PullPartialTransactionInfosSketchRequest>(cache::Max_Sketch_Num_Cells, ptSketchRetriever));
+	}
 }}
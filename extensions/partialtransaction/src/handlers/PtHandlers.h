@@ -37,4 +37,16 @@ namespace catapult { namespace handlers {
 	void RegisterPullPartialTransactionInfosHandler(
 			ionet::ServerPacketHandlers& handlers,
 			const partialtransaction::CosignedTransactionInfosRetriever& transactionInfosRetriever);
+
+	/// Registers a pull partial transactions by hash handler in \a handlers that responds with partial transactions
+	/// returned by the retriever (\a transactionInfosHashRetriever).
+	void RegisterPullPartialTransactionInfosByHashHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const partialtransaction::CosignedTransactionInfosHashRetriever& transactionInfosHashRetriever);
+
+	/// Registers a pull partial transactions sketch handler in \a handlers that responds with the partial transactions sketch
+	/// returned by the retriever (\a ptSketchRetriever).
+	void RegisterPullPartialTransactionInfosSketchHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const partialtransaction::PtSketchRetriever& ptSketchRetriever);
 }}
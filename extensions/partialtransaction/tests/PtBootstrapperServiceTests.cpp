@@ -199,7 +199,7 @@ namespace catapult { namespace partialtransaction {
 				&transactionInfos[4].EntityHash
 		};
 		std::vector<model::TransactionInfo> revertedTransactionInfos;
-		handler(consumers::TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos));
+		handler(consumers::TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, {}, {}));
 
 		// Assert:
 		auto view = ptCache.view();
@@ -230,7 +230,7 @@ namespace catapult { namespace partialtransaction {
 		auto handler = context.testState().state().hooks().transactionsChangeHandler();
 		utils::HashPointerSet addedTransactionHashes;
 		std::vector<model::TransactionInfo> revertedTransactionInfos;
-		handler(consumers::TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos));
+		handler(consumers::TransactionsChangeInfo(addedTransactionHashes, revertedTransactionInfos, {}, {}));
 
 		// Assert:
 		auto view = ptCache.view();
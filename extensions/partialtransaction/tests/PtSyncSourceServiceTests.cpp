@@ -76,10 +76,12 @@ namespace catapult { namespace partialtransaction {
 		const auto& handlers = context.testState().state().packetHandlers();
 
 		// Assert:
-		EXPECT_EQ(3u, handlers.size());
+		EXPECT_EQ(5u, handlers.size());
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Partial_Transactions));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Detached_Cosignatures));
 		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Partial_Transaction_Infos));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash));
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Pull_Partial_Transaction_Infos_Sketch));
 	}
 
 	// endregion
@@ -19,6 +19,7 @@
 **/
 
 #include "partialtransaction/src/api/RemotePtApi.h"
+#include "catapult/api/SketchPackets.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -119,6 +120,77 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct TransactionInfosByHashTraits {
+			static constexpr uint32_t Request_Data_Size = 3 * Hash256_Size;
+
+			static std::vector<Hash256> HashesValues() {
+				return { { { 12 } }, { { 23 } }, { { 34 } } };
+			}
+
+			static auto Invoke(const RemotePtApi& api) {
+				return api.transactionInfosByHash(model::HashRange::CopyFixed(reinterpret_cast<uint8_t*>(HashesValues().data()), 3));
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = CreatePacketWithTransactionInfos(3);
+				pResponsePacket->Type = ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash;
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it has an incorrect tag specifying no transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				reinterpret_cast<uint16_t&>(*pResponsePacket->Data()) = 0x0000;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash, packet.Type);
+				EXPECT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+				EXPECT_TRUE(0 == std::memcmp(packet.Data(), HashesValues().data(), Request_Data_Size));
+			}
+
+			static void ValidateResponse(
+					const ionet::Packet& response,
+					const partialtransaction::CosignedTransactionInfos& transactionInfos) {
+				TransactionInfosTraits::ValidateResponse(response, transactionInfos);
+			}
+		};
+
+		struct TransactionInfosSketchTraits {
+			static constexpr uint32_t Num_Cells = 3 * 4;
+
+			static auto Invoke(const RemotePtApi& api) {
+				return api.transactionInfosSketch(Num_Cells);
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto payloadSize = Num_Cells * static_cast<uint32_t>(sizeof(cache::PtSketch::Cell));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Partial_Transaction_Infos_Sketch;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains fewer cells than requested
+				auto pResponsePacket = CreateValidResponsePacket();
+				pResponsePacket->Size -= static_cast<uint32_t>(sizeof(cache::PtSketch::Cell));
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				const auto* pRequest = ionet::CoercePacket<PullPartialTransactionInfosSketchRequest>(&packet);
+				ASSERT_TRUE(!!pRequest);
+				EXPECT_EQ(Num_Cells, pRequest->NumCells);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const cache::PtSketchCellRange& cells) {
+				ASSERT_EQ(Num_Cells, cells.size());
+				EXPECT_TRUE(0 == std::memcmp(response.Data(), cells.data(), Num_Cells * sizeof(cache::PtSketch::Cell)));
+			}
+		};
+
 		struct RemotePtApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
 				return test::CreateLifetimeExtendedApi(CreateRemotePtApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
@@ -127,4 +199,6 @@ namespace catapult { namespace api {
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, TransactionInfos)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemotePtApi, TransactionInfosByHash)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemotePtApi, TransactionInfosSketch)
 }}
@@ -102,4 +102,130 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(PtSynchronizer)
+
+	// region sketch
+
+#define TEST_CLASS PtSketchSynchronizerTests
+
+	namespace {
+		class SketchTestContext {
+		public:
+			explicit SketchTestContext(uint32_t numResponseTransactionInfos)
+					: m_localSketch(cache::Max_Sketch_Num_Cells)
+					, m_remoteSketch(cache::Max_Sketch_Num_Cells)
+					, m_api(PtSynchronizerTraits::CreateResponseContainer(numResponseTransactionInfos))
+					, m_synchronizer(CreatePtSketchSynchronizer(
+							[&localSketch = m_localSketch](auto numCells) { return localSketch.fold(numCells); },
+							[]() { return cache::ShortHashPairRange(); },
+							[&numConsumedInfos = m_numConsumedInfos](auto&& infos) { numConsumedInfos += infos.size(); }))
+					, m_numConsumedInfos(0)
+			{}
+
+		public:
+			auto& api() {
+				return m_api;
+			}
+
+			auto numConsumedInfos() const {
+				return m_numConsumedInfos;
+			}
+
+		public:
+			void addLocal(const std::vector<cache::PtSketchKey>& keys) {
+				for (const auto& key : keys)
+					m_localSketch.insert(key);
+			}
+
+			void addRemote(const std::vector<cache::PtSketchKey>& keys) {
+				for (const auto& key : keys)
+					m_remoteSketch.insert(key);
+
+				m_api.setSketch(m_remoteSketch);
+			}
+
+			NodeInteractionResult synchronize() {
+				return m_synchronizer(m_api).get();
+			}
+
+		private:
+			cache::PtSketch m_localSketch;
+			cache::PtSketch m_remoteSketch;
+			MockRemoteApi m_api;
+			RemoteNodeSynchronizer<api::RemotePtApi> m_synchronizer;
+			size_t m_numConsumedInfos;
+		};
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenLocalAndRemoteTransactionInfosMatch) {
+		// Arrange:
+		SketchTestContext context(3);
+		auto keys = test::GenerateRandomDataVector<cache::PtSketchKey>(5);
+		context.addLocal(keys);
+		context.addRemote(keys);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_EQ(std::vector<uint32_t>({ cache::Min_Sketch_Num_Cells }), context.api().transactionInfosSketchRequests());
+		EXPECT_TRUE(context.api().transactionInfosByHashRequests().empty());
+		EXPECT_TRUE(context.api().transactionInfosRequests().empty());
+		EXPECT_EQ(0u, context.numConsumedInfos());
+	}
+
+	TEST(TEST_CLASS, SuccessInteractionWhenRemoteHasDifferentCosignatures) {
+		// Arrange: the remote has more cosignatures for one transaction
+		SketchTestContext context(1);
+		auto keys = test::GenerateRandomDataVector<cache::PtSketchKey>(5);
+		context.addLocal(keys);
+
+		auto remoteKey = keys[2];
+		remoteKey.CosignaturesShortHash = test::GenerateRandomValue<utils::ShortHash>();
+		context.addRemote({ keys[0], keys[1], remoteKey, keys[3], keys[4] });
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert: the transaction info is requested by transaction hash
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(1u, context.api().transactionInfosByHashRequests().size());
+		const auto& requestedHashes = context.api().transactionInfosByHashRequests()[0];
+		ASSERT_EQ(1u, requestedHashes.size());
+		EXPECT_EQ(keys[2].TransactionHash, *requestedHashes.cbegin());
+		EXPECT_TRUE(context.api().transactionInfosRequests().empty());
+		EXPECT_EQ(1u, context.numConsumedInfos());
+	}
+
+	TEST(TEST_CLASS, SuccessInteractionWhenDifferenceCannotBeDecodedAndFallbackPullReturnsTransactionInfos) {
+		// Arrange: difference is larger than the number of requested cells
+		SketchTestContext context(3);
+		context.addRemote(test::GenerateRandomDataVector<cache::PtSketchKey>(2 * cache::Min_Sketch_Num_Cells));
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_TRUE(context.api().transactionInfosByHashRequests().empty());
+		EXPECT_EQ(1u, context.api().transactionInfosRequests().size());
+		EXPECT_EQ(3u, context.numConsumedInfos());
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenSketchRequestThrows) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.api().setError(MockRemoteApi::EntryPoint::Partial_Transaction_Infos_Sketch);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.api().transactionInfosByHashRequests().empty());
+		EXPECT_TRUE(context.api().transactionInfosRequests().empty());
+		EXPECT_EQ(0u, context.numConsumedInfos());
+	}
+
+	// endregion
 }}
@@ -20,7 +20,9 @@
 
 #include "partialtransaction/src/handlers/PtHandlers.h"
 #include "plugins/txes/aggregate/src/model/AggregateEntityType.h"
+#include "catapult/api/SketchPackets.h"
 #include "catapult/utils/Functional.h"
+#include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PushHandlerTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/plugins/PullHandlerTests.h"
@@ -181,4 +183,94 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactions)
 
 	// endregion
+
+	// region pull partial transaction by hash handler
+
+	namespace {
+		struct PullTransactionsByHashTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Partial_Transaction_Infos_By_Hash;
+			static constexpr auto RegisterHandler = RegisterPullPartialTransactionInfosByHashHandler;
+			using ResponseType = CosignedTransactionInfos;
+			static constexpr auto Valid_Request_Payload_Size = Hash256_Size;
+
+			using RetrieverParamType = utils::HashSet;
+
+			static auto ExtractFromPacket(const ionet::Packet& packet, size_t numRequestEntities) {
+				RetrieverParamType extracted;
+				auto pData = reinterpret_cast<const Hash256*>(packet.Data());
+				for (auto i = 0u; i < numRequestEntities; ++i)
+					extracted.insert(*pData++);
+
+				return extracted;
+			}
+
+			using ResponseContext = PullTransactionsTraits::ResponseContext;
+		};
+	}
+
+	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactionsByHash)
+
+	// endregion
+
+	// region pull partial transaction sketch handler
+
+	namespace {
+		auto CreateSketchRequestPacket(uint32_t numCells) {
+			auto pPacket = ionet::CreateSharedPacket<api::PullPartialTransactionInfosSketchRequest>();
+			pPacket->NumCells = numCells;
+			return pPacket;
+		}
+
+		void RegisterSketchHandler(ionet::ServerPacketHandlers& handlers, const std::vector<cache::PtSketchKey>& keys) {
+			RegisterPullPartialTransactionInfosSketchHandler(handlers, [keys](auto numCells) {
+				cache::PtSketch sketch(numCells);
+				for (const auto& key : keys)
+					sketch.insert(key);
+
+				return sketch;
+			});
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToRequestWithInvalidNumberOfCells) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		RegisterSketchHandler(handlers, {});
+
+		for (auto numCells : { 0u, 3u * 4 + 1, 2 * cache::Max_Sketch_Num_Cells }) {
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(*CreateSketchRequestPacket(numCells), context));
+
+			// Assert:
+			test::AssertNoResponse(context);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_WritesSketchCellsInResponseToValidRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto keys = test::GenerateRandomDataVector<cache::PtSketchKey>(5);
+		RegisterSketchHandler(handlers, keys);
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*CreateSketchRequestPacket(3 * 64), context));
+
+		// Assert:
+		auto cellsSize = 3 * 64 * sizeof(cache::PtSketch::Cell);
+		test::AssertPacketHeader(context, sizeof(ionet::PacketHeader) + cellsSize, ionet::PacketType::Pull_Partial_Transaction_Infos_Sketch);
+
+		// - the response can be decoded
+		const auto* pCells = reinterpret_cast<const cache::PtSketch::Cell*>(test::GetSingleBufferData(context));
+		cache::PtSketch sketch(std::vector<cache::PtSketch::Cell>(pCells, pCells + 3 * 64));
+
+		std::vector<cache::PtSketchKey> positiveKeys;
+		std::vector<cache::PtSketchKey> negativeKeys;
+		EXPECT_TRUE(sketch.decode(positiveKeys, negativeKeys));
+		EXPECT_EQ(5u, positiveKeys.size());
+		EXPECT_TRUE(negativeKeys.empty());
+	}
+
+	// endregion
 }}
@@ -29,13 +29,16 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Partial_Transaction_Infos
+			Partial_Transaction_Infos,
+			Partial_Transaction_Infos_By_Hash,
+			Partial_Transaction_Infos_Sketch
 		};
 
 	public:
 		/// Creates a partial transaction api around cosigned transaction infos (\a transactionInfos).
 		explicit MockPtApi(const partialtransaction::CosignedTransactionInfos& transactionInfos)
 				: m_transactionInfos(transactionInfos)
+				, m_sketch(cache::Max_Sketch_Num_Cells)
 				, m_errorEntryPoint(EntryPoint::None)
 		{}
 
@@ -45,11 +48,26 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets the sketch returned by partial transaction infos sketch requests to \a sketch.
+		void setSketch(const cache::PtSketch& sketch) {
+			m_sketch = sketch;
+		}
+
 		/// Returns the vector of short hash pair ranges that were passed to the partial transaction infos requests.
 		const std::vector<cache::ShortHashPairRange>& transactionInfosRequests() const {
 			return m_transactionInfosRequests;
 		}
 
+		/// Returns the vector of hash ranges that were passed to the partial transaction infos by hash requests.
+		const std::vector<model::HashRange>& transactionInfosByHashRequests() const {
+			return m_transactionInfosByHashRequests;
+		}
+
+		/// Returns the vector of numbers of cells that were passed to the partial transaction infos sketch requests.
+		const std::vector<uint32_t>& transactionInfosSketchRequests() const {
+			return m_transactionInfosSketchRequests;
+		}
+
 	public:
 		/// Returns the configured partial transaction infos and throws if the error entry point is set to Partial_Transaction_Infos.
 		/// \note The \a knownShortHashPairs parameter is captured.
@@ -64,6 +82,32 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(decltype(m_transactionInfos)(m_transactionInfos));
 		}
 
+		/// Returns the configured partial transaction infos and throws if the error entry point is set to
+		/// Partial_Transaction_Infos_By_Hash.
+		/// \note The \a hashes parameter is captured.
+		thread::future<partialtransaction::CosignedTransactionInfos> transactionInfosByHash(model::HashRange&& hashes) const override {
+			m_transactionInfosByHashRequests.push_back(std::move(hashes));
+			if (shouldRaiseException(EntryPoint::Partial_Transaction_Infos_By_Hash)) {
+				using ResultType = partialtransaction::CosignedTransactionInfos;
+				return CreateFutureException<ResultType>("partial transaction infos by hash error has been set");
+			}
+
+			return thread::make_ready_future(decltype(m_transactionInfos)(m_transactionInfos));
+		}
+
+		/// Returns the cells of the configured sketch folded to \a numCells cells and throws if the error entry point is set to
+		/// Partial_Transaction_Infos_Sketch.
+		/// \note The \a numCells parameter is captured.
+		thread::future<cache::PtSketchCellRange> transactionInfosSketch(uint32_t numCells) const override {
+			m_transactionInfosSketchRequests.push_back(numCells);
+			if (shouldRaiseException(EntryPoint::Partial_Transaction_Infos_Sketch))
+				return CreateFutureException<cache::PtSketchCellRange>("partial transaction infos sketch error has been set");
+
+			auto sketch = m_sketch.fold(numCells);
+			const auto& cells = sketch.cells();
+			return thread::make_ready_future(cache::PtSketchCellRange::CopyFixed(reinterpret_cast<const uint8_t*>(cells.data()), cells.size()));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -76,7 +120,10 @@ namespace catapult { namespace mocks {
 
 	private:
 		partialtransaction::CosignedTransactionInfos m_transactionInfos;
+		cache::PtSketch m_sketch;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<cache::ShortHashPairRange> m_transactionInfosRequests;
+		mutable std::vector<model::HashRange> m_transactionInfosByHashRequests;
+		mutable std::vector<uint32_t> m_transactionInfosSketchRequests;
 	};
 }}
@@ -30,6 +30,7 @@
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
+#include "catapult/chain/TransactionDependencies.h"
 #include "catapult/chain/UtUpdater.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/consumers/AuditConsumer.h"
@@ -48,6 +49,7 @@
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
 #include "catapult/validators/AggregateEntityValidator.h"
+#include "catapult/validators/BatchSignatureVerifier.h"
 #include <boost/filesystem.hpp>
 
 using namespace catapult::consumers;
@@ -72,10 +74,34 @@ namespace catapult { namespace sync {
 			return options;
 		}
 
+		std::unique_ptr<const validators::stateless::AggregateEntityValidator> CreateSignaturelessStatelessValidator(
+				const plugins::PluginManager& pluginManager) {
+			return extensions::CreateStatelessValidator(pluginManager, [](auto notificationType) {
+				return model::Core_Signature_Notification != notificationType;
+			});
+		}
+
+		std::shared_ptr<const validators::BatchSignatureVerifier> CreateBatchSignatureVerifier(
+				const plugins::PluginManager& pluginManager,
+				const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+			return validators::CreateBatchSignatureVerifier(pluginManager.createNotificationPublisher(), pValidatorPool);
+		}
+
+		template<typename TConsumer, typename TMapConsumers>
+		std::vector<DisruptorConsumerStage> ToDisruptorConsumerStages(
+				const std::vector<std::vector<TConsumer>>& consumerStages,
+				TMapConsumers mapConsumers) {
+			std::vector<DisruptorConsumerStage> disruptorConsumerStages;
+			for (const auto& consumerStage : consumerStages)
+				disruptorConsumerStages.push_back(mapConsumers(consumerStage));
+
+			return disruptorConsumerStages;
+		}
+
 		std::unique_ptr<ConsumerDispatcher> CreateConsumerDispatcher(
 				extensions::ServiceState& state,
 				const ConsumerDispatcherOptions& options,
-				std::vector<DisruptorConsumer>&& disruptorConsumers) {
+				std::vector<DisruptorConsumerStage>&& disruptorConsumerStages) {
 			auto& statusSubscriber = state.transactionStatusSubscriber();
 			auto reclaimMemoryInspector = CreateReclaimMemoryInspector();
 			auto inspector = [&statusSubscriber, reclaimMemoryInspector](auto& input, const auto& completionResult) {
@@ -83,7 +109,8 @@ namespace catapult { namespace sync {
 				reclaimMemoryInspector(input, completionResult);
 			};
 
-			// if enabled, add an audit consumer before all other consumers
+			// if enabled, add an audit consumer as its own leading stage
+			// (a consumer in a shared stage could be skipped when another consumer in that stage aborts an input)
 			const auto& config = state.config();
 			if (config.Node.ShouldAuditDispatcherInputs) {
 				auto auditPath = boost::filesystem::path(config.User.DataDirectory) / "audit" / std::string(options.DispatcherName);
@@ -91,10 +118,11 @@ namespace catapult { namespace sync {
 				CATAPULT_LOG(debug) << "enabling auditing to " << auditPath;
 
 				boost::filesystem::create_directories(auditPath);
-				disruptorConsumers.insert(disruptorConsumers.begin(), CreateAuditConsumer(auditPath.generic_string()));
+				auto auditConsumerStage = DisruptorConsumerStage{ CreateAuditConsumer(auditPath.generic_string()) };
+				disruptorConsumerStages.insert(disruptorConsumerStages.begin(), auditConsumerStage);
 			}
 
-			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumers, inspector);
+			return std::make_unique<ConsumerDispatcher>(options, disruptorConsumerStages, inspector);
 		}
 
 		// endregion
@@ -152,6 +180,9 @@ namespace catapult { namespace sync {
 			};
 
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
+
+			// changed addresses are only used by the incremental unconfirmed transactions revalidation handler
+			syncHandlers.ShouldCollectChangedAddresses = state.config().Node.ShouldIncrementallyRevalidateTransactions;
 			return syncHandlers;
 		}
 
@@ -163,48 +194,68 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
-				m_consumers.push_back(CreateBlockHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateBlockHashCheckConsumer(
+			void addHashConsumers(const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+				const auto& transactionRegistry = m_state.pluginManager().transactionRegistry();
+				m_consumerStages.push_back({ CreateBlockHashCalculatorConsumer(transactionRegistry, pValidatorPool) });
+				m_consumerStages.push_back({ CreateBlockHashCheckConsumer(
 					m_state.timeSupplier(),
-					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
+					extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)) });
 			}
 
 			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateBlockAddressExtractionConsumer(publisher));
+				// address extraction depends on transaction elements created by hash calculation but not on hash checking,
+				// so it is run in parallel with the latter
+				m_consumerStages.back().push_back(CreateBlockAddressExtractionConsumer(publisher));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
 					const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool,
 					RollbackInfo& rollbackInfo) {
-				m_consumers.push_back(CreateBlockChainCheckConsumer(
+				m_consumerStages.push_back({ CreateBlockChainCheckConsumer(
 						m_nodeConfig.MaxBlocksPerSyncAttempt,
 						m_state.config().BlockChain.MaxBlockFutureTime,
-						m_state.timeSupplier()));
-				m_consumers.push_back(CreateBlockStatelessValidationConsumer(
-						extensions::CreateStatelessValidator(m_state.pluginManager()),
-						validators::CreateParallelValidationPolicy(pValidatorPool),
-						ToUnknownTransactionPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()))));
-
-				auto disruptorConsumers = DisruptorConsumersFromBlockConsumers(m_consumers);
-				disruptorConsumers.push_back(CreateBlockChainSyncConsumer(
+						m_state.timeSupplier()) });
+				addStatelessValidationConsumer(pValidatorPool);
+
+				auto disruptorConsumerStages = ToDisruptorConsumerStages(m_consumerStages, DisruptorConsumersFromBlockConsumers);
+				disruptorConsumerStages.push_back({ CreateBlockChainSyncConsumer(
 						m_state.cache(),
 						m_state.state(),
 						m_state.storage(),
 						m_state.config().BlockChain.MaxRollbackBlocks,
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, rollbackInfo)) });
 
-				disruptorConsumers.push_back(CreateNewBlockConsumer(m_state.hooks().newBlockSink(), InputSource::Local));
+				disruptorConsumerStages.push_back({ CreateNewBlockConsumer(m_state.hooks().newBlockSink(), InputSource::Local) });
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateBlockConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(disruptorConsumerStages));
+			}
+
+		private:
+			void addStatelessValidationConsumer(const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+				const auto& pluginManager = m_state.pluginManager();
+				auto pValidationPolicy = validators::CreateParallelValidationPolicy(pValidatorPool);
+				auto requiresValidationPredicate = ToUnknownTransactionPredicate(m_state.hooks().knownHashPredicate(m_state.utCache()));
+				if (m_nodeConfig.ShouldBatchVerifySignatures) {
+					m_consumerStages.push_back({ CreateBlockStatelessValidationConsumer(
+							extensions::CreateStatelessValidator(pluginManager),
+							CreateSignaturelessStatelessValidator(pluginManager),
+							CreateBatchSignatureVerifier(pluginManager, pValidatorPool),
+							pValidationPolicy,
+							requiresValidationPredicate) });
+				} else {
+					m_consumerStages.push_back({ CreateBlockStatelessValidationConsumer(
+							extensions::CreateStatelessValidator(pluginManager),
+							pValidationPolicy,
+							requiresValidationPredicate) });
+				}
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
-			std::vector<BlockConsumer> m_consumers;
+			std::vector<std::vector<BlockConsumer>> m_consumerStages;
 		};
 
 		void RegisterBlockDispatcherService(
@@ -240,28 +291,27 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
-				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(m_state.pluginManager().transactionRegistry()));
-				m_consumers.push_back(CreateTransactionHashCheckConsumer(
+			void addHashConsumers(const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+				const auto& transactionRegistry = m_state.pluginManager().transactionRegistry();
+				m_consumerStages.push_back({ CreateTransactionHashCalculatorConsumer(transactionRegistry, pValidatorPool) });
+				m_consumerStages.push_back({ CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
-						m_state.hooks().knownHashPredicate(m_state.utCache())));
+						m_state.hooks().knownHashPredicate(m_state.utCache())) });
 			}
 
 			void addPrecomputedTransactionAddressConsumer(const model::NotificationPublisher& publisher) {
-				m_consumers.push_back(CreateTransactionAddressExtractionConsumer(publisher));
+				// address extraction does not depend on hash checking, so it is run in parallel with the latter
+				m_consumerStages.back().push_back(CreateTransactionAddressExtractionConsumer(publisher));
 			}
 
 			std::shared_ptr<ConsumerDispatcher> build(
 					const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool,
 					chain::UtUpdater& utUpdater) {
-				m_consumers.push_back(CreateTransactionStatelessValidationConsumer(
-						extensions::CreateStatelessValidator(m_state.pluginManager()),
-						validators::CreateParallelValidationPolicy(pValidatorPool),
-						extensions::SubscriberToSink(m_state.transactionStatusSubscriber())));
+				addStatelessValidationConsumer(pValidatorPool);
 
-				auto disruptorConsumers = DisruptorConsumersFromTransactionConsumers(m_consumers);
-				disruptorConsumers.push_back(CreateNewTransactionsConsumer(
+				auto disruptorConsumerStages = ToDisruptorConsumerStages(m_consumerStages, DisruptorConsumersFromTransactionConsumers);
+				disruptorConsumerStages.push_back({ CreateNewTransactionsConsumer(
 						[&utUpdater, newTransactionsSink = m_state.hooks().newTransactionsSink()](auto&& transactionInfos) {
 					/// Note that all transaction infos are broadcast even though some transactions might fail stateful validation because:
 					/// 1. even though a transaction can fail stateful validation on one node, it might pass the validation on another
@@ -269,18 +319,38 @@ namespace catapult { namespace sync {
 					///    state information
 					newTransactionsSink(transactionInfos);
 					utUpdater.update(std::move(transactionInfos));
-				}));
+				}) });
 
 				return CreateConsumerDispatcher(
 						m_state,
 						CreateTransactionConsumerDispatcherOptions(m_nodeConfig),
-						std::move(disruptorConsumers));
+						std::move(disruptorConsumerStages));
+			}
+
+		private:
+			void addStatelessValidationConsumer(const std::shared_ptr<thread::IoServiceThreadPool>& pValidatorPool) {
+				const auto& pluginManager = m_state.pluginManager();
+				auto pValidationPolicy = validators::CreateParallelValidationPolicy(pValidatorPool);
+				auto failedTransactionSink = extensions::SubscriberToSink(m_state.transactionStatusSubscriber());
+				if (m_nodeConfig.ShouldBatchVerifySignatures) {
+					m_consumerStages.push_back({ CreateTransactionStatelessValidationConsumer(
+							extensions::CreateStatelessValidator(pluginManager),
+							CreateSignaturelessStatelessValidator(pluginManager),
+							CreateBatchSignatureVerifier(pluginManager, pValidatorPool),
+							pValidationPolicy,
+							failedTransactionSink) });
+				} else {
+					m_consumerStages.push_back({ CreateTransactionStatelessValidationConsumer(
+							extensions::CreateStatelessValidator(pluginManager),
+							pValidationPolicy,
+							failedTransactionSink) });
+				}
 			}
 
 		private:
 			extensions::ServiceState& m_state;
 			const config::NodeConfiguration& m_nodeConfig;
-			std::vector<TransactionConsumer> m_consumers;
+			std::vector<std::vector<TransactionConsumer>> m_consumerStages;
 		};
 
 		void RegisterTransactionDispatcherService(
@@ -305,6 +375,24 @@ namespace catapult { namespace sync {
 
 		// endregion
 
+		chain::TransactionDependencies CollectChangedDependencies(
+				const TransactionsChangeInfo& changeInfo,
+				const model::NotificationPublisher& notificationPublisher) {
+			chain::TransactionDependencies dependencies;
+			for (const auto& address : changeInfo.ChangedAddresses)
+				dependencies.add(address);
+
+			// non-account state changes can only be detected via the added transactions
+			for (const auto& blockElement : changeInfo.AddedBlockElements) {
+				for (const auto& transactionElement : blockElement.Transactions) {
+					auto entityInfo = model::WeakEntityInfo(transactionElement.Transaction, transactionElement.EntityHash);
+					dependencies.add(entityInfo, notificationPublisher);
+				}
+			}
+
+			return dependencies;
+		}
+
 		chain::UtUpdater& CreateAndRegisterUtUpdater(extensions::ServiceLocator& locator, extensions::ServiceState& state) {
 			auto pUtUpdater = std::make_shared<chain::UtUpdater>(
 					state.utCache(),
@@ -316,9 +404,17 @@ namespace catapult { namespace sync {
 			locator.registerRootedService("dispatcher.utUpdater", pUtUpdater);
 
 			auto& utUpdater = *pUtUpdater;
-			state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
-				utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
-			});
+			if (state.config().Node.ShouldIncrementallyRevalidateTransactions) {
+				auto pPublisher = std::shared_ptr<const model::NotificationPublisher>(state.pluginManager().createNotificationPublisher());
+				state.hooks().addTransactionsChangeHandler([&utUpdater, pPublisher](const auto& changeInfo) {
+					auto changedDependencies = CollectChangedDependencies(changeInfo, *pPublisher);
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos, changedDependencies);
+				});
+			} else {
+				state.hooks().addTransactionsChangeHandler([&utUpdater](const auto& changeInfo) {
+					utUpdater.update(changeInfo.AddedTransactionHashes, changeInfo.RevertedTransactionInfos);
+				});
+			}
 
 			return utUpdater;
 		}
@@ -371,10 +467,10 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(pValidatorPool);
 
 				if (state.config().Node.ShouldPrecomputeTransactionAddresses) {
 					auto pPublisher = state.pluginManager().createNotificationPublisher();
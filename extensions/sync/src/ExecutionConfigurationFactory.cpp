@@ -19,7 +19,10 @@
 **/
 
 #include "ExecutionConfigurationFactory.h"
+#include "catapult/cache/CatapultCacheDelta.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/TransactionUtils.h"
 #include "catapult/plugins/PluginManager.h"
 
 namespace catapult { namespace sync {
@@ -30,6 +33,14 @@ namespace catapult { namespace sync {
 		executionConfig.pObserver = pluginManager.createObserver();
 		executionConfig.pValidator = pluginManager.createStatefulValidator();
 		executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+
+		// when account states are stored in a database, load all referenced accounts with batched lookups up front
+		if (pluginManager.storageConfig().PreferCacheDatabase) {
+			executionConfig.Prefetcher = [](const model::AccountReferences& references, cache::CatapultCacheDelta& cacheDelta) {
+				cacheDelta.sub<cache::AccountStateCache>().prefetch(references.Addresses, references.PublicKeys);
+			};
+		}
+
 		return executionConfig;
 	}
 }}
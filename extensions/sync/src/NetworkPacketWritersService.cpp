@@ -61,6 +61,13 @@ namespace catapult { namespace sync {
 			};
 		}
 
+		TransactionsSink CreateAnnounceTransactionsSink(const extensions::ServiceLocator& locator) {
+			return [&locator](const auto& transactionInfos) {
+				auto payload = ionet::CreateAnnouncementPayload(transactionInfos);
+				locator.service<net::PacketWriters>(Service_Name)->broadcast(payload);
+			};
+		}
+
 		class NetworkPacketWritersServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -83,7 +90,9 @@ namespace catapult { namespace sync {
 
 				// add sinks
 				state.hooks().addNewBlockSink(extensions::CreatePushEntitySink<BlockSink>(locator, Service_Name));
-				state.hooks().addNewTransactionsSink(extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
+				state.hooks().addNewTransactionsSink(state.config().Node.ShouldAnnounceTransactions
+						? CreateAnnounceTransactionsSink(locator)
+						: extensions::CreatePushEntitySink<TransactionsSink>(locator, Service_Name));
 				state.hooks().addPacketPayloadSink([&writers = *pWriters](const auto& payload) { writers.broadcast(payload); });
 
 				// add retrievers
@@ -24,11 +24,14 @@
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/api/RemoteTransactionApi.h"
 #include "catapult/cache/MemoryUtCache.h"
+#include "catapult/chain/AnnouncedTransactions.h"
 #include "catapult/chain/UtSynchronizer.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/PeersConnectionTasks.h"
+#include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/SynchronizerTaskCallbacks.h"
+#include "catapult/handlers/TransactionHandlers.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/MemoryUtils.h"
 
@@ -36,6 +39,7 @@ namespace catapult { namespace sync {
 
 	namespace {
 		constexpr auto Sync_Source = disruptor::InputSource::Remote_Pull;
+		constexpr uint32_t Max_Announced_Hashes_Per_Request = 1000;
 
 		thread::Task CreateConnectPeersTask(extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& connectionsConfig = state.config().Node.OutgoingConnections;
@@ -56,15 +60,40 @@ namespace catapult { namespace sync {
 			return chainSynchronizerConfig;
 		}
 
+		chain::RemoteChainApisSupplier CreateDownloadPeersSupplier(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
+			const auto& nodeConfig = state.config().Node;
+			return [
+					&packetWriters,
+					&registry = state.pluginManager().transactionRegistry(),
+					numDownloadPeers = nodeConfig.MaxBlockDownloadPeers - 1,
+					syncTimeout = nodeConfig.SyncTimeout]() {
+				std::vector<std::shared_ptr<const api::RemoteChainApi>> remoteChainApis;
+				for (const auto& packetIoPair : net::PickMultiple(packetWriters, numDownloadPeers, syncTimeout)) {
+					// extend the lifetime of packetIoPair until the api is destroyed
+					auto pRemoteChainApi = api::CreateRemoteChainApi(*packetIoPair.io(), registry);
+					remoteChainApis.push_back(std::shared_ptr<const api::RemoteChainApi>(
+							pRemoteChainApi.release(),
+							[packetIoPair](const auto* pApi) { delete pApi; }));
+				}
+
+				return remoteChainApis;
+			};
+		}
+
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
-			auto chainSynchronizer = chain::CreateChainSynchronizer(
-					api::CreateLocalChainApi(
-							state.storage(),
-							[&score = state.score()]() { return score.get(); },
-							config.Node.MaxBlocksPerSyncAttempt),
-					CreateChainSynchronizerConfiguration(config),
-					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
+			auto pLocalChainApi = utils::UniqueToShared(api::CreateLocalChainApi(
+					state.storage(),
+					[&score = state.score()]() { return score.get(); },
+					config.Node.MaxBlocksPerSyncAttempt));
+			auto blockRangeConsumer = state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source);
+			auto chainSynchronizer = config.Node.MaxBlockDownloadPeers > 1
+					? chain::CreateChainSynchronizer(
+							pLocalChainApi,
+							CreateChainSynchronizerConfiguration(config),
+							CreateDownloadPeersSupplier(state, packetWriters),
+							blockRangeConsumer)
+					: chain::CreateChainSynchronizer(pLocalChainApi, CreateChainSynchronizerConfiguration(config), blockRangeConsumer);
 
 			thread::Task task;
 			task.Name = "synchronizer task";
@@ -77,10 +106,21 @@ namespace catapult { namespace sync {
 			return task;
 		}
 
+		chain::RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(const extensions::ServiceState& state) {
+			const auto& utCache = state.utCache();
+			auto shortHashesSupplier = [&utCache]() { return utCache.view().shortHashes(); };
+			auto transactionRangeConsumer = state.hooks().transactionRangeConsumerFactory()(Sync_Source);
+			if (!state.config().Node.ShouldReconcileTransactions)
+				return chain::CreateUtSynchronizer(shortHashesSupplier, transactionRangeConsumer);
+
+			return chain::CreateUtSketchSynchronizer(
+					[&utCache](auto numCells) { return utCache.view().sketch(numCells); },
+					shortHashesSupplier,
+					transactionRangeConsumer);
+		}
+
 		thread::Task CreatePullUtTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
-			auto utSynchronizer = chain::CreateUtSynchronizer(
-					[&cache = state.utCache()]() { return cache.view().shortHashes(); },
-					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
+			auto utSynchronizer = CreateUtSynchronizer(state);
 
 			thread::Task task;
 			task.Name = "pull unconfirmed transactions task";
@@ -93,6 +133,61 @@ namespace catapult { namespace sync {
 			return task;
 		}
 
+		std::shared_ptr<chain::AnnouncedTransactions> CreateAnnouncedTransactions(const extensions::ServiceState& state) {
+			const auto& nodeConfig = state.config().Node;
+			chain::AnnouncedTransactionsOptions options;
+			options.MaxTransactions = nodeConfig.UnconfirmedTransactionsCacheMaxSize;
+			options.MaxHashesPerRequest = Max_Announced_Hashes_Per_Request;
+			options.RequestTimeout = nodeConfig.SyncTimeout;
+			options.AnnouncementLifetime = nodeConfig.ShortLivedCacheTransactionDuration;
+			return std::make_shared<chain::AnnouncedTransactions>(options, [&cache = state.utCache()](const auto& hash) {
+				return cache.view().contains(hash);
+			});
+		}
+
+		thread::Task CreatePullAnnouncedUtTask(
+				const extensions::ServiceState& state,
+				net::PacketWriters& packetWriters,
+				const std::shared_ptr<chain::AnnouncedTransactions>& pAnnouncedTransactions) {
+			auto utSynchronizer = chain::CreateAnnouncedUtSynchronizer(
+					pAnnouncedTransactions,
+					state.timeSupplier(),
+					state.hooks().transactionRangeConsumerFactory()(Sync_Source));
+
+			thread::Task task;
+			task.Name = "pull announced transactions task";
+			task.Callback = [
+					&packetWriters,
+					&registry = state.pluginManager().transactionRegistry(),
+					pAnnouncedTransactions,
+					utSynchronizer,
+					chainSynced = state.hooks().chainSyncedPredicate(),
+					timeSupplier = state.timeSupplier(),
+					syncTimeout = state.config().Node.SyncTimeout]() {
+				pAnnouncedTransactions->prune(timeSupplier());
+				if (!chainSynced() || 0 == pAnnouncedTransactions->size())
+					return thread::make_ready_future(thread::TaskResult::Continue);
+
+				// each peer is only asked for the transactions it announced
+				std::vector<thread::future<chain::NodeInteractionResult>> interactionFutures;
+				auto packetIoPairs = net::PickMultiple(packetWriters, packetWriters.numActiveWriters(), syncTimeout);
+				for (const auto& packetIoPair : packetIoPairs) {
+					auto pRemoteApi = utils::UniqueToShared(api::CreateRemoteTransactionApi(*packetIoPair.io(), registry));
+
+					// extend the lifetimes of pRemoteApi and packetIoPair until the completion of the interaction
+					auto interactionFuture = utSynchronizer(*pRemoteApi, packetIoPair.node().identityKey());
+					interactionFutures.push_back(interactionFuture.then([pRemoteApi, packetIoPair](auto&& resultFuture) {
+						return resultFuture.get();
+					}));
+				}
+
+				return thread::when_all(std::move(interactionFutures)).then([](auto&&) {
+					return thread::TaskResult::Continue;
+				});
+			};
+			return task;
+		}
+
 		class SyncServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			extensions::ServiceRegistrarInfo info() const override {
@@ -106,10 +201,22 @@ namespace catapult { namespace sync {
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
 				auto& packetWriters = *GetPacketWriters(locator);
 
+				// announcements are always accepted so that peers announcing transactions can be synced with
+				auto pAnnouncedTransactions = CreateAnnouncedTransactions(state);
+				locator.registerRootedService("announcedTransactions", pAnnouncedTransactions);
+
+				// add handlers
+				handlers::RegisterPushTransactionHashesHandler(state.packetHandlers(), [
+						&announcedTransactions = *pAnnouncedTransactions,
+						timeSupplier = state.timeSupplier()](const auto& range) {
+					announcedTransactions.add(range.SourcePublicKey, range.Range, timeSupplier());
+				});
+
 				// add tasks
 				state.tasks().push_back(CreateConnectPeersTask(state, packetWriters));
 				state.tasks().push_back(CreateSynchronizerTask(state, packetWriters));
 				state.tasks().push_back(CreatePullUtTask(state, packetWriters));
+				state.tasks().push_back(CreatePullAnnouncedUtTask(state, packetWriters, pAnnouncedTransactions));
 			}
 		};
 	}
@@ -35,6 +35,7 @@ namespace catapult { namespace sync {
 		EXPECT_TRUE(!!config.pObserver);
 		EXPECT_TRUE(!!config.pValidator);
 		EXPECT_TRUE(!!config.pNotificationPublisher);
+		EXPECT_FALSE(!!config.Prefetcher);
 
 		// - notice that only observers and validators registered in CreateDefaultPluginManager are present
 		std::vector<std::string> expectedObserverNames{
@@ -57,4 +58,20 @@ namespace catapult { namespace sync {
 		};
 		EXPECT_EQ(expectedValidatorNames, config.pValidator->names());
 	}
+
+	TEST(TEST_CLASS, CanCreateExecutionConfigurationWithPrefetcherWhenCacheDatabaseIsPreferred) {
+		// Arrange:
+		plugins::StorageConfiguration storageConfig;
+		storageConfig.PreferCacheDatabase = true;
+		plugins::PluginManager pluginManager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+
+		// Act:
+		auto config = CreateExecutionConfiguration(pluginManager);
+
+		// Assert:
+		EXPECT_TRUE(!!config.pObserver);
+		EXPECT_TRUE(!!config.pValidator);
+		EXPECT_TRUE(!!config.pNotificationPublisher);
+		EXPECT_TRUE(!!config.Prefetcher);
+	}
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "sync/src/SyncService.h"
+#include "catapult/chain/AnnouncedTransactions.h"
 #include "catapult/extensions/ServerHooks.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -31,7 +32,7 @@ namespace catapult { namespace sync {
 #define TEST_CLASS SyncServiceTests
 
 	namespace {
-		constexpr auto Num_Expected_Tasks = 3u;
+		constexpr auto Num_Expected_Tasks = 4u;
 
 		struct SyncServiceTraits {
 			static constexpr auto CreateRegistrar = CreateSyncServiceRegistrar;
@@ -55,6 +56,54 @@ namespace catapult { namespace sync {
 
 	ADD_SERVICE_REGISTRAR_INFO_TEST(Sync, Post_Range_Consumers)
 
+	// region announced transactions
+
+	TEST(TEST_CLASS, AnnouncedTransactionsServiceIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+
+		// Assert:
+		EXPECT_EQ(2u, context.locator().numServices());
+		EXPECT_TRUE(!!context.locator().service<chain::AnnouncedTransactions>("announcedTransactions"));
+	}
+
+	TEST(TEST_CLASS, PushTransactionHashesHandlerIsRegistered) {
+		// Arrange:
+		TestContext context;
+
+		// Act:
+		context.boot();
+		const auto& handlers = context.testState().state().packetHandlers();
+
+		// Assert:
+		EXPECT_EQ(1u, handlers.size());
+		EXPECT_TRUE(handlers.canProcess(ionet::PacketType::Push_Transaction_Hashes));
+	}
+
+	TEST(TEST_CLASS, PushTransactionHashesHandlerAddsAnnouncedTransactions) {
+		// Arrange:
+		TestContext context;
+		context.boot();
+
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(3 * Hash256_Size);
+		pPacket->Type = ionet::PacketType::Push_Transaction_Hashes;
+		std::memcpy(pPacket->Data(), hashes.data(), 3 * Hash256_Size);
+
+		// Act:
+		ionet::ServerPacketHandlerContext handlerContext(test::GenerateRandomData<Key_Size>(), "");
+		context.testState().state().packetHandlers().process(*pPacket, handlerContext);
+
+		// Assert:
+		auto pAnnouncedTransactions = context.locator().service<chain::AnnouncedTransactions>("announcedTransactions");
+		EXPECT_EQ(3u, pAnnouncedTransactions->size());
+	}
+
+	// endregion
+
 	// region tasks
 
 	TEST(TEST_CLASS, ConnectPeersTaskIsScheduled) {
@@ -72,5 +121,10 @@ namespace catapult { namespace sync {
 		test::AssertRegisteredTask(TestContext(), Num_Expected_Tasks, "pull unconfirmed transactions task");
 	}
 
+	TEST(TEST_CLASS, PullAnnouncedUtTaskIsScheduled) {
+		// Assert:
+		test::AssertRegisteredTask(TestContext(), Num_Expected_Tasks, "pull announced transactions task");
+	}
+
 	// endregion
 }}
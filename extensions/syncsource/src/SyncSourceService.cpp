@@ -41,6 +41,8 @@ namespace catapult { namespace syncsource {
 			model::ChainScoreSupplier ChainScoreSupplier;
 			handlers::PullBlocksHandlerConfiguration BlocksHandlerConfig;
 			handlers::UtRetriever UtRetriever;
+			handlers::UtHashRetriever UtHashRetriever;
+			handlers::UtSketchRetriever UtSketchRetriever;
 		};
 
 		HandlersConfiguration CreateHandlersConfiguration(const extensions::ServiceState& state) {
@@ -51,6 +53,12 @@ namespace catapult { namespace syncsource {
 			config.UtRetriever = [&cache = state.utCache()](const auto& shortHashes) {
 				return cache.view().unknownTransactions(shortHashes);
 			};
+			config.UtHashRetriever = [&cache = state.utCache()](const auto& hashes) {
+				return cache.view().transactions(hashes);
+			};
+			config.UtSketchRetriever = [&cache = state.utCache()](auto numCells) {
+				return cache.view().sketch(numCells);
+			};
 
 			SetConfig(config.BlocksHandlerConfig, state.config().Node);
 			return config;
@@ -69,6 +77,8 @@ namespace catapult { namespace syncsource {
 			handlers::RegisterPullBlocksHandler(handlers, storage, config.BlocksHandlerConfig);
 
 			handlers::RegisterPullTransactionsHandler(handlers, config.UtRetriever);
+			handlers::RegisterPullTransactionsByHashHandler(handlers, config.UtHashRetriever);
+			handlers::RegisterPullTransactionsSketchHandler(handlers, config.UtSketchRetriever);
 		}
 
 		class SyncSourceServiceRegistrar : public extensions::ServiceRegistrar {
@@ -103,7 +103,13 @@ namespace catapult { namespace unbondedpruning {
 			auto addedTransactionHashes = test::GenerateRandomDataVector<Hash256>(2);
 			utils::HashPointerSet addedTransactionHashPointers{ &addedTransactionHashes[0], &addedTransactionHashes[1] };
 			auto revertedTransactionInfos = test::CreateTransactionInfos(numTransactions);
-			auto changeInfo = consumers::TransactionsChangeInfo(addedTransactionHashPointers, revertedTransactionInfos);
+			model::AddressSet changedAddresses;
+			disruptor::BlockElements addedBlockElements;
+			auto changeInfo = consumers::TransactionsChangeInfo(
+					addedTransactionHashPointers,
+					revertedTransactionInfos,
+					changedAddresses,
+					addedBlockElements);
 			handler(changeInfo);
 
 			// Assert:
@@ -0,0 +1,113 @@
+#include "ge.h"
+
+static void slide(signed char *r,const unsigned char *a)
+{
+  int i;
+  int b;
+  int k;
+
+  for (i = 0;i < 256;++i)
+    r[i] = 1 & (a[i >> 3] >> (i & 7));
+
+  for (i = 0;i < 256;++i)
+    if (r[i]) {
+      for (b = 1;b <= 6 && i + b < 256;++b) {
+        if (r[i + b]) {
+          if (r[i] + (r[i + b] << b) <= 15) {
+            r[i] += r[i + b] << b; r[i + b] = 0;
+          } else if (r[i] - (r[i + b] << b) >= -15) {
+            r[i] -= r[i + b] << b;
+            for (k = i + b;k < 256;++k) {
+              if (!r[k]) {
+                r[k] = 1;
+                break;
+              }
+              r[k] = 0;
+            }
+          } else
+            break;
+        }
+      }
+    }
+
+}
+
+static ge_precomp Bi[8] = {
+#include "base2.h"
+} ;
+
+/*
+r = b * B + a[0] * A[0] + ... + a[n-1] * A[n-1]
+where each a[j] is a 32 byte little endian scalar stored at a + 32 * j
+and b = b[0]+256*b[1]+...+256^31 b[31].
+B is the Ed25519 base point (x,4/5) with x positive.
+
+aslide must point to a workspace of at least 256 * n signed chars.
+Ai must point to a workspace of at least 8 * n cached points.
+All n points share a single chain of doublings (interleaved sliding windows).
+*/
+
+void ge_multi_scalarmult_vartime(
+    ge_p2 *r,
+    const unsigned char *b,
+    const unsigned char *a,
+    const ge_p3 *A,
+    size_t n,
+    signed char *aslide,
+    ge_cached *Ai)
+{
+  signed char bslide[256];
+  ge_p1p1 t;
+  ge_p3 u;
+  ge_p3 A2;
+  size_t j;
+  int k;
+  int i;
+
+  slide(bslide,b);
+
+  for (j = 0;j < n;++j) {
+    slide(aslide + 256 * j,a + 32 * j);
+
+    /* A,3A,5A,7A,9A,11A,13A,15A */
+    ge_p3_to_cached(&Ai[8 * j],&A[j]);
+    ge_p3_dbl(&t,&A[j]); ge_p1p1_to_p3(&A2,&t);
+    for (k = 1;k < 8;++k) {
+      ge_add(&t,&A2,&Ai[8 * j + k - 1]); ge_p1p1_to_p3(&u,&t); ge_p3_to_cached(&Ai[8 * j + k],&u);
+    }
+  }
+
+  ge_p2_0(r);
+
+  for (i = 255;i >= 0;--i) {
+    if (bslide[i]) break;
+    for (j = 0;j < n;++j)
+      if (aslide[256 * j + i]) break;
+    if (j < n) break;
+  }
+
+  for (;i >= 0;--i) {
+    ge_p2_dbl(&t,r);
+
+    for (j = 0;j < n;++j) {
+      signed char s = aslide[256 * j + i];
+      if (s > 0) {
+        ge_p1p1_to_p3(&u,&t);
+        ge_add(&t,&u,&Ai[8 * j + s/2]);
+      } else if (s < 0) {
+        ge_p1p1_to_p3(&u,&t);
+        ge_sub(&t,&u,&Ai[8 * j + (-s)/2]);
+      }
+    }
+
+    if (bslide[i] > 0) {
+      ge_p1p1_to_p3(&u,&t);
+      ge_madd(&t,&u,&Bi[bslide[i]/2]);
+    } else if (bslide[i] < 0) {
+      ge_p1p1_to_p3(&u,&t);
+      ge_msub(&t,&u,&Bi[(-bslide[i])/2]);
+    }
+
+    ge_p1p1_to_p2(r,&t);
+  }
+}
@@ -20,7 +20,7 @@
 
 #include "Validators.h"
 #include "catapult/cache_core/AccountStateCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyAddressCache.h"
 #include "catapult/validators/ValidatorContext.h"
 
 namespace catapult { namespace validators {
@@ -34,7 +34,7 @@ namespace catapult { namespace validators {
 
 			// if state could not be accessed by public key, try searching by address
 			if (!pAccountState)
-				pAccountState = cache.tryGet(model::PublicKeyToAddress(publicKey, cache.networkIdentifier()));
+				pAccountState = cache.tryGet(model::CachedPublicKeyToAddress(publicKey, cache.networkIdentifier()));
 
 			return pAccountState;
 		}
@@ -0,0 +1,66 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "HashCacheSerializers.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Timestamp_Size = sizeof(Timestamp);
+
+		void RequireSize(const RawBuffer& buffer, const char* message) {
+			if (sizeof(state::TimestampedHash) != buffer.Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1(message, buffer.Size);
+		}
+	}
+
+	HashCachePrimarySerializer::SerializedKeyType HashCachePrimarySerializer::SerializeKey(const KeyType& timestampedHash) {
+		SerializedKeyType key;
+		auto rawTimestamp = timestampedHash.Time.unwrap();
+		for (auto i = 0u; i < Timestamp_Size; ++i)
+			key[i] = static_cast<uint8_t>(rawTimestamp >> (8 * (Timestamp_Size - 1 - i)));
+
+		std::memcpy(key.data() + Timestamp_Size, timestampedHash.Hash.data(), timestampedHash.Hash.size());
+		return key;
+	}
+
+	HashCachePrimarySerializer::KeyType HashCachePrimarySerializer::DeserializeKey(const RawBuffer& buffer) {
+		RequireSize(buffer, "hash cache key has invalid size");
+
+		Timestamp::ValueType rawTimestamp = 0;
+		for (auto i = 0u; i < Timestamp_Size; ++i)
+			rawTimestamp = (rawTimestamp << 8) | buffer.pData[i];
+
+		auto timestampedHash = KeyType(Timestamp(rawTimestamp));
+		std::memcpy(timestampedHash.Hash.data(), buffer.pData + Timestamp_Size, timestampedHash.Hash.size());
+		return timestampedHash;
+	}
+
+	std::string HashCachePrimarySerializer::SerializeValue(const StorageType& element) {
+		return std::string(reinterpret_cast<const char*>(&element), sizeof(StorageType));
+	}
+
+	HashCachePrimarySerializer::ValueType HashCachePrimarySerializer::DeserializeValue(const RawBuffer& buffer) {
+		RequireSize(buffer, "hash cache value has invalid size");
+
+		return reinterpret_cast<const ValueType&>(*buffer.pData);
+	}
+}}
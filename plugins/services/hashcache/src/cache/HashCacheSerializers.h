@@ -0,0 +1,52 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/state/TimestampedHash.h"
+#include <array>
+#include <string>
+
+namespace catapult { namespace cache {
+
+	/// Serializer for hash cache primary (timestamped hash) data.
+	/// \note Keys are serialized with big endian timestamps, so serialized keys have the same (bytewise) order as keys.
+	struct HashCachePrimarySerializer {
+	public:
+		using KeyType = state::TimestampedHash;
+		using ValueType = state::TimestampedHash;
+		using StorageType = ValueType;
+
+		/// Serialized key type.
+		using SerializedKeyType = std::array<uint8_t, sizeof(state::TimestampedHash)>;
+
+	public:
+		/// Serializes \a timestampedHash to a key.
+		static SerializedKeyType SerializeKey(const KeyType& timestampedHash);
+
+		/// Deserializes a timestamped hash from key \a buffer.
+		static KeyType DeserializeKey(const RawBuffer& buffer);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes a timestamped hash from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+}}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "HashCacheSerializers.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/cache/SingleSetCacheTypesAdapter.h"
 #include "catapult/state/TimestampedHash.h"
@@ -54,6 +55,9 @@ namespace catapult { namespace cache {
 		using CacheDeltaType = HashCacheDelta;
 		using CacheViewType = HashCacheView;
 
+		// cache database serializer
+		using Serializer = HashCachePrimarySerializer;
+
 	public:
 		/// Gets the key corresponding to \a timestampedHash.
 		static const auto& GetKeyFromValue(const ValueType& timestampedHash) {
@@ -62,7 +66,11 @@ namespace catapult { namespace cache {
 	};
 
 	/// Hash cache types.
-	struct HashCacheTypes : public SingleSetCacheTypesAdapter<ImmutableOrderedSetAdapter<HashCacheDescriptor>, std::true_type> {
+	struct HashCacheTypes : public SingleSetCacheTypesAdapter<
+			ImmutableOrderedSetAdapter<HashCacheDescriptor, state::TimestampedHashHasher>,
+			std::true_type,
+			sizeof(state::TimestampedHash)
+	> {
 		using CacheReadOnlyType = ReadOnlySimpleCache<BasicHashCacheView, BasicHashCacheDelta, state::TimestampedHash>;
 
 		/// Custom sub view options.
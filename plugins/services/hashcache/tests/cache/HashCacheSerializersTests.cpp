@@ -0,0 +1,124 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/HashCacheSerializers.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS HashCacheSerializersTests
+
+	namespace {
+		state::TimestampedHash CreateTimestampedHash(Timestamp::ValueType rawTimestamp) {
+			return state::TimestampedHash(Timestamp(rawTimestamp), test::GenerateRandomData<Hash256_Size>());
+		}
+
+		RawBuffer ToBuffer(const HashCachePrimarySerializer::SerializedKeyType& key) {
+			return { key.data(), key.size() };
+		}
+	}
+
+	// region key
+
+	TEST(TEST_CLASS, KeyContainsBigEndianTimestampFollowedByHash) {
+		// Arrange:
+		auto timestampedHash = CreateTimestampedHash(0x0102030405060708);
+
+		// Act:
+		auto key = HashCachePrimarySerializer::SerializeKey(timestampedHash);
+
+		// Assert:
+		ASSERT_EQ(sizeof(Timestamp) + Cached_Hash_Size, key.size());
+		std::vector<uint8_t> expectedTimestamp{ 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+		EXPECT_EQ(expectedTimestamp, std::vector<uint8_t>(key.cbegin(), key.cbegin() + sizeof(Timestamp)));
+		EXPECT_EQ(timestampedHash.Hash, reinterpret_cast<const state::TimestampedHash::HashType&>(key[sizeof(Timestamp)]));
+	}
+
+	TEST(TEST_CLASS, KeyOrderMatchesTimestampedHashOrder) {
+		// Arrange: timestamps differ in both low and high bytes
+		std::vector<state::TimestampedHash> timestampedHashes{
+			CreateTimestampedHash(0x00FF),
+			CreateTimestampedHash(0x0100),
+			CreateTimestampedHash(0x0100),
+			CreateTimestampedHash(0x01000000'00000000)
+		};
+
+		// Act + Assert:
+		for (auto i = 0u; i < timestampedHashes.size(); ++i) {
+			for (auto j = 0u; j < timestampedHashes.size(); ++j) {
+				const auto& lhs = timestampedHashes[i];
+				const auto& rhs = timestampedHashes[j];
+				auto lhsKey = HashCachePrimarySerializer::SerializeKey(lhs);
+				auto rhsKey = HashCachePrimarySerializer::SerializeKey(rhs);
+				EXPECT_EQ(lhs < rhs, lhsKey < rhsKey) << "lhs " << lhs << ", rhs " << rhs;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripKey) {
+		// Arrange:
+		auto originalTimestampedHash = CreateTimestampedHash(0x0102030405060708);
+		auto key = HashCachePrimarySerializer::SerializeKey(originalTimestampedHash);
+
+		// Act:
+		auto timestampedHash = HashCachePrimarySerializer::DeserializeKey(ToBuffer(key));
+
+		// Assert:
+		EXPECT_EQ(originalTimestampedHash, timestampedHash);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeKeyWithInvalidSize) {
+		// Arrange:
+		auto key = HashCachePrimarySerializer::SerializeKey(CreateTimestampedHash(123));
+
+		// Act + Assert:
+		EXPECT_THROW(HashCachePrimarySerializer::DeserializeKey({ key.data(), key.size() - 1 }), catapult_runtime_error);
+		EXPECT_THROW(HashCachePrimarySerializer::DeserializeKey({ key.data(), 4 }), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region value
+
+	TEST(TEST_CLASS, CanRoundtripValue) {
+		// Arrange:
+		auto originalTimestampedHash = CreateTimestampedHash(0x0102030405060708);
+		auto value = HashCachePrimarySerializer::SerializeValue(originalTimestampedHash);
+
+		// Act:
+		auto timestampedHash = HashCachePrimarySerializer::DeserializeValue({ reinterpret_cast<const uint8_t*>(value.data()), value.size() });
+
+		// Assert:
+		EXPECT_EQ(sizeof(state::TimestampedHash), value.size());
+		EXPECT_EQ(originalTimestampedHash, timestampedHash);
+	}
+
+	TEST(TEST_CLASS, CannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		std::vector<uint8_t> buffer(sizeof(state::TimestampedHash) + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(HashCachePrimarySerializer::DeserializeValue({ buffer.data(), buffer.size() - 2 }), catapult_runtime_error);
+		EXPECT_THROW(HashCachePrimarySerializer::DeserializeValue({ buffer.data(), buffer.size() }), catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -62,7 +62,7 @@ namespace catapult { namespace cache {
 		struct BaseSets : public CacheDatabaseMixin {
 		public:
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default", "height_grouping" })
+					: CacheDatabaseMixin(config, { { "default" }, { "height_grouping" } })
 					, Primary(GetContainerMode(config), database(), 0)
 					, HeightGrouping(GetContainerMode(config), database(), 1)
 			{}
@@ -134,7 +134,7 @@ namespace catapult { namespace cache {
 		struct BaseSets : public CacheDatabaseMixin {
 		public:
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default", "namespace_grouping", "height_grouping" })
+					: CacheDatabaseMixin(config, { { "default" }, { "namespace_grouping" }, { "height_grouping" } })
 					, Primary(GetContainerMode(config), database(), 0)
 					, NamespaceGrouping(GetContainerMode(config), database(), 1)
 					, HeightGrouping(GetContainerMode(config), database(), 2)
@@ -0,0 +1,127 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NamespaceCacheSerializers.h"
+#include "NamespaceCacheStorage.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/StringOutputStream.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		template<typename TKey>
+		RawBuffer SerializeBaseValueKey(const TKey& key) {
+			return { reinterpret_cast<const uint8_t*>(&key), sizeof(TKey) };
+		}
+
+		void RequireEof(const io::BufferInputStreamAdapter& input, const char* message) {
+			if (!input.eof())
+				CATAPULT_THROW_RUNTIME_ERROR(message);
+		}
+	}
+
+	// region NamespacePrimarySerializer
+
+	RawBuffer NamespacePrimarySerializer::SerializeKey(const KeyType& id) {
+		return SerializeBaseValueKey(id);
+	}
+
+	std::string NamespacePrimarySerializer::SerializeValue(const StorageType& element) {
+		io::StringOutputStream output;
+		NamespaceCacheStorage::Save(element.second, output);
+		return output.str();
+	}
+
+	NamespacePrimarySerializer::ValueType NamespacePrimarySerializer::DeserializeValue(const RawBuffer& buffer) {
+		io::BufferInputStreamAdapter input(buffer);
+		auto history = NamespaceCacheStorage::Load(input);
+		RequireEof(input, "namespace history in cache database has trailing data");
+		return history;
+	}
+
+	// endregion
+
+	// region NamespaceFlatMapSerializer
+
+	RawBuffer NamespaceFlatMapSerializer::SerializeKey(const KeyType& id) {
+		return SerializeBaseValueKey(id);
+	}
+
+	std::string NamespaceFlatMapSerializer::SerializeValue(const StorageType& element) {
+		const auto& path = element.second.path();
+		io::StringOutputStream output(sizeof(uint8_t) + path.size() * sizeof(NamespaceId));
+		io::Write8(output, static_cast<uint8_t>(path.size()));
+		for (auto i = 0u; i < path.size(); ++i)
+			io::Write(output, path[i]);
+
+		return output.str();
+	}
+
+	NamespaceFlatMapSerializer::ValueType NamespaceFlatMapSerializer::DeserializeValue(const RawBuffer& buffer) {
+		io::BufferInputStreamAdapter input(buffer);
+		auto depth = io::Read8(input);
+		if (0 == depth || depth > Namespace_Max_Depth)
+			CATAPULT_THROW_RUNTIME_ERROR_1("namespace in cache database has invalid depth", static_cast<uint16_t>(depth));
+
+		state::Namespace::Path path;
+		for (auto i = 0u; i < depth; ++i)
+			path.push_back(io::Read<NamespaceId>(input));
+
+		RequireEof(input, "namespace in cache database has trailing data");
+		return state::Namespace(path);
+	}
+
+	// endregion
+
+	// region NamespaceHeightGroupingSerializer
+
+	RawBuffer NamespaceHeightGroupingSerializer::SerializeKey(const KeyType& height) {
+		return SerializeBaseValueKey(height);
+	}
+
+	std::string NamespaceHeightGroupingSerializer::SerializeValue(const StorageType& element) {
+		const auto& group = element.second;
+		io::StringOutputStream output(sizeof(Height) + sizeof(uint64_t) + group.size() * sizeof(NamespaceId));
+		io::Write(output, group.key());
+		io::Write64(output, group.size());
+		for (auto id : group.identifiers())
+			io::Write(output, id);
+
+		return output.str();
+	}
+
+	NamespaceHeightGroupingSerializer::ValueType NamespaceHeightGroupingSerializer::DeserializeValue(const RawBuffer& buffer) {
+		io::BufferInputStreamAdapter input(buffer);
+		ValueType group(io::Read<Height>(input));
+		auto numIds = io::Read64(input);
+		if (numIds > (buffer.Size - sizeof(Height) - sizeof(uint64_t)) / sizeof(NamespaceId))
+			CATAPULT_THROW_RUNTIME_ERROR_1("namespace height group in cache database has invalid size", numIds);
+
+		for (auto i = 0u; i < numIds; ++i)
+			group.add(io::Read<NamespaceId>(input));
+
+		RequireEof(input, "namespace height group in cache database has trailing data");
+		return group;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "src/state/Namespace.h"
+#include "src/state/RootNamespaceHistory.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/IdentifierGroup.h"
+#include <string>
+
+namespace catapult { namespace cache {
+
+	/// Serializer for namespace cache primary (root namespace id to root namespace history) data.
+	struct NamespacePrimarySerializer {
+	public:
+		using KeyType = NamespaceId;
+		using ValueType = state::RootNamespaceHistory;
+		using StorageType = std::pair<const KeyType, ValueType>;
+
+	public:
+		/// Serializes \a id to a key buffer.
+		static RawBuffer SerializeKey(const KeyType& id);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes a root namespace history from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+
+	/// Serializer for namespace cache flat map (namespace id to namespace) data.
+	struct NamespaceFlatMapSerializer {
+	public:
+		using KeyType = NamespaceId;
+		using ValueType = state::Namespace;
+		using StorageType = std::pair<const KeyType, ValueType>;
+
+	public:
+		/// Serializes \a id to a key buffer.
+		static RawBuffer SerializeKey(const KeyType& id);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes a namespace from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+
+	/// Serializer for namespace cache height grouping (height to root namespace ids) data.
+	struct NamespaceHeightGroupingSerializer {
+	public:
+		using KeyType = Height;
+		using ValueType = utils::IdentifierGroup<NamespaceId, Height, utils::BaseValueHasher<NamespaceId>>;
+		using StorageType = std::pair<const KeyType, ValueType>;
+
+	public:
+		/// Serializes \a height to a key buffer.
+		static RawBuffer SerializeKey(const KeyType& height);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes a group of root namespace ids from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+}}
@@ -45,7 +45,10 @@ namespace catapult { namespace cache {
 	}
 
 	void NamespaceCacheStorage::Save(const StorageType& element, io::OutputStream& output) {
-		const auto& history = element.second;
+		Save(element.second, output);
+	}
+
+	void NamespaceCacheStorage::Save(const state::RootNamespaceHistory& history, io::OutputStream& output) {
 		if (0 == history.historyDepth())
 			CATAPULT_THROW_RUNTIME_ERROR_1("cannot save empty namespace history", history.id());
 
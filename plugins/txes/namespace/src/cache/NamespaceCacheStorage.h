@@ -29,6 +29,9 @@ namespace catapult { namespace cache {
 		/// Saves \a element to \a output.
 		static void Save(const StorageType& element, io::OutputStream& output);
 
+		/// Saves \a history to \a output.
+		static void Save(const state::RootNamespaceHistory& history, io::OutputStream& output);
+
 		/// Loads a single value from \a input.
 		static state::RootNamespaceHistory Load(io::InputStream& input);
 
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "NamespaceCacheSerializers.h"
 #include "src/state/Namespace.h"
 #include "src/state/NamespaceEntry.h"
 #include "src/state/RootNamespaceHistory.h"
@@ -55,6 +56,9 @@ namespace catapult { namespace cache {
 		using CacheDeltaType = NamespaceCacheDelta;
 		using CacheViewType = NamespaceCacheView;
 
+		// cache database serializer
+		using Serializer = NamespacePrimarySerializer;
+
 	public:
 		/// Gets the key corresponding to \a history.
 		static auto GetKeyFromValue(const ValueType& history) {
@@ -79,6 +83,9 @@ namespace catapult { namespace cache {
 			using KeyType = NamespaceId;
 			using ValueType = state::Namespace;
 
+			// cache database serializer
+			using Serializer = NamespaceFlatMapSerializer;
+
 		public:
 			static auto GetKeyFromValue(const ValueType& ns) {
 				return ns.id();
@@ -90,6 +97,9 @@ namespace catapult { namespace cache {
 			using KeyType = Height;
 			using ValueType = utils::IdentifierGroup<NamespaceId, Height, utils::BaseValueHasher<NamespaceId>>;
 
+			// cache database serializer
+			using Serializer = NamespaceHeightGroupingSerializer;
+
 		public:
 			static auto GetKeyFromValue(const ValueType& heightNamespaces) {
 				return heightNamespaces.key();
@@ -115,7 +125,7 @@ namespace catapult { namespace cache {
 		struct BaseSets : public CacheDatabaseMixin {
 		public:
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default", "flat_map", "height_grouping" })
+					: CacheDatabaseMixin(config, { { "default" }, { "flat_map" }, { "height_grouping" } })
 					, Primary(GetContainerMode(config), database(), 0)
 					, FlatMap(GetContainerMode(config), database(), 1)
 					, HeightGrouping(GetContainerMode(config), database(), 2)
@@ -0,0 +1,233 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "src/cache/NamespaceCacheSerializers.h"
+#include "tests/test/NamespaceTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS NamespaceCacheSerializersTests
+
+	namespace {
+		RawBuffer ToBuffer(const std::string& value) {
+			return { reinterpret_cast<const uint8_t*>(value.data()), value.size() };
+		}
+
+		template<typename TSerializer>
+		void AssertKeyIsRawId(typename TSerializer::KeyType key) {
+			// Act:
+			auto buffer = TSerializer::SerializeKey(key);
+
+			// Assert:
+			EXPECT_EQ(reinterpret_cast<const uint8_t*>(&key), buffer.pData);
+			EXPECT_EQ(sizeof(key), buffer.Size);
+		}
+	}
+
+	// region NamespacePrimarySerializer
+
+	namespace {
+		state::RootNamespaceHistory CreateHistory(const Key& owner1, const Key& owner2) {
+			state::RootNamespaceHistory history(NamespaceId(123));
+			history.push_back(owner1, test::CreateLifetime(222, 333));
+			history.back().add(state::Namespace(test::CreatePath({ 123, 124 })));
+			history.back().add(state::Namespace(test::CreatePath({ 123, 124, 125 })));
+			history.push_back(owner1, test::CreateLifetime(333, 444));
+			history.push_back(owner2, test::CreateLifetime(444, 555));
+			history.back().add(state::Namespace(test::CreatePath({ 123, 126 })));
+			return history;
+		}
+
+		void AssertRootNamespace(
+				const state::RootNamespace& expectedRoot,
+				const state::RootNamespace& root,
+				const test::ChildNamespaces& expectedChildren) {
+			EXPECT_EQ(expectedRoot, root);
+			EXPECT_EQ(expectedRoot.lifetime().Start, root.lifetime().Start);
+			EXPECT_EQ(expectedRoot.lifetime().End, root.lifetime().End);
+			test::AssertChildren(expectedChildren, root.children());
+		}
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerKeyIsRootNamespaceId) {
+		// Assert:
+		AssertKeyIsRawId<NamespacePrimarySerializer>(NamespaceId(123));
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCanRoundtripHistory) {
+		// Arrange:
+		auto owner1 = test::CreateRandomOwner();
+		auto owner2 = test::CreateRandomOwner();
+		auto originalHistory = CreateHistory(owner1, owner2);
+		auto value = NamespacePrimarySerializer::SerializeValue(std::make_pair(NamespaceId(123), originalHistory));
+
+		// Act:
+		auto history = NamespacePrimarySerializer::DeserializeValue(ToBuffer(value));
+
+		// Assert:
+		EXPECT_EQ(NamespaceId(123), history.id());
+		ASSERT_EQ(3u, history.historyDepth());
+
+		auto expectedIter = originalHistory.begin();
+		auto iter = history.begin();
+		AssertRootNamespace(*expectedIter++, *iter++, test::CreateChildren({
+			test::CreatePath({ 123, 124 }),
+			test::CreatePath({ 123, 124, 125 })
+		}));
+		AssertRootNamespace(*expectedIter++, *iter++, test::CreateChildren({
+			test::CreatePath({ 123, 124 }),
+			test::CreatePath({ 123, 124, 125 })
+		}));
+		AssertRootNamespace(*expectedIter++, *iter++, test::CreateChildren({ test::CreatePath({ 123, 126 }) }));
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCannotSerializeEmptyHistory) {
+		// Arrange:
+		state::RootNamespaceHistory history(NamespaceId(123));
+
+		// Act + Assert:
+		EXPECT_THROW(NamespacePrimarySerializer::SerializeValue(std::make_pair(NamespaceId(123), history)), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		auto value = NamespacePrimarySerializer::SerializeValue(std::make_pair(
+				NamespaceId(123),
+				CreateHistory(test::CreateRandomOwner(), test::CreateRandomOwner())));
+
+		// Act + Assert:
+		auto pData = reinterpret_cast<const uint8_t*>(value.data());
+		EXPECT_THROW(NamespacePrimarySerializer::DeserializeValue({ pData, value.size() - 1 }), catapult_file_io_error);
+
+		value.push_back(0);
+		EXPECT_THROW(NamespacePrimarySerializer::DeserializeValue(ToBuffer(value)), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region NamespaceFlatMapSerializer
+
+	TEST(TEST_CLASS, FlatMapSerializerKeyIsNamespaceId) {
+		// Assert:
+		AssertKeyIsRawId<NamespaceFlatMapSerializer>(NamespaceId(124));
+	}
+
+	TEST(TEST_CLASS, FlatMapSerializerCanRoundtripNamespace) {
+		// Arrange:
+		state::Namespace originalNamespace(test::CreatePath({ 123, 124, 125 }));
+		auto value = NamespaceFlatMapSerializer::SerializeValue(std::make_pair(NamespaceId(125), originalNamespace));
+
+		// Act:
+		auto ns = NamespaceFlatMapSerializer::DeserializeValue(ToBuffer(value));
+
+		// Assert:
+		EXPECT_EQ(sizeof(uint8_t) + 3 * sizeof(NamespaceId), value.size());
+		EXPECT_EQ(originalNamespace, ns);
+		EXPECT_EQ(originalNamespace.path(), ns.path());
+	}
+
+	TEST(TEST_CLASS, FlatMapSerializerCannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		auto value = NamespaceFlatMapSerializer::SerializeValue(std::make_pair(
+				NamespaceId(124),
+				state::Namespace(test::CreatePath({ 123, 124 }))));
+
+		// Act + Assert:
+		auto pData = reinterpret_cast<const uint8_t*>(value.data());
+		EXPECT_THROW(NamespaceFlatMapSerializer::DeserializeValue({ pData, value.size() - 1 }), catapult_file_io_error);
+
+		value.push_back(0);
+		EXPECT_THROW(NamespaceFlatMapSerializer::DeserializeValue(ToBuffer(value)), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, FlatMapSerializerCannotDeserializeValueWithInvalidDepth) {
+		// Arrange:
+		std::vector<uint8_t> buffer((Namespace_Max_Depth + 1) * sizeof(NamespaceId) + 1);
+
+		// Act + Assert:
+		for (auto depth : std::initializer_list<size_t>{ 0, Namespace_Max_Depth + 1 }) {
+			buffer[0] = static_cast<uint8_t>(depth);
+			auto size = 1 + depth * sizeof(NamespaceId);
+			EXPECT_THROW(NamespaceFlatMapSerializer::DeserializeValue({ buffer.data(), size }), catapult_runtime_error) << depth;
+		}
+	}
+
+	// endregion
+
+	// region NamespaceHeightGroupingSerializer
+
+	namespace {
+		using HeightGroup = NamespaceHeightGroupingSerializer::ValueType;
+	}
+
+	TEST(TEST_CLASS, HeightGroupingSerializerKeyIsHeight) {
+		// Assert:
+		AssertKeyIsRawId<NamespaceHeightGroupingSerializer>(Height(987));
+	}
+
+	TEST(TEST_CLASS, HeightGroupingSerializerCanRoundtripGroup) {
+		// Arrange:
+		HeightGroup originalGroup(Height(987));
+		originalGroup.add(NamespaceId(123));
+		originalGroup.add(NamespaceId(246));
+		originalGroup.add(NamespaceId(369));
+		auto value = NamespaceHeightGroupingSerializer::SerializeValue(std::make_pair(Height(987), originalGroup));
+
+		// Act:
+		auto group = NamespaceHeightGroupingSerializer::DeserializeValue(ToBuffer(value));
+
+		// Assert:
+		EXPECT_EQ(sizeof(Height) + sizeof(uint64_t) + 3 * sizeof(NamespaceId), value.size());
+		EXPECT_EQ(Height(987), group.key());
+		EXPECT_EQ(originalGroup.identifiers(), group.identifiers());
+	}
+
+	TEST(TEST_CLASS, HeightGroupingSerializerCanRoundtripEmptyGroup) {
+		// Arrange:
+		auto value = NamespaceHeightGroupingSerializer::SerializeValue(std::make_pair(Height(987), HeightGroup(Height(987))));
+
+		// Act:
+		auto group = NamespaceHeightGroupingSerializer::DeserializeValue(ToBuffer(value));
+
+		// Assert:
+		EXPECT_EQ(sizeof(Height) + sizeof(uint64_t), value.size());
+		EXPECT_EQ(Height(987), group.key());
+		EXPECT_TRUE(group.empty());
+	}
+
+	TEST(TEST_CLASS, HeightGroupingSerializerCannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		HeightGroup originalGroup(Height(987));
+		originalGroup.add(NamespaceId(123));
+		originalGroup.add(NamespaceId(246));
+		auto value = NamespaceHeightGroupingSerializer::SerializeValue(std::make_pair(Height(987), originalGroup));
+
+		// Act + Assert:
+		auto pData = reinterpret_cast<const uint8_t*>(value.data());
+		EXPECT_THROW(NamespaceHeightGroupingSerializer::DeserializeValue({ pData, sizeof(Height) }), catapult_file_io_error);
+		EXPECT_THROW(NamespaceHeightGroupingSerializer::DeserializeValue({ pData, value.size() - 1 }), catapult_runtime_error);
+
+		value.push_back(0);
+		EXPECT_THROW(NamespaceHeightGroupingSerializer::DeserializeValue(ToBuffer(value)), catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -21,6 +21,7 @@
 #include "RemoteTransactionApi.h"
 #include "RemoteApiUtils.h"
 #include "RemoteRequestDispatcher.h"
+#include "SketchPackets.h"
 #include "catapult/ionet/PacketEntityUtils.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 
@@ -48,6 +49,51 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtByHashTraits : public RegistryDependentTraits<model::Transaction> {
+		public:
+			using ResultType = model::TransactionRange;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Transactions_By_Hash; }
+			static constexpr auto FriendlyName() { return "pull unconfirmed transactions by hash"; }
+
+			static auto CreateRequestPacketPayload(model::HashRange&& hashes) {
+				return ionet::PacketPayloadFactory::FromFixedSizeRange(PacketType(), std::move(hashes));
+			}
+
+		public:
+			using RegistryDependentTraits::RegistryDependentTraits;
+
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractEntitiesFromPacket<model::Transaction>(packet, *this);
+				return !result.empty() || sizeof(ionet::PacketHeader) == packet.Size;
+			}
+		};
+
+		struct UtSketchTraits {
+		public:
+			using ResultType = cache::UtSketchCellRange;
+			static constexpr auto PacketType() { return ionet::PacketType::Pull_Transactions_Sketch; }
+			static constexpr auto FriendlyName() { return "pull unconfirmed transactions sketch"; }
+
+			static auto CreateRequestPacketPayload(uint32_t numCells) {
+				auto pPacket = ionet::CreateSharedPacket<PullTransactionsSketchRequest>();
+				pPacket->NumCells = numCells;
+				return ionet::PacketPayload(pPacket);
+			}
+
+		public:
+			explicit UtSketchTraits(uint32_t numCells) : m_numCells(numCells)
+			{}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<cache::UtSketch::Cell>(packet);
+				return m_numCells == result.size();
+			}
+
+		private:
+			uint32_t m_numCells;
+		};
+
 		// endregion
 
 		class DefaultRemoteTransactionApi : public RemoteTransactionApi {
@@ -66,6 +112,14 @@ namespace catapult { namespace api {
 				return m_impl.dispatch(UtTraits(m_registry), std::move(knownShortHashes));
 			}
 
+			FutureType<UtByHashTraits> unconfirmedTransactionsByHash(model::HashRange&& hashes) const override {
+				return m_impl.dispatch(UtByHashTraits(m_registry), std::move(hashes));
+			}
+
+			FutureType<UtSketchTraits> unconfirmedTransactionsSketch(uint32_t numCells) const override {
+				return m_impl.dispatch(UtSketchTraits(numCells), numCells);
+			}
+
 		private:
 			const model::TransactionRegistry& m_registry;
 			mutable RemoteRequestDispatcher m_impl;
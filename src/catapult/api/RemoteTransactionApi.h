@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache/TransactionSketches.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/thread/Future.h"
 
@@ -34,6 +35,12 @@ namespace catapult { namespace api {
 	public:
 		/// Gets all unconfirmed transactions from the remote excluding those with hashes in \a knownShortHashes.
 		virtual thread::future<model::TransactionRange> unconfirmedTransactions(model::ShortHashRange&& knownShortHashes) const = 0;
+
+		/// Gets all unconfirmed transactions from the remote with hashes in \a hashes.
+		virtual thread::future<model::TransactionRange> unconfirmedTransactionsByHash(model::HashRange&& hashes) const = 0;
+
+		/// Gets the cells of a reconciliation sketch of all unconfirmed transactions from the remote with \a numCells cells.
+		virtual thread::future<cache::UtSketchCellRange> unconfirmedTransactionsSketch(uint32_t numCells) const = 0;
 	};
 
 	/// Creates a transaction api for interacting with a remote node with the specified \a io
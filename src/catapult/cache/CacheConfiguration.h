@@ -19,8 +19,12 @@
 **/
 
 #pragma once
+#include "catapult/cache_db/RocksDatabaseOptions.h"
+#include <memory>
 #include <string>
 
+namespace catapult { namespace cache { class RocksDatabase; } }
+
 namespace catapult { namespace cache {
 
 	/// Cache configuration.
@@ -30,10 +34,25 @@ namespace catapult { namespace cache {
 		CacheConfiguration() : ShouldUseCacheDatabase(false)
 		{}
 
-		/// Creates a cache configuration around \a databaseDirectory.
-		explicit CacheConfiguration(const std::string& databaseDirectory)
+		/// Creates a cache configuration around \a databaseDirectory and \a databaseOptions.
+		explicit CacheConfiguration(
+				const std::string& databaseDirectory,
+				const RocksDatabaseOptions& databaseOptions = RocksDatabaseOptions())
 				: ShouldUseCacheDatabase(true)
 				, CacheDatabaseDirectory(databaseDirectory)
+				, CacheDatabaseOptions(databaseOptions)
+		{}
+
+		/// Creates a cache configuration for a cache named \a name that stores its data in a shared database
+		/// (\a pSharedDatabase) using \a databaseOptions.
+		CacheConfiguration(
+				const std::shared_ptr<RocksDatabase>& pSharedDatabase,
+				const std::string& name,
+				const RocksDatabaseOptions& databaseOptions)
+				: ShouldUseCacheDatabase(true)
+				, CacheDatabaseOptions(databaseOptions)
+				, pSharedCacheDatabase(pSharedDatabase)
+				, SharedCacheDatabaseName(name)
 		{}
 
 	public:
@@ -42,5 +61,15 @@ namespace catapult { namespace cache {
 
 		/// Base directory to use for storing cache database.
 		std::string CacheDatabaseDirectory;
+
+		/// Cache database tuning options.
+		RocksDatabaseOptions CacheDatabaseOptions;
+
+		/// Database shared by all caches (optional).
+		/// \note When set, it is used instead of a dedicated database in CacheDatabaseDirectory.
+		std::shared_ptr<RocksDatabase> pSharedCacheDatabase;
+
+		/// Name of the cache within the shared database.
+		std::string SharedCacheDatabaseName;
 	};
 }}
@@ -28,11 +28,9 @@ namespace catapult { namespace cache {
 	/// Mixin that owns a cache database.
 	class CacheDatabaseMixin {
 	protected:
-		/// Creates a mixin around \a config and \a columnFamilyNames.
-		CacheDatabaseMixin(const CacheConfiguration& config, const std::vector<std::string>& columnFamilyNames)
-				: m_pDatabase(config.ShouldUseCacheDatabase
-						? std::make_unique<CacheDatabase>(config.CacheDatabaseDirectory, columnFamilyNames)
-						: std::make_unique<CacheDatabase>())
+		/// Creates a mixin around \a config and \a columnFamilies.
+		CacheDatabaseMixin(const CacheConfiguration& config, const std::vector<RdbColumnFamily>& columnFamilies)
+				: m_pDatabase(CreateDatabase(config, columnFamilies))
 		{}
 
 	protected:
@@ -49,6 +47,24 @@ namespace catapult { namespace cache {
 					: deltaset::ConditionalContainerMode::Memory;
 		}
 
+	private:
+		static std::unique_ptr<CacheDatabase> CreateDatabase(
+				const CacheConfiguration& config,
+				const std::vector<RdbColumnFamily>& columnFamilies) {
+			if (!config.ShouldUseCacheDatabase)
+				return std::make_unique<CacheDatabase>();
+
+			if (config.pSharedCacheDatabase) {
+				return std::make_unique<CacheDatabase>(
+						config.pSharedCacheDatabase,
+						config.SharedCacheDatabaseName,
+						columnFamilies,
+						config.CacheDatabaseOptions);
+			}
+
+			return std::make_unique<CacheDatabase>(config.CacheDatabaseDirectory, columnFamilies, config.CacheDatabaseOptions);
+		}
+
 	private:
 		std::unique_ptr<CacheDatabase> m_pDatabase;
 	};
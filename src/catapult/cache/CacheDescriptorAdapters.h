@@ -21,6 +21,7 @@
 #pragma once
 #include "CacheConfiguration.h"
 #include "catapult/cache_db/CacheDatabase.h"
+#include "catapult/cache_db/RdbCachedColumnContainer.h"
 #include "catapult/deltaset/BaseSet.h"
 #include "catapult/deltaset/ConditionalContainer.h"
 #include "catapult/deltaset/OrderedSet.h"
@@ -29,17 +30,75 @@
 namespace catapult { namespace cache {
 
 	namespace detail {
+		template<typename T>
+		struct VoidType {
+			using type = void;
+		};
+
+		/// If \a TDescriptor defines a serializer, this struct will provide the member constant value equal to \c true.
+		template<typename TDescriptor, typename = void>
+		struct HasSerializer : std::false_type
+		{};
+
+		template<typename TDescriptor>
+		struct HasSerializer<TDescriptor, typename VoidType<typename TDescriptor::Serializer>::type> : std::true_type
+		{};
+
+		/// Adapts a map cache descriptor (\a TDescriptor) to a column descriptor.
+		template<typename TDescriptor>
+		struct MapColumnDescriptor {
+		public:
+			using KeyType = typename TDescriptor::KeyType;
+			using ValueType = typename TDescriptor::ValueType;
+			using StorageType = std::pair<const KeyType, ValueType>;
+			using Serializer = typename TDescriptor::Serializer;
+
+		public:
+			static const KeyType& GetKeyFromElement(const StorageType& element) {
+				return element.first;
+			}
+
+			static auto GetKeyFromValue(const ValueType& value) {
+				return TDescriptor::GetKeyFromValue(value);
+			}
+		};
+
+		/// Adapts a set cache descriptor (\a TDescriptor) to a column descriptor.
+		template<typename TDescriptor>
+		struct SetColumnDescriptor {
+		public:
+			using KeyType = typename TDescriptor::KeyType;
+			using ValueType = typename TDescriptor::ValueType;
+			using StorageType = ValueType;
+			using Serializer = typename TDescriptor::Serializer;
+
+		public:
+			static auto GetKeyFromElement(const StorageType& element) {
+				return TDescriptor::GetKeyFromValue(element);
+			}
+
+			static auto GetKeyFromValue(const ValueType& value) {
+				return TDescriptor::GetKeyFromValue(value);
+			}
+		};
+
 		/// Defines cache types for an unordered map based cache.
 		template<typename TElementTraits, typename TDescriptor, typename TValueHasher>
 		struct UnorderedMapAdapter {
 		private:
-			// TODO: this is a placeholder for a rdb column adapter
-			class StorageMapType : public std::map<typename TDescriptor::KeyType, typename TDescriptor::ValueType> {
+			// descriptors without a serializer cannot be stored in a cache database, so they fall back to an in-memory map
+			class PlaceholderStorageMapType : public std::map<typename TDescriptor::KeyType, typename TDescriptor::ValueType> {
 			public:
-				StorageMapType(CacheDatabase&, size_t)
+				PlaceholderStorageMapType(CacheDatabase&, size_t)
 				{}
 			};
 
+			using StorageMapType = typename std::conditional<
+				HasSerializer<TDescriptor>::value,
+				RdbCachedColumnContainer<MapColumnDescriptor<TDescriptor>, TValueHasher>,
+				PlaceholderStorageMapType
+			>::type;
+
 			using MemoryMapType = std::unordered_map<typename TDescriptor::KeyType, typename TDescriptor::ValueType, TValueHasher>;
 
 			struct Converter {
@@ -79,6 +138,10 @@ namespace catapult { namespace cache {
 		TDescriptor,
 		TValueHasher>;
 
+	/// Defines cache types for an unordered map based cache with custom element traits (\a TElementTraits).
+	template<typename TElementTraits, typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
+	using CustomUnorderedMapAdapter = detail::UnorderedMapAdapter<TElementTraits, TDescriptor, TValueHasher>;
+
 	/// Defines cache types for an unordered immutable map based cache.
 	template<typename TDescriptor, typename TValueHasher = std::hash<typename TDescriptor::KeyType>>
 	using ImmutableUnorderedMapAdapter = detail::UnorderedMapAdapter<
@@ -88,18 +151,25 @@ namespace catapult { namespace cache {
 
 	namespace detail {
 		/// Defines cache types for an ordered set based cache.
-		template<typename TElementTraits>
+		template<typename TElementTraits, typename TDescriptor, typename TKeyHasher>
 		struct OrderedSetAdapter {
 		private:
 			using ElementType = typename std::remove_const<typename TElementTraits::ElementType>::type;
 
-			// TODO: this is a placeholder for a rdb column adapter
-			class StorageSetType : public deltaset::detail::OrderedSetType<TElementTraits> {
+			// descriptors without a serializer cannot be stored in a cache database, so they fall back to an in-memory set
+			class PlaceholderStorageSetType : public deltaset::detail::OrderedSetType<TElementTraits> {
 			public:
-				StorageSetType(CacheDatabase&, size_t)
+				PlaceholderStorageSetType(CacheDatabase&, size_t)
 				{}
 			};
 
+			// serialized keys must preserve key order because pruning removes all keys below the pruning boundary
+			using StorageSetType = typename std::conditional<
+				HasSerializer<TDescriptor>::value,
+				RdbCachedColumnContainer<SetColumnDescriptor<TDescriptor>, TKeyHasher>,
+				PlaceholderStorageSetType
+			>::type;
+
 			using MemorySetType = std::set<ElementType>;
 
 			// workaround for VS truncation
@@ -128,10 +198,16 @@ namespace catapult { namespace cache {
 	}
 
 	/// Defines cache types for an ordered mutable set based cache.
-	template<typename TDescriptor>
-	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::MutableTypeTraits<typename TDescriptor::ValueType>>;
+	template<typename TDescriptor, typename TKeyHasher = std::hash<typename TDescriptor::KeyType>>
+	using MutableOrderedSetAdapter = detail::OrderedSetAdapter<
+		deltaset::MutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		TKeyHasher>;
 
 	/// Defines cache types for an ordered immutable set based cache.
-	template<typename TDescriptor>
-	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>>;
+	template<typename TDescriptor, typename TKeyHasher = std::hash<typename TDescriptor::KeyType>>
+	using ImmutableOrderedSetAdapter = detail::OrderedSetAdapter<
+		deltaset::ImmutableTypeTraits<typename TDescriptor::ValueType>,
+		TDescriptor,
+		TKeyHasher>;
 }}
@@ -23,6 +23,7 @@
 #include "CatapultCacheDetachedDelta.h"
 #include "ReadOnlyCatapultCache.h"
 #include "SubCachePluginAdapter.h"
+#include "catapult/cache_db/RocksDatabase.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/NetworkInfo.h"
 
@@ -161,8 +162,15 @@ namespace catapult { namespace cache {
 	}
 
 	CatapultCache::CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches)
+			: CatapultCache(std::move(subCaches), nullptr)
+	{}
+
+	CatapultCache::CatapultCache(
+			std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches,
+			const std::shared_ptr<RocksDatabase>& pDatabase)
 			: m_pCacheHeight(std::make_unique<CacheHeight>())
 			, m_subCaches(std::move(subCaches))
+			, m_pDatabase(pDatabase)
 	{}
 
 	CatapultCache::~CatapultCache() = default;
@@ -198,11 +206,18 @@ namespace catapult { namespace cache {
 		// use the height writer lock to lock the entire cache during commit
 		auto cacheHeightModifier = m_pCacheHeight->modifier();
 
+		// collect the changes of all subcaches so that the database is never left in between blocks
+		if (m_pDatabase)
+			m_pDatabase->startPendingBatch();
+
 		for (const auto& pSubCache : m_subCaches) {
 			if (pSubCache)
 				pSubCache->commit();
 		}
 
+		if (m_pDatabase)
+			m_pDatabase->writePendingBatch();
+
 		// finally, update the cache height
 		cacheHeightModifier.set(height);
 	}
@@ -28,6 +28,7 @@ namespace catapult {
 	namespace cache {
 		class CacheHeight;
 		class CacheStorage;
+		class RocksDatabase;
 		class SubCachePlugin;
 	}
 	namespace model { struct BlockChainConfiguration; }
@@ -41,6 +42,9 @@ namespace catapult { namespace cache {
 		/// Creates a catapult cache around \a subCaches.
 		explicit CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches);
 
+		/// Creates a catapult cache around \a subCaches that share a database (\a pDatabase).
+		CatapultCache(std::vector<std::unique_ptr<SubCachePlugin>>&& subCaches, const std::shared_ptr<RocksDatabase>& pDatabase);
+
 		/// Destroys the cache.
 		~CatapultCache();
 
@@ -69,6 +73,7 @@ namespace catapult { namespace cache {
 		CatapultCacheDetachableDelta createDetachableDelta() const;
 
 		/// Commits all pending changes to the underlying storage and sets the cache height to \a height.
+		/// \note When subcaches share a database, all of their changes are written with a single batch.
 		void commit(Height height);
 
 	public:
@@ -81,5 +86,6 @@ namespace catapult { namespace cache {
 	private:
 		std::unique_ptr<CacheHeight> m_pCacheHeight; // use a unique_ptr to allow fwd declare
 		std::vector<std::unique_ptr<SubCachePlugin>> m_subCaches;
+		std::shared_ptr<RocksDatabase> m_pDatabase;
 	};
 }}
@@ -41,8 +41,13 @@ namespace catapult { namespace cache {
 
 		/// Builds a catapult cache.
 		CatapultCache build() {
+			return build(nullptr);
+		}
+
+		/// Builds a catapult cache with subcaches sharing a database (\a pDatabase).
+		CatapultCache build(const std::shared_ptr<RocksDatabase>& pDatabase) {
 			CATAPULT_LOG(debug) << "creating CatapultCache with " << m_subCaches.size() << " subcaches";
-			return CatapultCache(std::move(m_subCaches));
+			return CatapultCache(std::move(m_subCaches), pDatabase);
 		}
 
 	private:
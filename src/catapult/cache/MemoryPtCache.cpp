@@ -55,6 +55,10 @@ namespace catapult { namespace cache {
 			return m_cosignaturesHash;
 		}
 
+		PtSketchKey sketchKey() const {
+			return { entityHash(), utils::ToShortHash(m_cosignaturesHash) };
+		}
+
 		model::WeakCosignedTransactionInfo weakCosignedTransactionInfo() const {
 			return { transaction().get(), &m_cosignatures };
 		}
@@ -93,9 +97,11 @@ namespace catapult { namespace cache {
 	MemoryPtCacheView::MemoryPtCacheView(
 			uint64_t maxResponseSize,
 			const PtDataContainer& transactionDataContainer,
+			const PtSketch& sketch,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
+			, m_sketch(sketch)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -156,6 +162,34 @@ namespace catapult { namespace cache {
 		return unknownTransactionInfos;
 	}
 
+	MemoryPtCacheView::UnknownTransactionInfos MemoryPtCacheView::transactionInfos(const utils::HashSet& hashes) const {
+		uint64_t totalSize = 0;
+		UnknownTransactionInfos transactionInfos;
+		for (const auto& hash : hashes) {
+			auto iter = m_transactionDataContainer.find(hash);
+			if (m_transactionDataContainer.cend() == iter)
+				continue;
+
+			const auto& data = iter->second;
+			auto pTransaction = data.transaction();
+			totalSize += sizeof(Hash256) + sizeof(model::Cosignature) * data.cosignatures().size() + pTransaction->Size;
+			if (totalSize > m_maxResponseSize)
+				break;
+
+			model::CosignedTransactionInfo transactionInfo;
+			transactionInfo.EntityHash = data.entityHash();
+			transactionInfo.pTransaction = pTransaction;
+			transactionInfo.Cosignatures = data.cosignatures();
+			transactionInfos.push_back(transactionInfo);
+		}
+
+		return transactionInfos;
+	}
+
+	PtSketch MemoryPtCacheView::sketch(uint32_t numCells) const {
+		return m_sketch.fold(numCells);
+	}
+
 	// endregion
 
 	// region MemoryPtCacheModifier
@@ -171,10 +205,12 @@ namespace catapult { namespace cache {
 					uint64_t maxCacheSize,
 					PtDataContainer& transactionDataContainer,
 					std::set<state::TimestampedHash>& timestampedHashes,
+					PtSketch& sketch,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_timestampedHashes(timestampedHashes)
+					, m_sketch(sketch)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
 			{}
@@ -192,17 +228,26 @@ namespace catapult { namespace cache {
 				if (m_transactionDataContainer.cend() != iter)
 					return false;
 
-				m_transactionDataContainer.emplace(transactionInfo.EntityHash, PtData(transactionInfo));
+				auto& data = m_transactionDataContainer.emplace(transactionInfo.EntityHash, PtData(transactionInfo)).first->second;
 				m_timestampedHashes.emplace(transactionInfo.pEntity->Deadline, transactionInfo.EntityHash);
+				m_sketch.insert(data.sketchKey());
 				LogSizes("partial transactions", m_transactionDataContainer.size(), m_maxCacheSize);
 				return true;
 			}
 
 			model::DetachedTransactionInfo add(const Hash256& parentHash, const Key& signer, const Signature& signature) override {
 				auto iter = m_transactionDataContainer.find(parentHash);
-				return m_transactionDataContainer.cend() == iter || !iter->second.add(signer, signature)
-						? model::DetachedTransactionInfo()
-						: ToTransactionInfo(*iter);
+				if (m_transactionDataContainer.cend() == iter)
+					return model::DetachedTransactionInfo();
+
+				auto& data = iter->second;
+				auto previousSketchKey = data.sketchKey();
+				if (!data.add(signer, signature))
+					return model::DetachedTransactionInfo();
+
+				m_sketch.erase(previousSketchKey);
+				m_sketch.insert(data.sketchKey());
+				return ToTransactionInfo(*iter);
 			}
 
 			model::DetachedTransactionInfo remove(const Hash256& hash) override {
@@ -248,6 +293,7 @@ namespace catapult { namespace cache {
 		private:
 			void remove(PtDataContainer::iterator iter) {
 				m_timestampedHashes.erase(iter->second.timestampedHash());
+				m_sketch.erase(iter->second.sketchKey());
 				m_transactionDataContainer.erase(iter);
 			}
 
@@ -255,6 +301,7 @@ namespace catapult { namespace cache {
 			uint64_t m_maxCacheSize;
 			PtDataContainer& m_transactionDataContainer;
 			std::set<state::TimestampedHash>& m_timestampedHashes;
+			PtSketch& m_sketch;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -267,6 +314,7 @@ namespace catapult { namespace cache {
 	struct MemoryPtCache::Impl {
 		PtDataContainer TransactionDataContainer;
 		std::set<state::TimestampedHash> TimestampedHashes;
+		PtSketch Sketch = PtSketch(Max_Sketch_Num_Cells);
 	};
 
 	MemoryPtCache::MemoryPtCache(const MemoryCacheOptions& options)
@@ -277,7 +325,7 @@ namespace catapult { namespace cache {
 	MemoryPtCache::~MemoryPtCache() = default;
 
 	MemoryPtCacheView MemoryPtCache::view() const {
-		return MemoryPtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_lock.acquireReader());
+		return MemoryPtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->Sketch, m_lock.acquireReader());
 	}
 
 	PtCacheModifierProxy MemoryPtCache::modifier() {
@@ -285,6 +333,7 @@ namespace catapult { namespace cache {
 				m_options.MaxCacheSize,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->TimestampedHashes,
+				m_pImpl->Sketch,
 				m_lock.acquireReader()));
 	}
 
@@ -23,8 +23,10 @@
 #include "MemoryCacheProxy.h"
 #include "PtCache.h"
 #include "ShortHashPair.h"
+#include "TransactionSketches.h"
 #include "catapult/model/CosignedTransactionInfo.h"
 #include "catapult/model/WeakCosignedTransactionInfo.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 #include <unordered_map>
@@ -42,10 +44,11 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around around a maximum response size (\a maxResponseSize), a partial transaction data container
-		/// (\a transactionDataContainer) with lock context \a readLock.
+		/// (\a transactionDataContainer) and a sketch of all partial transactions (\a sketch) with lock context \a readLock.
 		explicit MemoryPtCacheView(
 				uint64_t maxResponseSize,
 				const PtDataContainer& transactionDataContainer,
+				const PtSketch& sketch,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -62,9 +65,17 @@ namespace catapult { namespace cache {
 		/// Gets a vector of all unknown transaction infos in the cache that do not have a short hash pair in \a knownShortHashPairs.
 		UnknownTransactionInfos unknownTransactions(const ShortHashPairMap& knownShortHashPairs) const;
 
+		/// Gets a vector of all transaction infos (including transactions) in the cache that have a hash in \a hashes.
+		UnknownTransactionInfos transactionInfos(const utils::HashSet& hashes) const;
+
+		/// Gets a reconciliation sketch of all partial transactions in the cache with \a numCells cells.
+		/// \note \a numCells must be a valid number of cells that is not greater than Max_Sketch_Num_Cells.
+		PtSketch sketch(uint32_t numCells) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const PtDataContainer& m_transactionDataContainer;
+		const PtSketch& m_sketch;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
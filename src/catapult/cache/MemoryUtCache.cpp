@@ -22,6 +22,7 @@
 #include "AccountCounters.h"
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
+#include <boost/multiprecision/cpp_int.hpp>
 
 namespace catapult { namespace cache {
 
@@ -46,16 +47,44 @@ namespace catapult { namespace cache {
 		size_t Id;
 	};
 
+	namespace {
+		struct FeePerByteComparer {
+		public:
+			bool operator()(const TransactionData* pLhs, const TransactionData* pRhs) const {
+				// compare fees per byte without division by cross multiplying fees and sizes
+				auto lhsWeightedFee = WeightedFee(*pLhs, *pRhs);
+				auto rhsWeightedFee = WeightedFee(*pRhs, *pLhs);
+				if (lhsWeightedFee != rhsWeightedFee)
+					return lhsWeightedFee > rhsWeightedFee;
+
+				return pLhs->Id < pRhs->Id;
+			}
+
+		private:
+			static boost::multiprecision::uint128_t WeightedFee(const TransactionData& data, const TransactionData& otherData) {
+				return boost::multiprecision::uint128_t(data.pEntity->Fee.unwrap()) * otherData.pEntity->Size;
+			}
+		};
+	}
+
+	/// Index of unconfirmed transactions ordered by decreasing fee per byte.
+	/// \note This allows the best paying transactions to be selected without scanning or sorting all transactions.
+	struct TransactionFeeIndex : public std::set<const TransactionData*, FeePerByteComparer> {};
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
 			uint64_t maxResponseSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
+			const TransactionFeeIndex& feeIndex,
+			const UtSketch& sketch,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_feeIndex(feeIndex)
+			, m_sketch(sketch)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -74,6 +103,13 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void MemoryUtCacheView::forEachByFee(const TransactionInfoConsumer& consumer) const {
+		for (const auto* pData : m_feeIndex) {
+			if (!consumer(*pData))
+				return;
+		}
+	}
+
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
 		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
 		auto shortHashesIter = shortHashes.begin();
@@ -102,6 +138,29 @@ namespace catapult { namespace cache {
 		return transactions;
 	}
 
+	MemoryUtCacheView::UnknownTransactions MemoryUtCacheView::transactions(const utils::HashSet& hashes) const {
+		uint64_t totalSize = 0;
+		UnknownTransactions transactions;
+		for (const auto& hash : hashes) {
+			auto idIter = m_idLookup.find(hash);
+			if (m_idLookup.cend() == idIter)
+				continue;
+
+			const auto& pTransaction = m_transactionDataContainer.find(TransactionData(idIter->second))->pEntity;
+			totalSize += pTransaction->Size;
+			if (totalSize > m_maxResponseSize)
+				break;
+
+			transactions.push_back(pTransaction);
+		}
+
+		return transactions;
+	}
+
+	UtSketch MemoryUtCacheView::sketch(uint32_t numCells) const {
+		return m_sketch.fold(numCells);
+	}
+
 	// endregion
 
 	// region MemoryUtCacheModifier
@@ -117,13 +176,17 @@ namespace catapult { namespace cache {
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
+					TransactionFeeIndex& feeIndex,
 					AccountCounters& counters,
+					UtSketch& sketch,
 					utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 					: m_maxCacheSize(maxCacheSize)
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
+					, m_feeIndex(feeIndex)
 					, m_counters(counters)
+					, m_sketch(sketch)
 					, m_readLock(std::move(readLock))
 					, m_writeLock(m_readLock.promoteToWriter())
 			{}
@@ -141,9 +204,11 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_feeIndex.insert(&*dataIter);
 
 				m_counters.increment(transactionInfo.pEntity->Signer);
+				m_sketch.insert(transactionInfo.EntityHash);
 
 				LogSizes("unconfirmed transactions", m_transactionDataContainer.size(), m_maxCacheSize);
 				return true;
@@ -158,7 +223,9 @@ namespace catapult { namespace cache {
 				auto erasedInfo = dataIter->copy();
 
 				m_counters.decrement(dataIter->pEntity->Signer);
+				m_sketch.erase(hash);
 
+				m_feeIndex.erase(&*dataIter);
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -179,9 +246,11 @@ namespace catapult { namespace cache {
 				for (const auto& data : m_transactionDataContainer)
 					transactionInfosCopy.emplace_back(data.copy());
 
+				m_feeIndex.clear();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
 				m_counters.reset();
+				m_sketch = UtSketch(m_sketch.numCells());
 				return transactionInfosCopy;
 			}
 
@@ -190,7 +259,9 @@ namespace catapult { namespace cache {
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
+			TransactionFeeIndex& m_feeIndex;
 			AccountCounters& m_counters;
+			UtSketch& m_sketch;
 			utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -203,7 +274,9 @@ namespace catapult { namespace cache {
 	struct MemoryUtCache::Impl {
 		cache::TransactionDataContainer TransactionDataContainer;
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		TransactionFeeIndex FeeIndex;
 		AccountCounters Counters;
+		UtSketch Sketch = UtSketch(Max_Sketch_Num_Cells);
 	};
 
 	MemoryUtCache::MemoryUtCache(const MemoryCacheOptions& options)
@@ -215,7 +288,13 @@ namespace catapult { namespace cache {
 	MemoryUtCache::~MemoryUtCache() = default;
 
 	MemoryUtCacheView MemoryUtCache::view() const {
-		return MemoryUtCacheView(m_options.MaxResponseSize, m_pImpl->TransactionDataContainer, m_pImpl->IdLookup, m_lock.acquireReader());
+		return MemoryUtCacheView(
+				m_options.MaxResponseSize,
+				m_pImpl->TransactionDataContainer,
+				m_pImpl->IdLookup,
+				m_pImpl->FeeIndex,
+				m_pImpl->Sketch,
+				m_lock.acquireReader());
 	}
 
 	UtCacheModifierProxy MemoryUtCache::modifier() {
@@ -224,7 +303,9 @@ namespace catapult { namespace cache {
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->FeeIndex,
 				m_pImpl->Counters,
+				m_pImpl->Sketch,
 				m_lock.acquireReader()));
 	}
 
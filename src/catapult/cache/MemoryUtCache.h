@@ -21,14 +21,21 @@
 #pragma once
 #include "MemoryCacheOptions.h"
 #include "MemoryCacheProxy.h"
+#include "TransactionSketches.h"
 #include "UtCache.h"
 #include "catapult/model/RangeTypes.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		struct TransactionData;
+		struct TransactionFeeIndex;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -45,11 +52,14 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), a transaction data container
-		/// (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// (\a transactionDataContainer), an id lookup (\a idLookup), a fee index (\a feeIndex) and a sketch of all
+		/// transactions (\a sketch) with lock context \a readLock.
 		explicit MemoryUtCacheView(
 				uint64_t maxResponseSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
+				const TransactionFeeIndex& feeIndex,
+				const UtSketch& sketch,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -62,6 +72,11 @@ namespace catapult { namespace cache {
 		/// Calls \a consumer with all transaction infos until all are consumed or \c false is returned by consumer.
 		void forEach(const TransactionInfoConsumer& consumer) const;
 
+		/// Calls \a consumer with all transaction infos ordered by decreasing fee per byte until all are consumed
+		/// or \c false is returned by consumer.
+		/// \note Transaction infos with equal fee per byte are ordered by arrival.
+		void forEachByFee(const TransactionInfoConsumer& consumer) const;
+
 		/// Gets a range of short hashes of all transactions in the cache.
 		/// A short hash consists of the first 4 bytes of the complete hash.
 		model::ShortHashRange shortHashes() const;
@@ -69,10 +84,19 @@ namespace catapult { namespace cache {
 		/// Gets a vector of all transactions in the cache that do not have a short hash in \a knownShortHashes.
 		UnknownTransactions unknownTransactions(const utils::ShortHashesSet& knownShortHashes) const;
 
+		/// Gets a vector of all transactions in the cache that have a hash in \a hashes.
+		UnknownTransactions transactions(const utils::HashSet& hashes) const;
+
+		/// Gets a reconciliation sketch of all transactions in the cache with \a numCells cells.
+		/// \note \a numCells must be a valid number of cells that is not greater than Max_Sketch_Num_Cells.
+		UtSketch sketch(uint32_t numCells) const;
+
 	private:
 		uint64_t m_maxResponseSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
+		const TransactionFeeIndex& m_feeIndex;
+		const UtSketch& m_sketch;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
@@ -26,7 +26,8 @@
 namespace catapult { namespace cache {
 
 	/// A cache types adapter for a cache composed of a single set.
-	template<typename TPrimaryTypes, typename IsOrderedFlag = std::false_type>
+	/// \note \a PrimaryKeySize is the size of all keys stored in the set or \c 0 if keys have variable sizes.
+	template<typename TPrimaryTypes, typename IsOrderedFlag = std::false_type, size_t PrimaryKeySize = 0>
 	struct SingleSetCacheTypesAdapter : public CacheDatabaseMixin {
 	public:
 		using PrimaryTypes = TPrimaryTypes;
@@ -46,7 +47,7 @@ namespace catapult { namespace cache {
 		public:
 			/// Creates base sets around \a config.
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default" })
+					: CacheDatabaseMixin(config, { { "default", PrimaryKeySize } })
 					, Primary(GetContainerMode(config), database(), 0)
 			{}
 
@@ -0,0 +1,58 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/EntityRange.h"
+#include "catapult/utils/InvertibleBloomLookupTable.h"
+#include "catapult/utils/ShortHash.h"
+
+namespace catapult { namespace cache {
+
+	/// Minimum number of cells in a requested transactions reconciliation sketch.
+	constexpr uint32_t Min_Sketch_Num_Cells = 3 * 64;
+
+	/// Maximum number of cells in a transactions reconciliation sketch.
+	constexpr uint32_t Max_Sketch_Num_Cells = 3 * 4096;
+
+	/// A reconciliation sketch of unconfirmed transactions composed of transaction hashes.
+	using UtSketch = utils::InvertibleBloomLookupTable<Hash256>;
+
+	/// An entity range composed of unconfirmed transactions sketch cells.
+	using UtSketchCellRange = model::EntityRange<UtSketch::Cell>;
+
+#pragma pack(push, 1)
+
+	/// A unique identifier for a partial transaction and its cosignatures.
+	struct PtSketchKey {
+		/// Transaction hash.
+		Hash256 TransactionHash;
+
+		/// Cosignatures short hash.
+		utils::ShortHash CosignaturesShortHash;
+	};
+
+#pragma pack(pop)
+
+	/// A reconciliation sketch of partial transactions composed of partial transaction keys.
+	using PtSketch = utils::InvertibleBloomLookupTable<PtSketchKey>;
+
+	/// An entity range composed of partial transactions sketch cells.
+	using PtSketchCellRange = model::EntityRange<PtSketch::Cell>;
+}}
@@ -19,7 +19,7 @@
 **/
 
 #include "AccountStateCacheDelta.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyAddressCache.h"
 #include "catapult/state/AccountStateAdapter.h"
 #include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
@@ -73,7 +73,7 @@ namespace catapult { namespace cache {
 		if (pPair)
 			return pPair->second;
 
-		auto address = model::PublicKeyToAddress(publicKey, m_options.NetworkIdentifier);
+		auto address = model::CachedPublicKeyToAddress(publicKey, m_options.NetworkIdentifier);
 		m_pKeyToAddress->emplace(publicKey, address);
 		return address;
 	}
@@ -83,7 +83,7 @@ namespace catapult { namespace cache {
 		if (pCurrentState)
 			return *pCurrentState;
 
-		auto pAccountState = std::make_shared<state::AccountState>(address, height);
+		auto pAccountState = state::MakeSharedAccountState(address, height);
 		m_pStateByAddress->insert(pAccountState);
 		return *pAccountState;
 	}
@@ -104,7 +104,7 @@ namespace catapult { namespace cache {
 		if (pCurrentState)
 			return *pCurrentState;
 
-		auto pAccountState = std::make_shared<state::AccountState>(state::ToAccountState(accountInfo));
+		auto pAccountState = state::MakeSharedAccountState(state::ToAccountState(accountInfo));
 		if (Height(0) != pAccountState->PublicKeyHeight)
 			m_pKeyToAddress->emplace(pAccountState->PublicKey, pAccountState->Address);
 
@@ -175,6 +175,20 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	void BasicAccountStateCacheDelta::prefetch(const model::AddressSet& addresses, const utils::KeySet& publicKeys) {
+		// 1. load key to address mappings so that the addresses of all public keys are known
+		m_pKeyToAddress->prefetch(std::vector<Key>(publicKeys.cbegin(), publicKeys.cend()));
+
+		// 2. load account states of all referenced accounts
+		std::vector<Address> allAddresses(addresses.cbegin(), addresses.cend());
+		for (const auto& publicKey : publicKeys) {
+			const auto* pPair = m_pKeyToAddress->find(publicKey);
+			allAddresses.push_back(pPair ? pPair->second : model::CachedPublicKeyToAddress(publicKey, m_options.NetworkIdentifier));
+		}
+
+		m_pStateByAddress->prefetch(allAddresses);
+	}
+
 	model::AddressSet BasicAccountStateCacheDelta::highValueAddresses() const {
 		// 1. copy original high value addresses
 		auto highValueAddresses = m_highValueAddresses;
@@ -24,6 +24,7 @@
 #include "catapult/cache/CacheMixinAliases.h"
 #include "catapult/cache/ReadOnlyViewSupplier.h"
 #include "catapult/model/ContainerTypes.h"
+#include "catapult/utils/ArraySet.h"
 
 namespace catapult { namespace model { struct AccountInfo; } }
 
@@ -128,6 +129,11 @@ namespace catapult { namespace cache {
 		/// Commits all queued removals.
 		void commitRemovals();
 
+	public:
+		/// Loads all accounts with \a addresses or \a publicKeys into memory using batched storage lookups.
+		/// \note This only has an effect when the cache is backed by a database.
+		void prefetch(const model::AddressSet& addresses, const utils::KeySet& publicKeys);
+
 	public:
 		/// Gets all high value addresses.
 		model::AddressSet highValueAddresses() const;
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AccountStateCacheSerializers.h"
+#include "catapult/state/AccountStateAdapter.h"
+#include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "catapult/exceptions.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+	// region AccountStatePrimarySerializer
+
+	RawBuffer AccountStatePrimarySerializer::SerializeKey(const KeyType& address) {
+		return { address.data(), address.size() };
+	}
+
+	std::string AccountStatePrimarySerializer::SerializeValue(const StorageType& element) {
+		auto pAccountInfo = state::ToAccountInfo(*element.second);
+		return std::string(reinterpret_cast<const char*>(pAccountInfo.get()), pAccountInfo->Size);
+	}
+
+	AccountStatePrimarySerializer::ValueType AccountStatePrimarySerializer::DeserializeValue(const RawBuffer& buffer) {
+		if (buffer.Size < sizeof(model::AccountInfo) || buffer.Size > model::AccountInfo_Max_Size)
+			CATAPULT_THROW_RUNTIME_ERROR_1("account in cache database has invalid size", buffer.Size);
+
+		// copy the data because the buffer is not guaranteed to be aligned
+		auto pAccountInfo = utils::MakeUniqueWithSize<model::AccountInfo>(buffer.Size);
+		std::memcpy(static_cast<void*>(pAccountInfo.get()), buffer.pData, buffer.Size);
+		if (buffer.Size != pAccountInfo->Size || buffer.Size != model::AccountInfo::CalculateRealSize(*pAccountInfo))
+			CATAPULT_THROW_RUNTIME_ERROR_1("account in cache database is corrupt", utils::HexFormat(pAccountInfo->Address));
+
+		return state::MakeSharedAccountState(state::ToAccountState(*pAccountInfo));
+	}
+
+	// endregion
+
+	// region AccountStateKeyLookupSerializer
+
+	RawBuffer AccountStateKeyLookupSerializer::SerializeKey(const KeyType& publicKey) {
+		return { publicKey.data(), publicKey.size() };
+	}
+
+	std::string AccountStateKeyLookupSerializer::SerializeValue(const StorageType& element) {
+		const auto& pair = element.second;
+		std::string value(Key_Size + Address_Decoded_Size, 0);
+		std::memcpy(&value[0], pair.first.data(), Key_Size);
+		std::memcpy(&value[Key_Size], pair.second.data(), Address_Decoded_Size);
+		return value;
+	}
+
+	AccountStateKeyLookupSerializer::ValueType AccountStateKeyLookupSerializer::DeserializeValue(const RawBuffer& buffer) {
+		if (Key_Size + Address_Decoded_Size != buffer.Size)
+			CATAPULT_THROW_RUNTIME_ERROR_1("key lookup in cache database has invalid size", buffer.Size);
+
+		ValueType pair;
+		std::memcpy(pair.first.data(), buffer.pData, Key_Size);
+		std::memcpy(pair.second.data(), buffer.pData + Key_Size, Address_Decoded_Size);
+		return pair;
+	}
+
+	// endregion
+}}
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/state/AccountState.h"
+#include <memory>
+#include <string>
+
+namespace catapult { namespace cache {
+
+	/// Serializer for account state cache primary (address to account state) data.
+	struct AccountStatePrimarySerializer {
+	public:
+		using KeyType = Address;
+		using ValueType = std::shared_ptr<state::AccountState>;
+		using StorageType = std::pair<const KeyType, ValueType>;
+
+	public:
+		/// Serializes \a address to a key buffer.
+		static RawBuffer SerializeKey(const KeyType& address);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes an account state from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+
+	/// Serializer for account state cache key lookup (public key to address) data.
+	struct AccountStateKeyLookupSerializer {
+	public:
+		using KeyType = Key;
+		using ValueType = std::pair<Key, Address>;
+		using StorageType = std::pair<const KeyType, ValueType>;
+
+	public:
+		/// Serializes \a publicKey to a key buffer.
+		static RawBuffer SerializeKey(const KeyType& publicKey);
+
+		/// Serializes \a element to a value string.
+		static std::string SerializeValue(const StorageType& element);
+
+		/// Deserializes a public key and address pair from \a buffer.
+		static ValueType DeserializeValue(const RawBuffer& buffer);
+	};
+}}
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "AccountStateCacheSerializers.h"
 #include "catapult/cache/CacheDatabaseMixin.h"
 #include "catapult/cache/CacheDescriptorAdapters.h"
 #include "catapult/deltaset/BaseSetDelta.h"
@@ -55,6 +56,9 @@ namespace catapult { namespace cache {
 		using CacheDeltaType = AccountStateCacheDelta;
 		using CacheViewType = AccountStateCacheView;
 
+		// cache database serializer
+		using Serializer = AccountStatePrimarySerializer;
+
 	public:
 		/// Gets the key corresponding to \a pAccountState.
 		static auto GetKeyFromValue(const ValueType& pAccountState) {
@@ -107,6 +111,9 @@ namespace catapult { namespace cache {
 			using KeyType = Key;
 			using ValueType = std::pair<Key, Address>;
 
+			// cache database serializer
+			using Serializer = AccountStateKeyLookupSerializer;
+
 		public:
 			static auto GetKeyFromValue(const ValueType& pair) {
 				return pair.first;
@@ -157,8 +164,16 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	private:
+		// account states are copied when they are first modified by a delta, so copies are allocated from a slab pool
+		struct PrimaryElementTraits : public deltaset::MutableTypeTraits<AccountStateCacheDescriptor::ValueType> {
+			static AccountStateCacheDescriptor::ValueType Copy(const std::shared_ptr<const state::AccountState>& pAccountState) {
+				return state::MakeSharedAccountState(*pAccountState);
+			}
+		};
+
 	public:
-		using PrimaryTypes = MutableUnorderedMapAdapter<AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
+		using PrimaryTypes = CustomUnorderedMapAdapter<PrimaryElementTraits, AccountStateCacheDescriptor, utils::ArrayHasher<Address>>;
 		using KeyLookupMapTypes = ImmutableUnorderedMapAdapter<KeyLookupMapTypesDescriptor, utils::ArrayHasher<Key>>;
 
 	public:
@@ -188,7 +203,7 @@ namespace catapult { namespace cache {
 		struct BaseSets : public CacheDatabaseMixin {
 		public:
 			explicit BaseSets(const CacheConfiguration& config)
-					: CacheDatabaseMixin(config, { "default", "key_lookup" })
+					: CacheDatabaseMixin(config, { { "default", Address_Decoded_Size }, { "key_lookup", Key_Size } })
 					, Primary(GetContainerMode(config), database(), 0)
 					, KeyLookupMap(GetContainerMode(config), database(), 1)
 			{}
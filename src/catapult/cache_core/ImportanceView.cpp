@@ -20,7 +20,7 @@
 
 #include "ImportanceView.h"
 #include "AccountStateCache.h"
-#include "catapult/model/Address.h"
+#include "catapult/model/PublicKeyAddressCache.h"
 
 namespace catapult { namespace cache {
 
@@ -30,7 +30,7 @@ namespace catapult { namespace cache {
 
 			// if state could not be accessed by public key, try searching by address
 			if (!pAccountState)
-				pAccountState = cache.tryGet(model::PublicKeyToAddress(publicKey, cache.networkIdentifier()));
+				pAccountState = cache.tryGet(model::CachedPublicKeyToAddress(publicKey, cache.networkIdentifier()));
 
 			auto importanceHeight = model::ConvertToImportanceHeight(height, cache.importanceGrouping());
 			if (!pAccountState || importanceHeight != pAccountState->ImportanceInfo.height())
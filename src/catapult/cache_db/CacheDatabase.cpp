@@ -0,0 +1,109 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "CacheDatabase.h"
+#include "RocksDatabase.h"
+#include "RocksInclude.h"
+#include "catapult/exceptions.h"
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Default_Column_Family_Name = "default";
+
+		std::vector<RdbColumnFamily> RemoveDefaultColumnFamily(const std::vector<RdbColumnFamily>& columnFamilies) {
+			// the default column is always created by RocksDatabase, so it must not be added again
+			std::vector<RdbColumnFamily> nonDefaultColumnFamilies;
+			for (const auto& columnFamily : columnFamilies) {
+				if (Default_Column_Family_Name != columnFamily.Name)
+					nonDefaultColumnFamilies.push_back(columnFamily);
+			}
+
+			return nonDefaultColumnFamilies;
+		}
+
+		std::vector<size_t> CreateColumnIds(size_t numColumns) {
+			std::vector<size_t> columnIds;
+			for (auto i = 0u; i < numColumns; ++i)
+				columnIds.push_back(i);
+
+			return columnIds;
+		}
+
+		std::vector<size_t> AddColumnFamilies(
+				RocksDatabase& database,
+				const std::string& name,
+				const std::vector<RdbColumnFamily>& columnFamilies) {
+			// all columns, including default, need a dedicated column family because other caches share the database
+			std::vector<size_t> columnIds;
+			for (auto columnFamily : columnFamilies) {
+				columnFamily.Name = name + ":" + columnFamily.Name;
+				columnIds.push_back(database.addColumnFamily(columnFamily));
+			}
+
+			return columnIds;
+		}
+	}
+
+	CacheDatabase::CacheDatabase() = default;
+
+	CacheDatabase::CacheDatabase(
+			const std::string& dbDir,
+			const std::vector<RdbColumnFamily>& columnFamilies,
+			const RocksDatabaseOptions& options)
+			: m_options(options)
+			, m_pDatabase(std::make_shared<RocksDatabase>(dbDir, RemoveDefaultColumnFamily(columnFamilies), options))
+			, m_columnIds(CreateColumnIds(columnFamilies.size()))
+	{}
+
+	CacheDatabase::CacheDatabase(
+			const std::shared_ptr<RocksDatabase>& pDatabase,
+			const std::string& name,
+			const std::vector<RdbColumnFamily>& columnFamilies,
+			const RocksDatabaseOptions& options)
+			: m_options(options)
+			, m_pDatabase(pDatabase)
+			, m_columnIds(AddColumnFamilies(*m_pDatabase, name, columnFamilies))
+	{}
+
+	CacheDatabase::~CacheDatabase() = default;
+
+	const RocksDatabaseOptions& CacheDatabase::options() const {
+		return m_options;
+	}
+
+	bool CacheDatabase::hasDatabase() const {
+		return !!m_pDatabase;
+	}
+
+	RocksDatabase& CacheDatabase::database() {
+		if (!m_pDatabase)
+			CATAPULT_THROW_INVALID_ARGUMENT("cache database is not backed by a RocksDb database");
+
+		return *m_pDatabase;
+	}
+
+	size_t CacheDatabase::columnId(size_t columnIndex) const {
+		if (columnIndex >= m_columnIds.size())
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cache database does not have column", columnIndex);
+
+		return m_columnIds[columnIndex];
+	}
+}}
@@ -19,17 +19,57 @@
 **/
 
 #pragma once
+#include "RocksDatabaseOptions.h"
+#include <memory>
 #include <string>
 #include <vector>
 
+namespace catapult { namespace cache { class RocksDatabase; } }
+
 namespace catapult { namespace cache {
 
-	// TODO: this is a placeholder/alias for RocksDatabase
+	/// Cache database that is optionally backed by a RocksDb database.
+	/// \note The RocksDb database can be shared by multiple cache databases so that all of their changes can be written
+	///       with a single batch.
 	class CacheDatabase {
 	public:
-		CacheDatabase() = default;
+		/// Creates a cache database that is not backed by a RocksDb database.
+		CacheDatabase();
+
+		/// Creates a cache database backed by a RocksDb database in \a dbDir with columns \a columnFamilies
+		/// tuned according to \a options.
+		/// \note The 'default' column always uses the default column tuning.
+		CacheDatabase(const std::string& dbDir, const std::vector<RdbColumnFamily>& columnFamilies, const RocksDatabaseOptions& options);
+
+		/// Creates a cache database named \a name backed by a shared RocksDb database (\a pDatabase) with columns
+		/// \a columnFamilies using \a options.
+		/// \note All columns are added to \a pDatabase and their names are prefixed with \a name.
+		CacheDatabase(
+				const std::shared_ptr<RocksDatabase>& pDatabase,
+				const std::string& name,
+				const std::vector<RdbColumnFamily>& columnFamilies,
+				const RocksDatabaseOptions& options);
+
+		/// Destroys the cache database.
+		~CacheDatabase();
+
+	public:
+		/// Gets the database options.
+		const RocksDatabaseOptions& options() const;
+
+		/// Returns \c true if this cache database is backed by a RocksDb database.
+		bool hasDatabase() const;
+
+		/// Gets the underlying RocksDb database.
+		/// \throws catapult_invalid_argument if this cache database is not backed by a RocksDb database.
+		RocksDatabase& database();
+
+		/// Gets the id of the underlying RocksDb column corresponding to the cache column with index \a columnIndex.
+		size_t columnId(size_t columnIndex) const;
 
-		CacheDatabase(const std::string&, const std::vector<std::string>&)
-		{}
+	private:
+		RocksDatabaseOptions m_options;
+		std::shared_ptr<RocksDatabase> m_pDatabase;
+		std::vector<size_t> m_columnIds;
 	};
 }}
@@ -0,0 +1,303 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "CacheDatabase.h"
+#include "RdbTypedColumnContainer.h"
+#include "UpdateSet.h"
+#include "catapult/deltaset/DeltaElements.h"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace catapult { namespace cache {
+
+	/// Typed container adapter that wraps column and keeps recently used entries in memory.
+	/// \note Entries found in between commits are always retained until the next commit, so pointers to found elements
+	///       remain valid until then. On commit, the in-memory entries are trimmed to the configured maximum.
+	/// \note When the database is collecting a pending batch, changes are added to it and are served from memory
+	///       until the pending batch is written.
+	template<typename TDescriptor, typename TKeyHasher = std::hash<typename TDescriptor::KeyType>, typename TContainer = RdbColumnContainer>
+	class RdbCachedColumnContainer {
+	public:
+		using KeyType = typename TDescriptor::KeyType;
+		using ValueType = typename TDescriptor::ValueType;
+		using StorageType = typename TDescriptor::StorageType;
+		using value_type = StorageType;
+
+	private:
+		using TypedContainer = RdbTypedColumnContainer<TDescriptor, TContainer>;
+		using ElementPointer = std::shared_ptr<const StorageType>;
+
+		struct HotEntry {
+			ElementPointer pElement;
+			typename std::list<KeyType>::iterator UsageIter;
+		};
+
+	public:
+		/// Typed container iterator pointing to an in-memory entry.
+		class const_iterator {
+		public:
+			/// Creates an iterator that represents non-existing element.
+			const_iterator() = default;
+
+			/// Creates an iterator around \a pElement.
+			explicit const_iterator(const ElementPointer& pElement) : m_pElement(pElement)
+			{}
+
+		public:
+			/// Returns \c true if this iterator and \a rhs are equal.
+			bool operator==(const const_iterator& rhs) const {
+				return m_pElement == rhs.m_pElement;
+			}
+
+			/// Returns \c true if this iterator and \a rhs are not equal.
+			bool operator!=(const const_iterator& rhs) const {
+				return !(*this == rhs);
+			}
+
+		public:
+			/// Returns reference to current element.
+			const StorageType& operator*() const {
+				if (!m_pElement)
+					CATAPULT_THROW_INVALID_ARGUMENT("dereference on empty iterator");
+
+				return *m_pElement;
+			}
+
+			/// Returns pointer to current element.
+			const StorageType* operator->() const {
+				return &operator*();
+			}
+
+		private:
+			ElementPointer m_pElement;
+		};
+
+	public:
+		/// Creates a container around \a database and \a columnIndex.
+		RdbCachedColumnContainer(CacheDatabase& database, size_t columnIndex)
+				: RdbCachedColumnContainer(database.database(), database.columnId(columnIndex), database.options().HotEntryCacheSize)
+		{}
+
+		/// Creates a container around \a database and \a columnId that keeps at most \a maxHotEntries entries in memory
+		/// across commits.
+		template<typename TDatabase>
+		RdbCachedColumnContainer(TDatabase& database, size_t columnId, size_t maxHotEntries)
+				: m_container(database, columnId)
+				, m_maxHotEntries(maxHotEntries)
+		{}
+
+	public:
+		/// Returns size of the container.
+		size_t size() const {
+			return m_container.size();
+		}
+
+		/// Returns \c true if container is empty.
+		bool empty() const {
+			return m_container.empty();
+		}
+
+		/// Returns number of entries currently kept in memory.
+		size_t hotSize() const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_hotEntries.size();
+		}
+
+	public:
+		/// Returns iterator that represents non-existing element.
+		const_iterator cend() const {
+			return const_iterator();
+		}
+
+		/// Finds element with \a key. Returns cend() if \a key has not been found.
+		const_iterator find(const KeyType& key) const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_pendingRemovals.cend() != m_pendingRemovals.find(key))
+				return cend();
+
+			auto hotIter = m_hotEntries.find(key);
+			if (m_hotEntries.cend() != hotIter) {
+				m_usage.splice(m_usage.begin(), m_usage, hotIter->second.UsageIter);
+				return const_iterator(hotIter->second.pElement);
+			}
+
+			auto iter = m_container.find(key);
+			if (m_container.cend() == iter)
+				return cend();
+
+			auto pElement = std::make_shared<const StorageType>(*iter);
+			addHotEntry(key, pElement);
+			return const_iterator(pElement);
+		}
+
+		/// Loads all elements with \a keys that are not in memory using a single lookup.
+		/// \note Loaded elements are retained until the next commit, like found elements.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			std::unordered_set<KeyType, TKeyHasher> uniqueKeys;
+			std::vector<KeyType> missingKeys;
+			for (const auto& key : keys) {
+				if (m_pendingRemovals.cend() != m_pendingRemovals.find(key) || m_hotEntries.cend() != m_hotEntries.find(key))
+					continue;
+
+				if (uniqueKeys.insert(key).second)
+					missingKeys.push_back(key);
+			}
+
+			if (missingKeys.empty())
+				return;
+
+			auto iters = m_container.findMany(missingKeys);
+			for (auto i = 0u; i < missingKeys.size(); ++i) {
+				if (m_container.cend() != iters[i])
+					addHotEntry(missingKeys[i], std::make_shared<const StorageType>(*iters[i]));
+			}
+		}
+
+	public:
+		/// Atomically writes all changes in \a deltas to the underlying column.
+		/// \note If the database is collecting a pending batch, changes are added to it instead.
+		template<typename TKeyTraits, typename TMemorySet>
+		void update(const deltaset::DeltaElements<TMemorySet>& deltas) {
+			applyUpdate<TKeyTraits>(deltas, [this, &deltas](auto& batch) {
+				UpdateSet<TKeyTraits>(m_container, deltas, batch);
+				return std::vector<KeyType>();
+			});
+		}
+
+		/// Atomically writes all changes in \a deltas to the underlying column and removes all elements less than
+		/// \a pruningBoundary from it.
+		/// \note If the database is collecting a pending batch, changes are added to it instead.
+		template<typename TKeyTraits, typename TMemorySet, typename TValue>
+		void update(const deltaset::DeltaElements<TMemorySet>& deltas, const deltaset::PruningBoundary<TValue>& pruningBoundary) {
+			applyUpdate<TKeyTraits>(deltas, [this, &deltas, &pruningBoundary](auto& batch) {
+				return UpdateSet<TKeyTraits>(m_container, deltas, pruningBoundary, batch);
+			});
+		}
+
+	private:
+		template<typename TKeyTraits, typename TMemorySet, typename TUpdateColumn>
+		void applyUpdate(const deltaset::DeltaElements<TMemorySet>& deltas, TUpdateColumn updateColumn) {
+			auto& database = m_container.database();
+			auto* pPendingBatch = database.pendingBatch();
+			RdbWriteBatch batch;
+			auto& updateBatch = pPendingBatch ? *pPendingBatch : batch;
+			auto prunedKeys = updateColumn(updateBatch);
+
+			{
+				// modified elements are likely to be used again, so they replace any stale in-memory entries
+				std::lock_guard<std::mutex> lock(m_mutex);
+				for (const auto& element : deltas.Added)
+					updateHotEntry(TKeyTraits::ToKey(element), element);
+
+				for (const auto& element : deltas.Copied)
+					updateHotEntry(TKeyTraits::ToKey(element), element);
+
+				// removed and pruned elements are still present in the column until the batch is written
+				for (const auto& element : deltas.Removed)
+					addPendingRemoval(TKeyTraits::ToKey(element));
+
+				for (const auto& key : prunedKeys)
+					addPendingRemoval(key);
+			}
+
+			updateBatch.addCompletionHandler([this]() {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_pendingRemovals.clear();
+				while (m_hotEntries.size() > m_maxHotEntries) {
+					m_hotEntries.erase(m_usage.back());
+					m_usage.pop_back();
+				}
+			});
+
+			if (!pPendingBatch)
+				database.write(batch);
+		}
+
+	private:
+		void addHotEntry(const KeyType& key, const ElementPointer& pElement) const {
+			m_usage.push_front(key);
+			m_hotEntries.emplace(key, HotEntry{ pElement, m_usage.begin() });
+		}
+
+		void updateHotEntry(const KeyType& key, const StorageType& element) {
+			removeHotEntry(key);
+			m_pendingRemovals.erase(key);
+			addHotEntry(key, std::make_shared<const StorageType>(element));
+		}
+
+		void addPendingRemoval(const KeyType& key) {
+			removeHotEntry(key);
+			m_pendingRemovals.insert(key);
+		}
+
+		void removeHotEntry(const KeyType& key) {
+			auto hotIter = m_hotEntries.find(key);
+			if (m_hotEntries.cend() == hotIter)
+				return;
+
+			m_usage.erase(hotIter->second.UsageIter);
+			m_hotEntries.erase(hotIter);
+		}
+
+	private:
+		mutable TypedContainer m_container;
+		size_t m_maxHotEntries;
+
+		mutable std::mutex m_mutex;
+		mutable std::list<KeyType> m_usage;
+		mutable std::unordered_map<KeyType, HotEntry, TKeyHasher> m_hotEntries;
+		std::unordered_set<KeyType, TKeyHasher> m_pendingRemovals;
+	};
+
+	/// Loads all elements with \a keys from \a elements into memory.
+	/// \note Specialization for RdbCachedColumnContainer.
+	template<typename TDescriptor, typename TKeyHasher, typename TContainer, typename TKey>
+	void PrefetchSet(const RdbCachedColumnContainer<TDescriptor, TKeyHasher, TContainer>& elements, const std::vector<TKey>& keys) {
+		elements.prefetch(keys);
+	}
+
+	/// Applies all changes in \a deltas to \a elements atomically.
+	/// \note Specialization for RdbCachedColumnContainer.
+	template<typename TKeyTraits, typename TDescriptor, typename TKeyHasher, typename TContainer, typename TMemorySet>
+	void UpdateSet(RdbCachedColumnContainer<TDescriptor, TKeyHasher, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
+		elements.template update<TKeyTraits>(deltas);
+	}
+
+	/// Applies all changes in \a deltas to \a elements and prunes all elements less than \a pruningBoundary atomically.
+	/// \note Specialization for RdbCachedColumnContainer.
+	template<
+			typename TKeyTraits,
+			typename TDescriptor,
+			typename TKeyHasher,
+			typename TContainer,
+			typename TMemorySet,
+			typename TValue
+	>
+	void UpdateSet(
+			RdbCachedColumnContainer<TDescriptor, TKeyHasher, TContainer>& elements,
+			const deltaset::DeltaElements<TMemorySet>& deltas,
+			const deltaset::PruningBoundary<TValue>& pruningBoundary) {
+		elements.template update<TKeyTraits>(deltas, pruningBoundary);
+	}
+}}
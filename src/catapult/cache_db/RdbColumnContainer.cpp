@@ -28,6 +28,12 @@ namespace catapult { namespace cache {
 		auto ToSlice(const RawBuffer& key) {
 			return rocksdb::Slice(reinterpret_cast<const char*>(key.pData), key.Size);
 		}
+
+		std::string SerializeSize(size_t size) {
+			std::string strSize(sizeof(uint64_t), 0);
+			*reinterpret_cast<uint64_t*>(&strSize[0]) = static_cast<uint64_t>(size);
+			return strSize;
+		}
 	}
 
 	RdbColumnContainer::RdbColumnContainer(RocksDatabase& database, size_t columnId)
@@ -40,14 +46,16 @@ namespace catapult { namespace cache {
 				: static_cast<size_t>(*reinterpret_cast<const uint64_t*>(iter.storage().data()));
 	}
 
+	RocksDatabase& RdbColumnContainer::database() {
+		return m_database;
+	}
+
 	size_t RdbColumnContainer::size() const {
 		return m_size;
 	}
 
 	void RdbColumnContainer::saveSize(size_t newSize) {
-		std::string strSize(sizeof(uint64_t), 0);
-		*reinterpret_cast<uint64_t*>(&strSize[0]) = static_cast<uint64_t>(newSize);
-		m_database.put(m_columnId, "size", strSize);
+		m_database.put(m_columnId, "size", SerializeSize(newSize));
 		m_size = newSize;
 	}
 
@@ -55,6 +63,15 @@ namespace catapult { namespace cache {
 		m_database.get(m_columnId, ToSlice(key), iterator);
 	}
 
+	void RdbColumnContainer::findMany(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) {
+		std::vector<rocksdb::Slice> slices;
+		slices.reserve(keys.size());
+		for (const auto& key : keys)
+			slices.push_back(ToSlice(key));
+
+		m_database.multiGet(m_columnId, slices, iterators);
+	}
+
 	void RdbColumnContainer::insert(const RawBuffer& key, const std::string& value) {
 		m_database.put(m_columnId, ToSlice(key), value);
 	}
@@ -62,4 +79,28 @@ namespace catapult { namespace cache {
 	void RdbColumnContainer::remove(const RawBuffer& key) {
 		m_database.del(m_columnId, ToSlice(key));
 	}
+
+	void RdbColumnContainer::saveSize(RdbWriteBatch& batch, size_t newSize) {
+		m_database.put(batch, m_columnId, "size", SerializeSize(newSize));
+		batch.addCompletionHandler([this, newSize]() { m_size = newSize; });
+	}
+
+	void RdbColumnContainer::insert(RdbWriteBatch& batch, const RawBuffer& key, const std::string& value) {
+		m_database.put(batch, m_columnId, ToSlice(key), value);
+	}
+
+	void RdbColumnContainer::remove(RdbWriteBatch& batch, const RawBuffer& key) {
+		m_database.del(batch, m_columnId, ToSlice(key));
+	}
+
+	void RdbColumnContainer::prune(RdbWriteBatch& batch, const RawBuffer& endKey, const consumer<const RawBuffer&>& consumer) {
+		m_database.forEachKeyBefore(m_columnId, ToSlice(endKey), [this, &batch, &consumer](const auto& key) {
+			// size is stored in the same column, so it must not be pruned
+			if (rocksdb::Slice("size") == key)
+				return;
+
+			m_database.del(batch, m_columnId, key);
+			consumer(RawBuffer(reinterpret_cast<const uint8_t*>(key.data()), key.size()));
+		});
+	}
 }}
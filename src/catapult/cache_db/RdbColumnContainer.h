@@ -19,11 +19,14 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include "catapult/types.h"
+#include <vector>
 
 namespace catapult {
 	namespace cache {
 		class RdbDataIterator;
+		class RdbWriteBatch;
 		class RocksDatabase;
 	}
 }
@@ -37,6 +40,9 @@ namespace catapult { namespace cache {
 		RdbColumnContainer(RocksDatabase& database, size_t columnId);
 
 	public:
+		/// Returns underlying database.
+		RocksDatabase& database();
+
 		/// Returns size of the column.
 		size_t size() const;
 
@@ -46,12 +52,30 @@ namespace catapult { namespace cache {
 		/// Finds element with \a key, storing result in \a iterator.
 		void find(const RawBuffer& key, RdbDataIterator& iterator);
 
+		/// Finds all elements with \a keys using a single lookup, storing results in \a iterators.
+		void findMany(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators);
+
 		/// Inserts element with \a key and \a value.
 		void insert(const RawBuffer& key, const std::string& value);
 
 		/// Removes element with \a key.
 		void remove(const RawBuffer& key);
 
+	public:
+		/// Adds a write of column size \a newSize to \a batch.
+		/// \note Cached size is only updated after \a batch has been successfully written.
+		void saveSize(RdbWriteBatch& batch, size_t newSize);
+
+		/// Adds an insert of element with \a key and \a value to \a batch.
+		void insert(RdbWriteBatch& batch, const RawBuffer& key, const std::string& value);
+
+		/// Adds a removal of element with \a key to \a batch.
+		void remove(RdbWriteBatch& batch, const RawBuffer& key);
+
+		/// Adds removals of all elements with keys less than \a endKey to \a batch and passes each removed key to \a consumer.
+		/// \note Column size is not changed, so it needs to be adjusted by the caller.
+		void prune(RdbWriteBatch& batch, const RawBuffer& endKey, const consumer<const RawBuffer&>& consumer);
+
 	private:
 		RocksDatabase& m_database;
 		size_t m_columnId;
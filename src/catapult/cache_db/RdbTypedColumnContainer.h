@@ -42,6 +42,14 @@ namespace catapult { namespace cache {
 			using ValueType = typename TDescriptor::ValueType;
 			using StorageType = typename TDescriptor::StorageType;
 
+		public:
+			/// Creates an iterator that represents non-existing element.
+			const_iterator() = default;
+
+			/// Creates an iterator around \a iterator.
+			explicit const_iterator(const RdbDataIterator& iterator) : m_iterator(iterator)
+			{}
+
 		public:
 			/// Returns \c true if this iterator and \a rhs are equal.
 			bool operator==(const const_iterator& rhs) const {
@@ -61,7 +69,7 @@ namespace catapult { namespace cache {
 
 				if (!m_pStorage) {
 					auto value = TDescriptor::Serializer::DeserializeValue(m_iterator.buffer());
-					m_pStorage = std::make_unique<StorageType>(TDescriptor::GetKeyFromValue(value), value);
+					m_pStorage = CreateStorage(value, std::is_same<StorageType, ValueType>());
 				}
 
 				return *m_pStorage;
@@ -83,6 +91,17 @@ namespace catapult { namespace cache {
 				return m_iterator;
 			}
 
+		private:
+			// sets store values directly
+			static std::shared_ptr<StorageType> CreateStorage(const ValueType& value, std::true_type) {
+				return std::make_shared<StorageType>(value);
+			}
+
+			// maps store key value pairs
+			static std::shared_ptr<StorageType> CreateStorage(const ValueType& value, std::false_type) {
+				return std::make_shared<StorageType>(TDescriptor::GetKeyFromValue(value), value);
+			}
+
 		private:
 			RdbDataIterator m_iterator;
 			mutable std::shared_ptr<StorageType> m_pStorage;
@@ -95,6 +114,11 @@ namespace catapult { namespace cache {
 		{}
 
 	public:
+		/// Returns underlying database.
+		auto& database() {
+			return m_container.database();
+		}
+
 		/// Returns size of the container.
 		size_t size() const {
 			return m_container.size();
@@ -123,11 +147,66 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds all elements with \a keys using a single lookup.
+		/// Returns one iterator per key, which is equal to cend() if the corresponding key has not been found.
+		std::vector<const_iterator> findMany(const std::vector<KeyType>& keys) {
+			// serialized keys need to be kept alive because serializers can return them by value
+			using SerializedKeyType = decltype(TDescriptor::Serializer::SerializeKey(keys[0]));
+			std::vector<SerializedKeyType> serializedKeys;
+			std::vector<RawBuffer> serializedKeyBuffers;
+			serializedKeys.reserve(keys.size());
+			serializedKeyBuffers.reserve(keys.size());
+			for (const auto& key : keys) {
+				serializedKeys.push_back(TDescriptor::Serializer::SerializeKey(key));
+				serializedKeyBuffers.push_back(serializedKeys.back());
+			}
+
+			std::vector<RdbDataIterator> dbIterators;
+			m_container.findMany(serializedKeyBuffers, dbIterators);
+
+			std::vector<const_iterator> iterators;
+			iterators.reserve(dbIterators.size());
+			for (const auto& dbIterator : dbIterators)
+				iterators.emplace_back(dbIterator);
+
+			return iterators;
+		}
+
 		/// Removes element with \a key.
 		void remove(const KeyType& key) {
 			m_container.remove(TDescriptor::Serializer::SerializeKey(key));
 		}
 
+	public:
+		/// Adds a write of container size \a newSize to \a batch.
+		void saveSize(RdbWriteBatch& batch, size_t newSize) {
+			m_container.saveSize(batch, newSize);
+		}
+
+		/// Adds an insert of \a element to \a batch.
+		void insert(RdbWriteBatch& batch, const StorageType& element) {
+			using Serializer = typename TDescriptor::Serializer;
+			auto key = Serializer::SerializeKey(TDescriptor::GetKeyFromElement(element));
+			m_container.insert(batch, key, Serializer::SerializeValue(element));
+		}
+
+		/// Adds a removal of element with \a key to \a batch.
+		void remove(RdbWriteBatch& batch, const KeyType& key) {
+			m_container.remove(batch, TDescriptor::Serializer::SerializeKey(key));
+		}
+
+		/// Adds removals of all elements with keys less than \a key to \a batch and returns the keys of all removed elements.
+		/// \note This requires a serializer that can deserialize keys and preserves key order in serialized keys.
+		std::vector<KeyType> prune(RdbWriteBatch& batch, const KeyType& key) {
+			using Serializer = typename TDescriptor::Serializer;
+			std::vector<KeyType> prunedKeys;
+			m_container.prune(batch, Serializer::SerializeKey(key), [&prunedKeys](const auto& prunedKey) {
+				prunedKeys.push_back(Serializer::DeserializeKey(prunedKey));
+			});
+			return prunedKeys;
+		}
+
+	public:
 		/// Returns iterator that represents non-existing element.
 		const_iterator cend() {
 			return const_iterator();
@@ -21,6 +21,7 @@
 #include "RocksDatabase.h"
 #include "RocksInclude.h"
 #include "catapult/exceptions.h"
+#include "catapult/utils/Casting.h"
 #include "catapult/utils/HexFormatter.h"
 #include <boost/filesystem.hpp>
 
@@ -66,21 +67,141 @@ namespace catapult { namespace cache {
 		return { reinterpret_cast<const uint8_t*>(storage().data()), storage().size() };
 	}
 
-	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames) : m_dbDir(dbDir) {
+	struct RdbWriteBatch::Impl {
+		rocksdb::WriteBatch Batch;
+		std::vector<action> CompletionHandlers;
+	};
+
+	RdbWriteBatch::RdbWriteBatch() : m_pImpl(std::make_unique<Impl>())
+	{}
+
+	RdbWriteBatch::~RdbWriteBatch() = default;
+
+	size_t RdbWriteBatch::size() const {
+		return static_cast<size_t>(m_pImpl->Batch.Count());
+	}
+
+	size_t RdbWriteBatch::dataSize() const {
+		return m_pImpl->Batch.GetDataSize();
+	}
+
+	void RdbWriteBatch::clear() {
+		m_pImpl->Batch.Clear();
+		m_pImpl->CompletionHandlers.clear();
+	}
+
+	void RdbWriteBatch::addCompletionHandler(const action& handler) {
+		m_pImpl->CompletionHandlers.push_back(handler);
+	}
+
+	void RdbWriteBatch::complete() {
+		auto completionHandlers = std::move(m_pImpl->CompletionHandlers);
+		clear();
+
+		for (const auto& handler : completionHandlers)
+			handler();
+	}
+
+	rocksdb::WriteBatch& RdbWriteBatch::batch() {
+		return m_pImpl->Batch;
+	}
+
+	namespace {
+		std::vector<RdbColumnFamily> ToColumnFamilies(const std::vector<std::string>& columnFamilyNames) {
+			std::vector<RdbColumnFamily> columnFamilies;
+			for (const auto& columnFamilyName : columnFamilyNames)
+				columnFamilies.push_back({ columnFamilyName });
+
+			return columnFamilies;
+		}
+
+		rocksdb::CompactionStyle ToRocksCompactionStyle(RdbCompactionStyle compactionStyle) {
+			switch (compactionStyle) {
+			case RdbCompactionStyle::Level:
+				return rocksdb::kCompactionStyleLevel;
+			case RdbCompactionStyle::Universal:
+				return rocksdb::kCompactionStyleUniversal;
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported compaction style", utils::to_underlying_type(compactionStyle));
+		}
+
+		rocksdb::CompressionType ToRocksCompressionType(RdbCompressionType compression) {
+			switch (compression) {
+			case RdbCompressionType::None:
+				return rocksdb::kNoCompression;
+			case RdbCompressionType::Snappy:
+				return rocksdb::kSnappyCompression;
+			case RdbCompressionType::Lz4:
+				return rocksdb::kLZ4Compression;
+			case RdbCompressionType::Zstd:
+				return rocksdb::kZSTD;
+			}
+
+			CATAPULT_THROW_INVALID_ARGUMENT_1("unsupported compression type", utils::to_underlying_type(compression));
+		}
+
+		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
+				const RdbColumnFamily& columnFamily,
+				const RocksDatabaseOptions& options,
+				const std::shared_ptr<rocksdb::Cache>& pBlockCache) {
+			auto tuningOptions = GetColumnFamilyOptions(options, columnFamily.Name);
+
+			rocksdb::ColumnFamilyOptions columnFamilyOptions;
+			if (0 != tuningOptions.WriteBufferSize.bytes())
+				columnFamilyOptions.write_buffer_size = tuningOptions.WriteBufferSize.bytes();
+
+			columnFamilyOptions.compaction_style = ToRocksCompactionStyle(tuningOptions.CompactionStyle);
+			columnFamilyOptions.compression = ToRocksCompressionType(tuningOptions.Compression);
+
+			rocksdb::BlockBasedTableOptions tableOptions;
+			if (pBlockCache)
+				tableOptions.block_cache = pBlockCache;
+
+			// bloom filters are only beneficial for point lookups of fixed-size keys (e.g. addresses, keys and hashes)
+			if (0 != columnFamily.FixedKeySize && 0 != tuningOptions.BloomFilterBitsPerKey)
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(tuningOptions.BloomFilterBitsPerKey, false));
+
+			if (0 != columnFamily.PrefixSize)
+				columnFamilyOptions.prefix_extractor.reset(rocksdb::NewFixedPrefixTransform(columnFamily.PrefixSize));
+
+			columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+			return columnFamilyOptions;
+		}
+	}
+
+	RocksDatabase::RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames)
+			: RocksDatabase(dbDir, ToColumnFamilies(columnFamilyNames), RocksDatabaseOptions())
+	{}
+
+	RocksDatabase::RocksDatabase(
+			const std::string& dbDir,
+			const std::vector<RdbColumnFamily>& columnFamilies,
+			const RocksDatabaseOptions& options)
+			: m_dbDir(dbDir)
+			, m_options(options) {
 		boost::system::error_code ec;
 		boost::filesystem::create_directories(dbDir, ec);
 
+		if (0 != options.BlockCacheSize.bytes())
+			m_pBlockCache = rocksdb::NewLRUCache(options.BlockCacheSize.bytes());
+
 		rocksdb::DB* pDb;
-		rocksdb::Options dbOptions;
+		rocksdb::DBOptions dbOptions;
 		dbOptions.create_if_missing = true;
 		dbOptions.create_missing_column_families = true;
+		if (options.ShouldEnableStatistics) {
+			m_pStatistics = rocksdb::CreateDBStatistics();
+			dbOptions.statistics = m_pStatistics;
+		}
 
-		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor("default", rocksdb::ColumnFamilyOptions()));
-		for (const auto& columnFamilyName : columnFamilyNames)
-			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, rocksdb::ColumnFamilyOptions()));
+		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilyDescriptors;
+		RdbColumnFamily defaultColumnFamily{ "default" };
+		columnFamilyDescriptors.emplace_back("default", CreateColumnFamilyOptions(defaultColumnFamily, options, m_pBlockCache));
+		for (const auto& columnFamily : columnFamilies)
+			columnFamilyDescriptors.emplace_back(columnFamily.Name, CreateColumnFamilyOptions(columnFamily, options, m_pBlockCache));
 
-		auto status = rocksdb::DB::Open(dbOptions, m_dbDir, columnFamilies, &m_handles, &pDb);
+		auto status = rocksdb::DB::Open(dbOptions, m_dbDir, columnFamilyDescriptors, &m_handles, &pDb);
 		m_pDb.reset(pDb);
 		if (!status.ok())
 			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't open database", dbDir, status.ToString());
@@ -91,6 +212,17 @@ namespace catapult { namespace cache {
 			m_pDb->DestroyColumnFamilyHandle(pHandle);
 	}
 
+	size_t RocksDatabase::addColumnFamily(const RdbColumnFamily& columnFamily) {
+		rocksdb::ColumnFamilyHandle* pHandle;
+		auto columnFamilyOptions = CreateColumnFamilyOptions(columnFamily, m_options, m_pBlockCache);
+		auto status = m_pDb->CreateColumnFamily(columnFamilyOptions, columnFamily.Name, &pHandle);
+		if (!status.ok())
+			CATAPULT_THROW_RUNTIME_ERROR_2("couldn't create column family", columnFamily.Name, status.ToString());
+
+		m_handles.push_back(pHandle);
+		return m_handles.size() - 1;
+	}
+
 	namespace {
 		[[noreturn]]
 		void ThrowError(const char* message, size_t columnId, const rocksdb::Slice& key) {
@@ -109,6 +241,33 @@ namespace catapult { namespace cache {
 			ThrowError("could not retrieve value (column, key)", columnId, key);
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		std::vector<rocksdb::ColumnFamilyHandle*> handles(keys.size(), m_handles[columnId]);
+		std::vector<std::string> values;
+		auto statuses = m_pDb->MultiGet(rocksdb::ReadOptions(), handles, keys, &values);
+
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& status = statuses[i];
+			auto& result = results[i];
+			result.setFound(status.ok());
+
+			if (status.ok()) {
+				auto& storage = result.storage();
+				storage.Reset();
+				*storage.GetSelf() = std::move(values[i]);
+				storage.PinSelf();
+				continue;
+			}
+
+			if (!status.IsNotFound())
+				ThrowError("could not retrieve value (column, key)", columnId, keys[i]);
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		auto status = m_pDb->Put(rocksdb::WriteOptions(), m_handles[columnId], key, value);
 
@@ -124,4 +283,72 @@ namespace catapult { namespace cache {
 		if (!status.ok())
 			ThrowError("could not remove value from db (column, key)", columnId, key);
 	}
+
+	void RocksDatabase::forEachKeyBefore(size_t columnId, const rocksdb::Slice& endKey, const consumer<const rocksdb::Slice&>& consumer) {
+		// total order seek is needed because columns with prefix extractors only support prefix seeks otherwise
+		rocksdb::ReadOptions readOptions;
+		readOptions.total_order_seek = true;
+		readOptions.iterate_upper_bound = &endKey;
+
+		std::unique_ptr<rocksdb::Iterator> pIterator(m_pDb->NewIterator(readOptions, m_handles[columnId]));
+		for (pIterator->SeekToFirst(); pIterator->Valid(); pIterator->Next())
+			consumer(pIterator->key());
+
+		if (!pIterator->status().ok())
+			ThrowError("could not iterate over keys in db (column, end key)", columnId, endKey);
+	}
+
+	void RocksDatabase::put(RdbWriteBatch& batch, size_t columnId, const rocksdb::Slice& key, const std::string& value) {
+		auto status = batch.batch().Put(m_handles[columnId], key, value);
+
+		if (!status.ok())
+			ThrowError("could not add value to batch (column, key)", columnId, key);
+	}
+
+	void RocksDatabase::del(RdbWriteBatch& batch, size_t columnId, const rocksdb::Slice& key) {
+		auto status = batch.batch().Delete(m_handles[columnId], key);
+
+		if (!status.ok())
+			ThrowError("could not add removal to batch (column, key)", columnId, key);
+	}
+
+	void RocksDatabase::write(RdbWriteBatch& batch) {
+		if (0 != batch.size()) {
+			auto status = m_pDb->Write(rocksdb::WriteOptions(), &batch.batch());
+			if (!status.ok())
+				CATAPULT_THROW_RUNTIME_ERROR_2("could not write batch to db (operations, status)", batch.size(), status.ToString());
+		}
+
+		batch.complete();
+	}
+
+	void RocksDatabase::startPendingBatch() {
+		m_pPendingBatch = std::make_unique<RdbWriteBatch>();
+	}
+
+	RdbWriteBatch* RocksDatabase::pendingBatch() {
+		return m_pPendingBatch.get();
+	}
+
+	void RocksDatabase::writePendingBatch() {
+		if (!m_pPendingBatch)
+			CATAPULT_THROW_RUNTIME_ERROR("cannot write pending batch when no changes are being collected");
+
+		// stop collecting changes even if the write fails
+		auto pPendingBatch = std::move(m_pPendingBatch);
+		write(*pPendingBatch);
+	}
+
+	RdbStatistics RocksDatabase::statistics() const {
+		RdbStatistics statistics{};
+		if (!m_pStatistics)
+			return statistics;
+
+		statistics.BlockCacheHits = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+		statistics.BlockCacheMisses = m_pStatistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+		statistics.StallMicros = m_pStatistics->getTickerCount(rocksdb::STALL_MICROS);
+		statistics.CompactionReadBytes = m_pStatistics->getTickerCount(rocksdb::COMPACT_READ_BYTES);
+		statistics.CompactionWriteBytes = m_pStatistics->getTickerCount(rocksdb::COMPACT_WRITE_BYTES);
+		return statistics;
+	}
 }}
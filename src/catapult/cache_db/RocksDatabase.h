@@ -19,16 +19,21 @@
 **/
 
 #pragma once
+#include "RocksDatabaseOptions.h"
+#include "catapult/functions.h"
 #include "catapult/types.h"
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace rocksdb {
+	class Cache;
 	class ColumnFamilyHandle;
 	class DB;
 	class PinnableSlice;
 	class Slice;
+	class Statistics;
+	class WriteBatch;
 }
 
 namespace catapult { namespace cache {
@@ -77,28 +82,129 @@ namespace catapult { namespace cache {
 		bool m_isFound;
 	};
 
+	/// Batch of write operations that are applied to a database atomically.
+	class RdbWriteBatch {
+	public:
+		/// Creates an empty batch.
+		RdbWriteBatch();
+
+		/// Destroys a batch.
+		~RdbWriteBatch();
+
+	public:
+		/// Gets the number of operations in the batch.
+		size_t size() const;
+
+		/// Gets the size of the serialized batch data.
+		size_t dataSize() const;
+
+		/// Removes all operations and completion handlers from the batch.
+		void clear();
+
+		/// Adds \a handler that is called after the batch has been successfully written.
+		void addCompletionHandler(const action& handler);
+
+	public:
+		/// Returns underlying rocksdb batch.
+		rocksdb::WriteBatch& batch();
+
+	private:
+		friend class RocksDatabase;
+
+		void complete();
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+
+	/// RocksDb database statistics.
+	struct RdbStatistics {
+	public:
+		/// Number of block cache hits.
+		uint64_t BlockCacheHits;
+
+		/// Number of block cache misses.
+		uint64_t BlockCacheMisses;
+
+		/// Total time writes were stalled (in microseconds).
+		uint64_t StallMicros;
+
+		/// Number of bytes read during compactions.
+		uint64_t CompactionReadBytes;
+
+		/// Number of bytes written during compactions.
+		uint64_t CompactionWriteBytes;
+	};
+
 	/// RocksDb-backed database.
 	class RocksDatabase {
 	public:
 		/// Creates database in \a dbDir with 'default' column and additional columns (\a columnFamilyNames).
 		RocksDatabase(const std::string& dbDir, const std::vector<std::string>& columnFamilyNames);
 
+		/// Creates database in \a dbDir with 'default' column and additional columns (\a columnFamilies)
+		/// tuned according to \a options.
+		RocksDatabase(const std::string& dbDir, const std::vector<RdbColumnFamily>& columnFamilies, const RocksDatabaseOptions& options);
+
 		/// Destroys database.
 		~RocksDatabase();
 
+	public:
+		/// Adds a column family described by \a columnFamily and returns its column id.
+		/// \note The column family is tuned according to the options passed to the constructor.
+		size_t addColumnFamily(const RdbColumnFamily& columnFamily);
+
 	public:
 		/// Gets \a key from \a columnId returning data in \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets all \a keys from \a columnId with a single lookup returning data in \a results.
+		/// \note \a results is resized to match \a keys and contains one iterator per key.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts \a value with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
 		/// Deletes \a key from \a columnId.
 		void del(size_t columnId, const rocksdb::Slice& key);
 
+		/// Passes all keys in \a columnId that are less than \a endKey to \a consumer in ascending (bytewise) order.
+		void forEachKeyBefore(size_t columnId, const rocksdb::Slice& endKey, const consumer<const rocksdb::Slice&>& consumer);
+
+	public:
+		/// Adds a put of \a value with \a key in \a columnId to \a batch.
+		void put(RdbWriteBatch& batch, size_t columnId, const rocksdb::Slice& key, const std::string& value);
+
+		/// Adds a delete of \a key from \a columnId to \a batch.
+		void del(RdbWriteBatch& batch, size_t columnId, const rocksdb::Slice& key);
+
+		/// Atomically applies all operations in \a batch, calls its completion handlers and clears it.
+		void write(RdbWriteBatch& batch);
+
+	public:
+		/// Starts collecting the changes of all containers backed by this database in a single pending batch.
+		/// \note Any previously pending batch is discarded.
+		void startPendingBatch();
+
+		/// Gets the pending batch or \c nullptr if no changes are being collected.
+		RdbWriteBatch* pendingBatch();
+
+		/// Atomically writes the pending batch and stops collecting changes.
+		void writePendingBatch();
+
+	public:
+		/// Gets database statistics.
+		/// \note All values are zero when statistics are not enabled.
+		RdbStatistics statistics() const;
+
 	private:
 		std::string m_dbDir;
+		RocksDatabaseOptions m_options;
+		std::shared_ptr<rocksdb::Cache> m_pBlockCache;
+		std::shared_ptr<rocksdb::Statistics> m_pStatistics;
 		std::shared_ptr<rocksdb::DB> m_pDb;
 		std::vector<rocksdb::ColumnFamilyHandle*> m_handles;
+		std::unique_ptr<RdbWriteBatch> m_pPendingBatch;
 	};
 }}
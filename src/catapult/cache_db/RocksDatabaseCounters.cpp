@@ -0,0 +1,42 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksDatabaseCounters.h"
+#include "RocksDatabase.h"
+
+namespace catapult { namespace cache {
+
+	void AddRocksDatabaseCounters(std::vector<utils::DiagnosticCounter>& counters, const RocksDatabase& database) {
+		counters.emplace_back(utils::DiagnosticCounterId("RDB HIT RATE"), [&database]() -> uint64_t {
+			auto statistics = database.statistics();
+			auto numLookups = statistics.BlockCacheHits + statistics.BlockCacheMisses;
+			return 0 == numLookups ? 0 : statistics.BlockCacheHits * 100 / numLookups;
+		});
+		counters.emplace_back(utils::DiagnosticCounterId("RDB STALL US"), [&database]() {
+			return database.statistics().StallMicros;
+		});
+		counters.emplace_back(utils::DiagnosticCounterId("RDB CMP READ"), [&database]() {
+			return database.statistics().CompactionReadBytes;
+		});
+		counters.emplace_back(utils::DiagnosticCounterId("RDB CMP WRITE"), [&database]() {
+			return database.statistics().CompactionWriteBytes;
+		});
+	}
+}}
@@ -0,0 +1,74 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "RocksDatabaseOptions.h"
+#include "catapult/utils/ConfigurationValueParsers.h"
+#include "catapult/utils/MacroBasedEnumIncludes.h"
+
+namespace catapult { namespace cache {
+
+#define DEFINE_ENUM RdbCompactionStyle
+#define ENUM_LIST RDB_COMPACTION_STYLE_LIST
+#include "catapult/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
+#define DEFINE_ENUM RdbCompressionType
+#define ENUM_LIST RDB_COMPRESSION_TYPE_LIST
+#include "catapult/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
+	namespace {
+		// note that fifo compaction is intentionally not supported because it deletes data, which would corrupt cache state
+		const std::array<std::pair<const char*, RdbCompactionStyle>, 2> String_To_Compaction_Style_Pairs{{
+			{ "Level", RdbCompactionStyle::Level },
+			{ "Universal", RdbCompactionStyle::Universal }
+		}};
+
+		const std::array<std::pair<const char*, RdbCompressionType>, 4> String_To_Compression_Type_Pairs{{
+			{ "None", RdbCompressionType::None },
+			{ "Snappy", RdbCompressionType::Snappy },
+			{ "Lz4", RdbCompressionType::Lz4 },
+			{ "Zstd", RdbCompressionType::Zstd }
+		}};
+	}
+
+	bool TryParseValue(const std::string& str, RdbCompactionStyle& parsedValue) {
+		return utils::TryParseEnumValue(String_To_Compaction_Style_Pairs, str, parsedValue);
+	}
+
+	bool TryParseValue(const std::string& str, RdbCompressionType& parsedValue) {
+		return utils::TryParseEnumValue(String_To_Compression_Type_Pairs, str, parsedValue);
+	}
+
+	RdbColumnFamilyOptions GetColumnFamilyOptions(const RocksDatabaseOptions& options, const std::string& columnFamilyName) {
+		auto iter = options.ColumnFamilyOptions.find(columnFamilyName);
+		if (options.ColumnFamilyOptions.cend() != iter)
+			return iter->second;
+
+		RdbColumnFamilyOptions columnFamilyOptions;
+		columnFamilyOptions.WriteBufferSize = options.WriteBufferSize;
+		columnFamilyOptions.BloomFilterBitsPerKey = options.BloomFilterBitsPerKey;
+		columnFamilyOptions.CompactionStyle = options.CompactionStyle;
+		columnFamilyOptions.Compression = options.Compression;
+		return columnFamilyOptions;
+	}
+}}
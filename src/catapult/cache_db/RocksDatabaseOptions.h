@@ -0,0 +1,138 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/FileSize.h"
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+namespace catapult { namespace cache {
+
+#define RDB_COMPACTION_STYLE_LIST \
+	/* Files are organized in levels that are compacted into each other. */ \
+	ENUM_VALUE(Level) \
+	\
+	/* Files are organized in sorted runs that are merged together (lower write amplification). */ \
+	ENUM_VALUE(Universal)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible database compaction styles.
+	enum class RdbCompactionStyle {
+		RDB_COMPACTION_STYLE_LIST
+	};
+#undef ENUM_VALUE
+
+#define RDB_COMPRESSION_TYPE_LIST \
+	/* Data is not compressed. */ \
+	ENUM_VALUE(None) \
+	\
+	/* Data is compressed using snappy. */ \
+	ENUM_VALUE(Snappy) \
+	\
+	/* Data is compressed using lz4. */ \
+	ENUM_VALUE(Lz4) \
+	\
+	/* Data is compressed using zstd. */ \
+	ENUM_VALUE(Zstd)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible database compression types.
+	enum class RdbCompressionType {
+		RDB_COMPRESSION_TYPE_LIST
+	};
+#undef ENUM_VALUE
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, RdbCompactionStyle value);
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, RdbCompressionType value);
+
+	/// Tries to parse \a str into a compaction style (\a parsedValue).
+	bool TryParseValue(const std::string& str, RdbCompactionStyle& parsedValue);
+
+	/// Tries to parse \a str into a compression type (\a parsedValue).
+	bool TryParseValue(const std::string& str, RdbCompressionType& parsedValue);
+
+	/// RocksDb column family tuning options.
+	/// \note Zero sizes leave the corresponding RocksDb defaults unchanged.
+	struct RdbColumnFamilyOptions {
+	public:
+		/// Size of a single memtable of the column family.
+		utils::FileSize WriteBufferSize;
+
+		/// Number of bloom filter bits per key if the column family has fixed-size keys (\c 0 disables bloom filters).
+		uint32_t BloomFilterBitsPerKey = 0;
+
+		/// Compaction style of the column family.
+		RdbCompactionStyle CompactionStyle = RdbCompactionStyle::Level;
+
+		/// Compression type of the column family.
+		RdbCompressionType Compression = RdbCompressionType::None;
+	};
+
+	/// RocksDb database tuning options.
+	/// \note Zero sizes leave the corresponding RocksDb defaults unchanged.
+	struct RocksDatabaseOptions {
+	public:
+		/// Size of the LRU block cache shared by all column families.
+		utils::FileSize BlockCacheSize;
+
+		/// Size of a single memtable of each column family without custom options.
+		utils::FileSize WriteBufferSize;
+
+		/// Number of bloom filter bits per key for column families with fixed-size keys and without custom options
+		/// (\c 0 disables bloom filters).
+		uint32_t BloomFilterBitsPerKey = 0;
+
+		/// Compaction style of all column families without custom options.
+		RdbCompactionStyle CompactionStyle = RdbCompactionStyle::Level;
+
+		/// Compression type of all column families without custom options.
+		RdbCompressionType Compression = RdbCompressionType::None;
+
+		/// \c true if database statistics should be collected.
+		bool ShouldEnableStatistics = false;
+
+		/// Maximum number of deserialized entries of each column family that are kept in memory across commits.
+		uint32_t HotEntryCacheSize = 0;
+
+		/// Custom options keyed by the (database) names of the column families they tune.
+		std::unordered_map<std::string, RdbColumnFamilyOptions> ColumnFamilyOptions;
+	};
+
+	/// Gets the tuning options of the column family named \a columnFamilyName given the database \a options.
+	/// \note Custom column family options are returned when present, otherwise the database-wide options are used.
+	RdbColumnFamilyOptions GetColumnFamilyOptions(const RocksDatabaseOptions& options, const std::string& columnFamilyName);
+
+	/// RocksDb column family description.
+	struct RdbColumnFamily {
+	public:
+		/// Column family name.
+		std::string Name;
+
+		/// Size of all keys stored in the column family or \c 0 if keys have variable sizes.
+		size_t FixedKeySize = 0;
+
+		/// Size of the key prefix used for prefix lookups or \c 0 if prefix lookups are not used.
+		size_t PrefixSize = 0;
+	};
+}}
@@ -25,7 +25,12 @@
 #pragma warning(disable : 4100) /* unreferenced formal parameter */
 #endif
 
+#include <rocksdb/cache.h>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/statistics.h>
+#include <rocksdb/table.h>
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
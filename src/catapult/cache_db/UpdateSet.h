@@ -21,25 +21,88 @@
 #pragma once
 #include "RdbTypedColumnContainer.h"
 #include "catapult/deltaset/DeltaElements.h"
+#include "catapult/deltaset/PruningBoundary.h"
 
 namespace catapult { namespace cache {
 
-	/// Applies all changes in \a deltas to \a elements.
+	/// Adds all changes in \a deltas to \a elements to \a batch.
 	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
-	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
+	void UpdateSet(
+			RdbTypedColumnContainer<TDescriptor, TContainer>& elements,
+			const deltaset::DeltaElements<TMemorySet>& deltas,
+			RdbWriteBatch& batch) {
 		auto size = elements.size();
 
 		for (const auto& added : deltas.Added)
-			elements.insert(added);
+			elements.insert(batch, added);
 
 		for (const auto& element : deltas.Copied)
-			elements.insert(element);
+			elements.insert(batch, element);
 
 		for (const auto& element : deltas.Removed)
-			elements.remove(TKeyTraits::ToKey(element));
+			elements.remove(batch, TKeyTraits::ToKey(element));
 
 		size += deltas.Added.size();
 		size -= deltas.Removed.size();
-		elements.saveSize(size);
+		elements.saveSize(batch, size);
+	}
+
+	/// Adds all changes in \a deltas to \a elements and removals of all elements less than \a pruningBoundary to \a batch.
+	/// Returns the keys of all pruned elements, including added elements that are pruned immediately.
+	/// \note Pruning requires that serialized keys have the same order as keys.
+	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet, typename TValue>
+	std::vector<typename TDescriptor::KeyType> UpdateSet(
+			RdbTypedColumnContainer<TDescriptor, TContainer>& elements,
+			const deltaset::DeltaElements<TMemorySet>& deltas,
+			const deltaset::PruningBoundary<TValue>& pruningBoundary,
+			RdbWriteBatch& batch) {
+		if (!pruningBoundary.isSet()) {
+			UpdateSet<TKeyTraits>(elements, deltas, batch);
+			return {};
+		}
+
+		auto pruningKey = TKeyTraits::ToKey(pruningBoundary.value());
+		auto isPruned = [&pruningKey](const auto& element) { return TKeyTraits::ToKey(element) < pruningKey; };
+
+		auto size = elements.size();
+		std::vector<typename TDescriptor::KeyType> prunedKeys;
+		for (const auto& added : deltas.Added) {
+			if (isPruned(added)) {
+				prunedKeys.push_back(TKeyTraits::ToKey(added));
+				continue;
+			}
+
+			elements.insert(batch, added);
+			++size;
+		}
+
+		// copied and removed elements that are pruned are still in the column, so they are removed (and counted) below
+		for (const auto& element : deltas.Copied) {
+			if (!isPruned(element))
+				elements.insert(batch, element);
+		}
+
+		for (const auto& element : deltas.Removed) {
+			if (isPruned(element))
+				continue;
+
+			elements.remove(batch, TKeyTraits::ToKey(element));
+			--size;
+		}
+
+		auto prunedColumnKeys = elements.prune(batch, pruningKey);
+		size -= prunedColumnKeys.size();
+		elements.saveSize(batch, size);
+
+		prunedKeys.insert(prunedKeys.end(), prunedColumnKeys.cbegin(), prunedColumnKeys.cend());
+		return prunedKeys;
+	}
+
+	/// Applies all changes in \a deltas to \a elements atomically.
+	template<typename TKeyTraits, typename TDescriptor, typename TContainer, typename TMemorySet>
+	void UpdateSet(RdbTypedColumnContainer<TDescriptor, TContainer>& elements, const deltaset::DeltaElements<TMemorySet>& deltas) {
+		RdbWriteBatch batch;
+		UpdateSet<TKeyTraits>(elements, deltas, batch);
+		elements.database().write(batch);
 	}
 }}
@@ -0,0 +1,125 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "AnnouncedTransactions.h"
+#include <algorithm>
+
+namespace catapult { namespace chain {
+
+	AnnouncedTransactions::AnnouncedTransactions(const AnnouncedTransactionsOptions& options, const predicate<const Hash256&>& isKnown)
+			: m_options(options)
+			, m_isKnown(isKnown)
+	{}
+
+	size_t AnnouncedTransactions::size() const {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_announcements.size();
+	}
+
+	size_t AnnouncedTransactions::add(const Key& sourcePublicKey, const model::HashRange& hashes, Timestamp time) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		size_t numAdded = 0;
+		for (const auto& hash : hashes) {
+			auto iter = m_announcements.find(hash);
+			if (m_announcements.end() != iter) {
+				iter->second.Announcers.insert(sourcePublicKey);
+				continue;
+			}
+
+			if (m_announcements.size() >= m_options.MaxTransactions || m_isKnown(hash))
+				continue;
+
+			m_announcements.emplace(hash, Announcement{ time, Timestamp(), { sourcePublicKey } });
+			++numAdded;
+		}
+
+		return numAdded;
+	}
+
+	std::vector<Hash256> AnnouncedTransactions::startRequest(const Key& publicKey, Timestamp time) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		std::vector<std::pair<Timestamp, Hash256>> candidates;
+		for (auto iter = m_announcements.begin(); m_announcements.end() != iter;) {
+			const auto& announcement = iter->second;
+			if (time < announcement.RequestDeadline || announcement.Announcers.cend() == announcement.Announcers.find(publicKey)) {
+				++iter;
+				continue;
+			}
+
+			// transaction could have been received from somewhere else in the meantime
+			if (m_isKnown(iter->first)) {
+				iter = m_announcements.erase(iter);
+				continue;
+			}
+
+			candidates.emplace_back(announcement.AnnounceTime, iter->first);
+			++iter;
+		}
+
+		// prefer transactions that have been announced first
+		if (candidates.size() > m_options.MaxHashesPerRequest) {
+			auto nthIter = candidates.begin() + m_options.MaxHashesPerRequest;
+			std::nth_element(candidates.begin(), nthIter, candidates.end(), [](const auto& lhs, const auto& rhs) {
+				return lhs.first < rhs.first;
+			});
+			candidates.erase(nthIter, candidates.end());
+		}
+
+		std::vector<Hash256> hashes;
+		hashes.reserve(candidates.size());
+		auto requestDeadline = Timestamp(time.unwrap() + m_options.RequestTimeout.millis());
+		for (const auto& candidate : candidates) {
+			m_announcements.find(candidate.second)->second.RequestDeadline = requestDeadline;
+			hashes.push_back(candidate.second);
+		}
+
+		return hashes;
+	}
+
+	void AnnouncedTransactions::completeRequest(const Key& publicKey, const std::vector<Hash256>& hashes) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		for (const auto& hash : hashes) {
+			auto iter = m_announcements.find(hash);
+			if (m_announcements.end() == iter)
+				continue;
+
+			// the peer either returned the transaction or does not have it, so it should not be asked again;
+			// the request deadline is kept so that a returned transaction is not requested again before it is processed
+			auto& announcement = iter->second;
+			announcement.Announcers.erase(publicKey);
+			if (announcement.Announcers.empty())
+				m_announcements.erase(iter);
+		}
+	}
+
+	void AnnouncedTransactions::prune(Timestamp time) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		for (auto iter = m_announcements.begin(); m_announcements.end() != iter;) {
+			if (iter->second.AnnounceTime.unwrap() + m_options.AnnouncementLifetime.millis() < time.unwrap())
+				iter = m_announcements.erase(iter);
+			else
+				++iter;
+		}
+	}
+}}
@@ -0,0 +1,87 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/RangeTypes.h"
+#include "catapult/utils/ArraySet.h"
+#include "catapult/utils/TimeSpan.h"
+#include "catapult/functions.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace chain {
+
+	/// Options for tracking announced transactions.
+	struct AnnouncedTransactionsOptions {
+		/// Maximum number of tracked transaction hashes.
+		uint32_t MaxTransactions;
+
+		/// Maximum number of transaction hashes requested from a single peer at once.
+		uint32_t MaxHashesPerRequest;
+
+		/// Amount of time after which an unanswered request for a transaction can be sent to another announcing peer.
+		utils::TimeSpan RequestTimeout;
+
+		/// Amount of time after which an announced transaction that has not been received is forgotten.
+		utils::TimeSpan AnnouncementLifetime;
+	};
+
+	/// Tracks hashes of transactions that have been announced by peers but have not been received yet.
+	/// \note This class is thread safe.
+	class AnnouncedTransactions {
+	public:
+		/// Creates a tracker around \a options and a predicate (\a isKnown) that returns \c true for transactions
+		/// that have already been received.
+		AnnouncedTransactions(const AnnouncedTransactionsOptions& options, const predicate<const Hash256&>& isKnown);
+
+	public:
+		/// Gets the number of tracked transaction hashes.
+		size_t size() const;
+
+		/// Adds all \a hashes announced by the peer with identity \a sourcePublicKey at \a time.
+		/// Returns the number of transaction hashes that were not previously tracked.
+		size_t add(const Key& sourcePublicKey, const model::HashRange& hashes, Timestamp time);
+
+		/// Selects the hashes of unknown transactions announced by the peer with identity \a publicKey that are not
+		/// being requested from another peer at \a time and marks them as being requested from that peer.
+		std::vector<Hash256> startRequest(const Key& publicKey, Timestamp time);
+
+		/// Completes the request of \a hashes from the peer with identity \a publicKey.
+		/// \note Transactions that were not returned by the peer can be requested from other announcing peers after the
+		///       request times out.
+		void completeRequest(const Key& publicKey, const std::vector<Hash256>& hashes);
+
+		/// Forgets all transactions that were first announced more than the announcement lifetime before \a time.
+		void prune(Timestamp time);
+
+	private:
+		struct Announcement {
+			Timestamp AnnounceTime;
+			Timestamp RequestDeadline;
+			utils::KeySet Announcers;
+		};
+
+	private:
+		AnnouncedTransactionsOptions m_options;
+		predicate<const Hash256&> m_isKnown;
+		std::unordered_map<Hash256, Announcement, utils::ArrayHasher<Hash256>> m_announcements;
+		mutable std::mutex m_mutex;
+	};
+}}
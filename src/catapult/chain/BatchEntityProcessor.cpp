@@ -21,6 +21,8 @@
 #include "BatchEntityProcessor.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/model/NotificationTape.h"
+#include "catapult/model/TransactionUtils.h"
 
 using namespace catapult::validators;
 
@@ -41,11 +43,22 @@ namespace catapult { namespace chain {
 				if (entityInfos.empty())
 					return ValidationResult::Neutral;
 
+				// when prefetching, all entities need to be published up front, so record them once and replay them for processing
+				model::NotificationTape tape;
+				if (m_config.Prefetcher)
+					prefetch(entityInfos, state.Cache, tape);
+
 				auto readOnlyCache = state.Cache.toReadOnly();
 				auto validatorContext = ValidatorContext(height, timestamp, m_config.Network, readOnlyCache);
 				auto observerContext = observers::ObserverContext(state, height, observers::NotifyMode::Commit);
 
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
+				if (m_config.Prefetcher) {
+					// the subscriber ignores all notifications following the first unsuccessful one
+					tape.replay(sub);
+					return sub.result();
+				}
+
 				for (const auto& entityInfo : entityInfos) {
 					m_config.pNotificationPublisher->publish(entityInfo, sub);
 					if (!IsValidationResultSuccess(sub.result()))
@@ -55,6 +68,19 @@ namespace catapult { namespace chain {
 				return ValidationResult::Success;
 			}
 
+		private:
+			void prefetch(
+					const model::WeakEntityInfos& entityInfos,
+					cache::CatapultCacheDelta& cache,
+					model::NotificationTape& tape) const {
+				for (const auto& entityInfo : entityInfos)
+					tape.record(*m_config.pNotificationPublisher, entityInfo);
+
+				model::AccountReferences references;
+				model::ExtractAccountReferences(tape, references);
+				m_config.Prefetcher(references, cache);
+			}
+
 		private:
 			ExecutionConfiguration m_config;
 		};
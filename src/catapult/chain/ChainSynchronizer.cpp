@@ -22,6 +22,7 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
 #include <queue>
@@ -140,6 +141,10 @@ namespace catapult { namespace chain {
 		}
 
 		class RangeAggregator {
+		public:
+			RangeAggregator() : m_numBlocks(0)
+			{}
+
 		public:
 			void add(model::BlockRange&& range) {
 				m_numBlocks += range.size();
@@ -217,6 +222,182 @@ namespace catapult { namespace chain {
 			});
 		}
 
+		// region hash-first download
+
+		std::vector<Hash256> ToHashes(const model::HashRange& hashRange, size_t maxHashes) {
+			std::vector<Hash256> hashes;
+			for (const auto& hash : hashRange) {
+				if (maxHashes == hashes.size())
+					break;
+
+				hashes.push_back(hash);
+			}
+
+			return hashes;
+		}
+
+		bool HasExpectedHashes(const model::BlockRange& range, const std::vector<Hash256>& expectedHashes, size_t startIndex) {
+			auto i = startIndex;
+			for (const auto& block : range) {
+				if (expectedHashes.size() == i || expectedHashes[i] != model::CalculateHash(block))
+					return false;
+
+				++i;
+			}
+
+			return true;
+		}
+
+		class BlockDownloads {
+		public:
+			BlockDownloads(Height height, std::vector<Hash256>&& hashes, size_t numPeers)
+					: m_height(height)
+					, m_hashes(std::move(hashes))
+					, m_numBlocksPerRange((m_hashes.size() + numPeers - 1) / numPeers)
+			{}
+
+		public:
+			size_t numRanges() const {
+				return (m_hashes.size() + m_numBlocksPerRange - 1) / m_numBlocksPerRange;
+			}
+
+			Height startHeight(size_t rangeIndex) const {
+				return m_height + Height(startIndex(rangeIndex));
+			}
+
+			uint32_t numBlocks(size_t rangeIndex) const {
+				return static_cast<uint32_t>(std::min(m_numBlocksPerRange, m_hashes.size() - startIndex(rangeIndex)));
+			}
+
+			bool isValid(const model::BlockRange& range, size_t rangeIndex) const {
+				return range.size() <= numBlocks(rangeIndex) && HasExpectedHashes(range, m_hashes, startIndex(rangeIndex));
+			}
+
+		private:
+			size_t startIndex(size_t rangeIndex) const {
+				return rangeIndex * m_numBlocksPerRange;
+			}
+
+		private:
+			Height m_height;
+			std::vector<Hash256> m_hashes;
+			size_t m_numBlocksPerRange;
+		};
+
+		NodeInteractionFuture CompleteBlockDownloads(
+				std::vector<thread::future<model::BlockRange>>&& rangeFutures,
+				const BlockDownloads& downloads,
+				uint64_t forkDepth,
+				UnprocessedElements& unprocessedElements) {
+			// only the longest prefix of contiguous blocks can be consumed
+			RangeAggregator rangeAggregator;
+			for (auto i = 0u; i < rangeFutures.size(); ++i) {
+				try {
+					auto range = rangeFutures[i].get();
+					if (!downloads.isValid(range, i)) {
+						CATAPULT_LOG(warning) << "peer returned unexpected blocks starting at height " << downloads.startHeight(i);
+						if (0 == i)
+							return thread::make_ready_future(NodeInteractionResult::Failure);
+
+						break;
+					}
+
+					auto isComplete = downloads.numBlocks(i) == range.size();
+					if (!range.empty())
+						rangeAggregator.add(std::move(range));
+
+					if (!isComplete)
+						break;
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting blocks: " << e.what();
+					if (0 == i)
+						return thread::make_ready_future(NodeInteractionResult::Failure);
+
+					break;
+				}
+			}
+
+			CATAPULT_LOG(info) << "peers returned " << rangeAggregator.numBlocks() << " contiguous blocks";
+
+			// a fork can only be resolved when all blocks up to the fork depth are available
+			if (rangeAggregator.numBlocks() < forkDepth) {
+				CATAPULT_LOG(warning) << "contiguous blocks do not cover fork depth " << forkDepth;
+				return thread::make_ready_future(NodeInteractionResult::Failure);
+			}
+
+			return CompleteChainBlocksFrom(rangeAggregator, unprocessedElements);
+		}
+
+		NodeInteractionFuture DownloadBlocks(
+				const api::RemoteChainApi& remoteChainApi,
+				std::vector<std::shared_ptr<const api::RemoteChainApi>>&& downloadPeers,
+				const std::shared_ptr<const BlockDownloads>& pDownloads,
+				uint32_t maxBytes,
+				uint64_t forkDepth,
+				const std::shared_ptr<UnprocessedElements>& pUnprocessedElements) {
+			// the synced peer is asked for the first range and each download peer is asked for (at most) one subsequent range
+			// (the byte budget is split across all ranges so that a sync attempt never exceeds maxBytes in total)
+			auto maxBytesPerRange = static_cast<uint32_t>(maxBytes / pDownloads->numRanges());
+			std::vector<thread::future<model::BlockRange>> rangeFutures;
+			for (auto i = 0u; i < pDownloads->numRanges(); ++i) {
+				auto height = pDownloads->startHeight(i);
+				auto options = api::BlocksFromOptions(pDownloads->numBlocks(i), maxBytesPerRange);
+				if (0 == i) {
+					rangeFutures.push_back(remoteChainApi.blocksFrom(height, options));
+					continue;
+				}
+
+				// extend the lifetime of the download peer until the completion of the request
+				const auto& pDownloadPeer = downloadPeers[i - 1];
+				rangeFutures.push_back(pDownloadPeer->blocksFrom(height, options).then([pDownloadPeer](auto&& rangeFuture) {
+					return rangeFuture.get();
+				}));
+			}
+
+			CATAPULT_LOG(debug) << "downloading blocks from " << rangeFutures.size() << " peers";
+			return thread::compose(
+					thread::when_all(std::move(rangeFutures)),
+					[pDownloads, forkDepth, pUnprocessedElements](auto&& rangesFuture) {
+						return CompleteBlockDownloads(rangesFuture.get(), *pDownloads, forkDepth, *pUnprocessedElements);
+					});
+		}
+
+		NodeInteractionFuture HashFirstBlocksFrom(
+				const api::RemoteChainApi& remoteChainApi,
+				const RemoteChainApisSupplier& downloadPeersSupplier,
+				Height height,
+				uint64_t forkDepth,
+				const ChainSynchronizerConfiguration& config,
+				const std::shared_ptr<UnprocessedElements>& pUnprocessedElements) {
+			return thread::compose(
+					remoteChainApi.hashesFrom(height),
+					[&remoteChainApi, downloadPeersSupplier, height, forkDepth, config, pUnprocessedElements](auto&& hashesFuture) {
+						try {
+							// only request blocks that can still be rolled back in case the peer is on a fork of the real chain
+							auto hashes = ToHashes(hashesFuture.get(), config.MaxRollbackBlocks);
+							if (hashes.empty()) {
+								CATAPULT_LOG(info) << "peer returned 0 hashes";
+								return thread::make_ready_future(NodeInteractionResult::Neutral);
+							}
+
+							auto downloadPeers = downloadPeersSupplier();
+							auto pDownloads = std::make_shared<const BlockDownloads>(height, std::move(hashes), downloadPeers.size() + 1);
+							return DownloadBlocks(
+									remoteChainApi,
+									std::move(downloadPeers),
+									pDownloads,
+									config.MaxChainBytesPerSyncAttempt,
+									forkDepth,
+									pUnprocessedElements);
+						} catch (const catapult_runtime_error& e) {
+							CATAPULT_LOG(warning) << "exception thrown while requesting hashes: " << e.what();
+							return thread::make_ready_future(NodeInteractionResult::Failure);
+						}
+					});
+		}
+
+		// endregion
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -227,8 +408,11 @@ namespace catapult { namespace chain {
 			explicit DefaultChainSynchronizer(
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
+					const RemoteChainApisSupplier& downloadPeersSupplier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
+					, m_config(config)
+					, m_downloadPeersSupplier(downloadPeersSupplier)
 					, m_compareChainOptions(config.MaxBlocksPerSyncAttempt, config.MaxRollbackBlocks)
 					, m_blocksFromOptions(config.MaxRollbackBlocks, config.MaxChainBytesPerSyncAttempt)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
@@ -290,9 +474,19 @@ namespace catapult { namespace chain {
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ")";
+				auto height = compareResult.CommonBlockHeight + Height(1);
+				if (m_downloadPeersSupplier)
+					return HashFirstBlocksFrom(
+							remoteChainApi,
+							m_downloadPeersSupplier,
+							height,
+							compareResult.ForkDepth,
+							m_config,
+							m_pUnprocessedElements);
+
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
-						compareResult.CommonBlockHeight + Height(1),
+						height,
 						compareResult.ForkDepth,
 						std::make_shared<RangeAggregator>(),
 						*m_pUnprocessedElements);
@@ -300,6 +494,8 @@ namespace catapult { namespace chain {
 
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
+			ChainSynchronizerConfiguration m_config;
+			RemoteChainApisSupplier m_downloadPeersSupplier;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
@@ -310,7 +506,24 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
-		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(pLocalChainApi, config, blockRangeConsumer);
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
+				pLocalChainApi,
+				config,
+				RemoteChainApisSupplier(),
+				blockRangeConsumer);
+		return CreateRemoteNodeSynchronizer(pSynchronizer);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& downloadPeersSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
+		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
+				pLocalChainApi,
+				config,
+				downloadPeersSupplier,
+				blockRangeConsumer);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
 }}
@@ -41,6 +41,9 @@ namespace catapult { namespace chain {
 			model::BlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Function signature for supplying remote chain apis around additional peers that blocks can be downloaded from.
+	using RemoteChainApisSupplier = supplier<std::vector<std::shared_ptr<const api::RemoteChainApi>>>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of blocks per sync attempt.
@@ -59,4 +62,14 @@ namespace catapult { namespace chain {
 			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 			const ChainSynchronizerConfiguration& config,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a hash-first chain synchronizer around the specified local chain api (\a pLocalChainApi), a block chain \a config,
+	/// a supplier of additional download peers (\a downloadPeersSupplier) and a block range consumer (\a blockRangeConsumer).
+	/// \note The hashes of the remote chain are pulled from the synced peer first. Afterwards, disjoint height ranges are
+	///       downloaded in parallel from the synced peer and the download peers and are consumed in order.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const RemoteChainApisSupplier& downloadPeersSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
@@ -19,13 +19,22 @@
 **/
 
 #pragma once
+#include "catapult/functions.h"
 #include "catapult/model/NetworkInfo.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/validators/ValidatorTypes.h"
 
+namespace catapult {
+	namespace cache { class CatapultCacheDelta; }
+	namespace model { struct AccountReferences; }
+}
+
 namespace catapult { namespace chain {
 
+	/// Prefetches all cache entries for accounts in \a references into \a cache.
+	using CachePrefetcher = consumer<const model::AccountReferences&, cache::CatapultCacheDelta&>;
+
 	/// Configuration for executing entities.
 	struct ExecutionConfiguration {
 	private:
@@ -45,5 +54,8 @@ namespace catapult { namespace chain {
 
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
+
+		/// Optional cache prefetcher that is called with all referenced accounts before entities are validated and observed.
+		CachePrefetcher Prefetcher;
 	};
 }}
@@ -56,12 +56,11 @@ namespace catapult { namespace chain {
 				m_observerContext.State,
 				m_observerContext.Height,
 				undoMode);
-		for (auto iter = m_notificationBuffers.crbegin(); m_notificationBuffers.crend() != iter; ++iter) {
-			const auto* pNotification = reinterpret_cast<const model::Notification*>(iter->data());
-			m_observer.notify(*pNotification, undoObserverContext);
-		}
+		m_undoTape.forEachReverse([this, &undoObserverContext](const auto& notification) {
+			m_observer.notify(notification, undoObserverContext);
+		});
 
-		m_notificationBuffers.clear();
+		m_undoTape.clear();
 	}
 
 	void ProcessingNotificationSubscriber::notify(const model::Notification& notification) {
@@ -95,8 +94,7 @@ namespace catapult { namespace chain {
 		if (!m_isUndoEnabled)
 			return;
 
-		// store a copy of the notification buffer
-		const auto* pData = reinterpret_cast<const uint8_t*>(&notification);
-		m_notificationBuffers.emplace_back(pData, pData + notification.Size);
+		// record the notification so that it can be undone
+		m_undoTape.notify(notification);
 	}
 }}
@@ -19,7 +19,7 @@
 **/
 
 #pragma once
-#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/NotificationTape.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/validators/ValidatorContext.h"
 #include "catapult/validators/ValidatorTypes.h"
@@ -62,6 +62,6 @@ namespace catapult { namespace chain {
 
 		validators::ValidationResult m_aggregateResult;
 		bool m_isUndoEnabled;
-		std::vector<std::vector<uint8_t>> m_notificationBuffers;
+		model::NotificationTape m_undoTape;
 	};
 }}
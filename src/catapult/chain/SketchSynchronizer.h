@@ -0,0 +1,129 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NodeInteractionResult.h"
+#include "catapult/thread/FutureUtils.h"
+#include "catapult/utils/Logging.h"
+#include <atomic>
+
+namespace catapult { namespace chain {
+
+	/// Options for a sketch synchronizer.
+	struct SketchSynchronizerOptions {
+		/// Minimum (and initial) number of requested sketch cells.
+		uint32_t MinNumCells;
+
+		/// Maximum number of requested sketch cells.
+		uint32_t MaxNumCells;
+	};
+
+	/// An entities synchronizer that reconciles local and remote entities by exchanging reconciliation sketches
+	/// so that only entities missing locally are transferred.
+	/// \note When the difference cannot be decoded, all entities are pulled from the remote instead.
+	template<typename TSynchronizerTraits>
+	class SketchSynchronizer {
+	public:
+		using RemoteApiType = typename TSynchronizerTraits::RemoteApiType;
+
+	private:
+		using SketchType = typename TSynchronizerTraits::SketchType;
+		using KeyType = typename SketchType::KeyType;
+		using NodeInteractionFuture = thread::future<NodeInteractionResult>;
+
+	public:
+		/// Creates a sketch synchronizer around \a traits and \a options.
+		SketchSynchronizer(TSynchronizerTraits&& traits, const SketchSynchronizerOptions& options)
+				: m_traits(std::move(traits))
+				, m_options(options)
+				, m_numCells(options.MinNumCells)
+		{}
+
+	public:
+		/// Gets the number of cells that will be requested in the next sketch.
+		uint32_t numCells() const {
+			return m_numCells;
+		}
+
+	public:
+		/// Pulls entities from a remote node using \a api.
+		NodeInteractionFuture operator()(const RemoteApiType& api) {
+			auto numCells = m_numCells.load();
+			return thread::compose(m_traits.sketchApiCall(api, numCells), [this, &api, numCells](auto&& cellsFuture) {
+				try {
+					return this->reconcile(api, numCells, cellsFuture.get());
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting " << TSynchronizerTraits::Name << " sketch: " << e.what();
+					return thread::make_ready_future(NodeInteractionResult::Failure);
+				}
+			});
+		}
+
+	private:
+		template<typename TCellRange>
+		NodeInteractionFuture reconcile(const RemoteApiType& api, uint32_t numCells, const TCellRange& cells) {
+			auto sketch = SketchType(std::vector<typename SketchType::Cell>(cells.cbegin(), cells.cend()));
+			sketch.subtract(m_traits.localSketch(numCells));
+
+			std::vector<KeyType> remoteKeys;
+			std::vector<KeyType> localKeys;
+			if (!sketch.decode(remoteKeys, localKeys)) {
+				// use a larger sketch next time and pull everything this time
+				m_numCells = std::min(2 * numCells, m_options.MaxNumCells);
+				CATAPULT_LOG(debug)
+						<< "unable to decode " << TSynchronizerTraits::Name << " sketch with " << numCells
+						<< " cells, falling back to full pull";
+				return pull(m_traits.fallbackApiCall(api));
+			}
+
+			// size the next sketch so that a similar difference can be decoded with high probability
+			auto minNumCells = std::max<size_t>(m_options.MinNumCells, 3 * (remoteKeys.size() + localKeys.size()));
+			m_numCells = static_cast<uint32_t>(std::min<size_t>(SketchType::CalculateNumCells(minNumCells), m_options.MaxNumCells));
+			if (remoteKeys.empty())
+				return thread::make_ready_future(NodeInteractionResult::Neutral);
+
+			CATAPULT_LOG(debug) << "sketch difference contains " << remoteKeys.size() << " unknown " << TSynchronizerTraits::Name;
+			return pull(m_traits.differenceApiCall(api, remoteKeys));
+		}
+
+		template<typename TRangeFuture>
+		NodeInteractionFuture pull(TRangeFuture&& rangeFuture) {
+			return rangeFuture.then([&traits = m_traits](auto&& future) {
+				try {
+					auto range = future.get();
+					if (range.empty())
+						return NodeInteractionResult::Neutral;
+
+					CATAPULT_LOG(debug) << "peer returned " << range.size() << " " << TSynchronizerTraits::Name;
+					traits.consume(std::move(range));
+					return NodeInteractionResult::Success;
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting " << TSynchronizerTraits::Name << ": " << e.what();
+					return NodeInteractionResult::Failure;
+				}
+			});
+		}
+
+	private:
+		TSynchronizerTraits m_traits;
+		SketchSynchronizerOptions m_options;
+		std::atomic<uint32_t> m_numCells;
+	};
+}}
@@ -0,0 +1,122 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "TransactionDependencies.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "catapult/model/PublicKeyAddressCache.h"
+
+namespace catapult { namespace chain {
+
+	namespace {
+		class DependenciesCollector : public model::NotificationSubscriber {
+		public:
+			DependenciesCollector(TransactionDependencies& dependencies, model::NetworkIdentifier networkIdentifier)
+					: m_dependencies(dependencies)
+					, m_networkIdentifier(networkIdentifier)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_dependencies.add(notification, m_networkIdentifier);
+			}
+
+		private:
+			TransactionDependencies& m_dependencies;
+			model::NetworkIdentifier m_networkIdentifier;
+		};
+
+		model::FacilityCode GetFacilityCode(model::NotificationType type) {
+			return static_cast<model::FacilityCode>((utils::to_underlying_type(type) >> 16) & 0xFF);
+		}
+
+		bool IsMosaicStateFacility(model::FacilityCode facilityCode) {
+			// mosaic definitions are owned by namespaces, so changes to either can affect mosaic transfers
+			return model::FacilityCode::Mosaic == facilityCode || model::FacilityCode::Namespace == facilityCode;
+		}
+
+		template<typename TSet>
+		bool HasIntersection(const TSet& lhs, const TSet& rhs) {
+			const auto& smaller = lhs.size() < rhs.size() ? lhs : rhs;
+			const auto& larger = lhs.size() < rhs.size() ? rhs : lhs;
+			return std::any_of(smaller.cbegin(), smaller.cend(), [&larger](const auto& value) {
+				return larger.cend() != larger.find(value);
+			});
+		}
+	}
+
+	void TransactionDependencies::add(const model::WeakEntityInfo& entityInfo, const model::NotificationPublisher& publisher) {
+		DependenciesCollector sub(*this, entityInfo.entity().Network());
+		publisher.publish(entityInfo, sub);
+	}
+
+	void TransactionDependencies::add(const model::Notification& notification, model::NetworkIdentifier networkIdentifier) {
+		if (model::Core_Register_Account_Address_Notification == notification.Type) {
+			add(static_cast<const model::AccountAddressNotification&>(notification).Address);
+		} else if (model::Core_Register_Account_Public_Key_Notification == notification.Type) {
+			const auto& publicKey = static_cast<const model::AccountPublicKeyNotification&>(notification).PublicKey;
+			add(model::CachedPublicKeyToAddress(publicKey, networkIdentifier));
+		} else if (model::Core_Balance_Transfer_Notification == notification.Type) {
+			const auto& transferNotification = static_cast<const model::BalanceTransferNotification&>(notification);
+			add(model::CachedPublicKeyToAddress(transferNotification.Sender, networkIdentifier));
+			add(transferNotification.Recipient);
+			m_mosaicIds.insert(transferNotification.MosaicId);
+		} else if (model::Core_Balance_Reserve_Notification == notification.Type) {
+			const auto& reserveNotification = static_cast<const model::BalanceReserveNotification&>(notification);
+			add(model::CachedPublicKeyToAddress(reserveNotification.Sender, networkIdentifier));
+			m_mosaicIds.insert(reserveNotification.MosaicId);
+		}
+
+		// non-core notifications cannot be interpreted here, so they are tracked by facility
+		auto facilityCode = GetFacilityCode(notification.Type);
+		if (model::FacilityCode::Core == facilityCode)
+			return;
+
+		m_referencedFacilities.insert(facilityCode);
+		if (IsSet(notification.Type, model::NotificationChannel::Observer))
+			m_modifiedFacilities.insert(facilityCode);
+	}
+
+	void TransactionDependencies::add(const Address& address) {
+		m_addresses.insert(address);
+	}
+
+	void TransactionDependencies::add(const TransactionDependencies& dependencies) {
+		m_addresses.insert(dependencies.m_addresses.cbegin(), dependencies.m_addresses.cend());
+		m_mosaicIds.insert(dependencies.m_mosaicIds.cbegin(), dependencies.m_mosaicIds.cend());
+		m_referencedFacilities.insert(dependencies.m_referencedFacilities.cbegin(), dependencies.m_referencedFacilities.cend());
+		m_modifiedFacilities.insert(dependencies.m_modifiedFacilities.cbegin(), dependencies.m_modifiedFacilities.cend());
+	}
+
+	bool TransactionDependencies::empty() const {
+		return m_addresses.empty() && m_mosaicIds.empty() && m_referencedFacilities.empty();
+	}
+
+	bool TransactionDependencies::affects(const TransactionDependencies& dependencies) const {
+		if (HasIntersection(m_addresses, dependencies.m_addresses) || HasIntersection(m_mosaicIds, dependencies.m_mosaicIds))
+			return true;
+
+		if (HasIntersection(m_modifiedFacilities, dependencies.m_referencedFacilities))
+			return true;
+
+		return !dependencies.m_mosaicIds.empty() && std::any_of(m_modifiedFacilities.cbegin(), m_modifiedFacilities.cend(), IsMosaicStateFacility);
+	}
+}}
@@ -0,0 +1,67 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/ContainerTypes.h"
+#include "catapult/model/FacilityCode.h"
+#include "catapult/model/WeakEntityInfo.h"
+#include "catapult/utils/Hashers.h"
+#include <unordered_set>
+
+namespace catapult {
+	namespace model {
+		struct Notification;
+		class NotificationPublisher;
+	}
+}
+
+namespace catapult { namespace chain {
+
+	/// State dependencies of one or more entities.
+	/// \note Accounts and mosaics are tracked individually via core notifications.
+	///       All other state (e.g. namespaces) is tracked at facility granularity via non-core notifications.
+	class TransactionDependencies {
+	public:
+		/// Adds all dependencies of \a entityInfo as published by \a publisher.
+		void add(const model::WeakEntityInfo& entityInfo, const model::NotificationPublisher& publisher);
+
+		/// Adds the dependencies of \a notification, which was published by an entity with network \a networkIdentifier.
+		void add(const model::Notification& notification, model::NetworkIdentifier networkIdentifier);
+
+		/// Adds an account dependency on \a address.
+		void add(const Address& address);
+
+		/// Adds all dependencies in \a dependencies.
+		void add(const TransactionDependencies& dependencies);
+
+	public:
+		/// Returns \c true if there are no dependencies.
+		bool empty() const;
+
+		/// Returns \c true if the state represented by \a dependencies is affected by changes to the state represented by this object.
+		bool affects(const TransactionDependencies& dependencies) const;
+
+	private:
+		model::AddressSet m_addresses;
+		std::unordered_set<MosaicId, utils::BaseValueHasher<MosaicId>> m_mosaicIds;
+		std::unordered_set<model::FacilityCode> m_referencedFacilities;
+		std::unordered_set<model::FacilityCode> m_modifiedFacilities;
+	};
+}}
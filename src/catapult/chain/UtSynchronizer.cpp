@@ -19,7 +19,9 @@
 **/
 
 #include "UtSynchronizer.h"
+#include "AnnouncedTransactions.h"
 #include "EntitiesSynchronizer.h"
+#include "SketchSynchronizer.h"
 #include "catapult/api/RemoteTransactionApi.h"
 
 namespace catapult { namespace chain {
@@ -51,6 +53,40 @@ namespace catapult { namespace chain {
 			ShortHashesSupplier m_shortHashesSupplier;
 			handlers::TransactionRangeHandler m_transactionRangeConsumer;
 		};
+
+		struct UtSketchTraits : public UtTraits {
+		public:
+			using SketchType = cache::UtSketch;
+
+		public:
+			explicit UtSketchTraits(
+					const UtSketchSupplier& sketchSupplier,
+					const ShortHashesSupplier& shortHashesSupplier,
+					const handlers::TransactionRangeHandler& transactionRangeConsumer)
+					: UtTraits(shortHashesSupplier, transactionRangeConsumer)
+					, m_sketchSupplier(sketchSupplier)
+			{}
+
+		public:
+			thread::future<cache::UtSketchCellRange> sketchApiCall(const RemoteApiType& api, uint32_t numCells) const {
+				return api.unconfirmedTransactionsSketch(numCells);
+			}
+
+			cache::UtSketch localSketch(uint32_t numCells) const {
+				return m_sketchSupplier(numCells);
+			}
+
+			thread::future<model::TransactionRange> differenceApiCall(const RemoteApiType& api, const std::vector<Hash256>& hashes) const {
+				return api.unconfirmedTransactionsByHash(model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size()));
+			}
+
+			thread::future<model::TransactionRange> fallbackApiCall(const RemoteApiType& api) const {
+				return apiCall(api);
+			}
+
+		private:
+			UtSketchSupplier m_sketchSupplier;
+		};
 	}
 
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
@@ -60,4 +96,46 @@ namespace catapult { namespace chain {
 		auto pSynchronizer = std::make_shared<EntitiesSynchronizer<UtTraits>>(std::move(traits));
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
+
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSketchSynchronizer(
+			const UtSketchSupplier& sketchSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+		auto traits = UtSketchTraits(sketchSupplier, shortHashesSupplier, transactionRangeConsumer);
+		auto options = SketchSynchronizerOptions{ cache::Min_Sketch_Num_Cells, cache::Max_Sketch_Num_Cells };
+		auto pSynchronizer = std::make_shared<SketchSynchronizer<UtSketchTraits>>(std::move(traits), options);
+		return CreateRemoteNodeSynchronizer(pSynchronizer);
+	}
+
+	AnnouncedUtSynchronizer CreateAnnouncedUtSynchronizer(
+			const std::shared_ptr<AnnouncedTransactions>& pAnnouncedTransactions,
+			const supplier<Timestamp>& timeSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer) {
+		return [pAnnouncedTransactions, timeSupplier, transactionRangeConsumer](const auto& api, const auto& remotePublicKey) {
+			auto hashes = pAnnouncedTransactions->startRequest(remotePublicKey, timeSupplier());
+			if (hashes.empty())
+				return thread::make_ready_future(NodeInteractionResult::Neutral);
+
+			auto hashRange = model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+			return api.unconfirmedTransactionsByHash(std::move(hashRange)).then([
+					pAnnouncedTransactions,
+					transactionRangeConsumer,
+					remotePublicKey,
+					hashes](auto&& rangeFuture) {
+				pAnnouncedTransactions->completeRequest(remotePublicKey, hashes);
+				try {
+					auto range = rangeFuture.get();
+					if (range.empty())
+						return NodeInteractionResult::Neutral;
+
+					CATAPULT_LOG(debug) << "peer returned " << range.size() << " announced unconfirmed transactions";
+					transactionRangeConsumer({ std::move(range), remotePublicKey });
+					return NodeInteractionResult::Success;
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning) << "exception thrown while requesting announced unconfirmed transactions: " << e.what();
+					return NodeInteractionResult::Failure;
+				}
+			});
+		};
+	}
 }}
@@ -20,10 +20,14 @@
 
 #pragma once
 #include "RemoteNodeSynchronizer.h"
+#include "catapult/cache/TransactionSketches.h"
 #include "catapult/handlers/HandlerTypes.h"
 #include "catapult/model/RangeTypes.h"
 
-namespace catapult { namespace api { class RemoteTransactionApi; } }
+namespace catapult {
+	namespace api { class RemoteTransactionApi; }
+	namespace chain { class AnnouncedTransactions; }
+}
 
 namespace catapult { namespace chain {
 
@@ -35,4 +39,27 @@ namespace catapult { namespace chain {
 	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSynchronizer(
 			const ShortHashesSupplier& shortHashesSupplier,
 			const handlers::TransactionRangeHandler& transactionRangeConsumer);
+
+	/// Function signature for supplying a reconciliation sketch with a given number of cells.
+	using UtSketchSupplier = std::function<cache::UtSketch (uint32_t)>;
+
+	/// Creates an unconfirmed transactions synchronizer that reconciles the local sketch supplied by \a sketchSupplier
+	/// with a remote sketch and forwards the missing transactions to \a transactionRangeConsumer.
+	/// \note When the sketch difference cannot be decoded, \a shortHashesSupplier is used to pull all unknown transactions.
+	RemoteNodeSynchronizer<api::RemoteTransactionApi> CreateUtSketchSynchronizer(
+			const UtSketchSupplier& sketchSupplier,
+			const ShortHashesSupplier& shortHashesSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer);
+
+	/// Function signature for synchronizing announced transactions with a remote node with a known identity.
+	using AnnouncedUtSynchronizer = std::function<thread::future<NodeInteractionResult> (
+			const api::RemoteTransactionApi&,
+			const Key&)>;
+
+	/// Creates an announced unconfirmed transactions synchronizer that requests transactions tracked by \a pAnnouncedTransactions
+	/// from the peers that announced them at times supplied by \a timeSupplier and forwards them to \a transactionRangeConsumer.
+	AnnouncedUtSynchronizer CreateAnnouncedUtSynchronizer(
+			const std::shared_ptr<AnnouncedTransactions>& pAnnouncedTransactions,
+			const supplier<Timestamp>& timeSupplier,
+			const handlers::TransactionRangeHandler& transactionRangeConsumer);
 }}
@@ -21,6 +21,7 @@
 #include "UtUpdater.h"
 #include "ChainResults.h"
 #include "ProcessingNotificationSubscriber.h"
+#include "TransactionDependencies.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/cache/RelockableDetachedCatapultCache.h"
@@ -30,14 +31,69 @@
 namespace catapult { namespace chain {
 
 	namespace {
+		using DependenciesMap = std::unordered_map<Hash256, TransactionDependencies, utils::ArrayHasher<Hash256>>;
+
 		struct ApplyState {
-			constexpr ApplyState(cache::UtCacheModifierProxy& modifier, cache::CatapultCacheDelta& unconfirmedCatapultCache)
+			ApplyState(
+					cache::UtCacheModifierProxy& modifier,
+					cache::CatapultCacheDelta& unconfirmedCatapultCache,
+					DependenciesMap& dependencies)
 					: Modifier(modifier)
 					, UnconfirmedCatapultCache(unconfirmedCatapultCache)
+					, Dependencies(dependencies)
+					, pChangedDependencies(nullptr)
 			{}
 
 			cache::UtCacheModifierProxy& Modifier;
 			cache::CatapultCacheDelta& UnconfirmedCatapultCache;
+
+			// dependencies of all transactions that have been added to the ut cache
+			DependenciesMap& Dependencies;
+
+			// dependencies that have changed since the existing transactions were last validated
+			// (nullptr if all existing transactions should be revalidated)
+			TransactionDependencies* pChangedDependencies;
+		};
+
+		class DependenciesCollectingSubscriber : public model::NotificationSubscriber {
+		public:
+			DependenciesCollectingSubscriber(
+					model::NotificationSubscriber& subscriber,
+					TransactionDependencies& dependencies,
+					model::NetworkIdentifier networkIdentifier)
+					: m_subscriber(subscriber)
+					, m_dependencies(dependencies)
+					, m_networkIdentifier(networkIdentifier)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				m_dependencies.add(notification, m_networkIdentifier);
+				m_subscriber.notify(notification);
+			}
+
+		private:
+			model::NotificationSubscriber& m_subscriber;
+			TransactionDependencies& m_dependencies;
+			model::NetworkIdentifier m_networkIdentifier;
+		};
+
+		class ObservingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			ObservingNotificationSubscriber(const observers::NotificationObserver& observer, const observers::ObserverContext& observerContext)
+					: m_observer(observer)
+					, m_observerContext(observerContext)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (IsSet(notification.Type, model::NotificationChannel::Observer))
+					m_observer.notify(notification, m_observerContext);
+			}
+
+		private:
+			const observers::NotificationObserver& m_observer;
+			const observers::ObserverContext& m_observerContext;
 		};
 	}
 
@@ -70,11 +126,14 @@ namespace catapult { namespace chain {
 				return;
 			}
 
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, m_dependencies);
 			apply(applyState, utInfos, TransactionSource::New);
 		}
 
-		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const TransactionDependencies* pChangedDependencies) {
 			if (!confirmedTransactionHashes.empty() || !utInfos.empty()) {
 				CATAPULT_LOG(debug)
 						<< "confirmed " << confirmedTransactionHashes.size() << " transactions, "
@@ -89,22 +148,32 @@ namespace catapult { namespace chain {
 			auto originalTransactionInfos = modifier.removeAll();
 
 			// 3. add back reverted txes
-			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache);
+			DependenciesMap dependencies;
+			auto applyState = ApplyState(modifier, *pUnconfirmedCatapultCache, dependencies);
+			std::unique_ptr<TransactionDependencies> pChangedDependenciesCopy;
+			if (pChangedDependencies) {
+				pChangedDependenciesCopy = std::make_unique<TransactionDependencies>(*pChangedDependencies);
+				applyState.pChangedDependencies = pChangedDependenciesCopy.get();
+			}
+
 			apply(applyState, utInfos, TransactionSource::Reverted);
 
 			// 4. add back original txes that have not been confirmed
 			apply(applyState, originalTransactionInfos, TransactionSource::Existing, [&confirmedTransactionHashes](const auto& info) {
 				return confirmedTransactionHashes.cend() == confirmedTransactionHashes.find(&info.EntityHash);
 			});
+
+			// 5. only retain dependencies of txes that are still unconfirmed
+			m_dependencies = std::move(dependencies);
 		}
 
 	private:
-		void apply(const ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
+		void apply(ApplyState& applyState, const std::vector<model::TransactionInfo>& utInfos, TransactionSource transactionSource) {
 			apply(applyState, utInfos, transactionSource, [](const auto&) { return true; });
 		}
 
 		void apply(
-				const ApplyState& applyState,
+				ApplyState& applyState,
 				const std::vector<model::TransactionInfo>& utInfos,
 				TransactionSource transactionSource,
 				const predicate<const model::TransactionInfo&>& filter) {
@@ -131,17 +200,24 @@ namespace catapult { namespace chain {
 				if (throttle(utInfo, transactionSource, applyState, readOnlyCache)) {
 					CATAPULT_LOG(warning) << "dropping transaction " << utils::HexFormat(entityHash) << " due to throttle";
 					m_failedTransactionSink(entity, entityHash, Failure_Chain_Unconfirmed_Cache_Too_Full);
+					markDropped(applyState, transactionSource, entityHash);
 					continue;
 				}
 
 				if (!applyState.Modifier.add(utInfo))
 					continue;
 
+				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
+				if (TransactionSource::Existing == transactionSource && tryReapply(applyState, entityInfo, currentTime, observerContext))
+					continue;
+
 				// notice that subscriber is created within loop because aggregate result needs to be reset each iteration
 				ProcessingNotificationSubscriber sub(*m_config.pValidator, validatorContext, *m_config.pObserver, observerContext);
 				sub.enableUndo();
-				auto entityInfo = model::WeakEntityInfo(entity, entityHash);
-				m_config.pNotificationPublisher->publish(entityInfo, sub);
+
+				TransactionDependencies dependencies;
+				DependenciesCollectingSubscriber collectingSub(sub, dependencies, entity.Network());
+				m_config.pNotificationPublisher->publish(entityInfo, collectingSub);
 				if (!IsValidationResultSuccess(sub.result())) {
 					CATAPULT_LOG_LEVEL(validators::MapToLogLevel(sub.result()))
 							<< "dropping transaction " << utils::HexFormat(entityHash) << ": " << sub.result();
@@ -152,11 +228,58 @@ namespace catapult { namespace chain {
 
 					sub.undo();
 					applyState.Modifier.remove(entityHash);
+					markDropped(applyState, transactionSource, entityHash);
 					continue;
 				}
+
+				// reverted txes were not part of the previous unconfirmed state, so any existing txes sharing their dependencies
+				// need to be revalidated
+				if (TransactionSource::Reverted == transactionSource && applyState.pChangedDependencies)
+					applyState.pChangedDependencies->add(dependencies);
+
+				applyState.Dependencies[entityHash] = std::move(dependencies);
 			}
 		}
 
+		bool tryReapply(
+				const ApplyState& applyState,
+				const model::WeakEntityInfo& entityInfo,
+				Timestamp currentTime,
+				const observers::ObserverContext& observerContext) {
+			if (!applyState.pChangedDependencies)
+				return false;
+
+			auto iter = m_dependencies.find(entityInfo.hash());
+			if (m_dependencies.cend() == iter)
+				return false;
+
+			// expired txes and txes with changed dependencies need to be revalidated
+			const auto& transaction = static_cast<const model::Transaction&>(entityInfo.entity());
+			if (transaction.Deadline < currentTime || applyState.pChangedDependencies->affects(iter->second))
+				return false;
+
+			// the transaction is still valid, but its changes need to be reapplied to the rebased unconfirmed cache
+			ObservingNotificationSubscriber sub(*m_config.pObserver, observerContext);
+			m_config.pNotificationPublisher->publish(entityInfo, sub);
+			applyState.Dependencies[entityInfo.hash()] = std::move(iter->second);
+			m_dependencies.erase(iter);
+			return true;
+		}
+
+		void markDropped(ApplyState& applyState, TransactionSource transactionSource, const Hash256& entityHash) const {
+			// only existing txes were part of the previous unconfirmed state
+			if (!applyState.pChangedDependencies || TransactionSource::Existing != transactionSource)
+				return;
+
+			// subsequent txes could depend on the changes of a dropped tx, so its dependencies are treated as changed
+			// (when they are unknown, all subsequent txes are revalidated)
+			auto iter = m_dependencies.find(entityHash);
+			if (m_dependencies.cend() == iter)
+				applyState.pChangedDependencies = nullptr;
+			else
+				applyState.pChangedDependencies->add(iter->second);
+		}
+
 		bool throttle(
 				const model::TransactionInfo& utInfo,
 				TransactionSource transactionSource,
@@ -177,6 +300,7 @@ namespace catapult { namespace chain {
 		TimeSupplier m_timeSupplier;
 		FailedTransactionSink m_failedTransactionSink;
 		UtUpdater::Throttle m_throttle;
+		DependenciesMap m_dependencies;
 	};
 
 	UtUpdater::UtUpdater(
@@ -202,6 +326,13 @@ namespace catapult { namespace chain {
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
-		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_pImpl->update(confirmedTransactionHashes, utInfos, nullptr);
+	}
+
+	void UtUpdater::update(
+			const utils::HashPointerSet& confirmedTransactionHashes,
+			const std::vector<model::TransactionInfo>& utInfos,
+			const TransactionDependencies& changedDependencies) {
+		m_pImpl->update(confirmedTransactionHashes, utInfos, &changedDependencies);
 	}
 }}
@@ -35,6 +35,8 @@ namespace catapult {
 
 namespace catapult { namespace chain {
 
+	class TransactionDependencies;
+
 	/// Provides batch updating of an unconfirmed transactions cache.
 	class UtUpdater {
 	public:
@@ -90,6 +92,15 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+		/// Updates this cache by applying new transaction infos in \a utInfos and
+		/// removing transactions with hashes in \a confirmedTransactionHashes.
+		/// Only remaining transactions that are expired or affected by \a changedDependencies are revalidated;
+		/// all other remaining transactions are reapplied without validation.
+		void update(
+				const utils::HashPointerSet& confirmedTransactionHashes,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const TransactionDependencies& changedDependencies);
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
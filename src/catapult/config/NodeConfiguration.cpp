@@ -40,12 +40,18 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAllowAddressReuse);
 		LOAD_NODE_PROPERTY(ShouldUseSingleThreadPool);
 		LOAD_NODE_PROPERTY(ShouldUseCacheDatabaseStorage);
+		LOAD_NODE_PROPERTY(ShouldUseSegmentedBlockStorage);
 
 		LOAD_NODE_PROPERTY(ShouldEnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
 
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxBlockDownloadPeers);
+		LOAD_NODE_PROPERTY(BlockLoadPrefetchDepth);
+		LOAD_NODE_PROPERTY(BlockLoadCommitInterval);
+		LOAD_NODE_PROPERTY(StateStorageWorkerThreads);
+		LOAD_NODE_PROPERTY(BlockStorageCacheSize);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -70,6 +76,10 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(ShouldAbortWhenDispatcherIsFull);
 		LOAD_NODE_PROPERTY(ShouldAuditDispatcherInputs);
 		LOAD_NODE_PROPERTY(ShouldPrecomputeTransactionAddresses);
+		LOAD_NODE_PROPERTY(ShouldBatchVerifySignatures);
+		LOAD_NODE_PROPERTY(ShouldIncrementallyRevalidateTransactions);
+		LOAD_NODE_PROPERTY(ShouldAnnounceTransactions);
+		LOAD_NODE_PROPERTY(ShouldReconcileTransactions);
 
 		LOAD_NODE_PROPERTY(OutgoingSecurityMode);
 		LOAD_NODE_PROPERTY(IncomingSecurityModes);
@@ -100,10 +110,42 @@ namespace catapult { namespace config {
 
 #undef LOAD_IN_CONNECTIONS_PROPERTY
 
+#define LOAD_CACHE_DATABASE_PROPERTY(NAME) utils::LoadIniProperty(bag, "cache_database", #NAME, config.CacheDatabase.NAME)
+
+		LOAD_CACHE_DATABASE_PROPERTY(BlockCacheSize);
+		LOAD_CACHE_DATABASE_PROPERTY(WriteBufferSize);
+		LOAD_CACHE_DATABASE_PROPERTY(BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_PROPERTY(CompactionStyle);
+		LOAD_CACHE_DATABASE_PROPERTY(Compression);
+		LOAD_CACHE_DATABASE_PROPERTY(ShouldEnableStatistics);
+		LOAD_CACHE_DATABASE_PROPERTY(HotEntryCacheSize);
+
+#undef LOAD_CACHE_DATABASE_PROPERTY
+
+		size_t numColumnFamilyProperties = 0;
+		for (const auto& section : bag.sections()) {
+			std::string prefix("cache_database:");
+			if (section.size() <= prefix.size() || 0 != section.find(prefix))
+				continue;
+
+#define LOAD_COLUMN_FAMILY_PROPERTY(NAME) utils::LoadIniProperty(bag, section.c_str(), #NAME, columnFamilyOptions.NAME)
+
+			cache::RdbColumnFamilyOptions columnFamilyOptions;
+			LOAD_COLUMN_FAMILY_PROPERTY(WriteBufferSize);
+			LOAD_COLUMN_FAMILY_PROPERTY(BloomFilterBitsPerKey);
+			LOAD_COLUMN_FAMILY_PROPERTY(CompactionStyle);
+			LOAD_COLUMN_FAMILY_PROPERTY(Compression);
+
+#undef LOAD_COLUMN_FAMILY_PROPERTY
+
+			config.CacheDatabase.ColumnFamilyOptions.emplace(section.substr(prefix.size()), columnFamilyOptions);
+			numColumnFamilyProperties += 4;
+		}
+
 		auto extensionsPair = utils::ExtractSectionAsUnorderedSet(bag, "extensions");
 		config.Extensions = extensionsPair.first;
 
-		utils::VerifyBagSizeLte(bag, 29 + 4 + 2 + 3 + extensionsPair.second);
+		utils::VerifyBagSizeLte(bag, 39 + 4 + 2 + 3 + 7 + numColumnFamilyProperties + extensionsPair.second);
 		return config;
 	}
 
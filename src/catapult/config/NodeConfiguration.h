@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/cache_db/RocksDatabaseOptions.h"
 #include "catapult/ionet/ConnectionSecurityMode.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/utils/FileSize.h"
@@ -47,6 +48,9 @@ namespace catapult { namespace config {
 		/// \c true if cache data should be saved in a database.
 		bool ShouldUseCacheDatabaseStorage;
 
+		/// \c true if blocks should be saved in memory-mapped segment files instead of one file per block.
+		bool ShouldUseSegmentedBlockStorage;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool ShouldEnableTransactionSpamThrottling;
 
@@ -59,6 +63,23 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of peers that blocks are downloaded from in parallel during a sync attempt
+		/// (\c 1 pulls all blocks from the synced peer).
+		uint32_t MaxBlockDownloadPeers;
+
+		/// Number of blocks to load ahead of execution when loading the block chain from storage (\c 0 disables prefetching).
+		uint32_t BlockLoadPrefetchDepth;
+
+		/// Number of blocks to execute between cache commits when loading the block chain from storage.
+		uint32_t BlockLoadCommitInterval;
+
+		/// Number of worker threads used to load and save cache state snapshots (\c 0 or \c 1 processes caches sequentially).
+		uint32_t StateStorageWorkerThreads;
+
+		/// Maximum total size of recently saved blocks that are kept in memory by the block storage cache.
+		/// \note The most recently saved block is always kept in memory.
+		utils::FileSize BlockStorageCacheSize;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -114,6 +135,19 @@ namespace catapult { namespace config {
 		/// \c true if all transaction addresses should be extracted during dispatcher processing.
 		bool ShouldPrecomputeTransactionAddresses;
 
+		/// \c true if all signatures in a dispatcher input should be verified together before falling back to individual verification.
+		bool ShouldBatchVerifySignatures;
+
+		/// \c true if only unconfirmed transactions affected by a block chain change should be revalidated after the change is committed.
+		/// \note Height based expiration (e.g. of namespaces, mosaics and locks) is not tracked as a change.
+		bool ShouldIncrementallyRevalidateTransactions;
+
+		/// \c true if new transactions should be announced to peers by hash and only fetched by peers that do not have them.
+		bool ShouldAnnounceTransactions;
+
+		/// \c true if unconfirmed and partial transactions should be synchronized with peers by exchanging reconciliation sketches.
+		bool ShouldReconcileTransactions;
+
 		/// Security mode of outgoing connections initiated by this node.
 		ionet::ConnectionSecurityMode OutgoingSecurityMode;
 
@@ -166,6 +200,11 @@ namespace catapult { namespace config {
 		/// Incoming connections configuration.
 		IncomingConnectionsSubConfiguration IncomingConnections;
 
+	public:
+		/// Cache database configuration.
+		/// \note Column families are tuned individually by sections named 'cache_database:<column family name>'.
+		cache::RocksDatabaseOptions CacheDatabase;
+
 	private:
 		NodeConfiguration() = default;
 
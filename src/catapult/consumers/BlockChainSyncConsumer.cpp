@@ -22,6 +22,7 @@
 #include "ConsumerResultFactory.h"
 #include "InputUtils.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/chain/ChainUtils.h"
 #include "catapult/io/BlockStorageCache.h"
@@ -37,6 +38,22 @@ namespace catapult { namespace consumers {
 			return disruptor::CompletionStatus::Aborted == result.CompletionStatus;
 		}
 
+		template<typename TAccountStates>
+		void AddAddresses(model::AddressSet& addresses, const TAccountStates& accountStates) {
+			for (const auto* pAccountState : accountStates)
+				addresses.insert(pAccountState->Address);
+		}
+
+		model::AddressSet CollectChangedAddresses(const cache::CatapultCacheDelta& cacheDelta) {
+			const auto& accountStateCacheDelta = cacheDelta.sub<cache::AccountStateCache>();
+
+			model::AddressSet addresses;
+			AddAddresses(addresses, accountStateCacheDelta.addedElements());
+			AddAddresses(addresses, accountStateCacheDelta.modifiedElements());
+			AddAddresses(addresses, accountStateCacheDelta.removedElements());
+			return addresses;
+		}
+
 		struct UnwindResult {
 		public:
 			model::ChainScore Score;
@@ -130,14 +147,16 @@ namespace catapult { namespace consumers {
 			ConsumerResult operator()(disruptor::ConsumerInput& input) const {
 				return input.empty()
 						? Abort(Failure_Consumer_Empty_Input)
-						: sync(input.blocks(), input.source());
+						: sync(input);
 			}
 
 		private:
-			ConsumerResult sync(BlockElements& elements, InputSource source) const {
+			ConsumerResult sync(disruptor::ConsumerInput& input) const {
+				auto& elements = input.blocks();
+
 				// 1. preprocess the peer and local chains and extract the sync state
 				SyncState syncState;
-				auto intermediateResult = preprocess(elements, source, syncState);
+				auto intermediateResult = preprocess(elements, input.source(), syncState);
 				if (IsAborted(intermediateResult))
 					return intermediateResult;
 
@@ -147,7 +166,7 @@ namespace catapult { namespace consumers {
 					return intermediateResult;
 
 				// 3. commit all changes
-				commitAll(elements, syncState);
+				commitAll(input, syncState);
 				return Continue();
 			}
 
@@ -243,16 +262,21 @@ namespace catapult { namespace consumers {
 				return Continue();
 			}
 
-			void commitAll(const BlockElements& elements, SyncState& syncState) const {
+			void commitAll(const disruptor::ConsumerInput& input, SyncState& syncState) const {
+				const auto& elements = input.blocks();
 				auto newHeight = elements.back().Block.Height;
 
-				// 1. save the peer chain into storage
-				commitToStorage(syncState.commonBlockHeight(), elements);
+				// 1. save the peer chain into storage (elements are shared with the storage cache instead of being copied)
+				commitToStorage(syncState.commonBlockHeight(), input.sharedBlocks());
 
 				// 2. indicate a state change
 				m_handlers.StateChange(StateChangeInfo(syncState.cacheDelta(), syncState.scoreDelta(), newHeight));
 
-				// 3. commit changes to the in-memory cache
+				// 3. commit changes to the in-memory cache (after collecting changed accounts, which are only accessible via the delta)
+				model::AddressSet changedAddresses;
+				if (m_handlers.ShouldCollectChangedAddresses)
+					changedAddresses = CollectChangedAddresses(syncState.cacheDelta());
+
 				syncState.commit(newHeight);
 
 				// 4. update the unconfirmed transactions
@@ -260,10 +284,10 @@ namespace catapult { namespace consumers {
 				auto revertedTransactionInfos = CollectRevertedTransactionInfos(
 						peerTransactionHashes,
 						syncState.detachRemovedTransactionInfos());
-				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos });
+				m_handlers.TransactionsChange({ peerTransactionHashes, revertedTransactionInfos, changedAddresses, elements });
 			}
 
-			void commitToStorage(Height commonBlockHeight, const BlockElements& elements) const {
+			void commitToStorage(Height commonBlockHeight, const std::vector<std::shared_ptr<const model::BlockElement>>& elements) const {
 				auto storageModifier = m_storage.modifier();
 				storageModifier.dropBlocksAfter(commonBlockHeight);
 				storageModifier.saveBlocks(elements);
@@ -21,6 +21,7 @@
 #pragma once
 #include "BlockChainProcessor.h"
 #include "StateChangeInfo.h"
+#include "catapult/model/ContainerTypes.h"
 #include "catapult/utils/ArraySet.h"
 
 namespace catapult {
@@ -33,12 +34,17 @@ namespace catapult { namespace consumers {
 	/// Information passed to a transactions change handler.
 	struct TransactionsChangeInfo {
 	public:
-		/// Creates a new transactions change info around \a addedTransactionHashes and \a revertedTransactionInfos.
+		/// Creates a new transactions change info around \a addedTransactionHashes, \a revertedTransactionInfos,
+		/// \a changedAddresses and \a addedBlockElements.
 		TransactionsChangeInfo(
 				const utils::HashPointerSet& addedTransactionHashes,
-				const std::vector<model::TransactionInfo>& revertedTransactionInfos)
+				const std::vector<model::TransactionInfo>& revertedTransactionInfos,
+				const model::AddressSet& changedAddresses,
+				const disruptor::BlockElements& addedBlockElements)
 				: AddedTransactionHashes(addedTransactionHashes)
 				, RevertedTransactionInfos(revertedTransactionInfos)
+				, ChangedAddresses(changedAddresses)
+				, AddedBlockElements(addedBlockElements)
 		{}
 
 	public:
@@ -47,6 +53,13 @@ namespace catapult { namespace consumers {
 
 		/// Infos of the transactions that were reverted (previously confirmed).
 		const std::vector<model::TransactionInfo>& RevertedTransactionInfos;
+
+		/// Addresses of all accounts that were added, modified or removed.
+		/// \note This is only collected when BlockChainSyncHandlers::ShouldCollectChangedAddresses is set.
+		const model::AddressSet& ChangedAddresses;
+
+		/// Block elements that were added.
+		const disruptor::BlockElements& AddedBlockElements;
 	};
 
 	/// Handlers used by the block chain sync consumer.
@@ -79,5 +92,8 @@ namespace catapult { namespace consumers {
 
 		/// Called with the hashes of confirmed transactions and the infos of reverted transactions when transaction statuses change.
 		TransactionsChangeFunc TransactionsChange;
+
+		/// \c true if the addresses of all changed accounts should be passed to TransactionsChange.
+		bool ShouldCollectChangedAddresses = false;
 	};
 }}
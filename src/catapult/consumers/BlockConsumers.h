@@ -25,6 +25,7 @@
 #include "InputUtils.h"
 #include "catapult/chain/ChainFunctions.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
+#include "catapult/validators/BatchSignatureVerifier.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
 namespace catapult {
@@ -39,6 +40,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
+	/// Transaction hashes are calculated in parallel using \a pPool.
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	disruptor::ConstBlockConsumer CreateBlockHashCheckConsumer(const chain::TimeSupplier& timeSupplier, const HashCheckOptions& options);
@@ -65,6 +72,17 @@ namespace catapult { namespace consumers {
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
 			const RequiresValidationPredicate& requiresValidationPredicate);
 
+	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
+	/// (\a pValidationPolicy) after verifying all signatures together using \a pBatchSignatureVerifier.
+	/// When all signatures are valid, \a pSignaturelessValidator is used instead of \a pValidator.
+	/// Validation will only be performed for entities for which \a requiresValidationPredicate returns \c true.
+	disruptor::ConstBlockConsumer CreateBlockStatelessValidationConsumer(
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pSignaturelessValidator,
+			const std::shared_ptr<const validators::BatchSignatureVerifier>& pBatchSignatureVerifier,
+			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+			const RequiresValidationPredicate& requiresValidationPredicate);
+
 	/// Creates a consumer that attempts to synchronize a remote chain with the local chain, which is composed of
 	/// state (in \a cache and \a state) and blocks (in \a storage).
 	/// \a maxRollbackBlocks The maximum number of blocks that can be rolled back.
@@ -24,14 +24,73 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
-		class BlockHashCalculatorConsumer {
+		using TransactionElementPointers = std::vector<model::TransactionElement*>;
+
+		class TransactionHasher {
 		public:
-			explicit BlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
+			TransactionHasher(
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
 					: m_transactionRegistry(transactionRegistry)
+					, m_pPool(pPool)
+			{}
+
+		public:
+			void updateHashes(const TransactionElementPointers& transactionElements) const {
+				if (!m_pPool || transactionElements.size() < 2) {
+					updateHashes(transactionElements.cbegin(), transactionElements.cend());
+					return;
+				}
+
+				// hashes are calculated on pool threads, so any exceptions need to be rethrown on the calling thread
+				auto numPartitions = std::min<size_t>(m_pPool->numWorkerThreads(), transactionElements.size());
+				std::vector<std::exception_ptr> exceptions(numPartitions);
+				thread::ParallelForPartition(m_pPool->service(), transactionElements, numPartitions, [this, &exceptions](
+						auto itBegin,
+						auto itEnd,
+						auto,
+						auto batchIndex) {
+					try {
+						this->updateHashes(itBegin, itEnd);
+					} catch (...) {
+						exceptions[batchIndex] = std::current_exception();
+					}
+				}).get();
+
+				for (const auto& pException : exceptions) {
+					if (pException)
+						std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			template<typename TIterator>
+			void updateHashes(TIterator itBegin, TIterator itEnd) const {
+				if (itBegin == itEnd)
+					return;
+
+				model::UpdateHashes(m_transactionRegistry, &*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd)));
+			}
+
+		private:
+			const model::TransactionRegistry& m_transactionRegistry;
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+		};
+	}
+
+	namespace {
+		class BlockHashCalculatorConsumer {
+		public:
+			BlockHashCalculatorConsumer(
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_transactionHasher(transactionRegistry, pPool)
 			{}
 
 		public:
@@ -39,17 +98,24 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				TransactionElementPointers transactionElements;
 				for (auto& element : elements) {
 					// note that disruptor input elements have been extracted from a packet (or created within this
 					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.emplace_back(transaction);
+
+					// element.Transactions is not modified after this point, so pointers into it remain valid
+					for (auto& transactionElement : element.Transactions)
+						transactionElements.push_back(&transactionElement);
+				}
 
+				m_transactionHasher.updateHashes(transactionElements);
+
+				for (auto& element : elements) {
+					crypto::MerkleHashBuilder transactionsHashBuilder;
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
@@ -63,19 +129,27 @@ namespace catapult { namespace consumers {
 			}
 
 		private:
-			const model::TransactionRegistry& m_transactionRegistry;
+			TransactionHasher m_transactionHasher;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(transactionRegistry);
+		return BlockHashCalculatorConsumer(transactionRegistry, nullptr);
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+		return BlockHashCalculatorConsumer(transactionRegistry, pPool);
 	}
 
 	namespace {
 		class TransactionHashCalculatorConsumer {
 		public:
-			explicit TransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry)
-					: m_transactionRegistry(transactionRegistry)
+			TransactionHashCalculatorConsumer(
+					const model::TransactionRegistry& transactionRegistry,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_transactionHasher(transactionRegistry, pPool)
 			{}
 
 		public:
@@ -83,18 +157,27 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				TransactionElementPointers transactionElements;
+				transactionElements.reserve(elements.size());
 				for (auto& element : elements)
-					model::UpdateHashes(m_transactionRegistry, element);
+					transactionElements.push_back(&element);
 
+				m_transactionHasher.updateHashes(transactionElements);
 				return Continue();
 			}
 
 		private:
-			const model::TransactionRegistry& m_transactionRegistry;
+			TransactionHasher m_transactionHasher;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry) {
-		return TransactionHashCalculatorConsumer(transactionRegistry);
+		return TransactionHashCalculatorConsumer(transactionRegistry, nullptr);
+	}
+
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+		return TransactionHashCalculatorConsumer(transactionRegistry, pPool);
 	}
 }}
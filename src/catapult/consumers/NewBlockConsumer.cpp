@@ -43,13 +43,11 @@ namespace catapult { namespace consumers {
 				if (1 != input.blocks().size() || !isConfigured(input.source()))
 					return Continue();
 
-				// 1. split up the input into its component blocks
-				//    - detachBlockRange transfers ownership of the range from the input
-				//      but doesn't invalidate the input elements
-				//    - the range is moved into ExtractEntitiesFromRange, which extends the lifetime of the range
-				//      to the lifetime of the returned blocks
-				auto blocks = model::BlockRange::ExtractEntitiesFromRange(input.detachBlockRange());
-				auto pNewBlock = blocks.front();
+				// 1. share the (single) block with the sink
+				//    - the block range might already be shared (e.g. with the block storage cache), so it cannot be detached
+				//    - the shared block element extends the lifetime of the range to the lifetime of the forwarded block
+				auto pBlockElement = input.sharedBlocks().front();
+				auto pNewBlock = std::shared_ptr<const model::Block>(pBlockElement, &pBlockElement->Block);
 				CATAPULT_LOG(debug) << "forwarding a new block with height " << pNewBlock->Height;
 				m_newBlockSink(pNewBlock);
 
@@ -24,22 +24,43 @@
 #include "TransactionConsumers.h"
 #include "catapult/validators/AggregateEntityValidator.h"
 #include "catapult/validators/AggregateValidationResult.h"
+#include "catapult/validators/BatchSignatureVerifier.h"
 
 namespace catapult { namespace consumers {
 
 	namespace {
-		template<typename TExtractAndProcess>
-		auto MakeConsumer(
-				const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
-				TExtractAndProcess extractAndProcess) {
+		using AggregateEntityValidatorPointer = std::shared_ptr<const validators::stateless::AggregateEntityValidator>;
+
+		auto CreateDispatch(const AggregateEntityValidatorPointer& pValidator) {
 			validators::stateless::AggregateEntityValidator::DispatchForwarder dispatcher(pValidator->curry());
-			return [pValidator, extractAndProcess, dispatcher](auto& elements) {
+			return [pValidator, dispatcher](const auto& validationPolicyFunc, const auto& entityInfos) {
+				return dispatcher.dispatch(validationPolicyFunc, entityInfos).get();
+			};
+		}
+
+		auto CreateBatchSignatureDispatch(
+				const AggregateEntityValidatorPointer& pValidator,
+				const AggregateEntityValidatorPointer& pSignaturelessValidator,
+				const std::shared_ptr<const validators::BatchSignatureVerifier>& pBatchSignatureVerifier) {
+			auto dispatch = CreateDispatch(pValidator);
+			auto signaturelessDispatch = CreateDispatch(pSignaturelessValidator);
+			return [pBatchSignatureVerifier, dispatch, signaturelessDispatch](const auto& validationPolicyFunc, const auto& entityInfos) {
+				// if any signature is invalid, fall back to full validation in order to get exact (per entity) results
+				if (pBatchSignatureVerifier->verify(entityInfos).get())
+					return signaturelessDispatch(validationPolicyFunc, entityInfos);
+
+				CATAPULT_LOG(debug) << "batch signature verification failed, verifying signatures individually";
+				return dispatch(validationPolicyFunc, entityInfos);
+			};
+		}
+
+		template<typename TDispatch, typename TExtractAndProcess>
+		auto MakeConsumer(TDispatch dispatch, TExtractAndProcess extractAndProcess) {
+			return [dispatch, extractAndProcess](auto& elements) {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				auto result = extractAndProcess(elements, [&dispatcher](const auto& validationPolicyFunc, const auto& entityInfos) {
-					return dispatcher.dispatch(validationPolicyFunc, entityInfos).get();
-				});
+				auto result = extractAndProcess(elements, dispatch);
 
 				if (IsValidationResultSuccess(result))
 					return Continue();
@@ -60,55 +81,95 @@ namespace catapult { namespace consumers {
 				return policy.validateAll(entityInfos, validationFunctions);
 			};
 		}
+
+		template<typename TDispatch>
+		auto MakeBlockConsumer(
+				TDispatch validationDispatch,
+				const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+				const RequiresValidationPredicate& requiresValidationPredicate) {
+			return MakeConsumer(validationDispatch, [pValidationPolicy, requiresValidationPredicate](const auto& elements, auto dispatch) {
+				model::WeakEntityInfos entityInfos;
+				ExtractMatchingEntityInfos(elements, entityInfos, requiresValidationPredicate);
+
+				return dispatch(AsShortCircuitFunction(*pValidationPolicy), entityInfos);
+			});
+		}
+
+		template<typename TDispatch>
+		auto MakeTransactionConsumer(
+				TDispatch validationDispatch,
+				const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+				const chain::FailedTransactionSink& failedTransactionSink) {
+			return MakeConsumer(validationDispatch, [pValidationPolicy, failedTransactionSink](auto& elements, auto dispatch) {
+				model::WeakEntityInfos entityInfos;
+				std::vector<size_t> entityInfoElementIndexes;
+				ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes);
+
+				auto results = dispatch(AsAllFunction(*pValidationPolicy), entityInfos);
+				auto numSkippedElements = 0u;
+				auto aggregateResult = validators::ValidationResult::Success;
+				for (auto i = 0u; i < results.size(); ++i) {
+					auto result = results[i];
+					validators::AggregateValidationResult(aggregateResult, result);
+					if (IsValidationResultSuccess(result))
+						continue;
+
+					// notice that ExtractEntityInfos ignores skipped elements, so finding the index in elements for a corresponding entityInfo
+					// requires an additional hop through entityInfoElementIndexes
+					auto& element = elements[entityInfoElementIndexes[i]];
+					element.Skip = true;
+					++numSkippedElements;
+
+					// only forward failure (not neutral) results
+					if (IsValidationResultFailure(result))
+						failedTransactionSink(element.Transaction, element.EntityHash, result);
+				}
+
+				// only abort if all elements failed
+				if (results.size() != numSkippedElements)
+					return validators::ValidationResult::Success;
+
+				CATAPULT_LOG(trace) << "all " << numSkippedElements << " transaction(s) skipped in TransactionStatelessValidation";
+				return aggregateResult;
+			});
+		}
 	}
 
 	disruptor::ConstBlockConsumer CreateBlockStatelessValidationConsumer(
 			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
 			const RequiresValidationPredicate& requiresValidationPredicate) {
-		return MakeConsumer(pValidator, [pValidationPolicy, requiresValidationPredicate](const auto& elements, auto dispatch) {
-			model::WeakEntityInfos entityInfos;
-			ExtractMatchingEntityInfos(elements, entityInfos, requiresValidationPredicate);
+		return MakeBlockConsumer(CreateDispatch(pValidator), pValidationPolicy, requiresValidationPredicate);
+	}
 
-			return dispatch(AsShortCircuitFunction(*pValidationPolicy), entityInfos);
-		});
+	disruptor::ConstBlockConsumer CreateBlockStatelessValidationConsumer(
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pSignaturelessValidator,
+			const std::shared_ptr<const validators::BatchSignatureVerifier>& pBatchSignatureVerifier,
+			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+			const RequiresValidationPredicate& requiresValidationPredicate) {
+		return MakeBlockConsumer(
+				CreateBatchSignatureDispatch(pValidator, pSignaturelessValidator, pBatchSignatureVerifier),
+				pValidationPolicy,
+				requiresValidationPredicate);
 	}
 
 	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
 			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
 			const chain::FailedTransactionSink& failedTransactionSink) {
-		return MakeConsumer(pValidator, [pValidationPolicy, failedTransactionSink](auto& elements, auto dispatch) {
-			model::WeakEntityInfos entityInfos;
-			std::vector<size_t> entityInfoElementIndexes;
-			ExtractEntityInfos(elements, entityInfos, entityInfoElementIndexes);
-
-			auto results = dispatch(AsAllFunction(*pValidationPolicy), entityInfos);
-			auto numSkippedElements = 0u;
-			auto aggregateResult = validators::ValidationResult::Success;
-			for (auto i = 0u; i < results.size(); ++i) {
-				auto result = results[i];
-				validators::AggregateValidationResult(aggregateResult, result);
-				if (IsValidationResultSuccess(result))
-					continue;
-
-				// notice that ExtractEntityInfos ignores skipped elements, so finding the index in elements for a corresponding entityInfo
-				// requires an additional hop through entityInfoElementIndexes
-				auto& element = elements[entityInfoElementIndexes[i]];
-				element.Skip = true;
-				++numSkippedElements;
-
-				// only forward failure (not neutral) results
-				if (IsValidationResultFailure(result))
-					failedTransactionSink(element.Transaction, element.EntityHash, result);
-			}
-
-			// only abort if all elements failed
-			if (results.size() != numSkippedElements)
-				return validators::ValidationResult::Success;
-
-			CATAPULT_LOG(trace) << "all " << numSkippedElements << " transaction(s) skipped in TransactionStatelessValidation";
-			return aggregateResult;
-		});
+		return MakeTransactionConsumer(CreateDispatch(pValidator), pValidationPolicy, failedTransactionSink);
+	}
+
+	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pSignaturelessValidator,
+			const std::shared_ptr<const validators::BatchSignatureVerifier>& pBatchSignatureVerifier,
+			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+			const chain::FailedTransactionSink& failedTransactionSink) {
+		return MakeTransactionConsumer(
+				CreateBatchSignatureDispatch(pValidator, pSignaturelessValidator, pBatchSignatureVerifier),
+				pValidationPolicy,
+				failedTransactionSink);
 	}
 }}
@@ -24,6 +24,7 @@
 #include "catapult/chain/ChainFunctions.h"
 #include "catapult/disruptor/DisruptorConsumer.h"
 #include "catapult/model/EntityInfo.h"
+#include "catapult/validators/BatchSignatureVerifier.h"
 #include "catapult/validators/ParallelValidationPolicy.h"
 
 namespace catapult { namespace model { class NotificationPublisher; } }
@@ -33,6 +34,12 @@ namespace catapult { namespace consumers {
 	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry.
+	/// Transaction hashes are calculated in parallel using \a pPool.
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const model::TransactionRegistry& transactionRegistry,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	/// \a knownHashPredicate returns \c true for known hashes.
@@ -51,6 +58,17 @@ namespace catapult { namespace consumers {
 			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
 			const chain::FailedTransactionSink& failedTransactionSink);
 
+	/// Creates a consumer that runs stateless validation using \a pValidator and the specified policy
+	/// (\a pValidationPolicy) after verifying all signatures together using \a pBatchSignatureVerifier
+	/// and calls \a failedTransactionSink for each failure.
+	/// When all signatures are valid, \a pSignaturelessValidator is used instead of \a pValidator.
+	disruptor::TransactionConsumer CreateTransactionStatelessValidationConsumer(
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pValidator,
+			const std::shared_ptr<const validators::stateless::AggregateEntityValidator>& pSignaturelessValidator,
+			const std::shared_ptr<const validators::BatchSignatureVerifier>& pBatchSignatureVerifier,
+			const std::shared_ptr<const validators::ParallelValidationPolicy>& pValidationPolicy,
+			const chain::FailedTransactionSink& failedTransactionSink);
+
 	/// Prototype for a function that is called with new transactions.
 	using NewTransactionsSink = consumer<TransactionInfos&&>;
 
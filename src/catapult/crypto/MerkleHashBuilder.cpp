@@ -19,7 +19,7 @@
 **/
 
 #include "MerkleHashBuilder.h"
-#include "Hashes.h"
+#include "MultiBufferHashes.h"
 #include "catapult/functions.h"
 
 namespace catapult { namespace crypto {
@@ -35,30 +35,25 @@ namespace catapult { namespace crypto {
 			// build the merkle tree
 			auto numRemainingHashes = hashes.size();
 			hashConsumer(hashes.data(), hashes.size());
+			std::vector<RawBuffer> buffers;
 			while (numRemainingHashes > 1) {
 				// merkle tree needs padding in case of an odd number of hashes, need to do before the next round of hashes is
 				// pushed into the vector because nodes with same depth should be consecutive entries in the vector
 				if (1 == numRemainingHashes % 2)
 					hashConsumer(&hashes[numRemainingHashes - 1], 1);
 
-				auto i = 0u;
-				for (; i < numRemainingHashes; i += 2) {
-					if (i + 1 < numRemainingHashes) {
-						Sha3_256({ hashes[i].data(), 2 * Hash256_Size }, hashes[i / 2]);
-						hashConsumer(&hashes[i / 2], 1);
-						continue;
-					}
+				// if there is an odd number of hashes, duplicate the last one
+				buffers.clear();
+				for (auto i = 0u; i < numRemainingHashes; ++i)
+					buffers.push_back(hashes[i]);
 
-					// if there is an odd number of hashes, duplicate the last one
-					Sha3_256_Builder builder;
-					builder.update(hashes[i]);
-					builder.update(hashes[i]);
-					builder.final(hashes[i / 2]);
-					hashConsumer(&hashes[i / 2], 1);
-					++numRemainingHashes;
-				}
+				if (1 == numRemainingHashes % 2)
+					buffers.push_back(hashes[numRemainingHashes - 1]);
 
-				numRemainingHashes /= 2;
+				// hash all pairs at once (each parent hash only overwrites hashes of the same or preceding pairs)
+				numRemainingHashes = buffers.size() / 2;
+				Sha3_256_Multi(buffers.data(), 2, hashes.data(), numRemainingHashes);
+				hashConsumer(hashes.data(), numRemainingHashes);
 			}
 
 			return hashes[0];
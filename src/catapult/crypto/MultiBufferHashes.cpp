@@ -0,0 +1,281 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MultiBufferHashes.h"
+#include "Hashes.h"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CATAPULT_SHA3_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace catapult { namespace crypto {
+
+	namespace {
+#ifdef SIGNATURE_SCHEME_NIS1
+		// original keccak padding
+		constexpr uint8_t Delimited_Suffix = 0x01;
+#else
+		// sha3 (FIPS 202) padding
+		constexpr uint8_t Delimited_Suffix = 0x06;
+#endif
+
+		template<typename TBuilder>
+		void HashScalar(
+				const RawBuffer* pBuffers,
+				size_t numBuffersPerMessage,
+				typename TBuilder::OutputType* pHashes,
+				size_t numMessages) noexcept {
+			for (auto i = 0u; i < numMessages; ++i) {
+				TBuilder builder;
+				for (auto j = 0u; j < numBuffersPerMessage; ++j)
+					builder.update(pBuffers[i * numBuffersPerMessage + j]);
+
+				builder.final(pHashes[i]);
+			}
+		}
+
+#ifdef CATAPULT_SHA3_AVX2
+		// region MessageReader
+
+		// reads a message composed of multiple buffers sequentially
+		class MessageReader {
+		public:
+			MessageReader() : MessageReader(nullptr, 0)
+			{}
+
+			MessageReader(const RawBuffer* pBuffers, size_t numBuffers)
+					: m_pBuffers(pBuffers)
+					, m_numBuffers(numBuffers)
+					, m_bufferIndex(0)
+					, m_offset(0)
+			{}
+
+		public:
+			size_t size() const {
+				size_t size = 0;
+				for (auto i = 0u; i < m_numBuffers; ++i)
+					size += m_pBuffers[i].Size;
+
+				return size;
+			}
+
+			size_t read(uint8_t* pDestination, size_t size) {
+				size_t numBytesRead = 0;
+				while (numBytesRead < size && m_bufferIndex < m_numBuffers) {
+					const auto& buffer = m_pBuffers[m_bufferIndex];
+					auto numBytesToCopy = std::min(size - numBytesRead, buffer.Size - m_offset);
+					if (0 != numBytesToCopy)
+						std::memcpy(pDestination + numBytesRead, buffer.pData + m_offset, numBytesToCopy);
+
+					numBytesRead += numBytesToCopy;
+					m_offset += numBytesToCopy;
+					if (m_offset == buffer.Size) {
+						++m_bufferIndex;
+						m_offset = 0;
+					}
+				}
+
+				return numBytesRead;
+			}
+
+		private:
+			const RawBuffer* m_pBuffers;
+			size_t m_numBuffers;
+			size_t m_bufferIndex;
+			size_t m_offset;
+		};
+
+		// endregion
+
+		// region KeccakP-1600 x 4 (AVX2)
+
+		constexpr size_t Num_Lanes = 4;
+
+		constexpr uint64_t Round_Constants[] = {
+			0x0000000000000001, 0x0000000000008082, 0x800000000000808A, 0x8000000080008000,
+			0x000000000000808B, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+			0x000000000000008A, 0x0000000000000088, 0x0000000080008009, 0x000000008000000A,
+			0x000000008000808B, 0x800000000000008B, 0x8000000000008089, 0x8000000000008003,
+			0x8000000000008002, 0x8000000000000080, 0x000000000000800A, 0x800000008000000A,
+			0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008
+		};
+
+		// rotation offsets indexed by x + 5 * y
+		constexpr int Rho_Offsets[] = {
+			0, 1, 62, 28, 27,
+			36, 44, 6, 55, 20,
+			3, 10, 43, 25, 39,
+			41, 45, 15, 21, 8,
+			18, 2, 61, 56, 14
+		};
+
+		AVX2_TARGET inline __m256i Rotate(__m256i value, int offset) {
+			return _mm256_or_si256(
+					_mm256_sll_epi64(value, _mm_cvtsi32_si128(offset)),
+					_mm256_srl_epi64(value, _mm_cvtsi32_si128(64 - offset)));
+		}
+
+		AVX2_TARGET void PermuteTimes4(__m256i* state) {
+			__m256i columns[5];
+			__m256i lanes[25];
+			for (auto round = 0u; round < 24; ++round) {
+				// theta
+				for (auto x = 0u; x < 5; ++x) {
+					columns[x] = _mm256_xor_si256(
+							_mm256_xor_si256(_mm256_xor_si256(state[x], state[x + 5]), _mm256_xor_si256(state[x + 10], state[x + 15])),
+							state[x + 20]);
+				}
+
+				for (auto x = 0u; x < 5; ++x) {
+					auto d = _mm256_xor_si256(columns[(x + 4) % 5], Rotate(columns[(x + 1) % 5], 1));
+					for (auto y = 0u; y < 25; y += 5)
+						state[x + y] = _mm256_xor_si256(state[x + y], d);
+				}
+
+				// rho and pi
+				for (auto x = 0u; x < 5; ++x) {
+					for (auto y = 0u; y < 5; ++y)
+						lanes[y + 5 * ((2 * x + 3 * y) % 5)] = Rotate(state[x + 5 * y], Rho_Offsets[x + 5 * y]);
+				}
+
+				// chi
+				for (auto y = 0u; y < 25; y += 5) {
+					for (auto x = 0u; x < 5; ++x)
+						state[x + y] = _mm256_xor_si256(lanes[x + y], _mm256_andnot_si256(lanes[(x + 1) % 5 + y], lanes[(x + 2) % 5 + y]));
+				}
+
+				// iota
+				state[0] = _mm256_xor_si256(state[0], _mm256_set1_epi64x(static_cast<long long>(Round_Constants[round])));
+			}
+		}
+
+		template<size_t Rate, typename THash>
+		AVX2_TARGET void HashTimes4(MessageReader* pReaders, size_t numMessages, THash* pHashes) {
+			static_assert(0 == Rate % sizeof(uint64_t), "rate must be a multiple of lane size");
+			static_assert(sizeof(THash) <= Rate, "hash must fit within a single squeezed block");
+
+			size_t numBlocks[Num_Lanes] = {};
+			size_t maxBlocks = 0;
+			for (auto i = 0u; i < numMessages; ++i) {
+				// the last block always contains padding
+				numBlocks[i] = pReaders[i].size() / Rate + 1;
+				maxBlocks = std::max(maxBlocks, numBlocks[i]);
+			}
+
+			__m256i state[25];
+			for (auto& lane : state)
+				lane = _mm256_setzero_si256();
+
+			alignas(32) uint64_t blocks[Num_Lanes][Rate / sizeof(uint64_t)];
+			alignas(32) uint64_t words[Num_Lanes];
+			THash hashes[Num_Lanes];
+			for (auto blockIndex = 0u; blockIndex < maxBlocks; ++blockIndex) {
+				for (auto i = 0u; i < Num_Lanes; ++i) {
+					auto* pBlock = reinterpret_cast<uint8_t*>(blocks[i]);
+					if (i >= numMessages || blockIndex >= numBlocks[i]) {
+						// lane is not used or its hash has already been extracted
+						std::memset(pBlock, 0, Rate);
+						continue;
+					}
+
+					auto numBytesRead = pReaders[i].read(pBlock, Rate);
+					if (numBytesRead < Rate) {
+						std::memset(pBlock + numBytesRead, 0, Rate - numBytesRead);
+						pBlock[numBytesRead] ^= Delimited_Suffix;
+						pBlock[Rate - 1] ^= 0x80;
+					}
+				}
+
+				// note that lanes are stored in little endian order, which matches the x86 byte order
+				for (auto j = 0u; j < Rate / sizeof(uint64_t); ++j) {
+					auto block = _mm256_set_epi64x(
+							static_cast<long long>(blocks[3][j]),
+							static_cast<long long>(blocks[2][j]),
+							static_cast<long long>(blocks[1][j]),
+							static_cast<long long>(blocks[0][j]));
+					state[j] = _mm256_xor_si256(state[j], block);
+				}
+
+				PermuteTimes4(state);
+
+				for (auto j = 0u; j < sizeof(THash) / sizeof(uint64_t); ++j) {
+					_mm256_store_si256(reinterpret_cast<__m256i*>(words), state[j]);
+					for (auto i = 0u; i < numMessages; ++i) {
+						if (blockIndex + 1 == numBlocks[i])
+							std::memcpy(hashes[i].data() + j * sizeof(uint64_t), &words[i], sizeof(uint64_t));
+					}
+				}
+			}
+
+			std::copy(hashes, hashes + numMessages, pHashes);
+		}
+
+		bool IsAvx2Supported() {
+			static const bool isSupported = __builtin_cpu_supports("avx2");
+			return isSupported;
+		}
+
+		// endregion
+#endif
+
+		template<size_t Rate, typename TBuilder>
+		void HashMulti(
+				const RawBuffer* pBuffers,
+				size_t numBuffersPerMessage,
+				typename TBuilder::OutputType* pHashes,
+				size_t numMessages) noexcept {
+#ifdef CATAPULT_SHA3_AVX2
+			if (IsAvx2Supported()) {
+				// hash all groups of at least two messages using simd instructions
+				auto i = 0u;
+				for (; i + 1 < numMessages; i += Num_Lanes) {
+					auto numGroupMessages = std::min(Num_Lanes, numMessages - i);
+					MessageReader readers[Num_Lanes];
+					for (auto j = 0u; j < numGroupMessages; ++j)
+						readers[j] = MessageReader(pBuffers + (i + j) * numBuffersPerMessage, numBuffersPerMessage);
+
+					HashTimes4<Rate>(readers, numGroupMessages, pHashes + i);
+				}
+
+				if (i < numMessages)
+					HashScalar<TBuilder>(pBuffers + i * numBuffersPerMessage, numBuffersPerMessage, pHashes + i, numMessages - i);
+
+				return;
+			}
+#endif
+
+			HashScalar<TBuilder>(pBuffers, numBuffersPerMessage, pHashes, numMessages);
+		}
+	}
+
+	void Sha3_256_Multi(const RawBuffer* pBuffers, size_t numBuffersPerMessage, Hash256* pHashes, size_t numMessages) noexcept {
+		// rate is (1600 - 2 * 256) / 8 bytes
+		HashMulti<136, Sha3_256_Builder>(pBuffers, numBuffersPerMessage, pHashes, numMessages);
+	}
+
+	void Sha3_512_Multi(const RawBuffer* pBuffers, size_t numBuffersPerMessage, Hash512* pHashes, size_t numMessages) noexcept {
+		// rate is (1600 - 2 * 512) / 8 bytes
+		HashMulti<72, Sha3_512_Builder>(pBuffers, numBuffersPerMessage, pHashes, numMessages);
+	}
+}}
@@ -0,0 +1,39 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto {
+
+	/// Calculates the 256-bit SHA3 hashes of \a numMessages messages into \a pHashes.
+	/// Message \c i is the concatenation of the \a numBuffersPerMessage buffers starting at \a pBuffers[i * numBuffersPerMessage].
+	/// \note Multiple messages are hashed at once when the cpu supports the required SIMD instructions.
+	///       Each hash is written only after its message and all preceding messages have been read,
+	///       so \a pHashes can overlap the buffers of the same or preceding messages.
+	void Sha3_256_Multi(const RawBuffer* pBuffers, size_t numBuffersPerMessage, Hash256* pHashes, size_t numMessages) noexcept;
+
+	/// Calculates the 512-bit SHA3 hashes of \a numMessages messages into \a pHashes.
+	/// Message \c i is the concatenation of the \a numBuffersPerMessage buffers starting at \a pBuffers[i * numBuffersPerMessage].
+	/// \note Multiple messages are hashed at once when the cpu supports the required SIMD instructions.
+	///       Each hash is written only after its message and all preceding messages have been read,
+	///       so \a pHashes can overlap the buffers of the same or preceding messages.
+	void Sha3_512_Multi(const RawBuffer* pBuffers, size_t numBuffersPerMessage, Hash512* pHashes, size_t numMessages) noexcept;
+}}
@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SharedKey.h"
+#include "CryptoUtils.h"
+#include "Hashes.h"
+#include "KeyPair.h"
+#include "SecureZero.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+
+extern "C" {
+#include <ref10/ge.h>
+}
+
+namespace catapult { namespace crypto {
+
+	namespace {
+		void ConditionalSwap(fe f, fe g, unsigned int swap) {
+			fe temp;
+			fe_copy(temp, f);
+			fe_cmov(f, g, swap);
+			fe_cmov(g, temp, swap);
+		}
+
+		void MultiplyA24(fe h, const fe f) {
+			// (A + 2) / 4 where A = 486662 is the montgomery curve coefficient
+			fe a24;
+			fe_0(a24);
+			a24[0] = 121666;
+			fe_mul(h, f, a24);
+		}
+
+		bool TryConvertToMontgomery(fe u, const Key& publicKey) {
+			// only the y coordinate is used, so the negation performed during decoding can be ignored
+			ge_p3 point;
+			if (0 != ge_frombytes_negate_vartime(&point, publicKey.data()))
+				return false;
+
+			// u = (1 + y) / (1 - y) (point is decoded with Z = 1)
+			fe one;
+			fe numerator;
+			fe denominator;
+			fe_1(one);
+			fe_add(numerator, one, point.Y);
+			fe_sub(denominator, one, point.Y);
+			fe_invert(denominator, denominator);
+			fe_mul(u, numerator, denominator);
+			return true;
+		}
+
+		void ScalarMultiply(uint8_t* pSharedPoint, const uint8_t* pScalar, const fe u) {
+			// montgomery ladder as described in rfc 7748 (section 5)
+			fe x1, x2, z2, x3, z3, temp0, temp1;
+			fe_copy(x1, u);
+			fe_1(x2);
+			fe_0(z2);
+			fe_copy(x3, u);
+			fe_1(z3);
+
+			unsigned int swap = 0;
+			for (auto pos = 254; pos >= 0; --pos) {
+				auto bit = static_cast<unsigned int>((pScalar[pos / 8] >> (pos & 7)) & 1);
+				swap ^= bit;
+				ConditionalSwap(x2, x3, swap);
+				ConditionalSwap(z2, z3, swap);
+				swap = bit;
+
+				fe_sub(temp0, x3, z3);
+				fe_sub(temp1, x2, z2);
+				fe_add(x2, x2, z2);
+				fe_add(z2, x3, z3);
+				fe_mul(z3, temp0, x2);
+				fe_mul(z2, z2, temp1);
+				fe_sq(temp0, temp1);
+				fe_sq(temp1, x2);
+				fe_add(x3, z3, z2);
+				fe_sub(z2, z3, z2);
+				fe_mul(x2, temp1, temp0);
+				fe_sub(temp1, temp1, temp0);
+				fe_sq(z2, z2);
+				MultiplyA24(z3, temp1);
+				fe_sq(x3, x3);
+				fe_add(temp0, temp0, z3);
+				fe_mul(z3, x1, z2);
+				fe_mul(z2, temp1, temp0);
+			}
+
+			ConditionalSwap(x2, x3, swap);
+			ConditionalSwap(z2, z3, swap);
+
+			fe_invert(z2, z2);
+			fe_mul(x2, x2, z2);
+			fe_tobytes(pSharedPoint, x2);
+		}
+	}
+
+	Key DeriveSharedKey(const KeyPair& keyPair, const Key& otherPublicKey) {
+		fe u;
+		if (!TryConvertToMontgomery(u, otherPublicKey))
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot derive shared key from invalid public key");
+
+		// use the same (clamped) scalar that was used to derive the public key
+		Hash512 privateHash;
+		HashPrivateKey(keyPair.privateKey(), privateHash);
+		privateHash[0] &= 0xF8;
+		privateHash[31] &= 0x7F;
+		privateHash[31] |= 0x40;
+
+		Key sharedPoint;
+		ScalarMultiply(sharedPoint.data(), privateHash.data(), u);
+		SecureZero(privateHash.data(), privateHash.size());
+
+		Hash256 sharedPointHash;
+		Sha3_256(sharedPoint, sharedPointHash);
+		SecureZero(sharedPoint);
+
+		Key sharedKey;
+		std::copy(sharedPointHash.cbegin(), sharedPointHash.cend(), sharedKey.begin());
+		SecureZero(sharedPointHash.data(), sharedPointHash.size());
+		return sharedKey;
+	}
+}}
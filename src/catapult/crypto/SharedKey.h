@@ -0,0 +1,33 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/types.h"
+
+namespace catapult { namespace crypto { class KeyPair; } }
+
+namespace catapult { namespace crypto {
+
+	/// Derives a key that is shared by \a keyPair and the owner of \a otherPublicKey.
+	/// \note Both (ed25519) keys are mapped onto their birationally equivalent (curve25519) montgomery representations
+	///       and combined with a constant time x25519 ladder. The resulting shared point is hashed.
+	/// \throws catapult_invalid_argument if \a otherPublicKey is not a valid public key.
+	Key DeriveSharedKey(const KeyPair& keyPair, const Key& otherPublicKey);
+}}
@@ -21,8 +21,11 @@
 #include "Signer.h"
 #include "CryptoUtils.h"
 #include "Hashes.h"
+#include "MultiBufferHashes.h"
 #include "catapult/exceptions.h"
+#include <algorithm>
 #include <cstring>
+#include <random>
 #include <ref10/crypto_verify_32.h>
 
 extern "C" {
@@ -48,6 +51,14 @@ namespace catapult { namespace crypto {
 		/// Indicates that the encoded S part of the signature is zero.
 		constexpr int Is_Zero = 2;
 
+		/// Order of the prime order subgroup (L).
+		constexpr uint8_t Group_Order[Encoded_Size] = {
+			0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+		};
+
+		constexpr uint8_t Zero_Scalar[Encoded_Size] = {};
+
 		int ValidateEncodedSPart(const uint8_t* encodedS) {
 			uint8_t encodedBuf[Signature_Size];
 			uint8_t *RESTRICT encodedTempR = encodedBuf;
@@ -71,6 +82,77 @@ namespace catapult { namespace crypto {
 			if (0 == (ValidateEncodedSPart(encodedS) & Is_Reduced))
 				CATAPULT_THROW_OUT_OF_RANGE("S part of signature invalid");
 		}
+
+		bool IsCanonicalEncodingOfNegatedPoint(const ge_p3& negatedPoint, const uint8_t* encodedPoint) {
+			// negate the point back and check that encoding it produces the original (canonical) encoding
+			ge_p3 point = negatedPoint;
+			fe_neg(point.X, negatedPoint.X);
+			fe_neg(point.T, negatedPoint.T);
+
+			unsigned char checkEncodedPoint[Encoded_Size];
+			ge_p3_tobytes(checkEncodedPoint, &point);
+			return 0 == crypto_verify_32(checkEncodedPoint, encodedPoint);
+		}
+
+		bool IsNeutralElement(const ge_p2& point) {
+			unsigned char encodedPoint[Encoded_Size];
+			unsigned char encodedNeutral[Encoded_Size] = { 1 };
+			ge_tobytes(encodedPoint, &point);
+			return 0 == crypto_verify_32(encodedPoint, encodedNeutral);
+		}
+
+		bool IsInPrimeOrderSubgroup(const ge_p3& point) {
+			// point has no small order component if and only if L * point is the neutral element
+			ge_p2 product;
+			ge_double_scalarmult_vartime(&product, Group_Order, &point, Zero_Scalar);
+			return IsNeutralElement(product);
+		}
+
+		bool VerifyIndividually(const SignatureInput& input) {
+			return crypto::Verify(input.Signer, input.Data, input.Signature);
+		}
+
+		std::vector<Hash512> CalculateHashes(const SignatureInput* pSignatureInputs, size_t count) {
+			// h = H(encodedR || public || data) for all inputs
+			std::vector<RawBuffer> buffers;
+			buffers.reserve(3 * count);
+			for (auto i = 0u; i < count; ++i) {
+				const auto& input = pSignatureInputs[i];
+				buffers.push_back({ input.Signature.data(), Encoded_Size });
+				buffers.push_back(input.Signer);
+				buffers.push_back(input.Data);
+			}
+
+			std::vector<Hash512> hashes(count);
+			Sha3_512_Multi(buffers.data(), 3, hashes.data(), count);
+			return hashes;
+		}
+
+		class RandomCoefficientGenerator {
+		public:
+			RandomCoefficientGenerator() {
+				std::random_device generator;
+				for (auto i = 0u; i < m_seed.size(); i += sizeof(uint32_t)) {
+					auto value = static_cast<uint32_t>(generator());
+					std::memcpy(m_seed.data() + i, &value, sizeof(uint32_t));
+				}
+			}
+
+		public:
+			/// Generates a 128-bit coefficient for the signature at \a index.
+			void generate(uint64_t index, uint8_t* coefficient) const {
+				Hash256 hash;
+				Sha3_256_Builder builder;
+				builder.update({ m_seed, { reinterpret_cast<const uint8_t*>(&index), sizeof(uint64_t) } });
+				builder.final(hash);
+
+				std::memset(coefficient, 0, Encoded_Size);
+				std::memcpy(coefficient, hash.data(), Encoded_Size / 2);
+			}
+
+		private:
+			Hash256 m_seed;
+		};
 	}
 
 	void Sign(const KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& computedSignature) {
@@ -168,4 +250,88 @@ namespace catapult { namespace crypto {
 		ge_tobytes(checkr, &R);
 		return 0 == crypto_verify_32(checkr, encodedR);
 	}
+
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count) {
+		if (0 == count)
+			return true;
+
+		// for random coefficients z[i], check that
+		// sum(z[i] * S[i]) * B + sum(z[i] * h[i] * -A[i]) + sum(z[i] * -R[i]) == 0
+		// (every valid signature satisfies S[i] * B == R[i] + h[i] * A[i])
+		//
+		// the combination is only equivalent to Verify when all A[i] and R[i] are in the prime order subgroup:
+		// small order components can cancel out in the combination, and Verify reduces h[i] before multiplying A[i],
+		// so signatures with such components are verified individually instead
+		std::vector<uint8_t> scalars(2 * count * Encoded_Size);
+		std::vector<ge_p3> points(2 * count);
+		std::vector<const SignatureInput*> batchedInputs;
+		batchedInputs.reserve(count);
+
+		uint8_t baseScalar[Encoded_Size] = {};
+
+		const Key Zero_Key{};
+		RandomCoefficientGenerator coefficientGenerator;
+		auto hashes = CalculateHashes(pSignatureInputs, count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& input = pSignatureInputs[i];
+			const uint8_t* encodedR = input.Signature.data();
+			const uint8_t* encodedS = input.Signature.data() + Encoded_Size;
+
+			// reject if not canonical or if public key is known weak key
+			if (!IsCanonicalS(encodedS) || Zero_Key == input.Signer)
+				return false;
+
+			// -A and -R
+			// (reject non-canonical encodings of R because Verify compares encodings, not points)
+			auto pointIndex = 2 * batchedInputs.size();
+			auto& negatedA = points[pointIndex];
+			auto& negatedR = points[pointIndex + 1];
+			if (0 != ge_frombytes_negate_vartime(&negatedA, input.Signer.data()))
+				return false;
+
+			if (0 != ge_frombytes_negate_vartime(&negatedR, encodedR) || !IsCanonicalEncodingOfNegatedPoint(negatedR, encodedR))
+				return false;
+
+			if (!IsInPrimeOrderSubgroup(negatedA) || !IsInPrimeOrderSubgroup(negatedR)) {
+				if (!VerifyIndividually(input))
+					return false;
+
+				continue;
+			}
+
+			// h = h mod group order
+			auto& h = hashes[i];
+			sc_reduce(h.data());
+
+			uint8_t z[Encoded_Size];
+			coefficientGenerator.generate(i, z);
+
+			// scalar of -A is z * h, scalar of -R is z
+			sc_muladd(&scalars[pointIndex * Encoded_Size], z, h.data(), Zero_Scalar);
+			std::memcpy(&scalars[(pointIndex + 1) * Encoded_Size], z, Encoded_Size);
+
+			// scalar of B is sum(z * S)
+			sc_muladd(baseScalar, z, encodedS, baseScalar);
+			batchedInputs.push_back(&input);
+		}
+
+		if (batchedInputs.empty())
+			return true;
+
+		auto numPoints = 2 * batchedInputs.size();
+		std::vector<signed char> slides(numPoints * 256);
+		std::vector<ge_cached> cachedPoints(numPoints * 8);
+
+		ge_p2 sum;
+		ge_multi_scalarmult_vartime(&sum, baseScalar, scalars.data(), points.data(), numPoints, slides.data(), cachedPoints.data());
+
+		// compare calculated sum to neutral element
+		if (IsNeutralElement(sum))
+			return true;
+
+		// fall back to individual verification so that the result always matches Verify
+		return std::all_of(batchedInputs.cbegin(), batchedInputs.cend(), [](const auto* pInput) {
+			return VerifyIndividually(*pInput);
+		});
+	}
 }}
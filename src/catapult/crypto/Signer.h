@@ -24,6 +24,18 @@
 
 namespace catapult { namespace crypto {
 
+	/// Input for batch signature verification.
+	struct SignatureInput {
+		/// Public key of the signer.
+		const Key& Signer;
+
+		/// Signed data.
+		RawBuffer Data;
+
+		/// Signature of data.
+		const catapult::Signature& Signature;
+	};
+
 	/// Signs data pointed by \a dataBuffer using \a keyPair, placing resulting signature in \a computedSignature.
 	/// \note The function will throw if the generated S part of the signature is not less than the group order.
 	void Sign(const KeyPair& keyPair, const RawBuffer& dataBuffer, Signature& computedSignature);
@@ -39,4 +51,11 @@ namespace catapult { namespace crypto {
 	/// Verifies that \a signature of data in \a buffersList is valid, using public key \a publicKey.
 	/// Returns \c true if signature is valid.
 	bool Verify(const Key& publicKey, std::initializer_list<const RawBuffer> buffersList, const Signature& signature);
+
+	/// Verifies that all \a count signatures in \a pSignatureInputs are valid.
+	/// Returns \c true if all signatures are valid.
+	/// \note Verification is performed as a single random linear combination over all signatures without small order components.
+	///       Any other signatures, and all signatures when the combination fails, are checked with Verify, so the result always
+	///       matches individual verification. When \c false is returned, Verify identifies the invalid signatures.
+	bool VerifyMulti(const SignatureInput* pSignatureInputs, size_t count);
 }}
@@ -20,7 +20,9 @@
 
 #pragma once
 #include "DeltaElements.h"
+#include "PruningBoundary.h"
 #include "catapult/exceptions.h"
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -43,6 +45,21 @@ namespace catapult { namespace deltaset {
 			elements.erase(TKeyTraits::ToKey(element));
 	}
 
+	/// Applies all changes in \a deltas to \a elements and then removes all elements less than \a pruningBoundary, if set.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TValue>
+	void UpdateSet(TStorageSet& elements, const DeltaElements<TMemorySet>& deltas, const PruningBoundary<TValue>& pruningBoundary) {
+		UpdateSet<TKeyTraits>(elements, deltas);
+
+		if (pruningBoundary.isSet())
+			elements.erase(elements.cbegin(), elements.lower_bound(pruningBoundary.value()));
+	}
+
+	/// Loads all elements with \a keys from \a elements into memory.
+	/// \note Memory-based sets are always in memory, so this does nothing.
+	template<typename TStorageSet, typename TKey>
+	void PrefetchSet(const TStorageSet&, const std::vector<TKey>&)
+	{}
+
 	/// Default policy for committing changes to a base set.
 	template<typename TSetTraits>
 	struct BaseSetCommitPolicy {
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "BaseSetCommitPolicy.h"
 #include "BaseSetDefaultTraits.h"
 #include "DeltaElements.h"
 #include "catapult/utils/NonCopyable.h"
@@ -148,6 +149,12 @@ namespace catapult { namespace deltaset {
 			return m_originalElements.cend() != originalIter ? ToResult(*originalIter) : nullptr;
 		}
 
+	public:
+		/// Loads all original elements with \a keys into memory so that subsequent searches for them do not hit storage.
+		void prefetch(const std::vector<KeyType>& keys) const {
+			PrefetchSet(m_originalElements, keys);
+		}
+
 	public:
 		/// Searches for \a key in this set.
 		/// Returns \c true if it is found or \c false if it is not found.
@@ -22,6 +22,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -141,6 +142,15 @@ namespace catapult { namespace deltaset {
 				UpdateSet<TKeyTraits>(*m_pContainer2, deltas);
 		}
 
+		/// Applies all changes in \a deltas to the underlying container and then prunes it using \a pruningBoundary.
+		template<typename TPruningBoundary>
+		void update(const DeltaElements<MemorySetType>& deltas, const TPruningBoundary& pruningBoundary) {
+			if (m_pContainer1)
+				UpdateSet<TKeyTraits>(*m_pContainer1, deltas, pruningBoundary);
+			else
+				UpdateSet<TKeyTraits>(*m_pContainer2, deltas, pruningBoundary);
+		}
+
 	private:
 		std::unique_ptr<StorageSetType> m_pContainer1;
 		std::unique_ptr<MemorySetType> m_pContainer2;
@@ -152,8 +162,10 @@ namespace catapult { namespace deltaset {
 		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2>
 		friend const TMemorySet2& SelectIterableSet(const ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& set);
 
-		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2>
-		friend TMemorySet2& SelectPrunableSet(ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& set);
+		template<typename TKeyTraits2, typename TStorageSet2, typename TMemorySet2, typename TKey>
+		friend void PrefetchSet(
+				const ConditionalContainer<TKeyTraits2, TStorageSet2, TMemorySet2>& container,
+				const std::vector<TKey>& keys);
 	};
 
 	// region specializations
@@ -176,15 +188,12 @@ namespace catapult { namespace deltaset {
 		return *set.m_pContainer2;
 	}
 
-	/// Selects the prunable set from \a set.
-	/// \throws catapult_invalid_argument if the set is not memory-based.
+	/// Loads all elements with \a keys from \a container into memory.
 	/// \note Specialization for ConditionalContainer.
-	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet>
-	TMemorySet& SelectPrunableSet(ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& set) {
-		if (!IsSetIterable(set))
-			CATAPULT_THROW_INVALID_ARGUMENT("ConditionalContainer is only prunable when it is memory-based");
-
-		return *set.m_pContainer2;
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKey>
+	void PrefetchSet(const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container, const std::vector<TKey>& keys) {
+		if (!IsSetIterable(container))
+			PrefetchSet(*container.m_pContainer1, keys);
 	}
 
 	/// Applies all changes in \a deltas to \a container.
@@ -194,5 +203,15 @@ namespace catapult { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Applies all changes in \a deltas to \a container and then prunes it using \a pruningBoundary.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TValue>
+	void UpdateSet(
+			ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container,
+			const DeltaElements<TMemorySet>& deltas,
+			const PruningBoundary<TValue>& pruningBoundary) {
+		container.update(deltas, pruningBoundary);
+	}
+
 	// endregion
 }}
@@ -53,19 +53,6 @@ namespace catapult { namespace deltaset {
 			typename std::remove_const<typename T::ElementType>::type,
 			OrderedSetDefaultComparator<typename T::ElementType>>;
 
-		/// Selects the prunable set from \a set.
-		template<typename TSet>
-		TSet& SelectPrunableSet(TSet& set) {
-			return set;
-		}
-
-		/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
-		template<typename TSet>
-		void PruneBaseSet(TSet& elements, const PruningBoundary<typename TSet::value_type>& pruningBoundary) {
-			auto iter = elements.lower_bound(pruningBoundary.value());
-			elements.erase(elements.cbegin(), iter);
-		}
-
 		/// Policy for committing changes to an ordered set.
 		template<typename TSetTraits>
 		struct OrderedSetCommitPolicy {
@@ -74,10 +61,8 @@ namespace catapult { namespace deltaset {
 					typename TSetTraits::SetType& elements,
 					const DeltaElements<typename TSetTraits::MemorySetType>& deltas,
 					const TPruningBoundary& pruningBoundary) {
-				UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas);
-
-				if (pruningBoundary.isSet())
-					PruneBaseSet(SelectPrunableSet(elements), pruningBoundary);
+				// pruning is delegated to the set so that storage-based sets can apply it atomically with the changes
+				UpdateSet<typename TSetTraits::KeyTraits>(elements, deltas, pruningBoundary);
 			}
 		};
 	}
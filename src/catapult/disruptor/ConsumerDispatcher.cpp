@@ -23,7 +23,7 @@
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/Functional.h"
-#include <thread>
+#include <algorithm>
 
 namespace catapult { namespace disruptor {
 
@@ -35,6 +35,27 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
+		const std::vector<DisruptorConsumerStage>& CheckStages(const std::vector<DisruptorConsumerStage>& consumerStages) {
+			for (const auto& consumerStage : consumerStages) {
+				if (consumerStage.empty())
+					CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher stages must not be empty");
+			}
+
+			// inspector runs within the thread of the last consumer, so the last stage cannot be parallel
+			if (!consumerStages.empty() && 1 != consumerStages.back().size())
+				CATAPULT_THROW_INVALID_ARGUMENT("last consumer dispatcher stage must contain a single consumer");
+
+			return consumerStages;
+		}
+
+		std::vector<DisruptorConsumerStage> ToConsumerStages(const std::vector<DisruptorConsumer>& consumers) {
+			std::vector<DisruptorConsumerStage> consumerStages;
+			for (const auto& consumer : consumers)
+				consumerStages.push_back({ consumer });
+
+			return consumerStages;
+		}
+
 		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
@@ -47,6 +68,37 @@ namespace catapult { namespace disruptor {
 		}
 	}
 
+	// region StagePositions
+
+	class ConsumerDispatcher::StagePositions {
+	public:
+		explicit StagePositions(size_t numConsumers) : m_positions(numConsumers) {
+			for (auto& position : m_positions)
+				position = 0;
+		}
+
+	public:
+		size_t size() const {
+			return m_positions.size();
+		}
+
+		PositionType update(size_t stageIndex, PositionType position) {
+			m_positions[stageIndex] = position;
+
+			// positions only increase, so the calculated minimum is never greater than the actual minimum
+			auto minPosition = position;
+			for (const auto& consumerPosition : m_positions)
+				minPosition = std::min<PositionType>(minPosition, consumerPosition);
+
+			return minPosition;
+		}
+
+	private:
+		std::vector<std::atomic<PositionType>> m_positions;
+	};
+
+	// endregion
+
 	ConsumerDispatcher::ConsumerDispatcher(const ConsumerDispatcherOptions& options, const std::vector<DisruptorConsumer>& consumers)
 			: ConsumerDispatcher(options, consumers, [](const auto&, const auto&) {})
 	{}
@@ -55,41 +107,55 @@ namespace catapult { namespace disruptor {
 			const ConsumerDispatcherOptions& options,
 			const std::vector<DisruptorConsumer>& consumers,
 			const DisruptorInspector& inspector)
+			: ConsumerDispatcher(options, ToConsumerStages(consumers), inspector)
+	{}
+
+	ConsumerDispatcher::ConsumerDispatcher(
+			const ConsumerDispatcherOptions& options,
+			const std::vector<DisruptorConsumerStage>& consumerStages,
+			const DisruptorInspector& inspector)
 			: NamedObjectMixin(CheckOptions(options).DispatcherName)
 			, m_elementTraceInterval(options.ElementTraceInterval)
 			, m_shouldThrowIfFull(options.ShouldThrowIfFull)
 			, m_keepRunning(true)
-			, m_barriers(consumers.size() + 1)
+			, m_barriers(CheckStages(consumerStages).size() + 1)
 			, m_disruptor(options.DisruptorSize, options.ElementTraceInterval)
 			, m_inspector(inspector)
 			, m_numActiveElements(0) {
 		auto currentLevel = 0u;
-		for (const auto& consumer : consumers) {
-			ConsumerEntry consumerEntry(currentLevel++);
-			m_threads.create_thread([pThis = this, consumerEntry, consumer]() mutable {
-				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
-				while (pThis->m_keepRunning) {
-					try {
-						auto* pDisruptorElement = pThis->tryNext(consumerEntry);
-						if (!pDisruptorElement) {
-							std::this_thread::sleep_for(std::chrono::milliseconds(10));
-							continue;
+		for (const auto& consumerStage : consumerStages) {
+			m_stagePositions.push_back(std::make_unique<StagePositions>(consumerStage.size()));
+			for (auto i = 0u; i < consumerStage.size(); ++i) {
+				ConsumerEntry consumerEntry(currentLevel);
+				ConsumerWaiter waiter(options.WaitStrategy);
+				m_threads.create_thread([pThis = this, consumerEntry, stageIndex = i, consumer = consumerStage[i], waiter]() mutable {
+					thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+					while (pThis->m_keepRunning) {
+						try {
+							auto* pDisruptorElement = pThis->tryNext(consumerEntry, stageIndex);
+							if (!pDisruptorElement) {
+								waiter.wait(pThis->m_barriers[consumerEntry.level()], consumerEntry.position());
+								continue;
+							}
+
+							waiter.reset();
+							auto result = consumer(pDisruptorElement->input());
+							if (CompletionStatus::Aborted == result.CompletionStatus)
+								pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
+
+							pThis->advance(consumerEntry, stageIndex);
+						} catch (...) {
+							CATAPULT_LOG(fatal)
+									<< "consumer at level " << consumerEntry.level() << " threw exception: "
+									<< EXCEPTION_DIAGNOSTIC_MESSAGE();
+							utils::CatapultLogFlush();
+							throw;
 						}
-
-						auto result = consumer(pDisruptorElement->input());
-						if (CompletionStatus::Aborted == result.CompletionStatus)
-							pThis->m_disruptor.markSkipped(consumerEntry.position(), result.CompletionCode);
-
-						pThis->advance(consumerEntry);
-					} catch (...) {
-						CATAPULT_LOG(fatal)
-								<< "consumer at level " << consumerEntry.level() << " threw exception: "
-								<< EXCEPTION_DIAGNOSTIC_MESSAGE();
-						utils::CatapultLogFlush();
-						throw;
 					}
-				}
-			});
+				});
+			}
+
+			++currentLevel;
 		}
 
 		CATAPULT_LOG(info) << options.DispatcherName << " ConsumerDispatcher spawned " << m_threads.size() << " workers";
@@ -101,6 +167,11 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+
+		// wake all blocked consumers so that they can exit promptly
+		for (auto i = 0u; i < m_barriers.size(); ++i)
+			m_barriers[i].notifyAll();
+
 		m_threads.join_all();
 	}
 
@@ -120,7 +191,7 @@ namespace catapult { namespace disruptor {
 		return m_numActiveElements.load();
 	}
 
-	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
+	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry, size_t stageIndex) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
 			auto consumerPosition = consumerEntry.position();
@@ -130,14 +201,21 @@ namespace catapult { namespace disruptor {
 			if (!m_disruptor.isSkipped(consumerPosition))
 				return &m_disruptor.elementAt(consumerPosition);
 
-			advance(consumerEntry);
+			advance(consumerEntry, stageIndex);
 		}
 	}
 
-	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry) {
+	void ConsumerDispatcher::advance(ConsumerEntry& consumerEntry, size_t stageIndex) {
 		auto consumerPosition = consumerEntry.position();
 		consumerEntry.advance();
-		m_barriers[consumerEntry.level() + 1].advance();
+
+		// when a stage has multiple consumers, the next stage can only process elements processed by all of them
+		auto& stagePositions = *m_stagePositions[consumerEntry.level()];
+		auto& nextBarrier = m_barriers[consumerEntry.level() + 1];
+		if (1 == stagePositions.size())
+			nextBarrier.advance();
+		else
+			nextBarrier.advanceTo(stagePositions.update(stageIndex, consumerEntry.position()));
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
 		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
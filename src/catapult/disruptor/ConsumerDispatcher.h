@@ -31,9 +31,21 @@ namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
 namespace catapult { namespace disruptor {
 
+	/// A group of independent disruptor consumers that process each element in parallel.
+	using DisruptorConsumerStage = std::vector<DisruptorConsumer>;
+
 	/// Dispatcher for disruptor consumers.
 	class ConsumerDispatcher final : public utils::NamedObjectMixin {
 	public:
+		/// Creates a dispatcher of \a consumerStages configured with \a options.
+		/// All consumers within a stage process an element in parallel and the next stage waits until all of them are done.
+		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
+		/// Inspector runs within a thread of the last consumer, so the last stage must contain a single consumer.
+		ConsumerDispatcher(
+				const ConsumerDispatcherOptions& options,
+				const std::vector<DisruptorConsumerStage>& consumerStages,
+				const DisruptorInspector& inspector);
+
 		/// Creates a dispatcher of \a consumers configured with \a options.
 		/// Inspector (\a inspector) is a special consumer that is always run (independent of skip) and as a last one.
 		/// Inspector runs within a thread of the last consumer.
@@ -71,19 +83,23 @@ namespace catapult { namespace disruptor {
 		size_t numActiveElements() const;
 
 	private:
-		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
+		DisruptorElement* tryNext(ConsumerEntry& consumerEntry, size_t stageIndex);
 
-		void advance(ConsumerEntry& consumerEntry);
+		void advance(ConsumerEntry& consumerEntry, size_t stageIndex);
 
 		bool canProcessNextElement() const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete);
 
+	private:
+		class StagePositions;
+
 	private:
 		size_t m_elementTraceInterval;
 		bool m_shouldThrowIfFull;
 		std::atomic_bool m_keepRunning;
 		DisruptorBarriers m_barriers;
+		std::vector<std::unique_ptr<StagePositions>> m_stagePositions;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
 		boost::thread_group m_threads;
@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "ConsumerWaitStrategy.h"
 #include <stddef.h>
 
 namespace catapult { namespace disruptor {
@@ -32,6 +33,7 @@ namespace catapult { namespace disruptor {
 				, DisruptorSize(disruptorSize)
 				, ElementTraceInterval(1)
 				, ShouldThrowIfFull(true)
+				, WaitStrategy(ConsumerWaitStrategy::Hybrid)
 		{}
 
 	public:
@@ -46,5 +48,8 @@ namespace catapult { namespace disruptor {
 
 		/// \c true if the dispatcher should throw if full, \c false if it should return an error.
 		bool ShouldThrowIfFull;
+
+		/// Strategy used by consumers to wait for new elements.
+		ConsumerWaitStrategy WaitStrategy;
 	};
 }}
@@ -47,6 +47,23 @@ namespace catapult { namespace disruptor {
 		}
 	}
 
+	std::vector<std::shared_ptr<const model::BlockElement>> ConsumerInput::sharedBlocks() const {
+		struct SharedBlockElements {
+			std::shared_ptr<const model::BlockRange> pBlockRange;
+			BlockElements Elements;
+		};
+
+		// copy the elements (but not the blocks they reference) into a single allocation that keeps the block range alive
+		auto pSharedElements = std::make_shared<SharedBlockElements>(SharedBlockElements{ m_pBlockRange, blocks() });
+
+		std::vector<std::shared_ptr<const model::BlockElement>> sharedElements;
+		sharedElements.reserve(pSharedElements->Elements.size());
+		for (const auto& element : pSharedElements->Elements)
+			sharedElements.emplace_back(pSharedElements, &element);
+
+		return sharedElements;
+	}
+
 	std::ostream& operator<<(std::ostream& out, const ConsumerInput& input) {
 		OutputElementsInfoT(out, input.m_blockElements, "blocks");
 		OutputElementsInfoT(out, input.m_transactionElements, "txes");
@@ -35,11 +35,11 @@ namespace catapult { namespace disruptor {
 
 		/// Creates a consumer input around a block \a range with an optional input source (\a inputSource).
 		explicit ConsumerInput(model::AnnotatedBlockRange&& range, InputSource source = InputSource::Unknown)
-				: m_blockRange(std::move(range.Range))
+				: m_pBlockRange(std::make_shared<model::BlockRange>(std::move(range.Range)))
 				, m_source(source)
 				, m_sourcePublicKey(range.SourcePublicKey) {
-			m_blockElements.reserve(m_blockRange.size());
-			for (const auto& block : m_blockRange)
+			m_blockElements.reserve(m_pBlockRange->size());
+			for (const auto& block : *m_pBlockRange)
 				m_blockElements.push_back(model::BlockElement(block));
 		}
 
@@ -56,12 +56,12 @@ namespace catapult { namespace disruptor {
 	public:
 		/// Returns \c true if this input is empty and has no elements.
 		bool empty() const {
-			return m_blockRange.empty() && m_transactionRange.empty();
+			return !hasBlockRange() && m_transactionRange.empty();
 		}
 
 		/// Returns \c true if this input is non-empty and has blocks.
 		bool hasBlocks() const {
-			return !m_blockRange.empty();
+			return hasBlockRange();
 		}
 
 		/// Returns \c true if this input is non-empty and has transactions.
@@ -83,6 +83,10 @@ namespace catapult { namespace disruptor {
 			return const_cast<ConsumerInput*>(this)->blocks();
 		}
 
+		/// Returns copies of the block elements associated with this input that share ownership of the block range.
+		/// \note Each returned element extends the lifetime of the block range but the block data is not copied.
+		std::vector<std::shared_ptr<const model::BlockElement>> sharedBlocks() const;
+
 		/// Returns the (free) transaction elements associated with this input.
 		TransactionElements& transactions() {
 			if (m_transactionElements.empty())
@@ -108,11 +112,15 @@ namespace catapult { namespace disruptor {
 
 	public:
 		/// Detaches the block range associated with this input.
+		/// \note The block range cannot be detached after it has been shared via sharedBlocks.
 		model::BlockRange detachBlockRange() {
-			if (m_blockRange.empty())
+			if (!hasBlockRange())
 				CATAPULT_THROW_RUNTIME_ERROR("input has no blocks set");
 
-			return std::move(m_blockRange);
+			if (1 != m_pBlockRange.use_count())
+				CATAPULT_THROW_RUNTIME_ERROR("input blocks are shared and cannot be detached");
+
+			return std::move(*m_pBlockRange);
 		}
 
 		/// Detaches the transaction range associated with this input.
@@ -128,8 +136,13 @@ namespace catapult { namespace disruptor {
 		friend std::ostream& operator<<(std::ostream& out, const ConsumerInput& input);
 
 	private:
-		// backing memory
-		model::BlockRange m_blockRange;
+		bool hasBlockRange() const {
+			return m_pBlockRange && !m_pBlockRange->empty();
+		}
+
+	private:
+		// backing memory (block range is shared so that block elements can outlive the input)
+		std::shared_ptr<model::BlockRange> m_pBlockRange;
 		model::TransactionRange m_transactionRange;
 
 		// used by consumers
@@ -0,0 +1,83 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "ConsumerWaitStrategy.h"
+#include "catapult/utils/MacroBasedEnumIncludes.h"
+#include <thread>
+
+namespace catapult { namespace disruptor {
+
+#define DEFINE_ENUM ConsumerWaitStrategy
+#define ENUM_LIST CONSUMER_WAIT_STRATEGY_LIST
+#include "catapult/utils/MacroBasedEnum.h"
+#undef ENUM_LIST
+#undef DEFINE_ENUM
+
+	namespace {
+		constexpr size_t Num_Spin_Iterations = 100;
+		constexpr size_t Num_Yield_Iterations = 100;
+		constexpr auto Sleep_Duration = std::chrono::milliseconds(10);
+
+		// bound blocking waits so that a consumer always eventually rechecks whether or not it should keep running
+		constexpr auto Max_Blocking_Duration = std::chrono::milliseconds(100);
+
+		void Yield(size_t numIdleIterations) {
+			if (numIdleIterations >= Num_Spin_Iterations)
+				std::this_thread::yield();
+		}
+	}
+
+	ConsumerWaiter::ConsumerWaiter(ConsumerWaitStrategy waitStrategy)
+			: m_waitStrategy(waitStrategy)
+			, m_numIdleIterations(0)
+	{}
+
+	void ConsumerWaiter::wait(const DisruptorBarrier& barrier, PositionType position) {
+		switch (m_waitStrategy) {
+		case ConsumerWaitStrategy::Sleep:
+			std::this_thread::sleep_for(Sleep_Duration);
+			break;
+
+		case ConsumerWaitStrategy::Busy_Spin:
+			break;
+
+		case ConsumerWaitStrategy::Spin_Yield:
+			Yield(m_numIdleIterations);
+			break;
+
+		case ConsumerWaitStrategy::Blocking:
+			barrier.waitForAdvance(position, Max_Blocking_Duration);
+			break;
+
+		case ConsumerWaitStrategy::Hybrid:
+			if (m_numIdleIterations < Num_Spin_Iterations + Num_Yield_Iterations)
+				Yield(m_numIdleIterations);
+			else
+				barrier.waitForAdvance(position, Max_Blocking_Duration);
+			break;
+		}
+
+		++m_numIdleIterations;
+	}
+
+	void ConsumerWaiter::reset() {
+		m_numIdleIterations = 0;
+	}
+}}
@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorBarrier.h"
+#include <iosfwd>
+
+namespace catapult { namespace disruptor {
+
+#define CONSUMER_WAIT_STRATEGY_LIST \
+	/* Consumer sleeps for a fixed interval whenever no element is available. */ \
+	ENUM_VALUE(Sleep) \
+	\
+	/* Consumer busy spins without ever giving up its processor. */ \
+	ENUM_VALUE(Busy_Spin) \
+	\
+	/* Consumer spins for a bounded number of iterations and then yields its processor. */ \
+	ENUM_VALUE(Spin_Yield) \
+	\
+	/* Consumer blocks until it is woken by the barrier it is waiting on. */ \
+	ENUM_VALUE(Blocking) \
+	\
+	/* Consumer spins, then yields and finally blocks until it is woken by the barrier it is waiting on. */ \
+	ENUM_VALUE(Hybrid)
+
+#define ENUM_VALUE(LABEL) LABEL,
+	/// Possible strategies used by consumers to wait for new elements.
+	enum class ConsumerWaitStrategy {
+		CONSUMER_WAIT_STRATEGY_LIST
+	};
+#undef ENUM_VALUE
+
+	/// Insertion operator for outputting \a value to \a out.
+	std::ostream& operator<<(std::ostream& out, ConsumerWaitStrategy value);
+
+	/// Waits for a consumer barrier to advance using a wait strategy.
+	/// \note Each consumer is expected to use its own waiter.
+	class ConsumerWaiter {
+	public:
+		/// Creates a waiter around \a waitStrategy.
+		explicit ConsumerWaiter(ConsumerWaitStrategy waitStrategy);
+
+	public:
+		/// Waits for \a barrier to advance beyond \a position.
+		/// \note This function might return before \a barrier has advanced.
+		void wait(const DisruptorBarrier& barrier, PositionType position);
+
+		/// Resets the waiter after an element has been processed.
+		void reset();
+
+	private:
+		ConsumerWaitStrategy m_waitStrategy;
+		size_t m_numIdleIterations;
+	};
+}}
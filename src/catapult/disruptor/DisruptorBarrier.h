@@ -23,6 +23,9 @@
 #include "catapult/utils/Logging.h"
 #include "catapult/preprocessor.h"
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -36,11 +39,53 @@ namespace catapult { namespace disruptor {
 		DisruptorBarrier(size_t level, PositionType position)
 				: m_level(level)
 				, m_position(position)
+				, m_numWaiters(0)
 		{}
 
-		/// Advances the barrier.
+		/// Advances the barrier and wakes all blocked waiters.
 		CATAPULT_INLINE void advance() {
 			++m_position;
+
+			// only acquire the lock when there is a blocked waiter
+			if (0 != m_numWaiters)
+				notifyAll();
+		}
+
+		/// Advances the barrier to \a position if it is beyond the current position and wakes all blocked waiters.
+		/// \note This allows multiple consumers to advance a shared barrier concurrently.
+		void advanceTo(PositionType position) {
+			auto currentPosition = m_position.load();
+			while (currentPosition < position) {
+				if (!m_position.compare_exchange_weak(currentPosition, position))
+					continue;
+
+				if (0 != m_numWaiters)
+					notifyAll();
+
+				return;
+			}
+		}
+
+		/// Wakes all blocked waiters.
+		void notifyAll() {
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_condition.notify_all();
+		}
+
+		/// Blocks until the barrier has advanced beyond \a position or \a timeout has elapsed.
+		/// Returns \c true if the barrier has advanced beyond \a position.
+		template<typename TRep, typename TPeriod>
+		bool waitForAdvance(PositionType position, const std::chrono::duration<TRep, TPeriod>& timeout) const {
+			if (position != m_position)
+				return true;
+
+			// notice that m_numWaiters must be incremented before m_position is rechecked under the lock
+			// so that either the waiter observes the new position or advance observes the waiter
+			++m_numWaiters;
+			std::unique_lock<std::mutex> lock(m_mutex);
+			auto isAdvanced = m_condition.wait_for(lock, timeout, [this, position]() { return position != m_position; });
+			--m_numWaiters;
+			return isAdvanced;
 		}
 
 		/// Returns level of the barrier.
@@ -56,5 +101,8 @@ namespace catapult { namespace disruptor {
 	private:
 		const size_t m_level;
 		std::atomic<PositionType> m_position;
+		mutable std::atomic<size_t> m_numWaiters;
+		mutable std::mutex m_mutex;
+		mutable std::condition_variable m_condition;
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "PluginUtils.h"
+#include "catapult/model/NotificationSubscriber.h"
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/observers/ReverseNotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
@@ -32,6 +33,46 @@ namespace catapult { namespace extensions {
 		auto MakeAdapter(const plugins::PluginManager& manager, std::unique_ptr<TAdaptee>&& pAdaptee) {
 			return std::make_unique<TAdapter>(std::move(pAdaptee), manager.createNotificationPublisher());
 		}
+
+		class FilteringNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			FilteringNotificationSubscriber(
+					model::NotificationSubscriber& subscriber,
+					const predicate<model::NotificationType>& notificationTypeFilter)
+					: m_subscriber(subscriber)
+					, m_notificationTypeFilter(notificationTypeFilter)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (m_notificationTypeFilter(notification.Type))
+					m_subscriber.notify(notification);
+			}
+
+		private:
+			model::NotificationSubscriber& m_subscriber;
+			const predicate<model::NotificationType>& m_notificationTypeFilter;
+		};
+
+		class FilteringNotificationPublisher : public model::NotificationPublisher {
+		public:
+			FilteringNotificationPublisher(
+					std::unique_ptr<model::NotificationPublisher>&& pPublisher,
+					const predicate<model::NotificationType>& notificationTypeFilter)
+					: m_pPublisher(std::move(pPublisher))
+					, m_notificationTypeFilter(notificationTypeFilter)
+			{}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				FilteringNotificationSubscriber filteringSub(sub, m_notificationTypeFilter);
+				m_pPublisher->publish(entityInfo, filteringSub);
+			}
+
+		private:
+			std::unique_ptr<model::NotificationPublisher> m_pPublisher;
+			predicate<model::NotificationType> m_notificationTypeFilter;
+		};
 	}
 
 	std::unique_ptr<const validators::stateless::AggregateEntityValidator> CreateStatelessValidator(
@@ -42,6 +83,17 @@ namespace catapult { namespace extensions {
 		return std::make_unique<validators::stateless::AggregateEntityValidator>(std::move(validators));
 	}
 
+	std::unique_ptr<const validators::stateless::AggregateEntityValidator> CreateStatelessValidator(
+			const plugins::PluginManager& manager,
+			const predicate<model::NotificationType>& notificationTypeFilter) {
+		// create an aggregate entity validator of one
+		auto validators = validators::ValidatorVectorT<>();
+		validators.push_back(std::make_unique<validators::NotificationValidatorAdapter>(
+				manager.createStatelessValidator(),
+				std::make_unique<FilteringNotificationPublisher>(manager.createNotificationPublisher(), notificationTypeFilter)));
+		return std::make_unique<validators::stateless::AggregateEntityValidator>(std::move(validators));
+	}
+
 	std::unique_ptr<const observers::EntityObserver> CreateEntityObserver(const plugins::PluginManager& manager) {
 		return MakeAdapter<observers::NotificationObserverAdapter>(manager, manager.createObserver());
 	}
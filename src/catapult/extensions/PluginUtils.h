@@ -19,6 +19,7 @@
 **/
 
 #pragma once
+#include "catapult/model/NotificationType.h"
 #include "catapult/validators/ValidatorTypes.h"
 #include <memory>
 
@@ -32,6 +33,12 @@ namespace catapult { namespace extensions {
 	/// Creates an entity stateless validator using \a pluginManager.
 	std::unique_ptr<const validators::stateless::AggregateEntityValidator> CreateStatelessValidator(const plugins::PluginManager& manager);
 
+	/// Creates an entity stateless validator using \a pluginManager that only validates notifications
+	/// with types for which \a notificationTypeFilter returns \c true.
+	std::unique_ptr<const validators::stateless::AggregateEntityValidator> CreateStatelessValidator(
+			const plugins::PluginManager& manager,
+			const predicate<model::NotificationType>& notificationTypeFilter);
+
 	/// Creates an entity observer using \a pluginManager.
 	std::unique_ptr<const observers::EntityObserver> CreateEntityObserver(const plugins::PluginManager& manager);
 
@@ -34,6 +34,9 @@ namespace catapult { namespace handlers {
 	/// Prototype for a function that processes a range of transactions.
 	using TransactionRangeHandler = RangeHandler<model::Transaction>;
 
+	/// Prototype for a function that processes a range of transaction hashes.
+	using TransactionHashRangeHandler = RangeHandler<Hash256>;
+
 	/// Accepts a range and returns a producer that produces specified shared pointer elements.
 	template<typename TIdentifier, typename TEntity>
 	using SharedPointerProducerFactory = std::function<supplier<std::shared_ptr<const TEntity>> (const model::EntityRange<TIdentifier>&)>;
@@ -21,6 +21,7 @@
 #pragma once
 #include "HandlerTypes.h"
 #include "catapult/ionet/PacketEntityUtils.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/TransactionPlugin.h"
 #include "catapult/utils/Logging.h"
 #include <functional>
@@ -44,4 +45,27 @@ namespace catapult { namespace handlers {
 			rangeHandler({ std::move(range), context.key() });
 		};
 	}
+
+	/// Creates a pull handler that responds to requests of type \a TRequest with the cells of the reconciliation sketch
+	/// returned by \a sketchRetriever. Requests for an invalid number of cells or more than \a maxNumCells cells are rejected.
+	template<typename TRequest, typename TSketchRetriever>
+	auto CreatePullSketchHandler(uint32_t maxNumCells, TSketchRetriever sketchRetriever) {
+		return [maxNumCells, sketchRetriever](const ionet::Packet& packet, auto& context) {
+			const auto* pRequest = ionet::CoercePacket<TRequest>(&packet);
+			if (!pRequest)
+				return;
+
+			using SketchType = decltype(sketchRetriever(pRequest->NumCells));
+			if (!SketchType::IsValidNumCells(pRequest->NumCells) || pRequest->NumCells > maxNumCells) {
+				CATAPULT_LOG(warning) << "rejecting sketch request with invalid number of cells " << pRequest->NumCells;
+				return;
+			}
+
+			auto sketch = sketchRetriever(pRequest->NumCells);
+			const auto& cells = sketch.cells();
+			const auto* pCellsData = reinterpret_cast<const uint8_t*>(cells.data());
+			auto range = model::EntityRange<typename SketchType::Cell>::CopyFixed(pCellsData, cells.size());
+			context.response(ionet::PacketPayloadFactory::FromFixedSizeRange(TRequest::Packet_Type, std::move(range)));
+		};
+	}
 }}
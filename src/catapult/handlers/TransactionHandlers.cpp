@@ -20,6 +20,7 @@
 
 #include "TransactionHandlers.h"
 #include "HandlerUtils.h"
+#include "catapult/api/SketchPackets.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/utils/ShortHash.h"
 #include "catapult/types.h"
@@ -35,6 +36,29 @@ namespace catapult { namespace handlers {
 				CreatePushEntityHandler<model::Transaction>(registry, transactionRangeHandler));
 	}
 
+	namespace {
+		auto CreatePushTransactionHashesHandler(const TransactionHashRangeHandler& rangeHandler) {
+			return [rangeHandler](const ionet::Packet& packet, const auto& context) {
+				auto range = ionet::ExtractFixedSizeStructuresFromPacket<Hash256>(packet);
+				if (range.empty()) {
+					CATAPULT_LOG(warning) << "rejecting empty range: " << packet;
+					return;
+				}
+
+				CATAPULT_LOG(trace) << "received valid " << packet;
+				rangeHandler({ std::move(range), context.key() });
+			};
+		}
+	}
+
+	void RegisterPushTransactionHashesHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const TransactionHashRangeHandler& transactionHashRangeHandler) {
+		handlers.registerHandler(
+				ionet::PacketType::Push_Transaction_Hashes,
+				CreatePushTransactionHashesHandler(transactionHashRangeHandler));
+	}
+
 	namespace {
 		struct PullTransactionsInfo {
 		public:
@@ -78,4 +102,54 @@ namespace catapult { namespace handlers {
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever) {
 		handlers.registerHandler(ionet::PacketType::Pull_Transactions, CreatePullTransactionsHandler(utRetriever));
 	}
+
+	namespace {
+		struct PullTransactionsByHashInfo {
+		public:
+			PullTransactionsByHashInfo() : IsValid(false)
+			{}
+
+		public:
+			utils::HashSet Hashes;
+			bool IsValid;
+		};
+
+		auto ProcessPullTransactionsByHashRequest(const ionet::Packet& packet) {
+			if (ionet::PacketType::Pull_Transactions_By_Hash != packet.Type)
+				return PullTransactionsByHashInfo();
+
+			auto range = ionet::ExtractFixedSizeStructuresFromPacket<Hash256>(packet);
+			if (range.empty() && sizeof(ionet::Packet) != packet.Size)
+				return PullTransactionsByHashInfo();
+
+			PullTransactionsByHashInfo info;
+			info.Hashes.reserve(range.size());
+			for (const auto& hash : range)
+				info.Hashes.insert(hash);
+
+			info.IsValid = true;
+			return info;
+		}
+
+		auto CreatePullTransactionsByHashHandler(const UtHashRetriever& utHashRetriever) {
+			return [utHashRetriever](const auto& packet, auto& context) {
+				auto info = ProcessPullTransactionsByHashRequest(packet);
+				if (!info.IsValid)
+					return;
+
+				auto transactions = utHashRetriever(info.Hashes);
+				context.response(ionet::PacketPayloadFactory::FromEntities(ionet::PacketType::Pull_Transactions_By_Hash, transactions));
+			};
+		}
+	}
+
+	void RegisterPullTransactionsByHashHandler(ionet::ServerPacketHandlers& handlers, const UtHashRetriever& utHashRetriever) {
+		handlers.registerHandler(ionet::PacketType::Pull_Transactions_By_Hash, CreatePullTransactionsByHashHandler(utHashRetriever));
+	}
+
+	void RegisterPullTransactionsSketchHandler(ionet::ServerPacketHandlers& handlers, const UtSketchRetriever& utSketchRetriever) {
+		handlers.registerHandler(
+				ionet::PacketType::Pull_Transactions_Sketch,
+				CreatePullSketchHandler<api::PullTransactionsSketchRequest>(cache::Max_Sketch_Num_Cells, utSketchRetriever));
+	}
 }}
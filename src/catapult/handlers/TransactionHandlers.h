@@ -20,9 +20,11 @@
 
 #pragma once
 #include "HandlerTypes.h"
+#include "catapult/cache/TransactionSketches.h"
 #include "catapult/ionet/PacketHandlers.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/model/Transaction.h"
+#include "catapult/utils/ArraySet.h"
 #include "catapult/utils/ShortHash.h"
 #include <unordered_set>
 
@@ -38,10 +40,30 @@ namespace catapult { namespace handlers {
 			const model::TransactionRegistry& registry,
 			const TransactionRangeHandler& transactionRangeHandler);
 
+	/// Registers a push transaction hashes handler in \a handlers that forwards announced transaction hashes
+	/// to \a transactionHashRangeHandler.
+	void RegisterPushTransactionHashesHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const TransactionHashRangeHandler& transactionHashRangeHandler);
+
 	/// Prototype for a function that retrieves unconfirmed transactions given a set of short hashes.
 	using UtRetriever = std::function<UnconfirmedTransactions (const utils::ShortHashesSet&)>;
 
 	/// Registers a pull transactions handler in \a handlers that responds with unconfirmed transactions
 	/// returned by the retriever (\a utRetriever).
 	void RegisterPullTransactionsHandler(ionet::ServerPacketHandlers& handlers, const UtRetriever& utRetriever);
+
+	/// Prototype for a function that retrieves unconfirmed transactions given a set of hashes.
+	using UtHashRetriever = std::function<UnconfirmedTransactions (const utils::HashSet&)>;
+
+	/// Registers a pull transactions by hash handler in \a handlers that responds with unconfirmed transactions
+	/// returned by the retriever (\a utHashRetriever).
+	void RegisterPullTransactionsByHashHandler(ionet::ServerPacketHandlers& handlers, const UtHashRetriever& utHashRetriever);
+
+	/// Prototype for a function that retrieves a reconciliation sketch of unconfirmed transactions with a given number of cells.
+	using UtSketchRetriever = std::function<cache::UtSketch (uint32_t)>;
+
+	/// Registers a pull transactions sketch handler in \a handlers that responds with the unconfirmed transactions sketch
+	/// returned by the retriever (\a utSketchRetriever).
+	void RegisterPullTransactionsSketchHandler(ionet::ServerPacketHandlers& handlers, const UtSketchRetriever& utSketchRetriever);
 }}
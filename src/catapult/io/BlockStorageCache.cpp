@@ -21,6 +21,9 @@
 #include "BlockStorageCache.h"
 #include "catapult/model/Elements.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <map>
 
 namespace catapult { namespace io {
 
@@ -64,59 +67,172 @@ namespace catapult { namespace io {
 	}
 
 	/// Cached data holder.
+	/// \note Recently saved block elements are kept in memory until the total size of the block data they retain exceeds
+	///        the maximum cache size. The most recently saved block element is always cached.
 	struct CachedData {
 	public:
-		CachedData() = default;
+		/// Creates cached data with a maximum cache size (\a maxSize).
+		explicit CachedData(uint64_t maxSize)
+				: m_maxSize(maxSize)
+				, m_size(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
 
+	public:
 		/// Returns cached height.
 		Height getHeight() const {
 			return m_chainHeight;
 		}
 
-		/// Returns \c true if cache contains element at \a height.
-		bool contains(Height height) const {
-			return m_pBlockElement && height == m_pBlockElement->Block.Height;
+		/// Returns the cached block element at \a height or \c nullptr if it is not cached.
+		std::shared_ptr<const model::BlockElement> getBlockElement(Height height) const {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.find(height);
+			if (m_entries.cend() == iter) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			++m_numHits;
+			m_usage.splice(m_usage.begin(), m_usage, iter->second.UsageIter);
+			return iter->second.pBlockElement;
+		}
+
+		/// Copies the hashes of \a numHashes cached block elements starting at \a height into \a pHashes.
+		/// Returns \c false if not all block elements are cached.
+		bool tryCopyHashes(Height height, size_t numHashes, Hash256* pHashes) const {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_entries.find(height);
+			for (auto i = 0u; i < numHashes; ++i, ++iter) {
+				if (m_entries.cend() == iter || height + Height(i) != iter->first)
+					return false;
+
+				pHashes[i] = iter->second.pBlockElement->EntityHash;
+			}
+
+			return true;
 		}
 
-		/// Returns cached block element.
-		std::shared_ptr<const model::BlockElement> getBlockElement(Height) const {
-			return m_pBlockElement;
+		/// Returns cache statistics.
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_entries.size(), m_size, m_numHits, m_numMisses };
 		}
 
-		/// Returns cached block.
-		std::shared_ptr<const model::Block> getBlock(Height) const {
-			return BlockElementAsSharedBlock(m_pBlockElement);
+		/// Updates cache with block element (\a pBlockElement) that exclusively owns its block.
+		void update(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			utils::SpinLockGuard guard(m_lock);
+			add(pBlockElement, std::make_shared<RetainedBuffer>(RetainedBuffer{ pBlockElement->Block.Size, 0 }));
 		}
 
-		/// Updates cache with block element (\a blockElement).
-		void update(const model::BlockElement& blockElement) {
-			// note: update receives elements during loadBlock, but also saveBlock. We get them from BlockChainSyncConsumer,
-			// and it gets them from disruptor... in order NOT to copy here we'd need to take ownership of those.
-			// Currently we can't/shouldn't do it, as there's "new block" consumer afterwards and possibly ProcessingCompleteFunc.
-			m_pBlockElement = Copy(blockElement);
+		/// Updates cache with block elements (\a blockElements) that all share ownership of a single buffer.
+		/// \note The buffer is retained until the last of the block elements is evicted, so its full size is accounted for.
+		///        When the buffer is larger than the cache, only copies of the most recent block elements are cached.
+		void update(const std::vector<std::shared_ptr<const model::BlockElement>>& blockElements) {
+			uint64_t bufferSize = 0;
+			for (const auto& pBlockElement : blockElements)
+				bufferSize += pBlockElement->Block.Size;
+
+			if (1 < blockElements.size() && bufferSize > m_maxSize) {
+				uint64_t copiedSize = 0;
+				auto iter = blockElements.crbegin();
+				do {
+					copiedSize += (*iter)->Block.Size;
+					++iter;
+				} while (blockElements.crend() != iter && copiedSize + (*iter)->Block.Size <= m_maxSize);
+
+				// copy outside of the lock and add the copies in chain order
+				std::vector<std::shared_ptr<const model::BlockElement>> copies;
+				for (auto copyIter = iter.base(); blockElements.cend() != copyIter; ++copyIter)
+					copies.push_back(Copy(**copyIter));
+
+				for (const auto& pBlockElement : copies)
+					update(pBlockElement);
+
+				return;
+			}
+
+			utils::SpinLockGuard guard(m_lock);
+			auto pBuffer = std::make_shared<RetainedBuffer>(RetainedBuffer{ bufferSize, 0 });
+			for (const auto& pBlockElement : blockElements)
+				add(pBlockElement, pBuffer);
 		}
 
 		/// Updates cached height to \a height.
 		void update(Height height) {
 			m_chainHeight = height;
 
-			if (m_pBlockElement && height < m_pBlockElement->Block.Height)
-				m_pBlockElement.reset();
+			utils::SpinLockGuard guard(m_lock);
+			while (!m_entries.empty() && height < m_entries.crbegin()->first)
+				remove(m_entries.crbegin()->first);
 		}
 
 	private:
-		// note: the reason to have them separated is drop blocks, which
-		// updates the height, but we don't want to touch cached block(s).
+		struct RetainedBuffer {
+			uint64_t Size;
+			size_t NumEntries;
+		};
+
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			std::list<Height>::iterator UsageIter;
+			std::shared_ptr<RetainedBuffer> pBuffer;
+		};
+
+	private:
+		void add(const std::shared_ptr<const model::BlockElement>& pBlockElement, const std::shared_ptr<RetainedBuffer>& pBuffer) {
+			auto height = pBlockElement->Block.Height;
+			remove(height);
+
+			if (0 == pBuffer->NumEntries++)
+				m_size += pBuffer->Size;
+
+			m_usage.push_front(height);
+			m_entries.emplace(height, Entry{ pBlockElement, m_usage.begin(), pBuffer });
+
+			while (m_size > m_maxSize && m_entries.size() > 1)
+				remove(m_usage.back());
+		}
+
+		void remove(Height height) {
+			auto iter = m_entries.find(height);
+			if (m_entries.cend() == iter)
+				return;
+
+			auto& buffer = *iter->second.pBuffer;
+			if (0 == --buffer.NumEntries)
+				m_size -= buffer.Size;
+
+			m_usage.erase(iter->second.UsageIter);
+			m_entries.erase(iter);
+		}
+
+	private:
+		// note: the chain height is read without acquiring the lock, so it is stored separately from the cached entries
+		//       (lowering it, e.g. when dropping blocks, evicts all cached entries above it)
 		Height m_chainHeight;
-		std::shared_ptr<const model::BlockElement> m_pBlockElement;
+
+		uint64_t m_maxSize;
+		uint64_t m_size;
+		std::map<Height, Entry> m_entries;
+
+		mutable utils::SpinLock m_lock;
+		mutable std::list<Height> m_usage;
+		mutable uint64_t m_numHits;
+		mutable uint64_t m_numMisses;
 	};
 
 	BlockStorageCache::~BlockStorageCache() = default;
 
-	// This ctor takes r-value, to move the storage (that's not a move ctor).
 	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage)
+			: BlockStorageCache(std::move(pStorage), utils::FileSize())
+	{}
+
+	// This ctor takes r-value, to move the storage (that's not a move ctor).
+	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize)
 			: m_pStorage(std::move(pStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>(maxCacheSize.bytes())) {
 		m_pCachedData->update(m_pStorage->chainHeight());
 	}
 
@@ -130,8 +246,9 @@ namespace catapult { namespace io {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlock(height);
+		auto pBlockElement = m_cachedData.getBlockElement(height);
+		if (pBlockElement)
+			return BlockElementAsSharedBlock(pBlockElement);
 
 		return m_storage.loadBlock(height);
 	}
@@ -140,13 +257,26 @@ namespace catapult { namespace io {
 		if (height > chainHeight())
 			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
 
-		if (m_cachedData.contains(height))
-			return m_cachedData.getBlockElement(height);
+		auto pBlockElement = m_cachedData.getBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
 
 		return m_storage.loadBlockElement(height);
 	}
 
 	model::HashRange BlockStorageView::loadHashesFrom(Height height, size_t maxHashes) const {
+		auto currentHeight = chainHeight();
+		if (Height(0) != height && currentHeight >= height) {
+			// hashes are only served from the cache when all of them are cached
+			auto numAvailableHashes = static_cast<size_t>((currentHeight - height).unwrap() + 1);
+			auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+			uint8_t* pData;
+			auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+			if (m_cachedData.tryCopyHashes(height, numHashes, reinterpret_cast<Hash256*>(pData)))
+				return range;
+		}
+
 		return m_storage.loadHashesFrom(height, maxHashes);
 	}
 
@@ -155,27 +285,43 @@ namespace catapult { namespace io {
 	// region BlockStorageModifier
 
 	namespace {
-		void CacheBlockElement(CachedData& cachedData, const model::BlockElement& blockElement) {
-			if (blockElement.Block.Height > cachedData.getHeight())
-				cachedData.update(blockElement.Block.Height);
+		void CacheBlockElement(CachedData& cachedData, const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			if (pBlockElement->Block.Height > cachedData.getHeight())
+				cachedData.update(pBlockElement->Block.Height);
 
-			cachedData.update(blockElement);
+			cachedData.update(pBlockElement);
 		}
 	}
 
 	void BlockStorageModifier::saveBlock(const model::BlockElement& blockElement) {
 		m_storage.saveBlock(blockElement);
-		CacheBlockElement(m_cachedData, blockElement);
+		CacheBlockElement(m_cachedData, Copy(blockElement));
 	}
 
-	void BlockStorageModifier::saveBlocks(const std::vector<model::BlockElement>& blockElements) {
-		if (blockElements.empty())
-			return;
+	namespace {
+		bool HaveSameOwner(const std::shared_ptr<const model::BlockElement>& pLhs, const std::shared_ptr<const model::BlockElement>& pRhs) {
+			return !pLhs.owner_before(pRhs) && !pRhs.owner_before(pLhs);
+		}
+	}
 
-		for (const auto& blockElement : blockElements)
-			m_storage.saveBlock(blockElement);
+	void BlockStorageModifier::saveBlocks(const std::vector<std::shared_ptr<const model::BlockElement>>& blockElements) {
+		// block elements sharing ownership of a buffer (e.g. a disruptor block range) are cached together
+		std::vector<std::shared_ptr<const model::BlockElement>> sharedBlockElements;
+		for (const auto& pBlockElement : blockElements) {
+			m_storage.saveBlock(*pBlockElement);
+			if (pBlockElement->Block.Height > m_cachedData.getHeight())
+				m_cachedData.update(pBlockElement->Block.Height);
+
+			if (!sharedBlockElements.empty() && !HaveSameOwner(sharedBlockElements.back(), pBlockElement)) {
+				m_cachedData.update(sharedBlockElements);
+				sharedBlockElements.clear();
+			}
 
-		CacheBlockElement(m_cachedData, blockElements.back());
+			sharedBlockElements.push_back(pBlockElement);
+		}
+
+		if (!sharedBlockElements.empty())
+			m_cachedData.update(sharedBlockElements);
 	}
 
 	void BlockStorageModifier::dropBlocksAfter(Height height) {
@@ -195,5 +341,9 @@ namespace catapult { namespace io {
 		return BlockStorageModifier(*m_pStorage, m_lock.acquireReader(), *m_pCachedData);
 	}
 
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pCachedData->statistics();
+	}
+
 	// endregion
 }}
@@ -20,12 +20,28 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
 namespace catapult { namespace io { struct CachedData; } }
 
 namespace catapult { namespace io {
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of cached block elements.
+		size_t NumCachedElements;
+
+		/// Total size of all block data retained by the cache.
+		uint64_t CachedBlocksSize;
+
+		/// Number of block loads that were served by the cache.
+		uint64_t NumHits;
+
+		/// Number of block loads that were served by the underlying storage.
+		uint64_t NumMisses;
+	};
+
 	/// A read only view on top of block storage.
 	class BlockStorageView : utils::MoveOnly {
 	public:
@@ -74,10 +90,13 @@ namespace catapult { namespace io {
 
 	public:
 		/// Saves a block element (\a blockElement).
+		/// \note The block element is copied into the cache.
 		void saveBlock(const model::BlockElement& blockElement);
 
 		/// Saves multiple block elements (\a blockElements).
-		void saveBlocks(const std::vector<model::BlockElement>& blockElements);
+		/// \note The block elements are shared with the cache without being copied unless they share ownership of a buffer
+		///       that is larger than the cache.
+		void saveBlocks(const std::vector<std::shared_ptr<const model::BlockElement>>& blockElements);
 
 		/// Drops all blocks after \a height.
 		void dropBlocksAfter(Height height);
@@ -90,12 +109,16 @@ namespace catapult { namespace io {
 	};
 
 	/// A cache around a BlockStorage.
-	/// \note Currently this "cache" only provides synchronization.
+	/// \note In addition to providing synchronization, this cache keeps recently saved block elements in memory.
 	class BlockStorageCache {
 	public:
-		/// Creates a new cache around \a pStorage.
+		/// Creates a new cache around \a pStorage that only keeps the most recently saved block element in memory.
 		explicit BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage);
 
+		/// Creates a new cache around \a pStorage that keeps recently saved block elements in memory
+		/// as long as their total size does not exceed \a maxCacheSize.
+		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, utils::FileSize maxCacheSize);
+
 		/// Destroys the cache.
 		~BlockStorageCache();
 
@@ -106,6 +129,9 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
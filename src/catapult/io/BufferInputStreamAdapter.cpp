@@ -0,0 +1,43 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BufferInputStreamAdapter.h"
+#include "catapult/exceptions.h"
+#include <cstring>
+
+namespace catapult { namespace io {
+
+	BufferInputStreamAdapter::BufferInputStreamAdapter(const RawBuffer& input)
+			: m_input(input)
+			, m_position(0)
+	{}
+
+	void BufferInputStreamAdapter::read(const MutableRawBuffer& buffer) {
+		if (m_position + buffer.Size > m_input.Size)
+			CATAPULT_THROW_FILE_IO_ERROR("BufferInputStreamAdapter read error");
+
+		std::memcpy(buffer.pData, m_input.pData + m_position, buffer.Size);
+		m_position += buffer.Size;
+	}
+
+	bool BufferInputStreamAdapter::eof() const {
+		return m_position == m_input.Size;
+	}
+}}
@@ -0,0 +1,381 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SegmentedFileStorage.h"
+#include "PodIoUtils.h"
+#include "RawFile.h"
+#include "catapult/model/Elements.h"
+#include "catapult/exceptions.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace catapult { namespace io {
+
+	constexpr uint16_t SegmentedFileStorage::Format_Version;
+
+	namespace {
+		constexpr uint32_t Index_Magic = 0x58444953; // SIDX
+		constexpr uint32_t Segment_Magic = 0x47455353; // SSEG
+		constexpr auto Index_File = "segments.idx";
+		constexpr auto Segment_File_Extension = ".seg";
+
+#pragma pack(push, 1)
+
+		struct FileHeader {
+			uint32_t Magic;
+			uint16_t Version;
+			uint16_t Reserved;
+		};
+
+#pragma pack(pop)
+
+		// index file: | header | chain height | entry (height 1) | entry (height 2) | ...
+		constexpr uint64_t Index_Header_Size = sizeof(FileHeader) + sizeof(Height);
+
+		// segment file: | header | record | record | ...
+		// record: | block | entity hash | generation hash | num transactions | (entity hash, merkle component hash) * n |
+		constexpr uint64_t Segment_Header_Size = sizeof(FileHeader);
+		constexpr uint32_t Record_Metadata_Size = 2 * Hash256_Size + sizeof(uint32_t);
+
+		std::string GetIndexPath(const std::string& baseDirectory) {
+			boost::filesystem::path indexPath = baseDirectory;
+			indexPath /= Index_File;
+			return indexPath.generic_string();
+		}
+
+		std::string GetSegmentPath(const std::string& baseDirectory, uint32_t segmentId) {
+			std::ostringstream filename;
+			filename << std::setw(5) << std::setfill('0') << segmentId << Segment_File_Extension;
+
+			boost::filesystem::path segmentPath = baseDirectory;
+			segmentPath /= filename.str();
+			return segmentPath.generic_string();
+		}
+
+		void WriteHeader(RawFile& file, uint32_t magic) {
+			FileHeader header{ magic, SegmentedFileStorage::Format_Version, 0 };
+			file.write({ reinterpret_cast<const uint8_t*>(&header), sizeof(FileHeader) });
+		}
+
+		void CheckHeader(const FileHeader& header, uint32_t magic) {
+			if (magic != header.Magic)
+				CATAPULT_THROW_RUNTIME_ERROR_1("storage file has invalid magic", header.Magic);
+
+			if (SegmentedFileStorage::Format_Version < header.Version)
+				CATAPULT_THROW_RUNTIME_ERROR_1("storage file has unsupported version", header.Version);
+		}
+
+		void ReadAndCheckHeader(RawFile& file, uint32_t magic) {
+			FileHeader header;
+			file.read({ reinterpret_cast<uint8_t*>(&header), sizeof(FileHeader) });
+			CheckHeader(header, magic);
+		}
+
+		std::vector<uint8_t> SerializeRecord(const model::BlockElement& blockElement) {
+			auto numTransactions = static_cast<uint32_t>(blockElement.Transactions.size());
+			std::vector<uint8_t> record(blockElement.Block.Size + Record_Metadata_Size + 2 * numTransactions * Hash256_Size);
+
+			auto* pData = record.data();
+			auto append = [&pData](const auto* pSource, size_t size) {
+				std::memcpy(pData, pSource, size);
+				pData += size;
+			};
+
+			append(&blockElement.Block, blockElement.Block.Size);
+			append(blockElement.EntityHash.data(), Hash256_Size);
+			append(blockElement.GenerationHash.data(), Hash256_Size);
+			append(&numTransactions, sizeof(uint32_t));
+			for (const auto& transactionElement : blockElement.Transactions) {
+				append(transactionElement.EntityHash.data(), Hash256_Size);
+				append(transactionElement.MerkleComponentHash.data(), Hash256_Size);
+			}
+
+			return record;
+		}
+
+		[[noreturn]]
+		void ThrowCorruptRecord(Height height) {
+			CATAPULT_THROW_RUNTIME_ERROR_1("segment contains corrupt record for block", height);
+		}
+
+		struct MappedBlockElement {
+		public:
+			MappedBlockElement(const std::shared_ptr<const void>& pOwner, const model::Block& block)
+					: pSegment(pOwner)
+					, Element(block)
+			{}
+
+		public:
+			std::shared_ptr<const void> pSegment;
+			model::BlockElement Element;
+		};
+	}
+
+	// region MappedSegment
+
+	class SegmentedFileStorage::MappedSegment {
+	public:
+		explicit MappedSegment(const std::string& segmentPath)
+				: m_mapping(segmentPath.c_str(), boost::interprocess::read_only)
+				, m_region(m_mapping, boost::interprocess::read_only) {
+			if (size() < Segment_Header_Size)
+				CATAPULT_THROW_RUNTIME_ERROR_1("segment is too small", segmentPath);
+
+			CheckHeader(reinterpret_cast<const FileHeader&>(*data()), Segment_Magic);
+		}
+
+	public:
+		const uint8_t* data() const {
+			return static_cast<const uint8_t*>(m_region.get_address());
+		}
+
+		uint64_t size() const {
+			return m_region.get_size();
+		}
+
+	private:
+		boost::interprocess::file_mapping m_mapping;
+		boost::interprocess::mapped_region m_region;
+	};
+
+	// endregion
+
+	SegmentedFileStorage::SegmentedFileStorage(const std::string& dataDirectory, utils::FileSize maxSegmentSize)
+			: m_dataDirectory(dataDirectory)
+			, m_maxSegmentSize(maxSegmentSize.bytes())
+			, m_writeSegmentId(0) {
+		static_assert(48 == sizeof(IndexEntry), "index entries must be tightly packed");
+
+		m_pIndexFile = std::make_unique<RawFile>(GetIndexPath(m_dataDirectory), OpenMode::Read_Append, LockMode::None);
+		if (0 == m_pIndexFile->size()) {
+			WriteHeader(*m_pIndexFile, Index_Magic);
+			Write(*m_pIndexFile, m_chainHeight);
+			return;
+		}
+
+		ReadAndCheckHeader(*m_pIndexFile, Index_Magic);
+		Read(*m_pIndexFile, m_chainHeight);
+
+		// load all entries (including ones after the chain height) in order to find the most recent segment
+		auto numEntries = (m_pIndexFile->size() - Index_Header_Size) / sizeof(IndexEntry);
+		if (numEntries < m_chainHeight.unwrap())
+			CATAPULT_THROW_RUNTIME_ERROR_2("segment index is truncated", numEntries, m_chainHeight);
+
+		m_entries.resize(numEntries);
+		m_pIndexFile->read({ reinterpret_cast<uint8_t*>(m_entries.data()), numEntries * sizeof(IndexEntry) });
+		for (const auto& entry : m_entries)
+			m_writeSegmentId = std::max(m_writeSegmentId, entry.SegmentId);
+
+		m_entries.resize(m_chainHeight.unwrap());
+	}
+
+	SegmentedFileStorage::~SegmentedFileStorage() = default;
+
+	Height SegmentedFileStorage::chainHeight() const {
+		return m_chainHeight;
+	}
+
+	std::shared_ptr<const model::Block> SegmentedFileStorage::loadBlock(Height height) const {
+		const auto& entry = getEntry(height);
+		auto pSegment = mapSegment(entry);
+
+		const auto* pRecord = pSegment->data() + entry.Offset;
+		const auto& block = reinterpret_cast<const model::Block&>(*pRecord);
+		if (entry.Size < sizeof(uint32_t) || entry.Size < block.Size + Record_Metadata_Size)
+			ThrowCorruptRecord(height);
+
+		// the returned block extends the lifetime of the mapped segment
+		return std::shared_ptr<const model::Block>(pSegment, &block);
+	}
+
+	std::shared_ptr<const model::BlockElement> SegmentedFileStorage::loadBlockElement(Height height) const {
+		const auto& entry = getEntry(height);
+		auto pSegment = mapSegment(entry);
+
+		const auto* pRecord = pSegment->data() + entry.Offset;
+		const auto& block = reinterpret_cast<const model::Block&>(*pRecord);
+		if (entry.Size < sizeof(uint32_t) || entry.Size < block.Size + Record_Metadata_Size)
+			ThrowCorruptRecord(height);
+
+		auto pHolder = std::make_shared<MappedBlockElement>(pSegment, block);
+		auto& blockElement = pHolder->Element;
+
+		const auto* pMetadata = pRecord + block.Size;
+		std::memcpy(blockElement.EntityHash.data(), pMetadata, Hash256_Size);
+		std::memcpy(blockElement.GenerationHash.data(), pMetadata + Hash256_Size, Hash256_Size);
+
+		uint32_t numTransactions;
+		std::memcpy(&numTransactions, pMetadata + 2 * Hash256_Size, sizeof(uint32_t));
+		if (entry.Size != block.Size + Record_Metadata_Size + 2 * numTransactions * Hash256_Size)
+			ThrowCorruptRecord(height);
+
+		const auto* pTransactionHashes = pMetadata + Record_Metadata_Size;
+		const auto* pTransactionHashesEnd = pTransactionHashes + 2 * numTransactions * Hash256_Size;
+		for (const auto& transaction : block.Transactions()) {
+			if (pTransactionHashesEnd == pTransactionHashes)
+				ThrowCorruptRecord(height);
+
+			blockElement.Transactions.push_back(model::TransactionElement(transaction));
+			auto& transactionElement = blockElement.Transactions.back();
+			std::memcpy(transactionElement.EntityHash.data(), pTransactionHashes, Hash256_Size);
+			std::memcpy(transactionElement.MerkleComponentHash.data(), pTransactionHashes + Hash256_Size, Hash256_Size);
+			pTransactionHashes += 2 * Hash256_Size;
+		}
+
+		// the returned block element extends the lifetime of the mapped segment
+		return std::shared_ptr<const model::BlockElement>(pHolder, &blockElement);
+	}
+
+	model::HashRange SegmentedFileStorage::loadHashesFrom(Height height, size_t maxHashes) const {
+		if (Height(0) == height || m_chainHeight < height)
+			return model::HashRange();
+
+		auto numAvailableHashes = static_cast<size_t>((m_chainHeight - height).unwrap() + 1);
+		auto numHashes = std::min(maxHashes, numAvailableHashes);
+
+		uint8_t* pData = nullptr;
+		auto range = model::HashRange::PrepareFixed(numHashes, &pData);
+
+		auto entryIter = m_entries.cbegin() + static_cast<std::ptrdiff_t>(height.unwrap() - 1);
+		for (auto i = 0u; i < numHashes; ++i, ++entryIter, pData += Hash256_Size)
+			std::memcpy(pData, entryIter->EntityHash.data(), Hash256_Size);
+
+		return range;
+	}
+
+	void SegmentedFileStorage::saveBlock(const model::BlockElement& blockElement) {
+		auto height = blockElement.Block.Height;
+		if (height != m_chainHeight + Height(1))
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot save out of order block at height", height);
+
+		auto record = SerializeRecord(blockElement);
+		if (!m_pWriteSegmentFile)
+			openWriteSegment(m_writeSegmentId);
+
+		// roll over to a new segment when the current one would grow too large (but never leave a segment empty)
+		auto segmentSize = m_pWriteSegmentFile->size();
+		if (Segment_Header_Size < segmentSize && segmentSize + record.size() > m_maxSegmentSize) {
+			openWriteSegment(m_writeSegmentId + 1);
+			segmentSize = m_pWriteSegmentFile->size();
+		}
+
+		m_pWriteSegmentFile->seek(segmentSize);
+		m_pWriteSegmentFile->write(record);
+
+		// write the index entry before updating the chain height so that the index never refers to missing data
+		IndexEntry entry{ segmentSize, m_writeSegmentId, static_cast<uint32_t>(record.size()), blockElement.EntityHash };
+		m_pIndexFile->seek(Index_Header_Size + m_entries.size() * sizeof(IndexEntry));
+		m_pIndexFile->write({ reinterpret_cast<const uint8_t*>(&entry), sizeof(IndexEntry) });
+		m_entries.push_back(entry);
+
+		setChainHeight(height);
+	}
+
+	void SegmentedFileStorage::dropBlocksAfter(Height height) {
+		if (height > m_chainHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot drop blocks after height greater than chain height", height);
+
+		// dropped records are left in their segments; new blocks are always appended
+		m_entries.resize(height.unwrap());
+		setChainHeight(height);
+	}
+
+	void SegmentedFileStorage::pruneBlocksBefore(Height height) {
+		if (height > m_chainHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("prune requested with height", height);
+
+		if (height <= Height(1))
+			return;
+
+		// segment ids are nondecreasing with height, so all segments strictly between the one containing the nemesis block
+		// and the one containing the prune height only contain prunable blocks
+		auto nemesisSegmentId = m_entries.front().SegmentId;
+		auto pruneSegmentId = getEntry(height).SegmentId;
+
+		std::lock_guard<std::mutex> guard(m_segmentsMutex);
+		for (auto segmentId = nemesisSegmentId + 1; segmentId < pruneSegmentId; ++segmentId) {
+			m_segments.erase(segmentId);
+			boost::filesystem::remove(GetSegmentPath(m_dataDirectory, segmentId));
+		}
+	}
+
+	const SegmentedFileStorage::IndexEntry& SegmentedFileStorage::getEntry(Height height) const {
+		if (height > m_chainHeight)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("cannot load block at height greater than chain height", height);
+
+		if (Height(0) == height)
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot load block at height zero");
+
+		return m_entries[height.unwrap() - 1];
+	}
+
+	std::shared_ptr<const SegmentedFileStorage::MappedSegment> SegmentedFileStorage::mapSegment(const IndexEntry& entry) const {
+		std::lock_guard<std::mutex> guard(m_segmentsMutex);
+		auto& pSegment = m_segments[entry.SegmentId];
+
+		// segments only grow, so a segment only needs to be remapped when it does not contain the requested record;
+		// previously loaded blocks keep the old mapping alive
+		auto recordEnd = entry.Offset + entry.Size;
+		if (!pSegment || pSegment->size() < recordEnd) {
+			auto segmentPath = GetSegmentPath(m_dataDirectory, entry.SegmentId);
+			if (!boost::filesystem::exists(segmentPath))
+				CATAPULT_THROW_RUNTIME_ERROR_1("block segment is not available", entry.SegmentId);
+
+			pSegment = std::make_shared<const MappedSegment>(segmentPath);
+			if (pSegment->size() < recordEnd)
+				CATAPULT_THROW_RUNTIME_ERROR_2("block segment is truncated", entry.SegmentId, recordEnd);
+		}
+
+		return pSegment;
+	}
+
+	void SegmentedFileStorage::openWriteSegment(uint32_t segmentId) {
+		auto pSegmentFile = std::make_unique<RawFile>(GetSegmentPath(m_dataDirectory, segmentId), OpenMode::Read_Append, LockMode::None);
+		if (0 == pSegmentFile->size())
+			WriteHeader(*pSegmentFile, Segment_Magic);
+		else
+			ReadAndCheckHeader(*pSegmentFile, Segment_Magic);
+
+		m_pWriteSegmentFile = std::move(pSegmentFile);
+		m_writeSegmentId = segmentId;
+	}
+
+	void SegmentedFileStorage::setChainHeight(Height height) {
+		m_pIndexFile->seek(sizeof(FileHeader));
+		Write(*m_pIndexFile, height);
+		m_chainHeight = height;
+	}
+
+	size_t ImportBlocks(const BlockStorage& source, LightBlockStorage& destination) {
+		auto sourceHeight = source.chainHeight();
+
+		size_t numImportedBlocks = 0;
+		for (auto height = destination.chainHeight() + Height(1); height <= sourceHeight; height = height + Height(1)) {
+			destination.saveBlock(*source.loadBlockElement(height));
+			++numImportedBlocks;
+		}
+
+		return numImportedBlocks;
+	}
+}}
@@ -0,0 +1,100 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace catapult { namespace io { class RawFile; } }
+
+namespace catapult { namespace io {
+
+	/// Segmented file-based block storage.
+	/// Blocks are appended to large segment files and are located via a fixed-size index that is kept in memory.
+	/// Loaded blocks are served directly from memory-mapped segments without being copied.
+	/// \note Storage assumes it is the only writer of its data directory.
+	class SegmentedFileStorage final : public PrunableBlockStorage {
+	public:
+		/// Current version of the segment and index file formats.
+		static constexpr uint16_t Format_Version = 1;
+
+	public:
+		/// Creates a segmented storage, where blocks will be stored inside \a dataDirectory
+		/// in segment files that are at most \a maxSegmentSize bytes (unless a single block is larger).
+		explicit SegmentedFileStorage(const std::string& dataDirectory, utils::FileSize maxSegmentSize = utils::FileSize::FromMegabytes(256));
+
+		/// Destroys the storage.
+		~SegmentedFileStorage() override;
+
+	public:
+		Height chainHeight() const override;
+
+	public:
+		std::shared_ptr<const model::Block> loadBlock(Height height) const override;
+		std::shared_ptr<const model::BlockElement> loadBlockElement(Height height) const override;
+
+		model::HashRange loadHashesFrom(Height height, size_t maxHashes) const override;
+
+		void saveBlock(const model::BlockElement& blockElement) override;
+		void dropBlocksAfter(Height height) override;
+
+	public:
+		/// Drops all blocks before \a height.
+		/// \note Only segments that exclusively contain blocks before \a height (excluding the nemesis block) are deleted.
+		void pruneBlocksBefore(Height height) override;
+
+	private:
+		// index entry describing the location of a single block
+		struct IndexEntry {
+			uint64_t Offset;
+			uint32_t SegmentId;
+			uint32_t Size;
+			Hash256 EntityHash;
+		};
+
+		class MappedSegment;
+
+	private:
+		const IndexEntry& getEntry(Height height) const;
+		std::shared_ptr<const MappedSegment> mapSegment(const IndexEntry& entry) const;
+		void openWriteSegment(uint32_t segmentId);
+		void setChainHeight(Height height);
+
+	private:
+		std::string m_dataDirectory;
+		uint64_t m_maxSegmentSize;
+		std::unique_ptr<RawFile> m_pIndexFile;
+		std::vector<IndexEntry> m_entries;
+		Height m_chainHeight;
+
+		uint32_t m_writeSegmentId;
+		std::unique_ptr<RawFile> m_pWriteSegmentFile;
+
+		mutable std::mutex m_segmentsMutex;
+		mutable std::unordered_map<uint32_t, std::shared_ptr<const MappedSegment>> m_segments;
+	};
+
+	/// Copies all blocks in \a source that are above the chain height of \a destination into \a destination.
+	/// Returns the number of copied blocks.
+	size_t ImportBlocks(const BlockStorage& source, LightBlockStorage& destination);
+}}
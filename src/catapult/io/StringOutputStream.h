@@ -0,0 +1,45 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "Stream.h"
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Output stream that appends all written data to a string.
+	class StringOutputStream final : public OutputStream {
+	public:
+		/// Creates an output stream with an (initially empty) string that has \a capacity bytes reserved.
+		explicit StringOutputStream(size_t capacity = 0);
+
+	public:
+		void write(const RawBuffer& buffer) override;
+
+		void flush() override;
+
+	public:
+		/// Gets all data written to this stream.
+		const std::string& str() const;
+
+	private:
+		std::string m_output;
+	};
+}}
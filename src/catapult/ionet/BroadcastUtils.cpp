@@ -41,6 +41,17 @@ namespace catapult { namespace ionet {
 		return builder.build();
 	}
 
+	PacketPayload CreateAnnouncementPayload(const std::vector<model::TransactionInfo>& transactionInfos) {
+		std::vector<Hash256> hashes;
+		hashes.reserve(transactionInfos.size());
+		for (const auto& transactionInfo : transactionInfos)
+			hashes.push_back(transactionInfo.EntityHash);
+
+		PacketPayloadBuilder builder(PacketType::Push_Transaction_Hashes);
+		builder.appendValues(hashes);
+		return builder.build();
+	}
+
 	PacketPayload CreateBroadcastPayload(const std::vector<model::DetachedCosignature>& cosignatures) {
 		PacketPayloadBuilder builder(PacketType::Push_Detached_Cosignatures);
 		builder.appendValues(cosignatures);
@@ -35,6 +35,9 @@ namespace catapult { namespace ionet {
 	/// Creates a payload around \a transactionInfos for broadcasting using \a packetType.
 	PacketPayload CreateBroadcastPayload(const std::vector<model::TransactionInfo>& transactionInfos, PacketType packetType);
 
+	/// Creates a payload around the hashes of \a transactionInfos for announcing.
+	PacketPayload CreateAnnouncementPayload(const std::vector<model::TransactionInfo>& transactionInfos);
+
 	/// Creates a payload around \a cosignatures for broadcasting.
 	PacketPayload CreateBroadcastPayload(const std::vector<model::DetachedCosignature>& cosignatures);
 }}
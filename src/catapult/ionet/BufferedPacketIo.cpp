@@ -19,31 +19,13 @@
 **/
 
 #include "BufferedPacketIo.h"
-#include "PacketIo.h"
+#include "BatchPacketWriter.h"
 #include "catapult/utils/Logging.h"
 #include <deque>
 
 namespace catapult { namespace ionet {
 
 	namespace {
-		class WriteRequest {
-		public:
-			explicit WriteRequest(PacketIo& io, const PacketPayload& payload)
-					: m_io(io)
-					, m_payload(payload)
-			{}
-
-		public:
-			template<typename TCallback>
-			void invoke(TCallback callback) {
-				m_io.write(m_payload, callback);
-			}
-
-		private:
-			PacketIo& m_io;
-			PacketPayload m_payload;
-		};
-
 		class ReadRequest {
 		public:
 			explicit ReadRequest(PacketIo& io) : m_io(io)
@@ -117,16 +99,91 @@ namespace catapult { namespace ionet {
 			std::deque<std::pair<TRequest, TCallback>> m_requests;
 		};
 
-		/// Protects RequestQueue via a strand.
-		template<typename TRequest, typename TCallback>
+		// write queue implementation that coalesces all writes queued while a write is in progress
+		// (when a coalesced write is rejected as malformed, its writes are retried individually so that only malformed ones fail)
+		template<typename TCallbackWrapper>
+		class CoalescingWriteQueue {
+		private:
+			using WriteRequest = std::pair<PacketPayload, PacketIo::WriteCallback>;
+
+		public:
+			CoalescingWriteQueue(TCallbackWrapper& wrapper, BatchPacketWriter& batchWriter)
+					: m_wrapper(wrapper)
+					, m_batchWriter(batchWriter)
+					, m_isWriteInProgress(false)
+			{}
+
+		public:
+			void push(const PacketPayload& payload, const PacketIo::WriteCallback& callback) {
+				m_pendingRequests.emplace_back(payload, callback);
+
+				if (m_isWriteInProgress) {
+					CATAPULT_LOG(trace) << "queuing write because in progress write detected";
+					return;
+				}
+
+				next();
+			}
+
+		private:
+			void next() {
+				auto pRequests = std::make_shared<std::vector<WriteRequest>>();
+				if (!m_isolatedRequests.empty()) {
+					// retried requests are written one at a time and before any requests that were queued after them
+					pRequests->push_back(m_isolatedRequests.front());
+					m_isolatedRequests.pop_front();
+				} else {
+					pRequests->swap(m_pendingRequests);
+				}
+
+				write(pRequests);
+			}
+
+			void write(const std::shared_ptr<std::vector<WriteRequest>>& pRequests) {
+				// write all payloads at once and complete all of their requests with the result of the batch write
+				std::vector<PacketPayload> payloads;
+				payloads.reserve(pRequests->size());
+				for (const auto& request : *pRequests)
+					payloads.push_back(request.first);
+
+				m_isWriteInProgress = true;
+				m_batchWriter.writeMultiple(payloads, m_wrapper.wrap([this, pRequests](auto code) {
+					m_isWriteInProgress = false;
+					if (SocketOperationCode::Malformed_Data == code && 1 < pRequests->size()) {
+						// none of the payloads were written, so retry them individually to only fail the malformed ones
+						CATAPULT_LOG(debug) << "retrying " << pRequests->size() << " coalesced writes individually";
+						m_isolatedRequests.insert(m_isolatedRequests.cbegin(), pRequests->cbegin(), pRequests->cend());
+					} else {
+						for (const auto& request : *pRequests)
+							request.second(code);
+					}
+
+					// if requests have been queued in the meantime, start the next batch
+					if (!m_isolatedRequests.empty() || !m_pendingRequests.empty())
+						this->next();
+				}));
+			}
+
+		private:
+			TCallbackWrapper& m_wrapper;
+			BatchPacketWriter& m_batchWriter;
+			std::vector<WriteRequest> m_pendingRequests;
+			std::deque<WriteRequest> m_isolatedRequests;
+			bool m_isWriteInProgress;
+		};
+
+		/// Protects a request queue via a strand.
+		template<typename TRequestQueue>
 		class QueuedOperation {
 		public:
-			explicit QueuedOperation(boost::asio::strand& strand)
+			template<typename... TArgs>
+			explicit QueuedOperation(boost::asio::strand& strand, TArgs&&... args)
 					: m_strand(strand)
-					, m_requests(m_strand)
+					, m_requests(m_strand, std::forward<TArgs>(args)...)
 			{}
 
 		public:
+			template<typename TRequest, typename TCallback>
 			void push(const TRequest& request, const TCallback& callback) {
 				m_strand.post([this, request, callback] {
 					m_requests.push(request, callback);
@@ -135,27 +192,30 @@ namespace catapult { namespace ionet {
 
 		private:
 			boost::asio::strand& m_strand;
-			RequestQueue<TRequest, TCallback, boost::asio::strand> m_requests;
+			TRequestQueue m_requests;
 		};
 
-		using QueuedWriteOperation = QueuedOperation<WriteRequest, PacketIo::WriteCallback>;
-		using QueuedReadOperation = QueuedOperation<ReadRequest, PacketIo::ReadCallback>;
+		using QueuedWriteOperation = QueuedOperation<CoalescingWriteQueue<boost::asio::strand>>;
+		using QueuedReadOperation = QueuedOperation<RequestQueue<ReadRequest, PacketIo::ReadCallback, boost::asio::strand>>;
 
 		class BufferedPacketIo
 				: public PacketIo
 				, public std::enable_shared_from_this<BufferedPacketIo> {
 		public:
-			BufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand)
+			BufferedPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					const std::shared_ptr<BatchPacketWriter>& pBatchWriter,
+					boost::asio::strand& strand)
 					: m_pIo(pIo)
+					, m_pBatchWriter(pBatchWriter)
 					, m_strand(strand)
-					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand))
+					, m_pWriteOperation(std::make_unique<QueuedWriteOperation>(m_strand, *m_pBatchWriter))
 					, m_pReadOperation(std::make_unique<QueuedReadOperation>(m_strand))
 			{}
 
 		public:
 			void write(const PacketPayload& payload, const WriteCallback& callback) override {
-				auto request = WriteRequest(*m_pIo, payload);
-				m_pWriteOperation->push(request, [pThis = shared_from_this(), callback](auto code) {
+				m_pWriteOperation->push(payload, [pThis = shared_from_this(), callback](auto code) {
 					callback(code);
 				});
 			}
@@ -169,13 +229,17 @@ namespace catapult { namespace ionet {
 
 		private:
 			std::shared_ptr<PacketIo> m_pIo;
+			std::shared_ptr<BatchPacketWriter> m_pBatchWriter;
 			boost::asio::strand& m_strand;
 			std::unique_ptr<QueuedWriteOperation> m_pWriteOperation;
 			std::unique_ptr<QueuedReadOperation> m_pReadOperation;
 		};
 	}
 
-	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand) {
-		return std::make_shared<BufferedPacketIo>(pIo, strand);
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pBatchWriter,
+			boost::asio::strand& strand) {
+		return std::make_shared<BufferedPacketIo>(pIo, pBatchWriter, strand);
 	}
 }}
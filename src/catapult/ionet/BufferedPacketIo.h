@@ -21,10 +21,20 @@
 #pragma once
 #include "IoTypes.h"
 
-namespace catapult { namespace ionet { class PacketIo; } }
+namespace catapult {
+	namespace ionet {
+		class BatchPacketWriter;
+		class PacketIo;
+	}
+}
 
 namespace catapult { namespace ionet {
 
 	/// Adds buffering to \a pIo using \a strand for synchronization.
-	std::shared_ptr<PacketIo> CreateBufferedPacketIo(const std::shared_ptr<PacketIo>& pIo, boost::asio::strand& strand);
+	/// Reads are delegated to \a pIo and all writes queued while a write is in progress are coalesced
+	/// into a single batch write delegated to \a pBatchWriter.
+	std::shared_ptr<PacketIo> CreateBufferedPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<BatchPacketWriter>& pBatchWriter,
+			boost::asio::strand& strand);
 }}
@@ -56,6 +56,14 @@ namespace catapult { namespace ionet {
 		return m_buffers;
 	}
 
+	const std::shared_ptr<SharedPacketPayloadSignature>& PacketPayload::sharedSignature() const {
+		return m_pSharedSignature;
+	}
+
+	void PacketPayload::enableSignatureSharing() {
+		m_pSharedSignature = std::make_shared<SharedPacketPayloadSignature>();
+	}
+
 	PacketPayload PacketPayload::Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload) {
 		// pPacket should envelop payload
 		PacketPayload mergedPayload(pPacket);
@@ -21,10 +21,23 @@
 #pragma once
 #include "Packet.h"
 #include "catapult/types.h"
+#include <mutex>
 #include <vector>
 
 namespace catapult { namespace ionet {
 
+	/// Signature of a packet payload that is shared by all copies of the payload.
+	struct SharedPacketPayloadSignature {
+		/// Flag that is set once the signature has been calculated.
+		std::once_flag CalculatedFlag;
+
+		/// Public key of the signer.
+		Key SignerPublicKey;
+
+		/// Payload signature.
+		catapult::Signature Signature;
+	};
+
 	/// A packet payload that can be written.
 	class PacketPayload {
 	public:
@@ -47,6 +60,14 @@ namespace catapult { namespace ionet {
 		/// Packet data.
 		const std::vector<RawBuffer>& buffers() const;
 
+		/// Signature shared by all copies of this payload or \c nullptr if signature sharing is not enabled.
+		const std::shared_ptr<SharedPacketPayloadSignature>& sharedSignature() const;
+
+	public:
+		/// Enables sharing of a single signature by all subsequent copies of this payload.
+		/// \note This allows a payload that is written to multiple signed connections to be signed only once.
+		void enableSignatureSharing();
+
 	public:
 		/// Merges a packet (\a pPacket) and a packet \a payload into a new packet payload.
 		static PacketPayload Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload);
@@ -58,6 +79,8 @@ namespace catapult { namespace ionet {
 		// the backing data
 		std::vector<std::shared_ptr<const void>> m_entities;
 
+		std::shared_ptr<SharedPacketPayloadSignature> m_pSharedSignature;
+
 	private:
 		friend class PacketPayloadBuilder;
 	};
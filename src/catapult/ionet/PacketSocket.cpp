@@ -19,6 +19,7 @@
 **/
 
 #include "PacketSocket.h"
+#include "BatchPacketWriter.h"
 #include "BufferedPacketIo.h"
 #include "Node.h"
 #include "WorkingBuffer.h"
@@ -78,64 +79,56 @@ namespace catapult { namespace ionet {
 
 		public:
 			void write(const PacketPayload& payload, const PacketSocket::WriteCallback& callback) {
-				if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
-					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
-					callback(SocketOperationCode::Malformed_Data);
-					return;
+				writeMultiple({ payload }, callback);
+			}
+
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback) {
+				for (const auto& payload : payloads) {
+					if (!IsPacketDataSizeValid(payload.header(), m_maxPacketDataSize)) {
+						CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+						callback(SocketOperationCode::Malformed_Data);
+						return;
+					}
 				}
 
-				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				// write all headers and data buffers with a single gathered write
+				auto pContext = std::make_shared<WriteContext>(payloads, callback);
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
 		private:
-			struct WriteContext {
+			class WriteContext {
 			public:
-				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
-						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
+				WriteContext(const std::vector<PacketPayload>& payloads, const PacketSocket::WriteCallback& callback)
+						: m_payloads(payloads)
+						, m_callback(callback) {
+					for (const auto& payload : m_payloads) {
+						const auto& header = payload.header();
+						m_buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+
+						for (const auto& rawBuffer : payload.buffers())
+							m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
+					}
+				}
 
 			public:
-				auto headerBuffer() const {
-					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+				const std::vector<boost::asio::const_buffer>& buffers() const {
+					return m_buffers;
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
-				}
-
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
 			private:
-				const PacketPayload m_payload;
+				// the buffers point into the payloads, so the payloads must be kept alive until the write completes
+				const std::vector<PacketPayload> m_payloads;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		public:
 			void read(const PacketSocket::ReadCallback& callback, bool allowMultiple) {
 				// try to extract a packet from the working buffer
@@ -245,6 +238,7 @@ namespace catapult { namespace ionet {
 		/// enable_shared_from_this.
 		class StrandedPacketSocket final
 				: public PacketSocket
+				, public BatchPacketWriter
 				, public std::enable_shared_from_this<StrandedPacketSocket> {
 		private:
 			using SocketType = BasicPacketSocket<StrandedPacketSocket>;
@@ -271,6 +265,10 @@ namespace catapult { namespace ionet {
 				post([payload, callback](auto& socket) { socket.write(payload, callback); });
 			}
 
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const WriteCallback& callback) override {
+				post([payloads, callback](auto& socket) { socket.writeMultiple(payloads, callback); });
+			}
+
 			void read(const ReadCallback& callback) override {
 				post([callback](auto& socket) { socket.read(callback, false); });
 			}
@@ -288,7 +286,8 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return CreateBufferedPacketIo(shared_from_this(), m_strand);
+				auto pThis = shared_from_this();
+				return CreateBufferedPacketIo(pThis, pThis, m_strand);
 			}
 
 		public:
@@ -60,6 +60,18 @@ namespace catapult { namespace ionet {
 	/* A secure packet with a signature. */ \
 	ENUM_VALUE(Secure_Signed, 11) \
 	\
+	/* A secure packet with a session keyed mac. */ \
+	ENUM_VALUE(Secure_Mac, 12) \
+	\
+	/* Hashes of new transactions have been announced by a peer. */ \
+	ENUM_VALUE(Push_Transaction_Hashes, 13) \
+	\
+	/* Unconfirmed transactions with specific hashes have been requested by a peer. */ \
+	ENUM_VALUE(Pull_Transactions_By_Hash, 14) \
+	\
+	/* A reconciliation sketch of unconfirmed transactions has been requested by a peer. */ \
+	ENUM_VALUE(Pull_Transactions_Sketch, 15) \
+	\
 	/* api only packets have types [500, 600) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -71,6 +83,12 @@ namespace catapult { namespace ionet {
 	/* Partial transaction infos have been requested by an api-node. */ \
 	ENUM_VALUE(Pull_Partial_Transaction_Infos, 502) \
 	\
+	/* A reconciliation sketch of partial transaction infos has been requested by an api-node. */ \
+	ENUM_VALUE(Pull_Partial_Transaction_Infos_Sketch, 503) \
+	\
+	/* Partial transaction infos with specific hashes have been requested by an api-node. */ \
+	ENUM_VALUE(Pull_Partial_Transaction_Infos_By_Hash, 504) \
+	\
 	/* node discovery packets have types [600, 700) */ \
 	\
 	/* Node information has been pushed by a peer. */ \
@@ -0,0 +1,285 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SecureMacPacketIo.h"
+#include "BatchPacketReader.h"
+#include "PacketIo.h"
+#include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/SecureZero.h"
+#include "catapult/crypto/SharedKey.h"
+#include "catapult/utils/HexFormatter.h"
+#include <atomic>
+#include <mutex>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+#pragma pack(push, 1)
+
+		struct SecureMacPacketHeader : public ionet::Packet {
+			static constexpr PacketType Packet_Type = PacketType::Secure_Mac;
+
+			uint64_t Sequence;
+			Hash256 Mac;
+		};
+
+#pragma pack(pop)
+
+		/// Number of sequence numbers preceding the largest received sequence number that can still be accepted.
+		/// \note Writes queued on a buffered io can be overtaken by writes on the underlying socket, so a small amount
+		///       of reordering is tolerated.
+		constexpr uint64_t Replay_Window_Size = 64;
+
+		Hash256 DeriveDirectionKey(const Key& sharedKey, const Hash256& sessionId, const Key& senderPublicKey) {
+			crypto::Sha3_256_Builder hashBuilder;
+			hashBuilder.update(sharedKey);
+			hashBuilder.update(sessionId);
+			hashBuilder.update(senderPublicKey);
+
+			Hash256 directionKey;
+			hashBuilder.final(directionKey);
+			return directionKey;
+		}
+
+		void StartMac(crypto::Sha3_256_Builder& macBuilder, const Hash256& key, uint64_t sequence) {
+			// keyed sha3 (kmac-style) is not susceptible to length extension, so the key can simply be prepended
+			macBuilder.update({ key, { reinterpret_cast<const uint8_t*>(&sequence), sizeof(uint64_t) } });
+		}
+
+		bool AreMacsEqual(const Hash256& lhs, const Hash256& rhs) {
+			// constant time comparison
+			uint8_t difference = 0;
+			for (auto i = 0u; i < Hash256_Size; ++i)
+				difference |= lhs[i] ^ rhs[i];
+
+			return 0 == difference;
+		}
+	}
+
+	class SecureMacSession {
+	public:
+		SecureMacSession(const crypto::KeyPair& sourceKeyPair, const Key& remoteKey, const Hash256& sessionId)
+				: m_remoteKey(remoteKey)
+				, m_nextSendSequence(1)
+				, m_maxReceivedSequence(0)
+				, m_receivedSequenceMask(0) {
+			auto sharedKey = crypto::DeriveSharedKey(sourceKeyPair, remoteKey);
+			m_sendKey = DeriveDirectionKey(sharedKey, sessionId, sourceKeyPair.publicKey());
+			m_receiveKey = DeriveDirectionKey(sharedKey, sessionId, remoteKey);
+			crypto::SecureZero(sharedKey);
+		}
+
+		~SecureMacSession() {
+			crypto::SecureZero(m_sendKey.data(), m_sendKey.size());
+			crypto::SecureZero(m_receiveKey.data(), m_receiveKey.size());
+		}
+
+	public:
+		const Key& remoteKey() const {
+			return m_remoteKey;
+		}
+
+	public:
+		void authenticate(const PacketPayload& payload, SecureMacPacketHeader& header) {
+			header.Sequence = m_nextSendSequence++;
+
+			// authenticate full payload, including header
+			crypto::Sha3_256_Builder macBuilder;
+			StartMac(macBuilder, m_sendKey, header.Sequence);
+			macBuilder.update({ reinterpret_cast<const uint8_t*>(&payload.header()), sizeof(PacketHeader) });
+			for (const auto& buffer : payload.buffers())
+				macBuilder.update(buffer);
+
+			macBuilder.final(header.Mac);
+		}
+
+		bool verify(const SecureMacPacketHeader& header, const Packet& childPacket) {
+			crypto::Sha3_256_Builder macBuilder;
+			StartMac(macBuilder, m_receiveKey, header.Sequence);
+			macBuilder.update({ reinterpret_cast<const uint8_t*>(&childPacket), childPacket.Size });
+
+			Hash256 mac;
+			macBuilder.final(mac);
+			if (!AreMacsEqual(header.Mac, mac))
+				return false;
+
+			// only accept the sequence number after the packet is authenticated so that forged packets cannot advance the window
+			return tryAcceptSequence(header.Sequence);
+		}
+
+	private:
+		bool tryAcceptSequence(uint64_t sequence) {
+			if (0 == sequence)
+				return false;
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (sequence > m_maxReceivedSequence) {
+				auto shift = sequence - m_maxReceivedSequence;
+				m_receivedSequenceMask = shift >= Replay_Window_Size ? 0 : m_receivedSequenceMask << shift;
+				m_receivedSequenceMask |= 1;
+				m_maxReceivedSequence = sequence;
+				return true;
+			}
+
+			auto offset = m_maxReceivedSequence - sequence;
+			if (offset >= Replay_Window_Size)
+				return false;
+
+			auto sequenceFlag = static_cast<uint64_t>(1) << offset;
+			if (0 != (m_receivedSequenceMask & sequenceFlag))
+				return false;
+
+			m_receivedSequenceMask |= sequenceFlag;
+			return true;
+		}
+
+	private:
+		Key m_remoteKey;
+		Hash256 m_sendKey;
+		Hash256 m_receiveKey;
+		std::atomic<uint64_t> m_nextSendSequence;
+
+		std::mutex m_mutex;
+		uint64_t m_maxReceivedSequence;
+		uint64_t m_receivedSequenceMask;
+	};
+
+	std::shared_ptr<SecureMacSession> CreateSecureMacSession(
+			const crypto::KeyPair& sourceKeyPair,
+			const Key& remoteKey,
+			const Hash256& sessionId) {
+		return std::make_shared<SecureMacSession>(sourceKeyPair, remoteKey, sessionId);
+	}
+
+	namespace {
+		class VerifyingReadCallback {
+		public:
+			VerifyingReadCallback(SecureMacSession& session, PacketIo::ReadCallback callback)
+					: m_session(session)
+					, m_callback(callback)
+			{}
+
+		public:
+			void operator()(SocketOperationCode code, const Packet* pPacket) {
+				if (SocketOperationCode::Success != code)
+					return m_callback(code, nullptr);
+
+				// cannot use CoercePacket because Size is variable
+				auto minPacketSize = sizeof(SecureMacPacketHeader) + sizeof(PacketHeader);
+				if (pPacket->Type != SecureMacPacketHeader::Packet_Type || minPacketSize > pPacket->Size)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				auto& secureMacPacketHeader = static_cast<const SecureMacPacketHeader&>(*pPacket);
+				auto& childPacket = static_cast<const Packet&>(*(&secureMacPacketHeader + 1));
+				if (secureMacPacketHeader.Size - sizeof(SecureMacPacketHeader) != childPacket.Size)
+					return m_callback(SocketOperationCode::Malformed_Data, nullptr);
+
+				if (!m_session.verify(secureMacPacketHeader, childPacket)) {
+					CATAPULT_LOG(warning)
+							<< "packet from " << utils::HexFormat(m_session.remoteKey())
+							<< " has invalid mac or was replayed (sequence " << secureMacPacketHeader.Sequence << ")";
+					return m_callback(SocketOperationCode::Security_Error, nullptr);
+				}
+
+				m_callback(code, &childPacket);
+			}
+
+		private:
+			SecureMacSession& m_session;
+			PacketIo::ReadCallback m_callback;
+		};
+
+		class SecureMacPacketIo
+				: public PacketIo
+				, public std::enable_shared_from_this<SecureMacPacketIo> {
+		public:
+			SecureMacPacketIo(
+					const std::shared_ptr<PacketIo>& pIo,
+					const std::shared_ptr<SecureMacSession>& pSession,
+					uint32_t maxMacPacketDataSize)
+					: m_pIo(pIo)
+					, m_pSession(pSession)
+					, m_maxMacPacketDataSize(maxMacPacketDataSize)
+			{}
+
+		public:
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				if (!IsPacketDataSizeValid(payload.header(), m_maxMacPacketDataSize)) {
+					CATAPULT_LOG(warning) << "bypassing write of malformed " << payload.header();
+					callback(SocketOperationCode::Malformed_Data);
+					return;
+				}
+
+				auto pSecureMacPacketHeader = CreateSharedPacket<SecureMacPacketHeader>(0);
+				m_pSession->authenticate(payload, *pSecureMacPacketHeader);
+
+				m_pIo->write(PacketPayload::Merge(pSecureMacPacketHeader, payload), callback);
+			}
+
+			void read(const ReadCallback& callback) override {
+				m_pIo->read([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback(*pThis->m_pSession, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<PacketIo> m_pIo;
+			std::shared_ptr<SecureMacSession> m_pSession;
+			uint32_t m_maxMacPacketDataSize;
+		};
+	}
+
+	std::shared_ptr<PacketIo> CreateSecureMacPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<SecureMacSession>& pSession,
+			uint32_t maxMacPacketDataSize) {
+		return std::make_shared<SecureMacPacketIo>(pIo, pSession, maxMacPacketDataSize);
+	}
+
+	namespace {
+		class SecureMacBatchPacketReader
+				: public BatchPacketReader
+				, public std::enable_shared_from_this<SecureMacBatchPacketReader> {
+		public:
+			SecureMacBatchPacketReader(const std::shared_ptr<BatchPacketReader>& pReader, const std::shared_ptr<SecureMacSession>& pSession)
+					: m_pReader(pReader)
+					, m_pSession(pSession)
+			{}
+
+		public:
+			void readMultiple(const PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple([pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					VerifyingReadCallback(*pThis->m_pSession, callback)(code, pPacket);
+				});
+			}
+
+		private:
+			std::shared_ptr<BatchPacketReader> m_pReader;
+			std::shared_ptr<SecureMacSession> m_pSession;
+		};
+	}
+
+	std::shared_ptr<BatchPacketReader> CreateSecureMacBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const std::shared_ptr<SecureMacSession>& pSession) {
+		return std::make_shared<SecureMacBatchPacketReader>(pReader, pSession);
+	}
+}}
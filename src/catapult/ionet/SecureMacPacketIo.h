@@ -0,0 +1,59 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "IoTypes.h"
+#include "catapult/types.h"
+
+namespace catapult {
+	namespace crypto { class KeyPair; }
+	namespace ionet {
+		class BatchPacketReader;
+		class PacketIo;
+	}
+}
+
+namespace catapult { namespace ionet {
+
+	/// Session keys and sequence numbers shared by all secure mac packet ios of a single connection.
+	class SecureMacSession;
+
+	/// Creates a mac session for a connection from \a sourceKeyPair to \a remoteKey that is uniquely identified by \a sessionId.
+	/// \note Separate keys are derived for each direction from a key shared by both peers.
+	std::shared_ptr<SecureMacSession> CreateSecureMacSession(
+			const crypto::KeyPair& sourceKeyPair,
+			const Key& remoteKey,
+			const Hash256& sessionId);
+
+	/// Adds session keyed authentication to all packets read from and written to \a pIo.
+	/// - All written packets are wrapped in a mac packet, authenticated with the \a pSession send key and must have
+	///   a max packet data size of \a maxMacPacketDataSize.
+	/// - All read packets are validated to be authenticated with the \a pSession receive key and to not be replayed.
+	std::shared_ptr<PacketIo> CreateSecureMacPacketIo(
+			const std::shared_ptr<PacketIo>& pIo,
+			const std::shared_ptr<SecureMacSession>& pSession,
+			uint32_t maxMacPacketDataSize);
+
+	/// Adds session keyed authentication to all packets read from \a pReader.
+	/// - All read packets are validated to be authenticated with the \a pSession receive key and to not be replayed.
+	std::shared_ptr<BatchPacketReader> CreateSecureMacBatchPacketReader(
+			const std::shared_ptr<BatchPacketReader>& pReader,
+			const std::shared_ptr<SecureMacSession>& pSession);
+}}
@@ -20,25 +20,25 @@
 
 #include "SecurePacketSocketDecorator.h"
 #include "PacketSocket.h"
+#include "SecureMacPacketIo.h"
 #include "SecureSignedPacketIo.h"
 #include "catapult/utils/FileSize.h"
 
 namespace catapult { namespace ionet {
 
 	namespace {
-		class SecureSignedPacketSocket : public PacketSocket {
+		using SecurePacketIoFactory = std::function<std::shared_ptr<PacketIo> (const std::shared_ptr<PacketIo>&)>;
+
+		class SecurePacketSocket : public PacketSocket {
 		public:
-			SecureSignedPacketSocket(
+			SecurePacketSocket(
 					const std::shared_ptr<PacketSocket>& pSocket,
-					const crypto::KeyPair& sourceKeyPair,
-					const Key& remoteKey,
-					uint32_t maxPacketDataSize)
+					const SecurePacketIoFactory& secureIoFactory,
+					const std::shared_ptr<BatchPacketReader>& pSecureReader)
 					: m_pSocket(pSocket)
-					, m_sourceKeyPair(sourceKeyPair)
-					, m_remoteKey(remoteKey)
-					, m_maxPacketDataSize(maxPacketDataSize)
-					, m_pIo(createSecureSignedPacketIo(m_pSocket))
-					, m_pReader(CreateSecureSignedBatchPacketReader(m_pSocket, m_remoteKey))
+					, m_secureIoFactory(secureIoFactory)
+					, m_pIo(m_secureIoFactory(m_pSocket))
+					, m_pReader(pSecureReader)
 			{}
 
 		public:
@@ -64,22 +64,40 @@ namespace catapult { namespace ionet {
 			}
 
 			std::shared_ptr<PacketIo> buffered() override {
-				return createSecureSignedPacketIo(m_pSocket->buffered());
-			}
-
-		private:
-			std::shared_ptr<PacketIo> createSecureSignedPacketIo(const std::shared_ptr<PacketIo>& pSocket) {
-				return CreateSecureSignedPacketIo(pSocket, m_sourceKeyPair, m_remoteKey, m_maxPacketDataSize);
+				return m_secureIoFactory(m_pSocket->buffered());
 			}
 
 		private:
 			std::shared_ptr<PacketSocket> m_pSocket;
-			const crypto::KeyPair& m_sourceKeyPair;
-			Key m_remoteKey;
-			uint32_t m_maxPacketDataSize;
+			SecurePacketIoFactory m_secureIoFactory;
 			std::shared_ptr<PacketIo> m_pIo;
 			std::shared_ptr<BatchPacketReader> m_pReader;
 		};
+
+		std::shared_ptr<PacketSocket> CreateSecureSignedPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const crypto::KeyPair& sourceKeyPair,
+				const Key& remoteKey,
+				uint32_t maxPacketDataSize) {
+			auto secureIoFactory = [&sourceKeyPair, remoteKey, maxPacketDataSize](const auto& pIo) {
+				return CreateSecureSignedPacketIo(pIo, sourceKeyPair, remoteKey, maxPacketDataSize);
+			};
+			return std::make_shared<SecurePacketSocket>(pSocket, secureIoFactory, CreateSecureSignedBatchPacketReader(pSocket, remoteKey));
+		}
+
+		std::shared_ptr<PacketSocket> CreateSecureMacPacketSocket(
+				const std::shared_ptr<PacketSocket>& pSocket,
+				const crypto::KeyPair& sourceKeyPair,
+				const Key& remoteKey,
+				const Hash256& sessionId,
+				uint32_t maxPacketDataSize) {
+			// all ios created for the same socket share a single session so that sequence numbers are unique per connection
+			auto pSession = CreateSecureMacSession(sourceKeyPair, remoteKey, sessionId);
+			auto secureIoFactory = [pSession, maxPacketDataSize](const auto& pIo) {
+				return CreateSecureMacPacketIo(pIo, pSession, maxPacketDataSize);
+			};
+			return std::make_shared<SecurePacketSocket>(pSocket, secureIoFactory, CreateSecureMacBatchPacketReader(pSocket, pSession));
+		}
 	}
 
 	std::shared_ptr<PacketSocket> Secure(
@@ -87,9 +105,13 @@ namespace catapult { namespace ionet {
 			ConnectionSecurityMode securityMode,
 			const crypto::KeyPair& sourceKeyPair,
 			const Key& remoteKey,
+			const Hash256& sessionId,
 			const utils::FileSize& maxPacketDataSize) {
+		if (HasFlag(ConnectionSecurityMode::Mac, securityMode))
+			return CreateSecureMacPacketSocket(pSocket, sourceKeyPair, remoteKey, sessionId, maxPacketDataSize.bytes32());
+
 		return HasFlag(ConnectionSecurityMode::Signed, securityMode)
-				? std::make_shared<SecureSignedPacketSocket>(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
+				? CreateSecureSignedPacketSocket(pSocket, sourceKeyPair, remoteKey, maxPacketDataSize.bytes32())
 				: pSocket;
 	}
 }}
@@ -22,6 +22,7 @@
 #include "BatchPacketReader.h"
 #include "PacketIo.h"
 #include "catapult/crypto/Hashes.h"
+#include "catapult/crypto/KeyPair.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/HexFormatter.h"
 
@@ -46,6 +47,24 @@ namespace catapult { namespace ionet {
 			return payloadHash;
 		}
 
+		void SignPayload(const crypto::KeyPair& keyPair, const PacketPayload& payload, Signature& signature) {
+			const auto& pSharedSignature = payload.sharedSignature();
+			if (pSharedSignature) {
+				// reuse the signature calculated by the first io that signed any copy of the payload
+				std::call_once(pSharedSignature->CalculatedFlag, [&keyPair, &payload, &sharedSignature = *pSharedSignature]() {
+					sharedSignature.SignerPublicKey = keyPair.publicKey();
+					crypto::Sign(keyPair, CalculatePayloadHash(payload), sharedSignature.Signature);
+				});
+
+				if (keyPair.publicKey() == pSharedSignature->SignerPublicKey) {
+					signature = pSharedSignature->Signature;
+					return;
+				}
+			}
+
+			crypto::Sign(keyPair, CalculatePayloadHash(payload), signature);
+		}
+
 		class VerifyingReadCallback {
 		public:
 			VerifyingReadCallback(const Key& remoteKey, PacketIo::ReadCallback callback)
@@ -107,9 +126,8 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
-				auto payloadHash = CalculatePayloadHash(payload);
 				auto pSecurePacketHeader = CreateSharedPacket<SecurePacketHeader>(0);
-				crypto::Sign(m_sourceKeyPair, payloadHash, pSecurePacketHeader->Signature);
+				SignPayload(m_sourceKeyPair, payload, pSecurePacketHeader->Signature);
 
 				m_pIo->write(PacketPayload::Merge(pSecurePacketHeader, payload), callback);
 			}
@@ -22,15 +22,18 @@
 #include "ConfigurationUtils.h"
 #include "MemoryCounters.h"
 #include "NodeUtils.h"
+#include "catapult/cache_db/RocksDatabaseCounters.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
 #include "catapult/extensions/ServiceLocator.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/ionet/NodeContainer.h"
+#include "catapult/model/PublicKeyAddressCache.h"
 #include "catapult/plugins/PluginLoader.h"
 #include "catapult/utils/ExceptionLogging.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/filesystem.hpp>
 
 namespace catapult { namespace local {
 
@@ -43,7 +46,7 @@ namespace catapult { namespace local {
 					, m_pBlockChainStorage(m_pBootstrapper->extensionManager().createBlockChainStorage())
 					, m_config(m_pBootstrapper->config())
 					, m_catapultCache({}) // note that subcaches are added in boot
-					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage())
+					, m_storage(m_pBootstrapper->subscriptionManager().createBlockStorage(), m_config.Node.BlockStorageCacheSize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(GetUtCacheOptions(m_config.Node)))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
@@ -61,6 +64,11 @@ namespace catapult { namespace local {
 			void boot() {
 				auto& extensionManager = m_pBootstrapper->extensionManager();
 
+				// cache state is always rebuilt from storage during boot, so any database left by a previous run is stale
+				// (the database needs to be open before plugins configure their caches)
+				purgeCacheDatabase();
+				m_pluginManager.openCacheDatabase();
+
 				CATAPULT_LOG(info) << "registering system plugins";
 				loadPlugins();
 
@@ -98,6 +106,15 @@ namespace catapult { namespace local {
 			}
 
 		private:
+			void purgeCacheDatabase() {
+				const auto& storageConfig = m_pluginManager.storageConfig();
+				if (!storageConfig.PreferCacheDatabase || storageConfig.CacheDatabaseDirectory.empty())
+					return;
+
+				CATAPULT_LOG(debug) << "purging cache database " << storageConfig.CacheDatabaseDirectory;
+				boost::filesystem::remove_all(storageConfig.CacheDatabaseDirectory);
+			}
+
 			void loadPlugins() {
 				for (const auto& pluginName : m_pBootstrapper->extensionManager().systemPluginNames())
 					loadPlugin(pluginName);
@@ -113,9 +130,26 @@ namespace catapult { namespace local {
 			void registerCounters() {
 				AddMemoryCounters(m_counters);
 				m_pluginManager.addDiagnosticCounters(m_counters, m_catapultCache); // add cache counters
+				if (m_pluginManager.cacheDatabase())
+					cache::AddRocksDatabaseCounters(m_counters, *m_pluginManager.cacheDatabase());
+
 				m_counters.emplace_back(utils::DiagnosticCounterId("UT CACHE"), [&source = *m_pUtCache]() {
 					return source.view().size();
 				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKSTG HIT"), [&source = m_storage]() {
+					return source.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("BLKSTG MISS"), [&source = m_storage]() {
+					return source.statistics().NumMisses;
+				});
+
+				auto& addressCache = model::GetPublicKeyAddressCache(m_config.BlockChain.Network.Identifier);
+				m_counters.emplace_back(utils::DiagnosticCounterId("KEYADDR HIT"), [&source = addressCache]() {
+					return source.statistics().NumHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("KEYADDR MISS"), [&source = addressCache]() {
+					return source.statistics().NumMisses;
+				});
 			}
 
 		public:
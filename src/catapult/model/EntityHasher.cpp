@@ -23,6 +23,7 @@
 #include "TransactionPlugin.h"
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/MultiBufferHashes.h"
 
 namespace catapult { namespace model {
 
@@ -95,4 +96,37 @@ namespace catapult { namespace model {
 				transactionElement.EntityHash,
 				transactionRegistry);
 	}
+
+	namespace {
+		constexpr size_t Num_Entity_Hash_Buffers = 3;
+
+		void AppendEntityHashBuffers(const VerifiableEntity& entity, const RawBuffer& buffer, std::vector<RawBuffer>& buffers) {
+			// buffers need to match the ones hashed by CalculateHash
+			buffers.push_back({ entity.Signature.data(), Signature_Size / 2 });
+			buffers.push_back(entity.Signer);
+			buffers.push_back(buffer);
+		}
+	}
+
+	void UpdateHashes(const TransactionRegistry& transactionRegistry, TransactionElement* const* ppTransactionElements, size_t count) {
+		std::vector<RawBuffer> buffers;
+		buffers.reserve(Num_Entity_Hash_Buffers * count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& transaction = ppTransactionElements[i]->Transaction;
+			const auto& plugin = *transactionRegistry.findPlugin(transaction.Type);
+			AppendEntityHashBuffers(transaction, plugin.dataBuffer(transaction), buffers);
+		}
+
+		std::vector<Hash256> entityHashes(count);
+		crypto::Sha3_256_Multi(buffers.data(), Num_Entity_Hash_Buffers, entityHashes.data(), count);
+
+		for (auto i = 0u; i < count; ++i) {
+			auto& transactionElement = *ppTransactionElements[i];
+			transactionElement.EntityHash = entityHashes[i];
+			transactionElement.MerkleComponentHash = CalculateMerkleComponentHash(
+					transactionElement.Transaction,
+					transactionElement.EntityHash,
+					transactionRegistry);
+		}
+	}
 }}
@@ -51,4 +51,9 @@ namespace catapult { namespace model {
 
 	/// Calculates the hashes for \a transactionElement in place using transaction information from \a transactionRegistry.
 	void UpdateHashes(const TransactionRegistry& transactionRegistry, TransactionElement& transactionElement);
+
+	/// Calculates the hashes for all \a count transaction elements pointed to by \a ppTransactionElements in place
+	/// using transaction information from \a transactionRegistry.
+	/// \note Entity hashes of multiple transactions are calculated at once.
+	void UpdateHashes(const TransactionRegistry& transactionRegistry, TransactionElement* const* ppTransactionElements, size_t count);
 }}
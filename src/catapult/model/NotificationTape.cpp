@@ -0,0 +1,72 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "NotificationTape.h"
+#include "NotificationPublisher.h"
+#include "catapult/exceptions.h"
+#include <cstddef>
+#include <cstring>
+
+namespace catapult { namespace model {
+
+	namespace {
+		// the buffer is allocated by the default allocator, so padding records keeps every notification suitably aligned
+		constexpr size_t Record_Alignment = alignof(std::max_align_t);
+
+		constexpr size_t AlignRecordSize(size_t size) {
+			return (size + Record_Alignment - 1) / Record_Alignment * Record_Alignment;
+		}
+	}
+
+	size_t NotificationTape::size() const {
+		return m_offsets.size();
+	}
+
+	bool NotificationTape::empty() const {
+		return m_offsets.empty();
+	}
+
+	void NotificationTape::record(const NotificationPublisher& publisher, const WeakEntityInfo& entityInfo) {
+		publisher.publish(entityInfo, *this);
+	}
+
+	void NotificationTape::clear() {
+		m_buffer.clear();
+		m_offsets.clear();
+	}
+
+	void NotificationTape::notify(const Notification& notification) {
+		if (notification.Size < sizeof(Notification))
+			CATAPULT_THROW_INVALID_ARGUMENT("cannot record notification with incorrect size");
+
+		auto offset = m_buffer.size();
+		m_buffer.resize(offset + AlignRecordSize(notification.Size));
+		std::memcpy(&m_buffer[offset], &notification, notification.Size);
+		m_offsets.push_back(offset);
+	}
+
+	void NotificationTape::replay(NotificationSubscriber& sub) const {
+		forEach([&sub](const auto& notification) { sub.notify(notification); });
+	}
+
+	void NotificationTape::replayReverse(NotificationSubscriber& sub) const {
+		forEachReverse([&sub](const auto& notification) { sub.notify(notification); });
+	}
+}}
@@ -0,0 +1,80 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NotificationSubscriber.h"
+#include "WeakEntityInfo.h"
+#include <vector>
+
+namespace catapult { namespace model { class NotificationPublisher; } }
+
+namespace catapult { namespace model {
+
+	/// Compact record of published notifications that can be replayed without publishing them again.
+	/// \note All notifications are shallow copied into a single growing buffer, so they must only reference data that outlives
+	///       the publish call (e.g. entity or plugin configuration data). Rollback already depends on this.
+	class NotificationTape : public NotificationSubscriber {
+	public:
+		/// Gets the number of recorded notifications.
+		size_t size() const;
+
+		/// Returns \c true if no notifications have been recorded.
+		bool empty() const;
+
+	public:
+		/// Records all notifications published by \a publisher for \a entityInfo.
+		void record(const NotificationPublisher& publisher, const WeakEntityInfo& entityInfo);
+
+		/// Removes all recorded notifications but retains the allocated memory so the tape can be reused.
+		void clear();
+
+		void notify(const Notification& notification) override;
+
+	public:
+		/// Calls \a action with every recorded notification in recording order.
+		template<typename TAction>
+		void forEach(TAction action) const {
+			for (auto offset : m_offsets)
+				action(at(offset));
+		}
+
+		/// Calls \a action with every recorded notification in reverse recording order.
+		template<typename TAction>
+		void forEachReverse(TAction action) const {
+			for (auto iter = m_offsets.crbegin(); m_offsets.crend() != iter; ++iter)
+				action(at(*iter));
+		}
+
+		/// Replays all recorded notifications to \a sub in recording order.
+		void replay(NotificationSubscriber& sub) const;
+
+		/// Replays all recorded notifications to \a sub in reverse recording order.
+		void replayReverse(NotificationSubscriber& sub) const;
+
+	private:
+		const Notification& at(size_t offset) const {
+			return reinterpret_cast<const Notification&>(m_buffer[offset]);
+		}
+
+	private:
+		std::vector<uint8_t> m_buffer;
+		std::vector<size_t> m_offsets;
+	};
+}}
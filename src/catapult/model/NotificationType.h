@@ -72,9 +72,14 @@ namespace catapult { namespace model {
 				(0x00FFFFFFu & utils::to_underlying_type(type)));
 	}
 
+	/// Gets the source (facility and code) of \a type.
+	constexpr uint32_t GetNotificationSource(NotificationType type) {
+		return 0x00FFFFFFu & utils::to_underlying_type(type);
+	}
+
 	/// Returns true if \a lhs and \a rhs have the same source (facility and code).
 	constexpr bool AreEqualExcludingChannel(NotificationType lhs, NotificationType rhs) {
-		return (0x00FFFFFFu & utils::to_underlying_type(lhs)) == (0x00FFFFFFu & utils::to_underlying_type(rhs));
+		return GetNotificationSource(lhs) == GetNotificationSource(rhs);
 	}
 
 	// region core notification types
@@ -0,0 +1,205 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PublicKeyAddressCache.h"
+#include "Address.h"
+#include "catapult/utils/Casting.h"
+#include "catapult/utils/Hashers.h"
+#include "catapult/utils/SpinLock.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace catapult { namespace model {
+
+	namespace {
+		// small caches are not sharded so that their eviction order is predictable
+		constexpr size_t Max_Num_Shards = 16;
+		constexpr size_t Min_Shard_Size = 64;
+
+		size_t CalculateNumShards(size_t maxSize) {
+			return std::max<size_t>(1, std::min(Max_Num_Shards, maxSize / Min_Shard_Size));
+		}
+
+		size_t GetShardIndex(const Key& publicKey, size_t numShards) {
+			// use different key bytes than the shard maps so that sharding does not skew their hash distribution
+			return utils::ArrayHasher<Key, 16>()(publicKey) % numShards;
+		}
+	}
+
+	class PublicKeyAddressCache::Shard {
+	public:
+		explicit Shard(size_t maxSize)
+				: m_maxSize(maxSize)
+				, m_nextEvictionIndex(0)
+				, m_numHits(0)
+				, m_numMisses(0) {
+			m_keys.reserve(m_maxSize);
+		}
+
+	public:
+		PublicKeyAddressCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_addresses.size(), m_numHits, m_numMisses };
+		}
+
+		bool tryGet(const Key& publicKey, Address& address) {
+			utils::SpinLockGuard guard(m_lock);
+			auto iter = m_addresses.find(publicKey);
+			if (m_addresses.cend() == iter) {
+				++m_numMisses;
+				return false;
+			}
+
+			++m_numHits;
+			iter->second.IsRecentlyUsed = true;
+			address = iter->second.Address;
+			return true;
+		}
+
+		void add(const Key& publicKey, const Address& address) {
+			utils::SpinLockGuard guard(m_lock);
+			if (m_addresses.cend() != m_addresses.find(publicKey))
+				return;
+
+			if (m_keys.size() < m_maxSize) {
+				m_keys.push_back(publicKey);
+				m_addresses.emplace(publicKey, CachedAddress{ address, false });
+				return;
+			}
+
+			// give recently used addresses a second chance and evict the first address that has not been used since
+			for (;;) {
+				auto& cachedAddress = m_addresses.find(m_keys[m_nextEvictionIndex])->second;
+				if (!cachedAddress.IsRecentlyUsed)
+					break;
+
+				cachedAddress.IsRecentlyUsed = false;
+				m_nextEvictionIndex = (m_nextEvictionIndex + 1) % m_maxSize;
+			}
+
+			auto& evictedKey = m_keys[m_nextEvictionIndex];
+			m_addresses.erase(evictedKey);
+			evictedKey = publicKey;
+			m_addresses.emplace(publicKey, CachedAddress{ address, false });
+			m_nextEvictionIndex = (m_nextEvictionIndex + 1) % m_maxSize;
+		}
+
+	private:
+		struct CachedAddress {
+			catapult::Address Address;
+			bool IsRecentlyUsed;
+		};
+
+	private:
+		size_t m_maxSize;
+		std::vector<Key> m_keys;
+		size_t m_nextEvictionIndex;
+		std::unordered_map<Key, CachedAddress, utils::ArrayHasher<Key>> m_addresses;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		mutable utils::SpinLock m_lock;
+	};
+
+	PublicKeyAddressCache::PublicKeyAddressCache(NetworkIdentifier networkIdentifier, size_t maxSize)
+			: m_networkIdentifier(networkIdentifier) {
+		// distribute the capacity across the shards so that the total capacity is exactly maxSize
+		maxSize = std::max<size_t>(1, maxSize);
+		auto numShards = CalculateNumShards(maxSize);
+		for (auto i = 0u; i < numShards; ++i)
+			m_shards.push_back(std::make_unique<Shard>(maxSize / numShards + (i < maxSize % numShards ? 1 : 0)));
+	}
+
+	PublicKeyAddressCache::~PublicKeyAddressCache() = default;
+
+	NetworkIdentifier PublicKeyAddressCache::networkIdentifier() const {
+		return m_networkIdentifier;
+	}
+
+	PublicKeyAddressCacheStatistics PublicKeyAddressCache::statistics() const {
+		PublicKeyAddressCacheStatistics statistics{ 0, 0, 0 };
+		for (const auto& pShard : m_shards) {
+			auto shardStatistics = pShard->statistics();
+			statistics.Size += shardStatistics.Size;
+			statistics.NumHits += shardStatistics.NumHits;
+			statistics.NumMisses += shardStatistics.NumMisses;
+		}
+
+		return statistics;
+	}
+
+	Address PublicKeyAddressCache::toAddress(const Key& publicKey) {
+		auto& shard = *m_shards[GetShardIndex(publicKey, m_shards.size())];
+
+		Address address;
+		if (shard.tryGet(publicKey, address))
+			return address;
+
+		// calculate the address outside of the lock so that concurrent lookups of other keys are not blocked
+		address = PublicKeyToAddress(publicKey, m_networkIdentifier);
+		shard.add(publicKey, address);
+		return address;
+	}
+
+	namespace {
+		// each cached address uses roughly 160 bytes, so a full process-wide cache uses less than 8MB
+		constexpr size_t Max_Process_Wide_Cache_Size = 50'000;
+
+		class PublicKeyAddressCacheRegistry {
+		public:
+			PublicKeyAddressCacheRegistry() : m_caches()
+			{}
+
+		public:
+			PublicKeyAddressCache& get(NetworkIdentifier networkIdentifier) {
+				auto& cacheSlot = m_caches[utils::to_underlying_type(networkIdentifier)];
+				auto* pCache = cacheSlot.load(std::memory_order_acquire);
+				if (pCache)
+					return *pCache;
+
+				std::lock_guard<std::mutex> lock(m_mutex);
+				pCache = cacheSlot.load(std::memory_order_relaxed);
+				if (!pCache) {
+					m_ownedCaches.push_back(std::make_unique<PublicKeyAddressCache>(networkIdentifier, Max_Process_Wide_Cache_Size));
+					pCache = m_ownedCaches.back().get();
+					cacheSlot.store(pCache, std::memory_order_release);
+				}
+
+				return *pCache;
+			}
+
+		private:
+			std::array<std::atomic<PublicKeyAddressCache*>, 256> m_caches;
+			std::mutex m_mutex;
+			std::vector<std::unique_ptr<PublicKeyAddressCache>> m_ownedCaches;
+		};
+	}
+
+	PublicKeyAddressCache& GetPublicKeyAddressCache(NetworkIdentifier networkIdentifier) {
+		static PublicKeyAddressCacheRegistry registry;
+		return registry.get(networkIdentifier);
+	}
+
+	Address CachedPublicKeyToAddress(const Key& publicKey, NetworkIdentifier networkIdentifier) {
+		return GetPublicKeyAddressCache(networkIdentifier).toAddress(publicKey);
+	}
+}}
@@ -0,0 +1,79 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NetworkInfo.h"
+#include "catapult/types.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace model {
+
+	/// Public key address cache statistics.
+	struct PublicKeyAddressCacheStatistics {
+		/// Number of cached addresses.
+		size_t Size;
+
+		/// Number of address lookups that were served by the cache.
+		uint64_t NumHits;
+
+		/// Number of address lookups that required the address to be calculated.
+		uint64_t NumMisses;
+	};
+
+	/// Bounded, thread safe cache of addresses calculated from public keys for a single network.
+	/// \note The cache is split into independently locked shards by public key so that concurrent lookups rarely contend.
+	///        Within a shard, addresses that have not been used since they were last passed over for eviction are evicted first
+	///        (approximate least recently used eviction).
+	class PublicKeyAddressCache {
+	public:
+		/// Creates a cache for the network identified by \a networkIdentifier that holds at most \a maxSize addresses.
+		PublicKeyAddressCache(NetworkIdentifier networkIdentifier, size_t maxSize);
+
+		/// Destroys the cache.
+		~PublicKeyAddressCache();
+
+	public:
+		/// Gets the network identifier.
+		NetworkIdentifier networkIdentifier() const;
+
+		/// Gets the cache statistics.
+		PublicKeyAddressCacheStatistics statistics() const;
+
+	public:
+		/// Gets the address corresponding to \a publicKey, calculating it if it is not cached.
+		Address toAddress(const Key& publicKey);
+
+	private:
+		class Shard;
+
+	private:
+		NetworkIdentifier m_networkIdentifier;
+		std::vector<std::unique_ptr<Shard>> m_shards;
+	};
+
+	/// Gets the process-wide public key address cache for the network identified by \a networkIdentifier.
+	/// \note Each process-wide cache holds at most 50'000 addresses.
+	PublicKeyAddressCache& GetPublicKeyAddressCache(NetworkIdentifier networkIdentifier);
+
+	/// Creates an address from a public key (\a publicKey) for the network identified by \a networkIdentifier
+	/// using the process-wide public key address cache.
+	Address CachedPublicKeyToAddress(const Key& publicKey, NetworkIdentifier networkIdentifier);
+}}
@@ -19,9 +19,10 @@
 **/
 
 #include "TransactionUtils.h"
-#include "Address.h"
 #include "NotificationPublisher.h"
 #include "NotificationSubscriber.h"
+#include "NotificationTape.h"
+#include "PublicKeyAddressCache.h"
 #include "Transaction.h"
 
 namespace catapult { namespace model {
@@ -47,13 +48,30 @@ namespace catapult { namespace model {
 
 		private:
 			Address toAddress(const Key& publicKey) const {
-				return PublicKeyToAddress(publicKey, m_networkIdentifier);
+				return CachedPublicKeyToAddress(publicKey, m_networkIdentifier);
 			}
 
 		private:
 			NetworkIdentifier m_networkIdentifier;
 			model::AddressSet m_addresses;
 		};
+
+		class AccountReferencesCollector : public NotificationSubscriber {
+		public:
+			explicit AccountReferencesCollector(AccountReferences& references) : m_references(references)
+			{}
+
+		public:
+			void notify(const Notification& notification) override {
+				if (Core_Register_Account_Address_Notification == notification.Type)
+					m_references.Addresses.insert(static_cast<const AccountAddressNotification&>(notification).Address);
+				else if (Core_Register_Account_Public_Key_Notification == notification.Type)
+					m_references.PublicKeys.insert(static_cast<const AccountPublicKeyNotification&>(notification).PublicKey);
+			}
+
+		private:
+			AccountReferences& m_references;
+		};
 	}
 
 	model::AddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
@@ -62,4 +80,23 @@ namespace catapult { namespace model {
 		notificationPublisher.publish(weakInfo, sub);
 		return sub.addresses();
 	}
+
+	model::AddressSet ExtractAddresses(const NotificationTape& notificationTape, NetworkIdentifier networkIdentifier) {
+		AddressCollector sub(networkIdentifier);
+		notificationTape.replay(sub);
+		return sub.addresses();
+	}
+
+	void ExtractAccountReferences(
+			const WeakEntityInfo& entityInfo,
+			const NotificationPublisher& notificationPublisher,
+			AccountReferences& references) {
+		AccountReferencesCollector sub(references);
+		notificationPublisher.publish(entityInfo, sub);
+	}
+
+	void ExtractAccountReferences(const NotificationTape& notificationTape, AccountReferences& references) {
+		AccountReferencesCollector sub(references);
+		notificationTape.replay(sub);
+	}
 }}
@@ -20,10 +20,14 @@
 
 #pragma once
 #include "ContainerTypes.h"
+#include "NetworkInfo.h"
+#include "WeakEntityInfo.h"
+#include "catapult/utils/ArraySet.h"
 
 namespace catapult {
 	namespace model {
 		class NotificationPublisher;
+		class NotificationTape;
 		struct Transaction;
 	}
 }
@@ -32,4 +36,27 @@ namespace catapult { namespace model {
 
 	/// Extracts all addresses that are involved in \a transaction using \a notificationPublisher.
 	model::AddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher);
+
+	/// Extracts all addresses that are involved in the notifications recorded in \a notificationTape,
+	/// which were published by entities with network \a networkIdentifier.
+	model::AddressSet ExtractAddresses(const NotificationTape& notificationTape, NetworkIdentifier networkIdentifier);
+
+	/// Addresses and public keys of accounts referenced by entities.
+	struct AccountReferences {
+		/// Referenced addresses.
+		AddressSet Addresses;
+
+		/// Referenced public keys.
+		utils::KeySet PublicKeys;
+	};
+
+	/// Adds all accounts that are referenced by \a entityInfo to \a references using \a notificationPublisher.
+	/// \note Unlike ExtractAddresses, public keys are not converted to addresses.
+	void ExtractAccountReferences(
+			const WeakEntityInfo& entityInfo,
+			const NotificationPublisher& notificationPublisher,
+			AccountReferences& references);
+
+	/// Adds all accounts that are referenced by the notifications recorded in \a notificationTape to \a references.
+	void ExtractAccountReferences(const NotificationTape& notificationTape, AccountReferences& references);
 }}
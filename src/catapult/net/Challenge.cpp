@@ -19,6 +19,7 @@
 **/
 
 #include "Challenge.h"
+#include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/KeyPair.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/utils/Casting.h"
@@ -91,4 +92,13 @@ namespace catapult { namespace net {
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge) {
 		return VerifyChallenge(serverPublicKey, { challenge }, response.Signature);
 	}
+
+	Hash256 CalculateSessionId(const Challenge& serverChallenge, const Challenge& clientChallenge) {
+		crypto::Sha3_256_Builder hashBuilder;
+		hashBuilder.update({ serverChallenge, clientChallenge });
+
+		Hash256 sessionId;
+		hashBuilder.final(sessionId);
+		return sessionId;
+	}
 }}
@@ -89,4 +89,7 @@ namespace catapult { namespace net {
 	/// Verifies a server's \a response to \a challenge assuming the server has a public key
 	/// of \a serverPublicKey.
 	bool VerifyClientChallengeResponse(const ClientChallengeResponse& response, const Key& serverPublicKey, const Challenge& challenge);
+
+	/// Calculates the identifier of the session established by exchanging \a serverChallenge and \a clientChallenge.
+	Hash256 CalculateSessionId(const Challenge& serverChallenge, const Challenge& clientChallenge);
 }}
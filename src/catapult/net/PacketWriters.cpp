@@ -286,8 +286,12 @@ namespace catapult { namespace net {
 
 		public:
 			void broadcast(const ionet::PacketPayload& payload) override {
-				m_writers.forEach([pThis = shared_from_this(), payload](const auto& state) {
-					state.pBufferedIo->write(payload, [pThis, pSocket = state.pSocket](auto code) {
+				// all writers sign with the same key, so the payload only needs to be signed once for all signed connections
+				auto sharedPayload = payload;
+				sharedPayload.enableSignatureSharing();
+
+				m_writers.forEach([pThis = shared_from_this(), sharedPayload](const auto& state) {
+					state.pBufferedIo->write(sharedPayload, [pThis, pSocket = state.pSocket](auto code) {
 						if (ionet::SocketOperationCode::Success == code)
 							return;
 
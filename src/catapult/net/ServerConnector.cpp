@@ -99,7 +99,13 @@ namespace catapult { namespace net {
 			}
 
 			PacketSocketPointer secure(const PacketSocketPointer& pSocket, const VerifiedPeerInfo& peerInfo) {
-				return Secure(pSocket, peerInfo.SecurityMode, m_keyPair, peerInfo.PublicKey, m_settings.MaxPacketDataSize);
+				return Secure(
+						pSocket,
+						peerInfo.SecurityMode,
+						m_keyPair,
+						peerInfo.PublicKey,
+						peerInfo.SessionId,
+						m_settings.MaxPacketDataSize);
 			}
 
 		public:
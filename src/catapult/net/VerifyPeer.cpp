@@ -79,6 +79,7 @@ namespace catapult { namespace net {
 					return invokeCallback(VerifyResult::Malformed_Data);
 
 				auto clientPeerInfo = VerifiedPeerInfo{ pResponse->PublicKey, pResponse->SecurityMode };
+				clientPeerInfo.SessionId = CalculateSessionId(m_pRequest->Challenge, pResponse->Challenge);
 				if (!HasSingleFlag(pResponse->SecurityMode) || !HasFlag(pResponse->SecurityMode, m_allowedSecurityModes))
 					return invokeCallback(VerifyResult::Failure_Unsupported_Connection, clientPeerInfo);
 
@@ -157,6 +158,7 @@ namespace catapult { namespace net {
 					return invokeCallback(VerifyResult::Malformed_Data);
 
 				m_pRequest = GenerateServerChallengeResponse(*pRequest, m_keyPair, m_serverPeerInfo.SecurityMode);
+				m_serverPeerInfo.SessionId = CalculateSessionId(pRequest->Challenge, m_pRequest->Challenge);
 				m_pIo->write(ionet::PacketPayload(m_pRequest), [pThis = shared_from_this()](auto writeCode) {
 					pThis->handleServerChallengeResponseWrite(writeCode);
 				});
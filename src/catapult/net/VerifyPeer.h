@@ -67,6 +67,9 @@ namespace catapult { namespace net {
 
 		/// Security mode established.
 		ionet::ConnectionSecurityMode SecurityMode;
+
+		/// Identifier of the established session (derived from the exchanged challenges).
+		Hash256 SessionId = Hash256();
 	};
 
 	/// Insertion operator for outputting \a value to \a out.
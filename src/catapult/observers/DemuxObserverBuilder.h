@@ -19,41 +19,48 @@
 **/
 
 #pragma once
-#include "AggregateObserverBuilder.h"
 #include "ObserverTypes.h"
-#include <functional>
+#include "catapult/utils/NamedObject.h"
+#include <unordered_map>
 #include <vector>
 
 namespace catapult { namespace observers {
 
 	/// A demultiplexing observer builder.
+	/// \note Built observers dispatch each notification through a table indexed by notification source (facility and code),
+	///       so only observers registered for that source and observers registered for all notifications are invoked.
 	class DemuxObserverBuilder {
 	private:
-		using NotificationObserverPredicate = predicate<const model::Notification&>;
+		struct ObserverEntry {
+			NotificationObserverPointerT<model::Notification> pObserver;
+			bool IsUniversal;
+			uint32_t Source;
+		};
+
+		using ObserverEntries = std::vector<ObserverEntry>;
 
 	public:
 		/// Adds an observer (\a pObserver) to the builder that is invoked only when matching notifications are processed.
 		template<typename TNotification>
 		DemuxObserverBuilder& add(NotificationObserverPointerT<TNotification>&& pObserver) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalObserver<TNotification>>(std::move(pObserver), predicate));
+			m_entries.push_back(ObserverEntry{
+				std::make_unique<TypedObserver<TNotification>>(std::move(pObserver)),
+				false,
+				model::GetNotificationSource(TNotification::Notification_Type)
+			});
 			return *this;
 		}
 
 		/// Builds a demultiplexing observer.
 		AggregateNotificationObserverPointerT<model::Notification> build() {
-			return m_builder.build();
+			return std::make_unique<DemuxAggregateNotificationObserver>(std::move(m_entries));
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalObserver : public NotificationObserver {
+		class TypedObserver : public NotificationObserver {
 		public:
-			ConditionalObserver(NotificationObserverPointerT<TNotification>&& pObserver, const NotificationObserverPredicate& predicate)
-					: m_pObserver(std::move(pObserver))
-					, m_predicate(predicate)
+			explicit TypedObserver(NotificationObserverPointerT<TNotification>&& pObserver) : m_pObserver(std::move(pObserver))
 			{}
 
 		public:
@@ -62,26 +69,90 @@ namespace catapult { namespace observers {
 			}
 
 			void notify(const model::Notification& notification, const ObserverContext& context) const override {
-				if (!m_predicate(notification))
-					return;
-
 				m_pObserver->notify(static_cast<const TNotification&>(notification), context);
 			}
 
 		private:
 			NotificationObserverPointerT<TNotification> m_pObserver;
-			NotificationObserverPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationObserver : public AggregateNotificationObserverT<model::Notification> {
+		private:
+			using ObserverPointers = std::vector<const NotificationObserver*>;
+
+		public:
+			explicit DemuxAggregateNotificationObserver(ObserverEntries&& entries)
+					: m_entries(std::move(entries))
+					, m_name(utils::ReduceNames(names())) {
+				// create a dispatch list for every registered source before filling any so that universal observers
+				// are interleaved in registration order
+				for (const auto& entry : m_entries) {
+					if (!entry.IsUniversal)
+						m_sourceObservers.emplace(entry.Source, ObserverPointers());
+				}
+
+				for (const auto& entry : m_entries) {
+					if (!entry.IsUniversal) {
+						m_sourceObservers[entry.Source].push_back(entry.pObserver.get());
+						continue;
+					}
+
+					m_universalObservers.push_back(entry.pObserver.get());
+					for (auto& pair : m_sourceObservers)
+						pair.second.push_back(entry.pObserver.get());
+				}
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				std::vector<std::string> names;
+				names.reserve(m_entries.size());
+				for (const auto& entry : m_entries)
+					names.push_back(entry.pObserver->name());
+
+				return names;
+			}
+
+			void notify(const model::Notification& notification, const ObserverContext& context) const override {
+				const auto& observers = this->observers(notification.Type);
+				if (NotifyMode::Commit == context.Mode)
+					notifyAll(observers.cbegin(), observers.cend(), notification, context);
+				else
+					notifyAll(observers.crbegin(), observers.crend(), notification, context);
+			}
+
+		private:
+			const ObserverPointers& observers(model::NotificationType type) const {
+				auto iter = m_sourceObservers.find(model::GetNotificationSource(type));
+				return m_sourceObservers.cend() == iter ? m_universalObservers : iter->second;
+			}
+
+			template<typename TIter>
+			static void notifyAll(TIter begin, TIter end, const model::Notification& notification, const ObserverContext& context) {
+				for (auto iter = begin; end != iter; ++iter)
+					(*iter)->notify(notification, context);
+			}
+
+		private:
+			ObserverEntries m_entries;
+			std::string m_name;
+			std::unordered_map<uint32_t, ObserverPointers> m_sourceObservers;
+			ObserverPointers m_universalObservers;
 		};
 
 	private:
-		AggregateObserverBuilder<model::Notification> m_builder;
+		ObserverEntries m_entries;
 	};
 
 	/// Adds an observer (\a pObserver) to the builder that is always invoked.
 	template<>
 	CATAPULT_INLINE
 	DemuxObserverBuilder& DemuxObserverBuilder::add(NotificationObserverPointerT<model::Notification>&& pObserver) {
-		m_builder.add(std::move(pObserver));
+		m_entries.push_back(ObserverEntry{ std::move(pObserver), true, 0 });
 		return *this;
 	}
 }}
@@ -19,7 +19,8 @@
 **/
 
 #include "PluginManager.h"
-#include <boost/filesystem/path.hpp>
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/exceptions.h"
 
 namespace catapult { namespace plugins {
 
@@ -39,9 +40,13 @@ namespace catapult { namespace plugins {
 	}
 
 	cache::CacheConfiguration PluginManager::cacheConfig(const std::string& name) const {
-		return m_storageConfig.PreferCacheDatabase
-				? cache::CacheConfiguration((boost::filesystem::path(m_storageConfig.CacheDatabaseDirectory) / name).generic_string())
-				: cache::CacheConfiguration();
+		if (!m_storageConfig.PreferCacheDatabase)
+			return cache::CacheConfiguration();
+
+		if (!m_pCacheDatabase)
+			CATAPULT_THROW_RUNTIME_ERROR_1("cache database must be opened before configuring cache", name);
+
+		return cache::CacheConfiguration(m_pCacheDatabase, name, m_storageConfig.CacheDatabaseOptions);
 	}
 
 	// endregion
@@ -60,8 +65,26 @@ namespace catapult { namespace plugins {
 
 	// region cache
 
+	void PluginManager::openCacheDatabase() {
+		if (!m_storageConfig.PreferCacheDatabase)
+			return;
+
+		if (m_pCacheDatabase)
+			CATAPULT_THROW_RUNTIME_ERROR("cache database is already open");
+
+		// caches add their columns to the shared database so that all of their changes can be committed atomically
+		m_pCacheDatabase = std::make_shared<cache::RocksDatabase>(
+				m_storageConfig.CacheDatabaseDirectory,
+				std::vector<cache::RdbColumnFamily>(),
+				m_storageConfig.CacheDatabaseOptions);
+	}
+
 	cache::CatapultCache PluginManager::createCache() {
-		return m_cacheBuilder.build();
+		return m_cacheBuilder.build(m_pCacheDatabase);
+	}
+
+	const cache::RocksDatabase* PluginManager::cacheDatabase() const {
+		return m_pCacheDatabase.get();
 	}
 
 	// endregion
@@ -41,6 +41,9 @@ namespace catapult { namespace plugins {
 
 		/// Base directory to use for storing cache database.
 		std::string CacheDatabaseDirectory;
+
+		/// Cache database tuning options.
+		cache::RocksDatabaseOptions CacheDatabaseOptions;
 	};
 
 	/// A manager for registering plugins.
@@ -71,6 +74,7 @@ namespace catapult { namespace plugins {
 		const StorageConfiguration& storageConfig() const;
 
 		/// Gets the cache configuration for cache with \a name.
+		/// \note When a cache database is preferred, all caches share a single database, which must already be open.
 		cache::CacheConfiguration cacheConfig(const std::string& name) const;
 
 		// endregion
@@ -93,9 +97,16 @@ namespace catapult { namespace plugins {
 			m_cacheBuilder.add<TStorageTraits>(std::move(pSubCache));
 		}
 
+		/// Opens the database shared by all caches if a cache database is preferred.
+		/// \note This must be called before any cache configuration is requested.
+		void openCacheDatabase();
+
 		/// Creates a catapult cache.
 		cache::CatapultCache createCache();
 
+		/// Gets the database shared by all caches or \c nullptr if caches are not backed by a database.
+		const cache::RocksDatabase* cacheDatabase() const;
+
 		// endregion
 
 		// region diagnostics
@@ -164,6 +175,7 @@ namespace catapult { namespace plugins {
 		StorageConfiguration m_storageConfig;
 		model::TransactionRegistry m_transactionRegistry;
 		cache::CatapultCacheBuilder m_cacheBuilder;
+		std::shared_ptr<cache::RocksDatabase> m_pCacheDatabase;
 
 		std::vector<HandlerHook> m_diagnosticHandlerHooks;
 		std::vector<CounterHook> m_diagnosticCounterHooks;
@@ -21,6 +21,8 @@
 #pragma once
 #include "AccountBalances.h"
 #include "AccountImportance.h"
+#include "catapult/utils/SlabAllocator.h"
+#include <memory>
 
 namespace catapult { namespace state {
 
@@ -53,4 +55,11 @@ namespace catapult { namespace state {
 		/// Balances of an account.
 		AccountBalances Balances;
 	};
+
+	/// Creates a shared account state around \a args.
+	/// \note The account state and its shared pointer control block are allocated together from a slab pool.
+	template<typename... TArgs>
+	std::shared_ptr<AccountState> MakeSharedAccountState(TArgs&&... args) {
+		return std::allocate_shared<AccountState>(utils::SlabAllocator<AccountState>(), std::forward<TArgs>(args)...);
+	}
 }}
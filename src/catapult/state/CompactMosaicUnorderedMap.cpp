@@ -51,6 +51,18 @@ namespace catapult { namespace state {
 
 	// endregion
 
+	// region SecondLevelStorage
+
+	void* CompactMosaicUnorderedMap::SecondLevelStorage::operator new(size_t) {
+		return utils::GetSlabPool<SecondLevelStorage>().allocate();
+	}
+
+	void CompactMosaicUnorderedMap::SecondLevelStorage::operator delete(void* pStorage) {
+		utils::GetSlabPool<SecondLevelStorage>().deallocate(pStorage);
+	}
+
+	// endregion
+
 	// region basic_iterator
 
 	CompactMosaicUnorderedMap::basic_iterator::basic_iterator(FirstLevelStorage& storage, Stage stage)
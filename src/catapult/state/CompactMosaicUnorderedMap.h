@@ -21,6 +21,7 @@
 #pragma once
 #include "catapult/utils/Hashers.h"
 #include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/SlabAllocator.h"
 #include "catapult/exceptions.h"
 #include "catapult/types.h"
 #include <unordered_map>
@@ -38,13 +39,24 @@ namespace catapult { namespace state {
 		using Mosaic = std::pair<const MosaicId, Amount>;
 		using MutableMosaic = std::pair<MosaicId, Amount>;
 		using MosaicArray = std::array<MutableMosaic, Array_Size>;
-		using MosaicMap = std::unordered_map<MosaicId, Amount, utils::BaseValueHasher<MosaicId>>;
+		using MosaicMap = std::unordered_map<
+			MosaicId,
+			Amount,
+			utils::BaseValueHasher<MosaicId>,
+			std::equal_to<MosaicId>,
+			utils::SlabAllocator<std::pair<const MosaicId, Amount>>>;
 
 	private:
 		struct SecondLevelStorage {
+		public:
 			MosaicArray ArrayStorage;
 			uint8_t ArraySize;
 			std::unique_ptr<MosaicMap> pMapStorage;
+
+		public:
+			// every account owning more than one mosaic has second level storage, so it is allocated from a slab pool
+			static void* operator new(size_t size);
+			static void operator delete(void* pStorage);
 		};
 
 		struct FirstLevelStorage {
@@ -20,6 +20,7 @@
 
 #pragma once
 #include "catapult/model/EntityRange.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/constants.h"
 #include "catapult/types.h"
 
@@ -77,6 +78,15 @@ namespace catapult { namespace state {
 	/// Insertion operator for outputting \a timestampedHash to \a out.
 	std::ostream& operator<<(std::ostream& out, const TimestampedHash& timestampedHash);
 
+	/// Hasher object for a timestamped hash.
+	/// \note Only the hash is used because it has more entropy than the timestamp.
+	struct TimestampedHashHasher {
+		/// Hashes \a timestampedHash.
+		size_t operator()(const TimestampedHash& timestampedHash) const {
+			return utils::ArrayHasher<TimestampedHash::HashType, 0>()(timestampedHash.Hash);
+		}
+	};
+
 	/// An entity range composed of timestamped hashes.
 	using TimestampedHashRange = model::EntityRange<TimestampedHash>;
 }}
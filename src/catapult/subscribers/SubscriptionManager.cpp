@@ -29,12 +29,32 @@
 #include "catapult/cache/AggregateUtCache.h"
 #include "catapult/config/LocalNodeConfiguration.h"
 #include "catapult/io/AggregateBlockStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/SegmentedFileStorage.h"
 
 namespace catapult { namespace subscribers {
 
+	namespace {
+		std::unique_ptr<io::PrunableBlockStorage> CreateFileStorage(const config::LocalNodeConfiguration& config) {
+			const auto& dataDirectory = config.User.DataDirectory;
+			if (!config.Node.ShouldUseSegmentedBlockStorage)
+				return std::make_unique<io::FileBasedStorage>(dataDirectory);
+
+			// when segmented storage is empty, seed it with the blocks (at least the nemesis block) in the one-file-per-block layout
+			auto pStorage = std::make_unique<io::SegmentedFileStorage>(dataDirectory);
+			if (Height(0) == pStorage->chainHeight()) {
+				io::FileBasedStorage legacyStorage(dataDirectory);
+				auto numImportedBlocks = io::ImportBlocks(legacyStorage, *pStorage);
+				CATAPULT_LOG(info) << "imported " << numImportedBlocks << " blocks into segmented block storage";
+			}
+
+			return std::move(pStorage);
+		}
+	}
+
 	SubscriptionManager::SubscriptionManager(const config::LocalNodeConfiguration& config)
 			: m_config(config)
-			, m_pStorage(std::make_unique<io::FileBasedStorage>(m_config.User.DataDirectory)) {
+			, m_pStorage(CreateFileStorage(m_config)) {
 		m_subscriberUsedFlags.fill(false);
 	}
 
@@ -0,0 +1,252 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+#pragma pack(push, 1)
+
+	/// A cell of an invertible bloom lookup table.
+	template<typename TKey>
+	struct InvertibleBloomLookupTableCell {
+		/// Number of keys inserted into the cell minus the number of keys erased from the cell.
+		int32_t Count;
+
+		/// Xor of the checksums of all keys in the cell.
+		uint32_t ChecksumSum;
+
+		/// Xor of all keys in the cell.
+		TKey KeySum;
+	};
+
+#pragma pack(pop)
+
+	/// An invertible bloom lookup table over fixed size keys.
+	/// \note Subtracting two tables that contain the same keys leaves only the keys that are in one but not both tables.
+	///       The remaining keys can be decoded as long as their number is proportional to the number of cells.
+	template<typename TKey>
+	class InvertibleBloomLookupTable {
+	private:
+		static_assert(std::is_standard_layout<TKey>::value, "keys must be plain data");
+
+	public:
+		using KeyType = TKey;
+		using Cell = InvertibleBloomLookupTableCell<TKey>;
+
+		/// Number of cells each key is added to (one in each partition).
+		static constexpr size_t Num_Partitions = 3;
+
+	public:
+		/// Creates a table with the smallest valid number of cells that is at least \a minNumCells.
+		explicit InvertibleBloomLookupTable(size_t minNumCells) : m_cells(CalculateNumCells(minNumCells), Cell())
+		{}
+
+		/// Creates a table around \a cells.
+		explicit InvertibleBloomLookupTable(std::vector<Cell>&& cells) : m_cells(std::move(cells)) {
+			if (!IsValidNumCells(m_cells.size()))
+				CATAPULT_THROW_INVALID_ARGUMENT_1("invalid number of cells", m_cells.size());
+		}
+
+	public:
+		/// Returns \c true if \a numCells is a valid number of cells.
+		static constexpr bool IsValidNumCells(size_t numCells) {
+			return 0 != numCells && 0 == numCells % Num_Partitions && IsPowerOfTwo(numCells / Num_Partitions);
+		}
+
+		/// Calculates the smallest valid number of cells that is at least \a minNumCells.
+		static size_t CalculateNumCells(size_t minNumCells) {
+			size_t partitionSize = 1;
+			while (partitionSize * Num_Partitions < minNumCells)
+				partitionSize <<= 1;
+
+			return partitionSize * Num_Partitions;
+		}
+
+	public:
+		/// Gets the number of cells.
+		size_t numCells() const {
+			return m_cells.size();
+		}
+
+		/// Gets the cells.
+		const std::vector<Cell>& cells() const {
+			return m_cells;
+		}
+
+	public:
+		/// Inserts \a key into the table.
+		void insert(const TKey& key) {
+			update(key, 1);
+		}
+
+		/// Erases \a key from the table.
+		void erase(const TKey& key) {
+			update(key, -1);
+		}
+
+		/// Subtracts all keys in \a rhs from this table.
+		void subtract(const InvertibleBloomLookupTable& rhs) {
+			if (numCells() != rhs.numCells())
+				CATAPULT_THROW_INVALID_ARGUMENT_2("cannot subtract tables with different number of cells", numCells(), rhs.numCells());
+
+			for (auto i = 0u; i < m_cells.size(); ++i) {
+				auto& cell = m_cells[i];
+				const auto& rhsCell = rhs.m_cells[i];
+				cell.Count -= rhsCell.Count;
+				cell.ChecksumSum ^= rhsCell.ChecksumSum;
+				XorKey(cell.KeySum, rhsCell.KeySum);
+			}
+		}
+
+		/// Folds this table into a smaller table with \a numCells cells that contains the same keys.
+		/// \note This is possible because every partition size is a power of two.
+		InvertibleBloomLookupTable fold(size_t numCells) const {
+			if (!IsValidNumCells(numCells) || numCells > m_cells.size())
+				CATAPULT_THROW_INVALID_ARGUMENT_1("cannot fold table into number of cells", numCells);
+
+			auto partitionSize = m_cells.size() / Num_Partitions;
+			auto foldedPartitionSize = numCells / Num_Partitions;
+			std::vector<Cell> foldedCells(numCells, Cell());
+			for (auto i = 0u; i < m_cells.size(); ++i) {
+				auto partitionId = i / partitionSize;
+				auto& foldedCell = foldedCells[partitionId * foldedPartitionSize + (i % partitionSize) % foldedPartitionSize];
+				const auto& cell = m_cells[i];
+				foldedCell.Count += cell.Count;
+				foldedCell.ChecksumSum ^= cell.ChecksumSum;
+				XorKey(foldedCell.KeySum, cell.KeySum);
+			}
+
+			return InvertibleBloomLookupTable(std::move(foldedCells));
+		}
+
+		/// Decodes all keys in this table into \a positiveKeys (inserted keys) and \a negativeKeys (erased keys).
+		/// Returns \c false if the table contains too many keys to be decoded completely.
+		bool decode(std::vector<TKey>& positiveKeys, std::vector<TKey>& negativeKeys) const {
+			auto cells = m_cells;
+			std::vector<size_t> pureCellIds;
+			for (auto i = 0u; i < cells.size(); ++i) {
+				if (IsPure(cells[i]))
+					pureCellIds.push_back(i);
+			}
+
+			// a table cannot hold more distinct keys than cells, so stop peeling if that happens (due to a checksum collision)
+			size_t numDecodedKeys = 0;
+			auto partitionSize = cells.size() / Num_Partitions;
+			while (!pureCellIds.empty() && numDecodedKeys <= cells.size()) {
+				auto cellId = pureCellIds.back();
+				pureCellIds.pop_back();
+				if (!IsPure(cells[cellId]))
+					continue;
+
+				auto key = cells[cellId].KeySum;
+				auto count = cells[cellId].Count;
+				(1 == count ? positiveKeys : negativeKeys).push_back(key);
+				++numDecodedKeys;
+
+				auto keyHash = HashKey(key);
+				auto checksum = CalculateChecksum(keyHash);
+				for (auto partitionId = 0u; partitionId < Num_Partitions; ++partitionId) {
+					auto id = CalculateCellId(keyHash, partitionId, partitionSize);
+					auto& cell = cells[id];
+					cell.Count -= count;
+					cell.ChecksumSum ^= checksum;
+					XorKey(cell.KeySum, key);
+					if (IsPure(cell))
+						pureCellIds.push_back(id);
+				}
+			}
+
+			return std::all_of(cells.cbegin(), cells.cend(), IsEmpty);
+		}
+
+	private:
+		void update(const TKey& key, int32_t count) {
+			auto keyHash = HashKey(key);
+			auto checksum = CalculateChecksum(keyHash);
+			auto partitionSize = m_cells.size() / Num_Partitions;
+			for (auto partitionId = 0u; partitionId < Num_Partitions; ++partitionId) {
+				auto& cell = m_cells[CalculateCellId(keyHash, partitionId, partitionSize)];
+				cell.Count += count;
+				cell.ChecksumSum ^= checksum;
+				XorKey(cell.KeySum, key);
+			}
+		}
+
+	private:
+		static constexpr bool IsPowerOfTwo(size_t value) {
+			return 0 == (value & (value - 1));
+		}
+
+		static uint64_t Mix(uint64_t value) {
+			// splitmix64 finalizer
+			value += 0x9E3779B97F4A7C15;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EB;
+			return value ^ (value >> 31);
+		}
+
+		static uint64_t HashKey(const TKey& key) {
+			const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
+			uint64_t hash = sizeof(TKey);
+			for (auto i = 0u; i < sizeof(TKey); i += sizeof(uint64_t)) {
+				uint64_t word = 0;
+				std::memcpy(&word, pKeyData + i, std::min(sizeof(uint64_t), sizeof(TKey) - i));
+				hash = Mix(hash ^ word);
+			}
+
+			return hash;
+		}
+
+		static uint32_t CalculateChecksum(uint64_t keyHash) {
+			return static_cast<uint32_t>(Mix(keyHash + Num_Partitions));
+		}
+
+		static size_t CalculateCellId(uint64_t keyHash, size_t partitionId, size_t partitionSize) {
+			// partition sizes are powers of two, so masking allows cells to be folded
+			return partitionId * partitionSize + (Mix(keyHash + partitionId) & (partitionSize - 1));
+		}
+
+		static void XorKey(TKey& keySum, const TKey& key) {
+			auto* pKeySumData = reinterpret_cast<uint8_t*>(&keySum);
+			const auto* pKeyData = reinterpret_cast<const uint8_t*>(&key);
+			for (auto i = 0u; i < sizeof(TKey); ++i)
+				pKeySumData[i] ^= pKeyData[i];
+		}
+
+		static bool IsPure(const Cell& cell) {
+			return (1 == cell.Count || -1 == cell.Count) && CalculateChecksum(HashKey(cell.KeySum)) == cell.ChecksumSum;
+		}
+
+		static bool IsEmpty(const Cell& cell) {
+			static const TKey Zero_Key = TKey();
+			return 0 == cell.Count && 0 == cell.ChecksumSum && 0 == std::memcmp(&cell.KeySum, &Zero_Key, sizeof(TKey));
+		}
+
+	private:
+		std::vector<Cell> m_cells;
+	};
+}}
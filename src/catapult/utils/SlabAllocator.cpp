@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "SlabAllocator.h"
+#include <algorithm>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr size_t AlignBlockSize(size_t size) {
+			// every block must be able to hold a free list link and must keep the next block suitably aligned
+			return (std::max(size, sizeof(void*)) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+		}
+	}
+
+	SlabPool::SlabPool(size_t blockSize, size_t blocksPerSlab)
+			: m_blockSize(AlignBlockSize(blockSize))
+			, m_blocksPerSlab(std::max<size_t>(1, blocksPerSlab))
+			, m_pFreeBlocks(nullptr)
+			, m_pNextUnusedBlock(nullptr)
+			, m_numUnusedBlocks(0)
+			, m_numAllocatedBlocks(0)
+			, m_numTotalAllocations(0)
+	{}
+
+	SlabPoolStatistics SlabPool::statistics() const {
+		SpinLockGuard guard(m_lock);
+		return { m_blockSize, m_slabs.size(), m_numAllocatedBlocks, m_numTotalAllocations };
+	}
+
+	void* SlabPool::allocate() {
+		SpinLockGuard guard(m_lock);
+		++m_numAllocatedBlocks;
+		++m_numTotalAllocations;
+
+		// prefer reusing freed blocks
+		if (m_pFreeBlocks) {
+			auto* pBlock = m_pFreeBlocks;
+			m_pFreeBlocks = pBlock->pNext;
+			return pBlock;
+		}
+
+		if (0 == m_numUnusedBlocks) {
+			// slab memory is intentionally left uninitialized so that its pages are only committed when blocks are used
+			m_slabs.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[m_blockSize * m_blocksPerSlab]));
+			m_pNextUnusedBlock = m_slabs.back().get();
+			m_numUnusedBlocks = m_blocksPerSlab;
+		}
+
+		auto* pBlock = m_pNextUnusedBlock;
+		m_pNextUnusedBlock += m_blockSize;
+		--m_numUnusedBlocks;
+		return pBlock;
+	}
+
+	void SlabPool::deallocate(void* pBlock) {
+		if (!pBlock)
+			return;
+
+		SpinLockGuard guard(m_lock);
+		--m_numAllocatedBlocks;
+
+		auto* pFreeBlock = static_cast<FreeBlock*>(pBlock);
+		pFreeBlock->pNext = m_pFreeBlocks;
+		m_pFreeBlocks = pFreeBlock;
+	}
+}}
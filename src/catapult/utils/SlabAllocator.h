@@ -0,0 +1,140 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include "SpinLock.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace catapult { namespace utils {
+
+	/// Slab pool statistics.
+	struct SlabPoolStatistics {
+		/// Size of each block.
+		size_t BlockSize;
+
+		/// Number of slabs allocated from the heap.
+		size_t NumSlabs;
+
+		/// Number of blocks currently handed out.
+		size_t NumAllocatedBlocks;
+
+		/// Total number of block allocations.
+		uint64_t NumTotalAllocations;
+	};
+
+	/// Thread safe pool of fixed size blocks that are carved out of large slabs.
+	/// \note Freed blocks are reused by subsequent allocations, but slabs are only returned to the heap when the pool is destroyed.
+	class SlabPool : NonCopyable {
+	public:
+		/// Creates a pool of blocks with size \a blockSize and \a blocksPerSlab blocks in each slab.
+		SlabPool(size_t blockSize, size_t blocksPerSlab);
+
+	public:
+		/// Gets the pool statistics.
+		SlabPoolStatistics statistics() const;
+
+	public:
+		/// Allocates a single block.
+		void* allocate();
+
+		/// Returns the block pointed to by \a pBlock to the pool.
+		void deallocate(void* pBlock);
+
+	private:
+		struct FreeBlock {
+			FreeBlock* pNext;
+		};
+
+	private:
+		size_t m_blockSize;
+		size_t m_blocksPerSlab;
+
+		mutable SpinLock m_lock;
+		std::vector<std::unique_ptr<uint8_t[]>> m_slabs;
+		FreeBlock* m_pFreeBlocks;
+		uint8_t* m_pNextUnusedBlock;
+		size_t m_numUnusedBlocks;
+		size_t m_numAllocatedBlocks;
+		uint64_t m_numTotalAllocations;
+	};
+
+	/// Gets the process-wide slab pool used for objects of type \a T.
+	/// \note Pools are never destroyed, so objects allocated from them can safely outlive static destruction.
+	template<typename T>
+	SlabPool& GetSlabPool() {
+		static_assert(alignof(T) <= alignof(std::max_align_t), "slab pool does not support over aligned types");
+
+		// size slabs so that each one holds roughly 64KB of blocks
+		constexpr size_t Slab_Size = 64 * 1024;
+		constexpr size_t Blocks_Per_Slab = sizeof(T) < Slab_Size ? Slab_Size / sizeof(T) : 1;
+
+		static auto* pPool = new SlabPool(sizeof(T), Blocks_Per_Slab);
+		return *pPool;
+	}
+
+	/// Allocator that allocates single objects from a process-wide slab pool and arrays from the heap.
+	template<typename T>
+	class SlabAllocator {
+	public:
+		using value_type = T;
+
+	public:
+		/// Creates an allocator.
+		SlabAllocator() = default;
+
+		/// Creates an allocator from an allocator for a different type.
+		template<typename U>
+		SlabAllocator(const SlabAllocator<U>&)
+		{}
+
+	public:
+		/// Allocates storage for \a count objects.
+		T* allocate(size_t count) {
+			return 1 == count
+					? static_cast<T*>(GetSlabPool<T>().allocate())
+					: static_cast<T*>(::operator new(count * sizeof(T)));
+		}
+
+		/// Deallocates storage for \a count objects pointed to by \a pObjects.
+		void deallocate(T* pObjects, size_t count) {
+			if (1 == count)
+				GetSlabPool<T>().deallocate(pObjects);
+			else
+				::operator delete(pObjects);
+		}
+	};
+
+	/// Returns \c true because all slab allocators are interchangeable.
+	template<typename T, typename U>
+	bool operator==(const SlabAllocator<T>&, const SlabAllocator<U>&) {
+		return true;
+	}
+
+	/// Returns \c false because all slab allocators are interchangeable.
+	template<typename T, typename U>
+	bool operator!=(const SlabAllocator<T>&, const SlabAllocator<U>&) {
+		return false;
+	}
+}}
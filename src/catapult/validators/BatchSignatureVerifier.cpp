@@ -0,0 +1,137 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "BatchSignatureVerifier.h"
+#include "catapult/crypto/Signer.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/FutureUtils.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
+#include <boost/asio/io_service.hpp>
+
+namespace catapult { namespace validators {
+
+	namespace {
+		class SignatureCollector : public model::NotificationSubscriber {
+		public:
+			explicit SignatureCollector(std::vector<crypto::SignatureInput>& signatureInputs) : m_signatureInputs(signatureInputs)
+			{}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (model::Core_Signature_Notification != notification.Type)
+					return;
+
+				const auto& signatureNotification = static_cast<const model::SignatureNotification&>(notification);
+				m_signatureInputs.push_back({ signatureNotification.Signer, signatureNotification.Data, signatureNotification.Signature });
+			}
+
+		private:
+			std::vector<crypto::SignatureInput>& m_signatureInputs;
+		};
+
+		class VerificationWork {
+		public:
+			VerificationWork(const std::shared_ptr<const void>& pOwner, const model::WeakEntityInfos& entityInfos)
+					: m_pOwner(pOwner) // extend the owner lifetime to the lifetime of this context
+					, m_entityInfos(entityInfos) // signature inputs reference entity memory, so entity infos must be kept alive too
+					, m_areAllValid(true)
+			{}
+
+		public:
+			auto& signatureInputs() {
+				return m_signatureInputs;
+			}
+
+			bool areAllValid() const {
+				return m_areAllValid;
+			}
+
+		public:
+			void collect(const model::NotificationPublisher& publisher) {
+				SignatureCollector collector(m_signatureInputs);
+				for (const auto& entityInfo : m_entityInfos)
+					publisher.publish(entityInfo, collector);
+			}
+
+			template<typename TIterator>
+			void verify(TIterator itBegin, TIterator itEnd) {
+				// bypass verification when another partition has already failed
+				if (!m_areAllValid)
+					return;
+
+				// (VerifyMulti falls back to individual verification when the batch fails, so its result matches Verify)
+				if (!crypto::VerifyMulti(&*itBegin, static_cast<size_t>(std::distance(itBegin, itEnd))))
+					m_areAllValid = false;
+			}
+
+		private:
+			std::shared_ptr<const void> m_pOwner;
+			model::WeakEntityInfos m_entityInfos;
+			std::vector<crypto::SignatureInput> m_signatureInputs;
+			std::atomic_bool m_areAllValid;
+		};
+
+		class DefaultBatchSignatureVerifier final
+				: public BatchSignatureVerifier
+				, public std::enable_shared_from_this<DefaultBatchSignatureVerifier> {
+		public:
+			DefaultBatchSignatureVerifier(
+					std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+					const std::shared_ptr<thread::IoServiceThreadPool>& pPool)
+					: m_pPublisher(std::move(pPublisher))
+					, m_pPool(pPool)
+					, m_service(pPool->service())
+			{}
+
+		public:
+			thread::future<bool> verify(const model::WeakEntityInfos& entityInfos) const override {
+				auto pWork = std::make_shared<VerificationWork>(shared_from_this(), entityInfos);
+				pWork->collect(*m_pPublisher);
+				if (pWork->signatureInputs().empty())
+					return thread::make_ready_future(true);
+
+				// each partition is verified as an independent batch
+				return thread::compose(
+						thread::ParallelForPartition(m_service, pWork->signatureInputs(), m_pPool->numWorkerThreads(), [pWork](
+								auto itBegin,
+								auto itEnd,
+								auto,
+								auto) {
+							pWork->verify(itBegin, itEnd);
+						}),
+						[pWork](const auto&) {
+							return thread::make_ready_future(pWork->areAllValid());
+						});
+			}
+
+		private:
+			std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+			std::shared_ptr<const thread::IoServiceThreadPool> m_pPool;
+			boost::asio::io_service& m_service;
+		};
+	}
+
+	std::shared_ptr<const BatchSignatureVerifier> CreateBatchSignatureVerifier(
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool) {
+		return std::make_shared<const DefaultBatchSignatureVerifier>(std::move(pPublisher), pPool);
+	}
+}}
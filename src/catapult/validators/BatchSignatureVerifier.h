@@ -0,0 +1,44 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/thread/Future.h"
+
+namespace catapult { namespace thread { class IoServiceThreadPool; } }
+
+namespace catapult { namespace validators {
+
+	/// A verifier that verifies all signatures published by multiple entities together.
+	class BatchSignatureVerifier {
+	public:
+		virtual ~BatchSignatureVerifier() {}
+
+	public:
+		/// Verifies all signatures published by \a entityInfos.
+		/// \note The returned future is resolved with \c true only if all signatures are valid.
+		virtual thread::future<bool> verify(const model::WeakEntityInfos& entityInfos) const = 0;
+	};
+
+	/// Creates a batch signature verifier that extracts signatures using \a pPublisher and uses \a pPool for parallelization.
+	std::shared_ptr<const BatchSignatureVerifier> CreateBatchSignatureVerifier(
+			std::unique_ptr<const model::NotificationPublisher>&& pPublisher,
+			const std::shared_ptr<thread::IoServiceThreadPool>& pPool);
+}}
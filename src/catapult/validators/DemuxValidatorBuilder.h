@@ -19,55 +19,64 @@
 **/
 
 #pragma once
-#include "AggregateValidatorBuilder.h"
+#include "AggregateValidationResult.h"
 #include "ValidatorTypes.h"
-#include <functional>
+#include "catapult/utils/NamedObject.h"
+#include <unordered_map>
 #include <vector>
 
 namespace catapult { namespace validators {
 
 	/// A demultiplexing validator builder.
+	/// \note Built validators dispatch each notification through a table indexed by notification source (facility and code),
+	///       so only validators registered for that source and validators registered for all notifications are invoked.
 	template<typename... TArgs>
 	class DemuxValidatorBuilderT {
 	private:
+		using NotificationValidator = NotificationValidatorT<model::Notification, TArgs...>;
+
 		template<typename TNotification>
 		using NotificationValidatorPointerT = std::unique_ptr<const NotificationValidatorT<TNotification, TArgs...>>;
-		using NotificationValidatorPredicate = predicate<const model::Notification&>;
 		using AggregateValidatorPointer = std::unique_ptr<const AggregateNotificationValidatorT<model::Notification, TArgs...>>;
 
+		struct ValidatorEntry {
+			NotificationValidatorPointerT<model::Notification> pValidator;
+			bool IsUniversal;
+			uint32_t Source;
+		};
+
+		using ValidatorEntries = std::vector<ValidatorEntry>;
+
 	public:
 		/// Adds a validator (\a pValidator) to the builder that is invoked only when matching notifications are processed.
 		template<
 				typename TNotification,
 				typename X = typename std::enable_if<!std::is_same<model::Notification, TNotification>::value>::type>
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<TNotification>&& pValidator) {
-			auto predicate = [type = TNotification::Notification_Type](const auto& notification) {
-				return model::AreEqualExcludingChannel(type, notification.Type);
-			};
-			m_builder.add(std::make_unique<ConditionalValidator<TNotification>>(std::move(pValidator), predicate));
+			m_entries.push_back(ValidatorEntry{
+				std::make_unique<TypedValidator<TNotification>>(std::move(pValidator)),
+				false,
+				model::GetNotificationSource(TNotification::Notification_Type)
+			});
 			return *this;
 		}
 
 		/// Adds a validator (\a pValidator) to the builder that is always invoked.
 		DemuxValidatorBuilderT& add(NotificationValidatorPointerT<model::Notification>&& pValidator) {
-			m_builder.add(std::move(pValidator));
+			m_entries.push_back(ValidatorEntry{ std::move(pValidator), true, 0 });
 			return *this;
 		}
 
 		/// Builds a demultiplexing validator that ignores suppressed failures according to \a isSuppressedFailure.
 		AggregateValidatorPointer build(const ValidationResultPredicate& isSuppressedFailure) {
-			return m_builder.build(isSuppressedFailure);
+			return std::make_unique<DemuxAggregateNotificationValidator>(std::move(m_entries), isSuppressedFailure);
 		}
 
 	private:
 		template<typename TNotification>
-		class ConditionalValidator : public NotificationValidatorT<model::Notification, TArgs...> {
+		class TypedValidator : public NotificationValidator {
 		public:
-			ConditionalValidator(
-					NotificationValidatorPointerT<TNotification>&& pValidator,
-					const NotificationValidatorPredicate& predicate)
-					: m_pValidator(std::move(pValidator))
-					, m_predicate(predicate)
+			explicit TypedValidator(NotificationValidatorPointerT<TNotification>&& pValidator) : m_pValidator(std::move(pValidator))
 			{}
 
 		public:
@@ -76,18 +85,89 @@ namespace catapult { namespace validators {
 			}
 
 			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
-				if (!m_predicate(notification))
-					return ValidationResult::Success;
-
 				return m_pValidator->validate(static_cast<const TNotification&>(notification), std::forward<TArgs>(args)...);
 			}
 
 		private:
 			NotificationValidatorPointerT<TNotification> m_pValidator;
-			NotificationValidatorPredicate m_predicate;
+		};
+
+		class DemuxAggregateNotificationValidator : public AggregateNotificationValidatorT<model::Notification, TArgs...> {
+		private:
+			using ValidatorPointers = std::vector<const NotificationValidator*>;
+
+		public:
+			DemuxAggregateNotificationValidator(ValidatorEntries&& entries, const ValidationResultPredicate& isSuppressedFailure)
+					: m_entries(std::move(entries))
+					, m_isSuppressedFailure(isSuppressedFailure)
+					, m_name(utils::ReduceNames(names())) {
+				// create a dispatch list for every registered source before filling any so that universal validators
+				// are interleaved in registration order
+				for (const auto& entry : m_entries) {
+					if (!entry.IsUniversal)
+						m_sourceValidators.emplace(entry.Source, ValidatorPointers());
+				}
+
+				for (const auto& entry : m_entries) {
+					if (!entry.IsUniversal) {
+						m_sourceValidators[entry.Source].push_back(entry.pValidator.get());
+						continue;
+					}
+
+					m_universalValidators.push_back(entry.pValidator.get());
+					for (auto& pair : m_sourceValidators)
+						pair.second.push_back(entry.pValidator.get());
+				}
+			}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			std::vector<std::string> names() const override {
+				std::vector<std::string> names;
+				names.reserve(m_entries.size());
+				for (const auto& entry : m_entries)
+					names.push_back(entry.pValidator->name());
+
+				return names;
+			}
+
+			ValidationResult validate(const model::Notification& notification, TArgs&&... args) const override {
+				auto aggregateResult = ValidationResult::Success;
+				for (const auto* pValidator : validators(notification.Type)) {
+					auto result = pValidator->validate(notification, std::forward<TArgs>(args)...);
+
+					// ignore suppressed failures
+					if (m_isSuppressedFailure(result))
+						continue;
+
+					// exit on other failures
+					if (IsValidationResultFailure(result))
+						return result;
+
+					AggregateValidationResult(aggregateResult, result);
+				}
+
+				return aggregateResult;
+			}
+
+		private:
+			const ValidatorPointers& validators(model::NotificationType type) const {
+				auto iter = m_sourceValidators.find(model::GetNotificationSource(type));
+				return m_sourceValidators.cend() == iter ? m_universalValidators : iter->second;
+			}
+
+		private:
+			ValidatorEntries m_entries;
+			ValidationResultPredicate m_isSuppressedFailure;
+			std::string m_name;
+			std::unordered_map<uint32_t, ValidatorPointers> m_sourceValidators;
+			ValidatorPointers m_universalValidators;
 		};
 
 	private:
-		AggregateValidatorBuilder<model::Notification, TArgs...> m_builder;
+		ValidatorEntries m_entries;
 	};
 }}
@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/api/RemoteTransactionApi.h"
+#include "catapult/api/SketchPackets.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/other/RemoteApiFactory.h"
 #include "tests/test/other/RemoteApiTestUtils.h"
@@ -100,6 +101,79 @@ namespace catapult { namespace api {
 			}
 		};
 
+		struct UtByHashTraits {
+			static constexpr uint32_t Request_Data_Size = 3 * Hash256_Size;
+
+			static std::vector<Hash256> HashesValues() {
+				return { { { 12 } }, { { 23 } }, { { 34 } } };
+			}
+
+			static model::HashRange Hashes() {
+				return model::HashRange::CopyFixed(reinterpret_cast<uint8_t*>(HashesValues().data()), 3);
+			}
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.unconfirmedTransactionsByHash(Hashes());
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = CreatePacketWithTransactions(3);
+				pResponsePacket->Type = ionet::PacketType::Pull_Transactions_By_Hash;
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains a partial transaction
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_EQ(ionet::PacketType::Pull_Transactions_By_Hash, packet.Type);
+				EXPECT_EQ(sizeof(ionet::Packet) + Request_Data_Size, packet.Size);
+				EXPECT_TRUE(0 == std::memcmp(packet.Data(), HashesValues().data(), Request_Data_Size));
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const model::TransactionRange& transactions) {
+				UtTraits::ValidateResponse(response, transactions);
+			}
+		};
+
+		struct UtSketchTraits {
+			static constexpr uint32_t Num_Cells = 3 * 4;
+
+			static auto Invoke(const RemoteTransactionApi& api) {
+				return api.unconfirmedTransactionsSketch(Num_Cells);
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto payloadSize = Num_Cells * static_cast<uint32_t>(sizeof(cache::UtSketch::Cell));
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Pull_Transactions_Sketch;
+				test::FillWithRandomData({ pResponsePacket->Data(), payloadSize });
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// the packet is malformed because it contains fewer cells than requested
+				auto pResponsePacket = CreateValidResponsePacket();
+				pResponsePacket->Size -= static_cast<uint32_t>(sizeof(cache::UtSketch::Cell));
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				const auto* pRequest = ionet::CoercePacket<PullTransactionsSketchRequest>(&packet);
+				ASSERT_TRUE(!!pRequest);
+				EXPECT_EQ(Num_Cells, pRequest->NumCells);
+			}
+
+			static void ValidateResponse(const ionet::Packet& response, const cache::UtSketchCellRange& cells) {
+				ASSERT_EQ(Num_Cells, cells.size());
+				EXPECT_TRUE(0 == std::memcmp(response.Data(), cells.data(), Num_Cells * sizeof(cache::UtSketch::Cell)));
+			}
+		};
+
 		struct RemoteTransactionApiTraits {
 			static auto Create(const std::shared_ptr<ionet::PacketIo>& pPacketIo) {
 				return test::CreateLifetimeExtendedApi(CreateRemoteTransactionApi, *pPacketIo, mocks::CreateDefaultTransactionRegistry());
@@ -108,4 +182,6 @@ namespace catapult { namespace api {
 	}
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, Ut)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteTransactionApi, UtByHash)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteTransactionApi, UtSketch)
 }}
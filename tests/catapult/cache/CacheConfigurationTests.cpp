@@ -41,5 +41,24 @@ namespace catapult { namespace cache {
 		// Assert:
 		EXPECT_TRUE(config.ShouldUseCacheDatabase);
 		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
+		EXPECT_EQ(0u, config.CacheDatabaseOptions.BloomFilterBitsPerKey);
+	}
+
+	TEST(TEST_CLASS, CanCreateConfigurationWithPathAndOptions) {
+		// Arrange:
+		RocksDatabaseOptions options;
+		options.BlockCacheSize = utils::FileSize::FromMegabytes(12);
+		options.BloomFilterBitsPerKey = 7;
+		options.CompactionStyle = RdbCompactionStyle::Universal;
+
+		// Act:
+		CacheConfiguration config("xyz", options);
+
+		// Assert:
+		EXPECT_TRUE(config.ShouldUseCacheDatabase);
+		EXPECT_EQ("xyz", config.CacheDatabaseDirectory);
+		EXPECT_EQ(utils::FileSize::FromMegabytes(12), config.CacheDatabaseOptions.BlockCacheSize);
+		EXPECT_EQ(7u, config.CacheDatabaseOptions.BloomFilterBitsPerKey);
+		EXPECT_EQ(RdbCompactionStyle::Universal, config.CacheDatabaseOptions.CompactionStyle);
 	}
 }}
@@ -22,9 +22,11 @@
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCacheBuilder.h"
 #include "catapult/cache/ReadOnlyCatapultCache.h"
+#include "catapult/cache_db/RocksDatabase.h"
 #include "tests/test/cache/CacheBasicTests.h"
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockMemoryStream.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -214,6 +216,25 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(Height(123), cache.createDetachableDelta().height());
 	}
 
+	TEST(TEST_CLASS, CommitWritesPendingBatchToSharedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		auto pDatabase = std::make_shared<RocksDatabase>("testdb", std::vector<RdbColumnFamily>(), RocksDatabaseOptions());
+
+		CatapultCacheBuilder builder;
+		AddSubCacheWithId<2>(builder);
+		auto cache = builder.build(pDatabase);
+		{
+			// Act:
+			auto delta = cache.createDelta();
+			cache.commit(Height(123));
+		}
+
+		// Assert: height was updated and no batch is left pending
+		EXPECT_EQ(Height(123), cache.createView().height());
+		EXPECT_FALSE(!!pDatabase->pendingBatch());
+	}
+
 	// endregion
 
 	// region toReadOnly
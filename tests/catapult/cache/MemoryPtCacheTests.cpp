@@ -916,6 +916,163 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region transactionInfos
+
+	TEST(TEST_CLASS, TransactionInfosReturnsNoTransactionInfosIfNoHashesAreRequested) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		AddAll(cache, test::CreateTransactionInfos(5));
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos({});
+
+		// Assert:
+		EXPECT_TRUE(transactionInfos.empty());
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsTransactionsAndCosignaturesWithRequestedHashes) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		auto originalInfos = test::CreateTransactionInfos(5);
+		AddAll(cache, originalInfos);
+
+		auto cosignatures = Sort(test::GenerateRandomDataVector<model::Cosignature>(3));
+		AddAll(cache, originalInfos[3], cosignatures);
+
+		// - request some known hashes together with unknown hashes
+		utils::HashSet hashes{
+			originalInfos[3].EntityHash,
+			test::GenerateRandomData<Hash256_Size>(),
+			originalInfos[0].EntityHash,
+			test::GenerateRandomData<Hash256_Size>()
+		};
+
+		// Act:
+		auto transactionInfoMap = ToMap(cache.view().transactionInfos(hashes));
+
+		// Assert:
+		ASSERT_EQ(2u, transactionInfoMap.size());
+		for (auto index : { 0u, 3u }) {
+			auto message = "at index " + std::to_string(index);
+			const auto& transactionInfo = transactionInfoMap.at(originalInfos[index].EntityHash);
+			EXPECT_EQ(originalInfos[index].pEntity, transactionInfo.pTransaction) << message;
+			AssertCosignatures(3 == index ? cosignatures : std::vector<model::Cosignature>(), transactionInfo.Cosignatures, message);
+		}
+	}
+
+	TEST(TEST_CLASS, TransactionInfosReturnsTransactionInfosWithTotalSizeOfAtMostMaxResponseSize) {
+		// Arrange:
+		auto transactionSize = test::CreateTransactionInfos(1)[0].pEntity->Size;
+		auto entrySize = static_cast<uint64_t>(transactionSize + Hash256_Size);
+		MemoryPtCache cache(MemoryCacheOptions(3 * entrySize - 1, 1000));
+		auto originalInfos = test::CreateTransactionInfos(5);
+		AddAll(cache, originalInfos);
+
+		utils::HashSet hashes;
+		for (const auto& transactionInfo : originalInfos)
+			hashes.insert(transactionInfo.EntityHash);
+
+		// Act:
+		auto transactionInfos = cache.view().transactionInfos(hashes);
+
+		// Assert:
+		EXPECT_EQ(2u, transactionInfos.size());
+	}
+
+	// endregion
+
+	// region sketch
+
+	namespace {
+		constexpr uint32_t Num_Sketch_Cells = 3 * 64;
+
+		std::vector<PtSketchKey> DecodeSketch(const MemoryPtCache& cache) {
+			auto sketch = cache.view().sketch(Num_Sketch_Cells);
+
+			std::vector<PtSketchKey> positiveKeys;
+			std::vector<PtSketchKey> negativeKeys;
+			EXPECT_TRUE(sketch.decode(positiveKeys, negativeKeys));
+			EXPECT_TRUE(negativeKeys.empty());
+			return positiveKeys;
+		}
+
+		void AssertSketchKeys(
+				const std::vector<PtSketchKey>& keys,
+				const std::map<Hash256, utils::ShortHash>& expectedCosignaturesShortHashes) {
+			ASSERT_EQ(expectedCosignaturesShortHashes.size(), keys.size());
+
+			for (const auto& key : keys) {
+				auto iter = expectedCosignaturesShortHashes.find(key.TransactionHash);
+				ASSERT_NE(expectedCosignaturesShortHashes.cend(), iter) << utils::HexFormat(key.TransactionHash);
+				EXPECT_EQ(iter->second, key.CosignaturesShortHash) << utils::HexFormat(key.TransactionHash);
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, SketchIsInitiallyEmpty) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+
+		// Act:
+		auto keys = DecodeSketch(cache);
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	TEST(TEST_CLASS, SketchContainsAllAddedTransactionsWithCosignaturesShortHashes) {
+		// Arrange:
+		MemoryPtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(3);
+		AddAll(cache, transactionInfos);
+
+		auto cosignatures = test::GenerateRandomDataVector<model::Cosignature>(4);
+		AddAll(cache, transactionInfos[1], cosignatures);
+
+		// Act:
+		auto keys = DecodeSketch(cache);
+
+		// Assert: sketch key is updated when cosignatures are added
+		AssertSketchKeys(keys, {
+			{ transactionInfos[0].EntityHash, utils::ShortHash() },
+			{ transactionInfos[1].EntityHash, utils::ToShortHash(HashCosignatures(Sort(cosignatures))) },
+			{ transactionInfos[2].EntityHash, utils::ShortHash() }
+		});
+	}
+
+	TEST(TEST_CLASS, SketchExcludesRemovedAndPrunedTransactions) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		auto pCache = PrepareCache(hashes);
+
+		// Act: remove one transaction and prune two transactions (deadlines 10 and 20)
+		{
+			auto modifier = pCache->modifier();
+			modifier.remove(hashes[3]);
+			modifier.prune(Timestamp(20));
+		}
+
+		auto keys = DecodeSketch(*pCache);
+
+		// Assert:
+		AssertSketchKeys(keys, { { hashes[2], utils::ShortHash() }, { hashes[4], utils::ShortHash() } });
+	}
+
+	TEST(TEST_CLASS, SketchExcludesTransactionsPrunedByPredicate) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		auto pCache = PrepareCache(hashes);
+
+		// Act:
+		pCache->modifier().prune([&hashes](const auto& hash) { return hashes[1] == hash || hashes[2] == hash; });
+		auto keys = DecodeSketch(*pCache);
+
+		// Assert:
+		AssertSketchKeys(keys, { { hashes[0], utils::ShortHash() }, { hashes[3], utils::ShortHash() }, { hashes[4], utils::ShortHash() } });
+	}
+
+	// endregion
+
 	// region max size
 
 	TEST(TEST_CLASS, CacheCanContainMaxTransactions) {
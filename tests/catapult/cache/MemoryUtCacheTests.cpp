@@ -24,6 +24,7 @@
 #include "tests/test/cache/UtTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/nodeps/LockTestUtils.h"
 #include "tests/TestHarness.h"
 
@@ -515,6 +516,121 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region forEachByFee
+
+	namespace {
+		model::TransactionInfo CreateTransactionInfoWithFeeMultiplier(uint64_t feeMultiplier, uint16_t dataSize, Timestamp deadline) {
+			// fee is proportional to size, so fee per byte is determined by feeMultiplier
+			auto pTransaction = mocks::CreateMockTransaction(dataSize);
+			pTransaction->Fee = Amount(feeMultiplier * pTransaction->Size);
+			pTransaction->Deadline = deadline;
+
+			auto transactionInfo = model::TransactionInfo(std::move(pTransaction));
+			test::FillWithRandomData(transactionInfo.EntityHash);
+			test::FillWithRandomData(transactionInfo.MerkleComponentHash);
+			return transactionInfo;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlinesByFee(const MemoryUtCache& cache, size_t count) {
+			std::vector<Timestamp::ValueType> rawDeadlines;
+			cache.view().forEachByFee([count, &rawDeadlines](const auto& info) {
+				rawDeadlines.push_back(info.pEntity->Deadline.unwrap());
+				return count != rawDeadlines.size();
+			});
+			return rawDeadlines;
+		}
+
+		std::vector<Timestamp::ValueType> ExtractRawDeadlinesByFee(const MemoryUtCache& cache) {
+			return ExtractRawDeadlinesByFee(cache, std::numeric_limits<size_t>::max());
+		}
+
+		void AddWithFeeMultipliers(MemoryUtCache& cache, const std::vector<uint64_t>& feeMultipliers) {
+			// use different sizes so that fee per byte and not absolute fee determines order
+			std::vector<model::TransactionInfo> transactionInfos;
+			for (auto i = 0u; i < feeMultipliers.size(); ++i) {
+				auto dataSize = static_cast<uint16_t>((feeMultipliers.size() - i) * 10);
+				transactionInfos.push_back(CreateTransactionInfoWithFeeMultiplier(feeMultipliers[i], dataSize, Timestamp(i + 1)));
+			}
+
+			test::AddAll(cache, transactionInfos);
+		}
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeForwardsNoTransactionInfosIfCacheIsEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		EXPECT_TRUE(ExtractRawDeadlinesByFee(cache).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeForwardsTransactionsOrderedByDecreasingFeePerByte) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 3, 7, 1, 5, 2 });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 1, 5, 3 }), ExtractRawDeadlinesByFee(cache));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeForwardsTransactionsWithEqualFeePerByteInArrivalOrder) {
+		// Arrange: transactions with equal fee per byte have different sizes and absolute fees
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 4, 9, 4, 9, 4 });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4, 1, 3, 5 }), ExtractRawDeadlinesByFee(cache));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeForwardsSubsetOfTransactionsIfShortCircuited) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 3, 7, 1, 5, 2 });
+
+		// Act + Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4 }), ExtractRawDeadlinesByFee(cache, 2));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeExcludesRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 3, 7, 1, 5, 2 });
+		auto hashes = ExtractEverySecondHash(cache);
+
+		// Act:
+		test::RemoveAll(cache, hashes);
+
+		// Assert: transactions with deadlines 1, 3 and 5 were removed
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 2, 4 }), ExtractRawDeadlinesByFee(cache));
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeForwardsNoTransactionInfosAfterRemoveAll) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 3, 7, 1, 5, 2 });
+
+		// Act:
+		cache.modifier().removeAll();
+
+		// Assert:
+		EXPECT_TRUE(ExtractRawDeadlinesByFee(cache).empty());
+	}
+
+	TEST(TEST_CLASS, ForEachByFeeIncludesTransactionsAddedAfterRemoval) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		AddWithFeeMultipliers(cache, { 3, 7, 1 });
+		test::RemoveAll(cache, ExtractEverySecondHash(cache));
+
+		// Act:
+		cache.modifier().add(CreateTransactionInfoWithFeeMultiplier(8, 0, Timestamp(10)));
+
+		// Assert:
+		EXPECT_EQ(std::vector<Timestamp::ValueType>({ 10, 2 }), ExtractRawDeadlinesByFee(cache));
+	}
+
+	// endregion
+
 	// region shortHashes
 
 	TEST(TEST_CLASS, ShortHashesReturnsAllShortHashes) {
@@ -611,6 +727,166 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region transactions
+
+	TEST(TEST_CLASS, TransactionsReturnsNoTransactionsIfNoHashesAreRequested) {
+		// Arrange:
+		auto pCache = PrepareCache(5);
+
+		// Act:
+		auto transactions = pCache->view().transactions({});
+
+		// Assert:
+		EXPECT_TRUE(transactions.empty());
+	}
+
+	TEST(TEST_CLASS, TransactionsReturnsAllTransactionsWithRequestedHashes) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// - request some known hashes together with unknown hashes
+		utils::HashSet hashes{
+			transactionInfos[3].EntityHash,
+			test::GenerateRandomData<Hash256_Size>(),
+			transactionInfos[0].EntityHash,
+			transactionInfos[4].EntityHash,
+			test::GenerateRandomData<Hash256_Size>()
+		};
+
+		// Act:
+		auto transactions = cache.view().transactions(hashes);
+
+		// Assert:
+		std::set<Timestamp::ValueType> rawDeadlines;
+		for (const auto& pTransaction : transactions)
+			rawDeadlines.insert(pTransaction->Deadline.unwrap());
+
+		EXPECT_EQ(3u, transactions.size());
+		EXPECT_EQ(std::set<Timestamp::ValueType>({ 1, 4, 5 }), rawDeadlines);
+	}
+
+	TEST(TEST_CLASS, TransactionsReturnsTransactionsWithTotalSizeOfAtMostMaxResponseSize) {
+		// Arrange:
+		auto transactionSize = test::CreateTransactionInfos(1)[0].pEntity->Size;
+		MemoryUtCache cache(MemoryCacheOptions(3 * transactionSize - 1, 1000));
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		utils::HashSet hashes;
+		for (const auto& transactionInfo : transactionInfos)
+			hashes.insert(transactionInfo.EntityHash);
+
+		// Act:
+		auto transactions = cache.view().transactions(hashes);
+
+		// Assert:
+		EXPECT_EQ(2u, transactions.size());
+		EXPECT_GE(3 * transactionSize - 1, test::TotalSize(transactions));
+	}
+
+	// endregion
+
+	// region sketch
+
+	namespace {
+		constexpr uint32_t Num_Sketch_Cells = 3 * 64;
+
+		std::vector<Hash256> DecodeSketch(const UtSketch& sketch) {
+			std::vector<Hash256> positiveKeys;
+			std::vector<Hash256> negativeKeys;
+			EXPECT_TRUE(sketch.decode(positiveKeys, negativeKeys));
+			EXPECT_TRUE(negativeKeys.empty());
+			return positiveKeys;
+		}
+
+		void AssertSketchContents(const MemoryUtCache& cache, const std::vector<Hash256>& expectedHashes) {
+			// Act:
+			auto sketch = cache.view().sketch(Num_Sketch_Cells);
+			auto hashes = DecodeSketch(sketch);
+
+			// Assert:
+			EXPECT_EQ(Num_Sketch_Cells, sketch.numCells());
+			EXPECT_EQ(utils::HashSet(expectedHashes.cbegin(), expectedHashes.cend()), utils::HashSet(hashes.cbegin(), hashes.cend()));
+		}
+	}
+
+	TEST(TEST_CLASS, SketchIsInitiallyEmpty) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+
+		// Act + Assert:
+		AssertSketchContents(cache, {});
+	}
+
+	TEST(TEST_CLASS, SketchContainsAllAddedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act + Assert:
+		AssertSketchContents(cache, test::ExtractHashes(transactionInfos));
+	}
+
+	TEST(TEST_CLASS, SketchExcludesRemovedTransactions) {
+		// Arrange:
+		MemoryUtCache cache(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		test::AddAll(cache, transactionInfos);
+
+		// Act:
+		{
+			auto modifier = cache.modifier();
+			modifier.remove(transactionInfos[1].EntityHash);
+			modifier.remove(transactionInfos[3].EntityHash);
+		}
+
+		// Assert:
+		AssertSketchContents(cache, { transactionInfos[0].EntityHash, transactionInfos[2].EntityHash, transactionInfos[4].EntityHash });
+	}
+
+	TEST(TEST_CLASS, SketchIsEmptyAfterRemoveAll) {
+		// Arrange:
+		auto pCache = PrepareCache(5);
+
+		// Act:
+		pCache->modifier().removeAll();
+
+		// Assert:
+		AssertSketchContents(*pCache, {});
+	}
+
+	TEST(TEST_CLASS, SketchDifferenceContainsOnlyMismatchedTransactions) {
+		// Arrange: caches share three transactions and each have one unique transaction
+		MemoryUtCache cache1(Default_Options);
+		MemoryUtCache cache2(Default_Options);
+		auto transactionInfos = test::CreateTransactionInfos(5);
+		for (auto i = 0u; i < transactionInfos.size(); ++i) {
+			if (4 != i)
+				cache1.modifier().add(transactionInfos[i]);
+
+			if (3 != i)
+				cache2.modifier().add(transactionInfos[i]);
+		}
+
+		// Act:
+		auto sketch = cache1.view().sketch(Num_Sketch_Cells);
+		sketch.subtract(cache2.view().sketch(Num_Sketch_Cells));
+
+		std::vector<Hash256> positiveKeys;
+		std::vector<Hash256> negativeKeys;
+		auto isDecoded = sketch.decode(positiveKeys, negativeKeys);
+
+		// Assert:
+		EXPECT_TRUE(isDecoded);
+		EXPECT_EQ(std::vector<Hash256>({ transactionInfos[3].EntityHash }), positiveKeys);
+		EXPECT_EQ(std::vector<Hash256>({ transactionInfos[4].EntityHash }), negativeKeys);
+	}
+
+	// endregion
+
 	// region max size
 
 	namespace {
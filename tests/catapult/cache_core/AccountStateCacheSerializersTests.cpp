@@ -0,0 +1,132 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_core/AccountStateCacheSerializers.h"
+#include "catapult/model/AccountInfo.h"
+#include "tests/test/core/AccountStateTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS AccountStateCacheSerializersTests
+
+	// region AccountStatePrimarySerializer
+
+	namespace {
+		std::shared_ptr<state::AccountState> CreateAccountState() {
+			auto pAccountState = std::make_shared<state::AccountState>(test::GenerateRandomData<Address_Decoded_Size>(), Height(123));
+			pAccountState->PublicKey = test::GenerateRandomData<Key_Size>();
+			pAccountState->PublicKeyHeight = Height(234);
+			test::RandomFillAccountData(5, *pAccountState, 3);
+			return pAccountState;
+		}
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerKeyIsAddress) {
+		// Arrange:
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+
+		// Act:
+		auto buffer = AccountStatePrimarySerializer::SerializeKey(address);
+
+		// Assert:
+		EXPECT_EQ(address.data(), buffer.pData);
+		EXPECT_EQ(Address_Decoded_Size, buffer.Size);
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCanRoundtripAccountState) {
+		// Arrange:
+		auto pOriginalAccountState = CreateAccountState();
+		auto value = AccountStatePrimarySerializer::SerializeValue(std::make_pair(pOriginalAccountState->Address, pOriginalAccountState));
+
+		// Act:
+		auto pAccountState = AccountStatePrimarySerializer::DeserializeValue({ reinterpret_cast<const uint8_t*>(value.data()), value.size() });
+
+		// Assert:
+		ASSERT_TRUE(!!pAccountState);
+		EXPECT_EQ(sizeof(model::AccountInfo) + 3 * sizeof(model::Mosaic), value.size());
+		EXPECT_EQ(3u, pAccountState->Balances.size());
+		test::AssertEqual(*pOriginalAccountState, *pAccountState);
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		auto pOriginalAccountState = CreateAccountState();
+		auto value = AccountStatePrimarySerializer::SerializeValue(std::make_pair(pOriginalAccountState->Address, pOriginalAccountState));
+
+		// Act + Assert:
+		auto pData = reinterpret_cast<const uint8_t*>(value.data());
+		EXPECT_THROW(AccountStatePrimarySerializer::DeserializeValue({ pData, sizeof(model::AccountInfo) - 1 }), catapult_runtime_error);
+		EXPECT_THROW(AccountStatePrimarySerializer::DeserializeValue({ pData, value.size() - 1 }), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, PrimarySerializerCannotDeserializeCorruptValue) {
+		// Arrange: corrupt the mosaics count
+		auto pOriginalAccountState = CreateAccountState();
+		auto value = AccountStatePrimarySerializer::SerializeValue(std::make_pair(pOriginalAccountState->Address, pOriginalAccountState));
+		reinterpret_cast<model::AccountInfo&>(value[0]).MosaicsCount = 2;
+
+		// Act + Assert:
+		auto pData = reinterpret_cast<const uint8_t*>(value.data());
+		EXPECT_THROW(AccountStatePrimarySerializer::DeserializeValue({ pData, value.size() }), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region AccountStateKeyLookupSerializer
+
+	TEST(TEST_CLASS, KeyLookupSerializerKeyIsPublicKey) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto buffer = AccountStateKeyLookupSerializer::SerializeKey(publicKey);
+
+		// Assert:
+		EXPECT_EQ(publicKey.data(), buffer.pData);
+		EXPECT_EQ(Key_Size, buffer.Size);
+	}
+
+	TEST(TEST_CLASS, KeyLookupSerializerCanRoundtripPair) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+		auto value = AccountStateKeyLookupSerializer::SerializeValue(std::make_pair(publicKey, std::make_pair(publicKey, address)));
+
+		// Act:
+		auto pair = AccountStateKeyLookupSerializer::DeserializeValue({ reinterpret_cast<const uint8_t*>(value.data()), value.size() });
+
+		// Assert:
+		EXPECT_EQ(Key_Size + Address_Decoded_Size, value.size());
+		EXPECT_EQ(publicKey, pair.first);
+		EXPECT_EQ(address, pair.second);
+	}
+
+	TEST(TEST_CLASS, KeyLookupSerializerCannotDeserializeValueWithInvalidSize) {
+		// Arrange:
+		std::vector<uint8_t> buffer(Key_Size + Address_Decoded_Size + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(AccountStateKeyLookupSerializer::DeserializeValue({ buffer.data(), buffer.size() - 2 }), catapult_runtime_error);
+		EXPECT_THROW(AccountStateKeyLookupSerializer::DeserializeValue({ buffer.data(), buffer.size() }), catapult_runtime_error);
+	}
+
+	// endregion
+}}
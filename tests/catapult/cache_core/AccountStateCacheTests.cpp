@@ -25,6 +25,7 @@
 #include "tests/test/cache/CacheMixinsTests.h"
 #include "tests/test/cache/DeltaElementsMixinTests.h"
 #include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 
 namespace catapult { namespace cache {
@@ -899,6 +900,55 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region prefetch
+
+	namespace {
+		template<typename TAction>
+		void RunPrefetchTest(const CacheConfiguration& config, TAction action) {
+			// Arrange: add accounts by address and by public key
+			AccountStateCache cache(config, Default_Cache_Options);
+			auto address = test::GenerateRandomAddress();
+			auto publicKey = test::GenerateRandomData<Key_Size>();
+			{
+				auto delta = cache.createDelta();
+				delta->addAccount(address, Height(123));
+				delta->addAccount(publicKey, Height(234));
+				cache.commit();
+			}
+
+			// Act:
+			auto delta = cache.createDelta();
+			delta->prefetch({ address, test::GenerateRandomAddress() }, { publicKey, test::GenerateRandomData<Key_Size>() });
+
+			// Assert: prefetching does not change cache contents
+			EXPECT_EQ(2u, delta->size());
+			action(*delta, address, publicKey);
+		}
+
+		void AssertPrefetchedAccounts(AccountStateCacheDelta& delta, const Address& address, const Key& publicKey) {
+			ASSERT_TRUE(!!delta.tryGet(address));
+			EXPECT_EQ(Height(123), delta.tryGet(address)->AddressHeight);
+
+			ASSERT_TRUE(!!delta.tryGet(publicKey));
+			EXPECT_EQ(Height(234), delta.tryGet(publicKey)->PublicKeyHeight);
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffectOnMemoryBasedCache) {
+		// Act + Assert:
+		RunPrefetchTest(CacheConfiguration(), AssertPrefetchedAccounts);
+	}
+
+	TEST(TEST_CLASS, PrefetchLoadsAccountsFromStorageBasedCache) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+
+		// Act + Assert:
+		RunPrefetchTest(CacheConfiguration("testdb"), AssertPrefetchedAccounts);
+	}
+
+	// endregion
+
 	// region highValueAddresses
 
 	namespace {
@@ -0,0 +1,152 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/CacheDatabase.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "tests/catapult/cache_db/test/RdbTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS CacheDatabaseTests
+
+	TEST(TEST_CLASS, CanCreateCacheDatabaseWithoutBackingDatabase) {
+		// Act:
+		CacheDatabase database;
+
+		// Assert:
+		EXPECT_FALSE(database.hasDatabase());
+		EXPECT_EQ(0u, database.options().HotEntryCacheSize);
+		EXPECT_THROW(database.database(), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheDatabaseWithBackingDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		RocksDatabaseOptions options;
+		options.HotEntryCacheSize = 7;
+
+		// Act:
+		CacheDatabase database("testdb", { { "default" }, { "alpha" }, { "beta" } }, options);
+
+		// Assert:
+		EXPECT_TRUE(database.hasDatabase());
+		EXPECT_EQ(7u, database.options().HotEntryCacheSize);
+	}
+
+	TEST(TEST_CLASS, CanAccessAllColumnsOfBackingDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		CacheDatabase database("testdb", { { "default" }, { "alpha" }, { "beta" } }, RocksDatabaseOptions());
+
+		// Act:
+		database.database().put(2, "hello", "amazing");
+
+		// Assert:
+		RdbDataIterator iter;
+		database.database().get(2, "hello", iter);
+		test::AssertIteratorValue("amazing", iter);
+	}
+
+	TEST(TEST_CLASS, ColumnIdsOfDedicatedDatabaseMatchColumnIndexes) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+
+		// Act:
+		CacheDatabase database("testdb", { { "default" }, { "alpha" }, { "beta" } }, RocksDatabaseOptions());
+
+		// Assert:
+		for (auto i = 0u; i < 3; ++i)
+			EXPECT_EQ(i, database.columnId(i)) << i;
+
+		EXPECT_THROW(database.columnId(3), catapult_invalid_argument);
+	}
+
+	// region shared database
+
+	TEST(TEST_CLASS, CanCreateCacheDatabasesAroundSharedDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		auto pDatabase = std::make_shared<RocksDatabase>("testdb", std::vector<RdbColumnFamily>(), RocksDatabaseOptions());
+
+		// Act:
+		CacheDatabase database1(pDatabase, "foo", { { "default" }, { "alpha" } }, RocksDatabaseOptions());
+		CacheDatabase database2(pDatabase, "bar", { { "default" }, { "alpha" }, { "beta" } }, RocksDatabaseOptions());
+
+		// Assert: each cache gets its own columns, none of which is the shared default column
+		EXPECT_TRUE(database1.hasDatabase());
+		EXPECT_EQ(pDatabase.get(), &database1.database());
+		EXPECT_EQ(1u, database1.columnId(0));
+		EXPECT_EQ(2u, database1.columnId(1));
+		EXPECT_THROW(database1.columnId(2), catapult_invalid_argument);
+
+		EXPECT_TRUE(database2.hasDatabase());
+		EXPECT_EQ(pDatabase.get(), &database2.database());
+		EXPECT_EQ(3u, database2.columnId(0));
+		EXPECT_EQ(4u, database2.columnId(1));
+		EXPECT_EQ(5u, database2.columnId(2));
+	}
+
+	TEST(TEST_CLASS, CacheDatabasesAroundSharedDatabaseDoNotShareColumns) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		auto pDatabase = std::make_shared<RocksDatabase>("testdb", std::vector<RdbColumnFamily>(), RocksDatabaseOptions());
+		CacheDatabase database1(pDatabase, "foo", { { "default" } }, RocksDatabaseOptions());
+		CacheDatabase database2(pDatabase, "bar", { { "default" } }, RocksDatabaseOptions());
+
+		// Act:
+		pDatabase->put(database1.columnId(0), "hello", "amazing");
+
+		// Assert:
+		RdbDataIterator iter1;
+		pDatabase->get(database1.columnId(0), "hello", iter1);
+		test::AssertIteratorValue("amazing", iter1);
+
+		RdbDataIterator iter2;
+		pDatabase->get(database2.columnId(0), "hello", iter2);
+		EXPECT_EQ(RdbDataIterator::End(), iter2);
+	}
+
+	TEST(TEST_CLASS, CanUseTunedColumnsOfSharedDatabase) {
+		// Arrange: enable bloom filters and prefix extractors
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		RocksDatabaseOptions options;
+		options.BloomFilterBitsPerKey = 10;
+		auto pDatabase = std::make_shared<RocksDatabase>("testdb", std::vector<RdbColumnFamily>(), options);
+		CacheDatabase database(pDatabase, "foo", { { "default", 5 }, { "alpha", 5, 2 } }, options);
+
+		// Act:
+		pDatabase->put(database.columnId(0), "hello", "amazing");
+		pDatabase->put(database.columnId(1), "world", "awesome");
+
+		// Assert:
+		RdbDataIterator iter1;
+		pDatabase->get(database.columnId(0), "hello", iter1);
+		test::AssertIteratorValue("amazing", iter1);
+
+		RdbDataIterator iter2;
+		pDatabase->get(database.columnId(1), "world", iter2);
+		test::AssertIteratorValue("awesome", iter2);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,394 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RdbCachedColumnContainer.h"
+#include "catapult/deltaset/BaseSetDefaultTraits.h"
+#include "tests/catapult/cache_db/test/RdbTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <cstring>
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RdbCachedColumnContainerTests
+
+	namespace {
+		struct TestValue {
+		public:
+			uint64_t Id;
+			uint32_t Data;
+		};
+
+		struct ColumnDescriptor {
+		public:
+			using KeyType = uint64_t;
+			using ValueType = TestValue;
+			using StorageType = std::pair<const KeyType, ValueType>;
+
+			static const KeyType& GetKeyFromElement(const StorageType& element) {
+				return element.first;
+			}
+
+			static KeyType GetKeyFromValue(const ValueType& value) {
+				return value.Id;
+			}
+
+			struct Serializer {
+			public:
+				static RawBuffer SerializeKey(const KeyType& key) {
+					return { reinterpret_cast<const uint8_t*>(&key), sizeof(KeyType) };
+				}
+
+				static std::string SerializeValue(const StorageType& element) {
+					std::string value(sizeof(uint64_t) + sizeof(uint32_t), 0);
+					std::memcpy(&value[0], &element.second.Id, sizeof(uint64_t));
+					std::memcpy(&value[sizeof(uint64_t)], &element.second.Data, sizeof(uint32_t));
+					return value;
+				}
+
+				static ValueType DeserializeValue(const RawBuffer& buffer) {
+					ValueType value;
+					std::memcpy(&value.Id, buffer.pData, sizeof(uint64_t));
+					std::memcpy(&value.Data, buffer.pData + sizeof(uint64_t), sizeof(uint32_t));
+					return value;
+				}
+			};
+		};
+
+		using ContainerType = RdbCachedColumnContainer<ColumnDescriptor>;
+		using MemorySetType = std::unordered_map<uint64_t, TestValue>;
+		using KeyTraits = deltaset::MapKeyTraits<MemorySetType>;
+
+		MemorySetType CreateElements(std::initializer_list<std::pair<uint64_t, uint32_t>> pairs) {
+			MemorySetType elements;
+			for (const auto& pair : pairs)
+				elements.emplace(pair.first, TestValue{ pair.first, pair.second });
+
+			return elements;
+		}
+
+		void Add(ContainerType& container, const MemorySetType& added) {
+			container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(added, MemorySetType(), MemorySetType()));
+		}
+
+		void Commit(ContainerType& container) {
+			Add(container, MemorySetType());
+		}
+
+		void AssertElement(const ContainerType& container, uint64_t key, uint32_t expectedData) {
+			auto iter = container.find(key);
+			ASSERT_NE(container.cend(), iter) << "key " << key;
+			EXPECT_EQ(key, iter->first) << "key " << key;
+			EXPECT_EQ(key, iter->second.Id) << "key " << key;
+			EXPECT_EQ(expectedData, iter->second.Data) << "key " << key;
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, ContainerIsInitiallyEmpty) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act:
+		ContainerType container(context.database(), 0, 10);
+
+		// Assert:
+		EXPECT_TRUE(container.empty());
+		EXPECT_EQ(0u, container.size());
+		EXPECT_EQ(0u, container.hotSize());
+		EXPECT_EQ(container.cend(), container.find(123));
+	}
+
+	TEST(TEST_CLASS, CanCreateContainerAroundCacheDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("testdb");
+		RocksDatabaseOptions options;
+		options.HotEntryCacheSize = 1;
+		CacheDatabase database("testdb", { { "default" }, { "alpha" } }, options);
+
+		// Act:
+		ContainerType container(database, 1);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+
+		// Assert: in-memory entries are limited by options
+		EXPECT_EQ(2u, container.size());
+		EXPECT_EQ(1u, container.hotSize());
+	}
+
+	// endregion
+
+	// region update / find
+
+	TEST(TEST_CLASS, CanFindAddedElements) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+
+		// Act:
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 }, { 3, 33 } }));
+
+		// Assert:
+		EXPECT_FALSE(container.empty());
+		EXPECT_EQ(3u, container.size());
+		EXPECT_EQ(3u, container.hotSize());
+		AssertElement(container, 1, 11);
+		AssertElement(container, 2, 22);
+		AssertElement(container, 3, 33);
+		EXPECT_EQ(container.cend(), container.find(4));
+	}
+
+	TEST(TEST_CLASS, CanFindPersistedElementsInNewContainer) {
+		// Arrange:
+		test::RdbTestContext context({});
+		{
+			ContainerType container(context.database(), 0, 10);
+			Add(container, CreateElements({ { 1, 11 }, { 2, 22 }, { 3, 33 } }));
+		}
+
+		// Act:
+		ContainerType container(context.database(), 0, 10);
+
+		// Assert: elements are loaded from the database on demand
+		EXPECT_EQ(3u, container.size());
+		EXPECT_EQ(0u, container.hotSize());
+		AssertElement(container, 1, 11);
+		AssertElement(container, 3, 33);
+		EXPECT_EQ(2u, container.hotSize());
+	}
+
+	TEST(TEST_CLASS, UpdateReplacesCopiedElements) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+		auto originalIter = container.find(1);
+
+		// Act:
+		auto copied = CreateElements({ { 1, 111 } });
+		container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(MemorySetType(), MemorySetType(), copied));
+
+		// Assert: previously found element is unchanged
+		EXPECT_EQ(2u, container.size());
+		EXPECT_EQ(11u, originalIter->second.Data);
+		AssertElement(container, 1, 111);
+		AssertElement(container, 2, 22);
+	}
+
+	TEST(TEST_CLASS, UpdateRemovesRemovedElements) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+
+		// Act:
+		auto removed = CreateElements({ { 1, 11 } });
+		container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(MemorySetType(), removed, MemorySetType()));
+
+		// Assert:
+		EXPECT_EQ(1u, container.size());
+		EXPECT_EQ(1u, container.hotSize());
+		EXPECT_EQ(container.cend(), container.find(1));
+		AssertElement(container, 2, 22);
+
+		// Sanity: element was also removed from the database
+		EXPECT_EQ(container.cend(), ContainerType(context.database(), 0, 10).find(1));
+	}
+
+	// endregion
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetchLoadsAllFoundElementsIntoMemory) {
+		// Arrange:
+		test::RdbTestContext context({});
+		{
+			ContainerType seedContainer(context.database(), 0, 10);
+			Add(seedContainer, CreateElements({ { 1, 11 }, { 2, 22 }, { 3, 33 } }));
+		}
+
+		ContainerType container(context.database(), 0, 10);
+
+		// Sanity:
+		EXPECT_EQ(0u, container.hotSize());
+
+		// Act: prefetch two existing elements, one unknown element and one duplicate
+		container.prefetch({ 1, 3, 4, 3 });
+
+		// Assert:
+		EXPECT_EQ(2u, container.hotSize());
+		AssertElement(container, 1, 11);
+		AssertElement(container, 3, 33);
+		EXPECT_EQ(container.cend(), container.find(4));
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotReplaceElementsInMemory) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+		auto iter1 = container.find(1);
+
+		// Act:
+		container.prefetch({ 1, 2 });
+
+		// Assert:
+		EXPECT_EQ(2u, container.hotSize());
+		EXPECT_EQ(iter1, container.find(1));
+	}
+
+	TEST(TEST_CLASS, PrefetchDoesNotLoadElementsPendingRemoval) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+		context.database().startPendingBatch();
+		auto removed = CreateElements({ { 1, 11 } });
+		container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(MemorySetType(), removed, MemorySetType()));
+
+		// Act:
+		container.prefetch({ 1 });
+
+		// Assert:
+		EXPECT_EQ(container.cend(), container.find(1));
+	}
+
+	// endregion
+
+	// region pending batch
+
+	TEST(TEST_CLASS, UpdateAddsChangesToPendingBatchWhenPresent) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+		context.database().startPendingBatch();
+
+		// Act:
+		auto removed = CreateElements({ { 1, 11 } });
+		container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(CreateElements({ { 3, 33 } }), removed, MemorySetType()));
+
+		// Assert: changes are visible via container
+		EXPECT_EQ(container.cend(), container.find(1));
+		AssertElement(container, 2, 22);
+		AssertElement(container, 3, 33);
+
+		// - but have not been written to the database
+		ContainerType container2(context.database(), 0, 10);
+		EXPECT_EQ(2u, container2.size());
+		AssertElement(container2, 1, 11);
+		EXPECT_EQ(container2.cend(), container2.find(3));
+	}
+
+	TEST(TEST_CLASS, PendingChangesAreWrittenWithPendingBatch) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 } }));
+		context.database().startPendingBatch();
+
+		auto removed = CreateElements({ { 1, 11 } });
+		container.update<KeyTraits>(deltaset::DeltaElements<MemorySetType>(CreateElements({ { 3, 33 } }), removed, MemorySetType()));
+
+		// Act:
+		context.database().writePendingBatch();
+
+		// Assert:
+		EXPECT_EQ(2u, container.size());
+		EXPECT_EQ(container.cend(), container.find(1));
+		AssertElement(container, 2, 22);
+		AssertElement(container, 3, 33);
+
+		ContainerType container2(context.database(), 0, 10);
+		EXPECT_EQ(2u, container2.size());
+		EXPECT_EQ(container2.cend(), container2.find(1));
+		AssertElement(container2, 2, 22);
+		AssertElement(container2, 3, 33);
+	}
+
+	// endregion
+
+	// region hot entries
+
+	TEST(TEST_CLASS, RepeatedFindsReturnSameElement) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 10);
+		Add(container, CreateElements({ { 1, 11 } }));
+
+		// Act:
+		auto iter1 = container.find(1);
+		auto iter2 = container.find(1);
+
+		// Assert:
+		EXPECT_EQ(iter1, iter2);
+		EXPECT_EQ(&*iter1, &*iter2);
+	}
+
+	TEST(TEST_CLASS, FoundElementsAreRetainedUntilCommit) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 1);
+		Add(container, CreateElements({ { 1, 11 }, { 2, 22 }, { 3, 33 } }));
+
+		// Sanity:
+		EXPECT_EQ(1u, container.hotSize());
+
+		// Act: find all elements
+		std::vector<const TestValue*> values;
+		for (auto key : { 1u, 2u, 3u })
+			values.push_back(&container.find(key)->second);
+
+		// Assert: all found elements are retained, so pointers to them are still valid
+		EXPECT_EQ(3u, container.hotSize());
+		for (auto i = 0u; i < values.size(); ++i)
+			EXPECT_EQ(&container.find(i + 1)->second, values[i]) << i;
+
+		// Act: commit
+		Commit(container);
+
+		// Assert: in-memory entries are trimmed
+		EXPECT_EQ(1u, container.hotSize());
+	}
+
+	TEST(TEST_CLASS, LeastRecentlyUsedElementsAreEvictedOnCommit) {
+		// Arrange:
+		test::RdbTestContext context({});
+		ContainerType container(context.database(), 0, 2);
+		Add(container, CreateElements({ { 1, 11 } }));
+		Add(container, CreateElements({ { 2, 22 } }));
+
+		// - mark 1 as most recently used
+		auto iter1 = container.find(1);
+		auto iter2 = container.find(2);
+		container.find(1);
+
+		// Act:
+		Add(container, CreateElements({ { 3, 33 } }));
+
+		// Assert: 2 was evicted and reloaded, 1 is still in memory
+		EXPECT_EQ(2u, container.hotSize());
+		EXPECT_EQ(iter1, container.find(1));
+		EXPECT_NE(iter2, container.find(2));
+		AssertElement(container, 2, 22);
+	}
+
+	// endregion
+}}
@@ -92,6 +92,28 @@ namespace catapult { namespace cache {
 		test::AssertIteratorValue("world", iter);
 	}
 
+	TEST(TEST_CLASS, FindManyForwardsToMultiGet) {
+		// Arrange:
+		auto key1 = test::GenerateRandomData<10>();
+		auto key2 = test::GenerateRandomData<10>();
+		auto key3 = test::GenerateRandomData<10>();
+		test::RdbTestContext context({}, [&key1, &key3](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key1), "hello");
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key3), "world");
+		});
+		RdbColumnContainer container(context.database(), 0);
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		container.findMany({ key1, key2, key3 }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("hello", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("world", iters[2]);
+	}
+
 	TEST(TEST_CLASS, InsertForwardsToPut) {
 		// Arrange:
 		auto key = test::GenerateRandomData<10>();
@@ -123,4 +145,118 @@ namespace catapult { namespace cache {
 		container.find(key, iter);
 		EXPECT_EQ(RdbDataIterator::End(), iter);
 	}
+
+	// region batched operations
+
+	TEST(TEST_CLASS, BatchedSaveSizeUpdatesSizeAndWritesSizeToDbOnWrite) {
+		// Arrange:
+		test::RdbTestContext context({});
+		RdbColumnContainer container(context.database(), 0);
+		RdbWriteBatch batch;
+
+		// Act:
+		container.saveSize(batch, 0x12345678'90ABCDEFull);
+
+		// Assert: neither cached size nor db is updated until batch is written
+		EXPECT_EQ(0u, container.size());
+		EXPECT_EQ(0u, RdbColumnContainer(context.database(), 0).size());
+
+		context.database().write(batch);
+		EXPECT_EQ(0x12345678'90ABCDEFull, container.size());
+		EXPECT_EQ(0x12345678'90ABCDEFull, RdbColumnContainer(context.database(), 0).size());
+	}
+
+	TEST(TEST_CLASS, BatchedSaveSizeDoesNotUpdateSizeWhenBatchIsDiscarded) {
+		// Arrange:
+		test::RdbTestContext context({});
+		RdbColumnContainer container(context.database(), 0);
+		RdbWriteBatch batch;
+		container.saveSize(batch, 0x12345678'90ABCDEFull);
+
+		// Act:
+		batch.clear();
+		context.database().write(batch);
+
+		// Assert:
+		EXPECT_EQ(0u, container.size());
+		EXPECT_EQ(0u, RdbColumnContainer(context.database(), 0).size());
+	}
+
+	TEST(TEST_CLASS, BatchedInsertForwardsToPut) {
+		// Arrange:
+		auto key = test::GenerateRandomData<10>();
+		test::RdbTestContext context({});
+		RdbColumnContainer container(context.database(), 0);
+		RdbWriteBatch batch;
+
+		// Act:
+		container.insert(batch, key, "1234567890");
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+
+		context.database().write(batch);
+		container.find(key, iter);
+		test::AssertIteratorValue("1234567890", iter);
+	}
+
+	TEST(TEST_CLASS, BatchedRemoveForwardsToDel) {
+		// Arrange:
+		auto key = test::GenerateRandomData<10>();
+		test::RdbTestContext context({}, [&key](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], ToSlice(key), "world");
+		});
+		RdbColumnContainer container(context.database(), 0);
+		RdbWriteBatch batch;
+
+		// Act:
+		container.remove(batch, key);
+
+		// Assert:
+		RdbDataIterator iter;
+		container.find(key, iter);
+		test::AssertIteratorValue("world", iter);
+
+		context.database().write(batch);
+		container.find(key, iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	TEST(TEST_CLASS, BatchedPruneRemovesAllKeysBeforeEndKeyExceptSize) {
+		// Arrange:
+		test::RdbTestContext context({}, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "alpha", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "charlie", "fantastic");
+			db.Put(rocksdb::WriteOptions(), columns[0], "tango", "amazing");
+		});
+		RdbColumnContainer container(context.database(), 0);
+		container.saveSize(3);
+		RdbWriteBatch batch;
+
+		// Act: size is less than tango, so it is before the end key
+		std::vector<std::string> prunedKeys;
+		container.prune(batch, RawBuffer(reinterpret_cast<const uint8_t*>("tango"), 5), [&prunedKeys](const auto& key) {
+			prunedKeys.emplace_back(reinterpret_cast<const char*>(key.pData), key.Size);
+		});
+
+		// Assert: removals are only applied when batch is written and size is unchanged
+		EXPECT_EQ(std::vector<std::string>({ "alpha", "charlie" }), prunedKeys);
+		EXPECT_EQ(2u, batch.size());
+
+		context.database().write(batch);
+
+		RdbDataIterator iter;
+		for (const auto& key : { "alpha", "charlie" }) {
+			container.find(RawBuffer(reinterpret_cast<const uint8_t*>(key), std::strlen(key)), iter);
+			EXPECT_EQ(RdbDataIterator::End(), iter) << key;
+		}
+
+		container.find(RawBuffer(reinterpret_cast<const uint8_t*>("tango"), 5), iter);
+		test::AssertIteratorValue("amazing", iter);
+		EXPECT_EQ(3u, RdbColumnContainer(context.database(), 0).size());
+	}
+
+	// endregion
 }}
@@ -74,6 +74,10 @@ namespace catapult { namespace cache {
 				static ValueType DeserializeValue(const RawBuffer&) {
 					return { "world", 54321, 2.718281 };
 				}
+
+				static KeyType DeserializeKey(const RawBuffer& buffer) {
+					return "key" + std::to_string(buffer.Size);
+				}
 			};
 		};
 
@@ -110,6 +114,15 @@ namespace catapult { namespace cache {
 			RawBuffer Key;
 		};
 
+		struct PruneParamsType {
+		public:
+			PruneParamsType(const RawBuffer& endKey) : EndKey(endKey)
+			{}
+
+		public:
+			RawBuffer EndKey;
+		};
+
 		struct MockDb {
 		public:
 			explicit MockDb(bool isKeyFound = false) : IsKeyFound(isKeyFound)
@@ -135,6 +148,7 @@ namespace catapult { namespace cache {
 			test::ParamsCapture<InsertParamsType> InsertParams;
 			test::ParamsCapture<FindParamsType> FindParams;
 			test::ParamsCapture<RemoveParamsType> RemoveParams;
+			test::ParamsCapture<PruneParamsType> PruneParams;
 		};
 
 		// mock replacing RdbColumnContainer
@@ -162,11 +176,28 @@ namespace catapult { namespace cache {
 				return true;
 			}
 
+			bool findMany(const std::vector<RawBuffer>& keys, std::vector<RdbDataIterator>& iterators) {
+				iterators.resize(keys.size());
+				for (auto i = 0u; i < keys.size(); ++i)
+					m_db.find(keys[i], iterators[i]);
+
+				return true;
+			}
+
 			bool remove(const RawBuffer& key) {
 				m_db.RemoveParams.push(key);
 				return true;
 			}
 
+			void prune(RdbWriteBatch&, const RawBuffer& endKey, const consumer<const RawBuffer&>& consumer) {
+				m_db.PruneParams.push(endKey);
+
+				// simulate removal of two keys with different sizes
+				std::array<uint8_t, 5> buffer{};
+				consumer({ buffer.data(), 3 });
+				consumer({ buffer.data(), 5 });
+			}
+
 		private:
 			MockDb& m_db;
 		};
@@ -255,6 +286,26 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(&iter.dbIterator(), params.pIterator);
 	}
 
+	TEST(TEST_CLASS, FindManySerializesKeysAndForwardsToContainer) {
+		// Arrange:
+		MockDb db(true);
+		auto container = CreateContainer(db);
+
+		// Act:
+		std::vector<std::string> keys{ "hello", "world" };
+		auto iters = container.findMany(keys);
+
+		// Assert:
+		ASSERT_EQ(2u, db.FindParams.params().size());
+		ASSERT_EQ(2u, iters.size());
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& params = db.FindParams.params()[i];
+			EXPECT_EQ(MutatePointer(keys[i].data()), params.Key.pData) << "key at " << i;
+			EXPECT_EQ(MutateSize(keys[i].size()), params.Key.Size) << "key at " << i;
+			EXPECT_NE(container.cend(), iters[i]) << "key at " << i;
+		}
+	}
+
 	TEST(TEST_CLASS, RemoveSerializesKeyAndForwardsToContainer) {
 		// Arrange:
 		MockDb db;
@@ -271,6 +322,25 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(MutateSize(key.size()), params.Key.Size);
 	}
 
+	TEST(TEST_CLASS, PruneSerializesKeyAndDeserializesPrunedKeys) {
+		// Arrange:
+		MockDb db;
+		auto container = CreateContainer(db);
+		RdbWriteBatch batch;
+
+		// Act:
+		std::string key = "hello";
+		auto prunedKeys = container.prune(batch, key);
+
+		// Assert:
+		ASSERT_EQ(1u, db.PruneParams.params().size());
+		const auto& params = db.PruneParams.params()[0];
+		EXPECT_EQ(MutatePointer(key.data()), params.EndKey.pData);
+		EXPECT_EQ(MutateSize(key.size()), params.EndKey.Size);
+
+		EXPECT_EQ(std::vector<std::string>({ "key3", "key5" }), prunedKeys);
+	}
+
 	TEST(TEST_CLASS, CendReturnsUnitializedIterator) {
 		// Arrange:
 		MockDb db;
@@ -0,0 +1,63 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabaseCounters.h"
+#include "catapult/cache_db/RocksInclude.h"
+#include "catapult/cache_db/RocksDatabase.h"
+#include "tests/catapult/cache_db/test/RdbTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksDatabaseCountersTests
+
+	TEST(TEST_CLASS, CanAddDatabaseCounters) {
+		// Arrange:
+		test::RdbTestContext context({});
+		std::vector<utils::DiagnosticCounter> counters;
+
+		// Act:
+		AddRocksDatabaseCounters(counters, context.database());
+
+		// Assert:
+		ASSERT_EQ(4u, counters.size());
+		EXPECT_EQ("RDB HIT RATE", counters[0].id().name());
+		EXPECT_EQ("RDB STALL US", counters[1].id().name());
+		EXPECT_EQ("RDB CMP READ", counters[2].id().name());
+		EXPECT_EQ("RDB CMP WRITE", counters[3].id().name());
+	}
+
+	TEST(TEST_CLASS, CountersAreZeroWhenStatisticsAreDisabled) {
+		// Arrange: statistics are disabled by default
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+
+		std::vector<utils::DiagnosticCounter> counters;
+		AddRocksDatabaseCounters(counters, database);
+
+		// Act + Assert:
+		for (const auto& counter : counters)
+			EXPECT_EQ(0u, counter.value()) << counter.id().name();
+	}
+}}
@@ -0,0 +1,133 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/RocksDatabaseOptions.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS RocksDatabaseOptionsTests
+
+	namespace {
+		template<typename T>
+		bool TryParseValueT(const std::string& str, T& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		}
+	}
+
+	TEST(TEST_CLASS, CanCreateDefaultOptions) {
+		// Act:
+		RocksDatabaseOptions options;
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize(), options.BlockCacheSize);
+		EXPECT_EQ(utils::FileSize(), options.WriteBufferSize);
+		EXPECT_EQ(0u, options.BloomFilterBitsPerKey);
+		EXPECT_EQ(RdbCompactionStyle::Level, options.CompactionStyle);
+		EXPECT_EQ(RdbCompressionType::None, options.Compression);
+		EXPECT_FALSE(options.ShouldEnableStatistics);
+		EXPECT_EQ(0u, options.HotEntryCacheSize);
+		EXPECT_TRUE(options.ColumnFamilyOptions.empty());
+	}
+
+	TEST(TEST_CLASS, CanParseValidCompactionStyles) {
+		// Assert:
+		test::AssertParse("Level", RdbCompactionStyle::Level, TryParseValueT<RdbCompactionStyle>);
+		test::AssertParse("Universal", RdbCompactionStyle::Universal, TryParseValueT<RdbCompactionStyle>);
+	}
+
+	TEST(TEST_CLASS, CannotParseFifoCompactionStyle) {
+		// Arrange:
+		auto compactionStyle = RdbCompactionStyle::Level;
+
+		// Act + Assert: fifo compaction deletes data, so it is not supported
+		EXPECT_FALSE(TryParseValue("Fifo", compactionStyle));
+		EXPECT_EQ(RdbCompactionStyle::Level, compactionStyle);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCompactionStyle) {
+		// Assert:
+		test::AssertEnumParseFailure("Universal", RdbCompactionStyle::Level, TryParseValueT<RdbCompactionStyle>);
+	}
+
+	TEST(TEST_CLASS, CanParseValidCompressionTypes) {
+		// Assert:
+		test::AssertParse("None", RdbCompressionType::None, TryParseValueT<RdbCompressionType>);
+		test::AssertParse("Snappy", RdbCompressionType::Snappy, TryParseValueT<RdbCompressionType>);
+		test::AssertParse("Lz4", RdbCompressionType::Lz4, TryParseValueT<RdbCompressionType>);
+		test::AssertParse("Zstd", RdbCompressionType::Zstd, TryParseValueT<RdbCompressionType>);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidCompressionType) {
+		// Assert:
+		test::AssertEnumParseFailure("Snappy", RdbCompressionType::None, TryParseValueT<RdbCompressionType>);
+	}
+
+	// region GetColumnFamilyOptions
+
+	namespace {
+		RocksDatabaseOptions CreateOptionsWithCustomColumnFamily() {
+			RocksDatabaseOptions options;
+			options.WriteBufferSize = utils::FileSize::FromMegabytes(64);
+			options.BloomFilterBitsPerKey = 10;
+			options.CompactionStyle = RdbCompactionStyle::Universal;
+			options.Compression = RdbCompressionType::Lz4;
+
+			RdbColumnFamilyOptions columnFamilyOptions;
+			columnFamilyOptions.WriteBufferSize = utils::FileSize::FromMegabytes(16);
+			columnFamilyOptions.BloomFilterBitsPerKey = 14;
+			columnFamilyOptions.CompactionStyle = RdbCompactionStyle::Level;
+			columnFamilyOptions.Compression = RdbCompressionType::Zstd;
+			options.ColumnFamilyOptions.emplace("AlphaCache:key_lookup", columnFamilyOptions);
+			return options;
+		}
+	}
+
+	TEST(TEST_CLASS, GetColumnFamilyOptionsReturnsDatabaseOptionsWhenColumnFamilyHasNoCustomOptions) {
+		// Arrange:
+		auto options = CreateOptionsWithCustomColumnFamily();
+
+		// Act:
+		auto columnFamilyOptions = GetColumnFamilyOptions(options, "AlphaCache:default");
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromMegabytes(64), columnFamilyOptions.WriteBufferSize);
+		EXPECT_EQ(10u, columnFamilyOptions.BloomFilterBitsPerKey);
+		EXPECT_EQ(RdbCompactionStyle::Universal, columnFamilyOptions.CompactionStyle);
+		EXPECT_EQ(RdbCompressionType::Lz4, columnFamilyOptions.Compression);
+	}
+
+	TEST(TEST_CLASS, GetColumnFamilyOptionsReturnsCustomOptionsWhenColumnFamilyHasCustomOptions) {
+		// Arrange:
+		auto options = CreateOptionsWithCustomColumnFamily();
+
+		// Act:
+		auto columnFamilyOptions = GetColumnFamilyOptions(options, "AlphaCache:key_lookup");
+
+		// Assert:
+		EXPECT_EQ(utils::FileSize::FromMegabytes(16), columnFamilyOptions.WriteBufferSize);
+		EXPECT_EQ(14u, columnFamilyOptions.BloomFilterBitsPerKey);
+		EXPECT_EQ(RdbCompactionStyle::Level, columnFamilyOptions.CompactionStyle);
+		EXPECT_EQ(RdbCompressionType::Zstd, columnFamilyOptions.Compression);
+	}
+
+	// endregion
+}}
@@ -329,4 +329,462 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region tuning options
+
+	namespace {
+		constexpr auto Fixed_Key_Size = 5u;
+
+		RocksDatabaseOptions CreateCustomOptions(RdbCompactionStyle compactionStyle) {
+			RocksDatabaseOptions options;
+			options.BlockCacheSize = utils::FileSize::FromMegabytes(8);
+			options.WriteBufferSize = utils::FileSize::FromMegabytes(4);
+			options.BloomFilterBitsPerKey = 10;
+			options.CompactionStyle = compactionStyle;
+			options.ShouldEnableStatistics = true;
+			return options;
+		}
+
+		void AssertCanUseDatabaseWithCustomOptions(RdbCompactionStyle compactionStyle) {
+			// Arrange: use fixed-size keys so that bloom filters and prefix extractors are enabled
+			rocksdb::DestroyDB("testdb", {});
+			test::TempDirectoryGuard dirGuard("testdb");
+			std::vector<RdbColumnFamily> columnFamilies{ { "beta", Fixed_Key_Size }, { "gamma", Fixed_Key_Size, 2 } };
+			RocksDatabase database("testdb", columnFamilies, CreateCustomOptions(compactionStyle));
+
+			// Act:
+			database.put(1, "hello", "amazing");
+			database.put(2, "hello", "awesome");
+			database.put(2, "world", "incredible");
+			database.del(2, "world");
+
+			// Assert:
+			auto iters = GetHelloKeyFromColumns(database, 3);
+			EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+			test::AssertIteratorValue("amazing", iters[1]);
+			test::AssertIteratorValue("awesome", iters[2]);
+
+			RdbDataIterator iter;
+			database.get(2, "world", iter);
+			EXPECT_EQ(RdbDataIterator::End(), iter);
+		}
+	}
+
+	TEST(TEST_CLASS, CanUseDatabaseWithCustomOptions_Level) {
+		AssertCanUseDatabaseWithCustomOptions(RdbCompactionStyle::Level);
+	}
+
+	TEST(TEST_CLASS, CanUseDatabaseWithCustomOptions_Universal) {
+		AssertCanUseDatabaseWithCustomOptions(RdbCompactionStyle::Universal);
+	}
+
+	TEST(TEST_CLASS, CanUseDatabaseWithCustomColumnFamilyOptions) {
+		// Arrange: tune one column differently from the others
+		rocksdb::DestroyDB("testdb", {});
+		test::TempDirectoryGuard dirGuard("testdb");
+		auto options = CreateCustomOptions(RdbCompactionStyle::Level);
+		RdbColumnFamilyOptions columnFamilyOptions;
+		columnFamilyOptions.WriteBufferSize = utils::FileSize::FromMegabytes(1);
+		columnFamilyOptions.BloomFilterBitsPerKey = 16;
+		columnFamilyOptions.CompactionStyle = RdbCompactionStyle::Universal;
+		options.ColumnFamilyOptions.emplace("gamma", columnFamilyOptions);
+
+		std::vector<RdbColumnFamily> columnFamilies{ { "beta", Fixed_Key_Size }, { "gamma", Fixed_Key_Size } };
+		RocksDatabase database("testdb", columnFamilies, options);
+
+		// Act:
+		database.put(1, "hello", "amazing");
+		database.put(2, "hello", "awesome");
+
+		// Assert:
+		auto iters = GetHelloKeyFromColumns(database, 3);
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("amazing", iters[1]);
+		test::AssertIteratorValue("awesome", iters[2]);
+	}
+
+	TEST(TEST_CLASS, StatisticsAreZeroWhenDisabled) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.put(0, "hello", "amazing");
+
+		// Act:
+		auto statistics = database.statistics();
+
+		// Assert:
+		EXPECT_EQ(0u, statistics.BlockCacheHits);
+		EXPECT_EQ(0u, statistics.BlockCacheMisses);
+		EXPECT_EQ(0u, statistics.StallMicros);
+		EXPECT_EQ(0u, statistics.CompactionReadBytes);
+		EXPECT_EQ(0u, statistics.CompactionWriteBytes);
+	}
+
+	// endregion
+
+	// region multi get
+
+	TEST(TEST_CLASS, CanReadMultipleKeysFromDb) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" }, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "other", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "world", "other", "hello" }, iters);
+
+		// Assert: 'other' is not found because it is in a different column
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanReadZeroKeysFromDb) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, CanReuseIteratorsWhenReadingMultipleKeysFromDb) {
+		// Arrange:
+		test::RdbTestContext context({}, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+		});
+		auto& database = context.database();
+
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "other" }, iters);
+
+		// Act:
+		database.multiGet(0, { "other", "world" }, iters);
+
+		// Assert:
+		ASSERT_EQ(2u, iters.size());
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+	}
+
+	// endregion
+
+	// region key iteration
+
+	namespace {
+		std::vector<std::string> GetKeysBefore(RocksDatabase& database, size_t columnId, const std::string& endKey) {
+			std::vector<std::string> keys;
+			database.forEachKeyBefore(columnId, endKey, [&keys](const auto& key) {
+				keys.push_back(key.ToString());
+			});
+			return keys;
+		}
+	}
+
+	TEST(TEST_CLASS, CanIterateOverKeysBeforeEndKeyInOrder) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" }, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[1], "delta", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "alpha", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "gamma", "incredible");
+			db.Put(rocksdb::WriteOptions(), columns[1], "charlie", "fantastic");
+			db.Put(rocksdb::WriteOptions(), columns[0], "bravo", "other");
+		});
+		auto& database = context.database();
+
+		// Act:
+		auto keys = GetKeysBefore(database, 1, "delta");
+
+		// Assert: end key is excluded and 'bravo' is not found because it is in a different column
+		EXPECT_EQ(std::vector<std::string>({ "alpha", "charlie" }), keys);
+	}
+
+	TEST(TEST_CLASS, CanIterateOverZeroKeysBeforeEndKey) {
+		// Arrange:
+		test::RdbTestContext context({}, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "delta", "amazing");
+		});
+		auto& database = context.database();
+
+		// Act:
+		auto keys = GetKeysBefore(database, 0, "charlie");
+
+		// Assert:
+		EXPECT_TRUE(keys.empty());
+	}
+
+	// endregion
+
+	// region write batch
+
+	TEST(TEST_CLASS, WriteBatchIsInitiallyEmpty) {
+		// Act:
+		RdbWriteBatch batch;
+
+		// Assert:
+		EXPECT_EQ(0u, batch.size());
+	}
+
+	TEST(TEST_CLASS, BatchedOperationsAreNotVisibleBeforeWrite) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" }, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+		});
+		auto& database = context.database();
+		RdbWriteBatch batch;
+
+		// Act:
+		database.put(batch, 0, "hello", "amazing");
+		database.del(batch, 1, "hello");
+
+		// Assert:
+		EXPECT_EQ(2u, batch.size());
+
+		auto iters = GetHelloKeyFromColumns(database, 2);
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+	}
+
+	TEST(TEST_CLASS, CanWriteBatchToDb_DifferentColumns) {
+		// Arrange:
+		test::RdbTestContext context({ "beta", "gamma" }, [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[2], "hello", "incredible");
+			db.Put(rocksdb::WriteOptions(), columns[2], "world", "fractured");
+		});
+		auto& database = context.database();
+		RdbWriteBatch batch;
+		database.put(batch, 0, "hello", "amazing");
+		database.put(batch, 1, "hello", "awesome");
+		database.del(batch, 2, "hello");
+
+		// Act:
+		database.write(batch);
+
+		// Assert: batch is cleared and all operations are applied
+		EXPECT_EQ(0u, batch.size());
+
+		auto iters = GetHelloKeyFromColumns(database, 3);
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[2]);
+
+		// Sanity: 'world' is left untouched
+		RdbDataIterator iter;
+		database.get(2, "world", iter);
+		test::AssertIteratorValue("fractured", iter);
+	}
+
+	TEST(TEST_CLASS, LaterBatchedOperationsOverrideEarlierOnes) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		RdbWriteBatch batch;
+		database.put(batch, 0, "hello", "amazing");
+		database.put(batch, 0, "world", "awesome");
+		database.del(batch, 0, "hello");
+		database.put(batch, 0, "world", "incredible");
+
+		// Act:
+		database.write(batch);
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+
+		AssertKeyValueColumn0(database, "world", "incredible");
+	}
+
+	TEST(TEST_CLASS, CanWriteEmptyBatch) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		RdbWriteBatch batch;
+
+		// Act + Assert: exception is not thrown
+		EXPECT_NO_THROW(database.write(batch));
+	}
+
+	TEST(TEST_CLASS, CompletionHandlersAreCalledOnlyAfterBatchIsWritten) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		RdbWriteBatch batch;
+		database.put(batch, 0, "hello", "amazing");
+
+		std::vector<std::string> values;
+		batch.addCompletionHandler([&database, &values]() {
+			RdbDataIterator iter;
+			database.get(0, "hello", iter);
+			values.push_back(RdbDataIterator::End() == iter ? "" : iter.storage().ToString());
+		});
+
+		// Sanity:
+		EXPECT_TRUE(values.empty());
+
+		// Act:
+		database.write(batch);
+		database.write(batch);
+
+		// Assert: handler was called once after the operations were applied
+		EXPECT_EQ(std::vector<std::string>({ "amazing" }), values);
+	}
+
+	TEST(TEST_CLASS, CompletionHandlersAreCalledWhenEmptyBatchIsWritten) {
+		// Arrange:
+		test::RdbTestContext context({});
+		RdbWriteBatch batch;
+
+		auto numCalls = 0u;
+		batch.addCompletionHandler([&numCalls]() { ++numCalls; });
+
+		// Act:
+		context.database().write(batch);
+
+		// Assert:
+		EXPECT_EQ(1u, numCalls);
+	}
+
+	TEST(TEST_CLASS, CompletionHandlersAreRemovedWhenBatchIsCleared) {
+		// Arrange:
+		test::RdbTestContext context({});
+		RdbWriteBatch batch;
+
+		auto numCalls = 0u;
+		batch.addCompletionHandler([&numCalls]() { ++numCalls; });
+
+		// Act:
+		batch.clear();
+		context.database().write(batch);
+
+		// Assert:
+		EXPECT_EQ(0u, numCalls);
+	}
+
+	// endregion
+
+	// region pending batch
+
+	TEST(TEST_CLASS, PendingBatchIsInitiallyNotPresent) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act + Assert:
+		EXPECT_FALSE(!!context.database().pendingBatch());
+	}
+
+	TEST(TEST_CLASS, CanStartPendingBatch) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act:
+		context.database().startPendingBatch();
+
+		// Assert:
+		ASSERT_TRUE(!!context.database().pendingBatch());
+		EXPECT_EQ(0u, context.database().pendingBatch()->size());
+	}
+
+	TEST(TEST_CLASS, StartingPendingBatchDiscardsPreviousPendingBatch) {
+		// Arrange:
+		test::RdbTestContext context({});
+		auto& database = context.database();
+		database.startPendingBatch();
+		database.put(*database.pendingBatch(), 0, "hello", "amazing");
+
+		// Act:
+		database.startPendingBatch();
+		database.writePendingBatch();
+
+		// Assert:
+		RdbDataIterator iter;
+		database.get(0, "hello", iter);
+		EXPECT_EQ(RdbDataIterator::End(), iter);
+	}
+
+	TEST(TEST_CLASS, CanWritePendingBatch) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		database.startPendingBatch();
+		database.put(*database.pendingBatch(), 0, "hello", "amazing");
+		database.put(*database.pendingBatch(), 1, "hello", "awesome");
+
+		// Sanity:
+		auto iters = GetHelloKeyFromColumns(database, 2);
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+
+		// Act:
+		database.writePendingBatch();
+
+		// Assert: all operations are applied and changes are no longer collected
+		EXPECT_FALSE(!!database.pendingBatch());
+
+		iters = GetHelloKeyFromColumns(database, 2);
+		test::AssertIteratorValue("amazing", iters[0]);
+		test::AssertIteratorValue("awesome", iters[1]);
+	}
+
+	TEST(TEST_CLASS, CannotWritePendingBatchWhenNotStarted) {
+		// Arrange:
+		test::RdbTestContext context({});
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().writePendingBatch(), catapult_runtime_error);
+	}
+
+	// endregion
+
+	// region add column family
+
+	TEST(TEST_CLASS, CanAddColumnFamilies) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+
+		// Act:
+		auto columnId1 = database.addColumnFamily({ "gamma", 32, 0 });
+		auto columnId2 = database.addColumnFamily({ "delta", 0, 0 });
+
+		// Assert:
+		EXPECT_EQ(2u, columnId1);
+		EXPECT_EQ(3u, columnId2);
+	}
+
+	TEST(TEST_CLASS, CanAccessAddedColumnFamilies) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+		auto& database = context.database();
+		auto columnId = database.addColumnFamily({ "gamma", 0, 0 });
+
+		// Act:
+		database.put(columnId, "hello", "amazing");
+
+		// Assert: only the added column contains the value
+		auto iters = GetHelloKeyFromColumns(database, 3);
+		EXPECT_EQ(RdbDataIterator::End(), iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CannotAddColumnFamilyWithExistingName) {
+		// Arrange:
+		test::RdbTestContext context({ "beta" });
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().addColumnFamily({ "beta", 0, 0 }), catapult_runtime_error);
+	}
+
+	// endregion
 }}
@@ -53,6 +53,10 @@ namespace catapult { namespace cache {
 					return { reinterpret_cast<const uint8_t*>(key.data()), key.size() };
 				}
 
+				static KeyType DeserializeKey(const RawBuffer& buffer) {
+					return std::string(reinterpret_cast<const char*>(buffer.pData), buffer.Size);
+				}
+
 				static std::string SerializeValue(const StorageType& element) {
 					std::ostringstream out;
 					const auto& value = element.second;
@@ -138,4 +142,121 @@ namespace catapult { namespace cache {
 	}
 
 	DEFINE_UPDATE_SET_TESTS(RdbStorageTraits)
+
+	// region batched update
+
+	TEST(TEST_CLASS, BatchedUpdateIsAppliedOnlyWhenBatchIsWritten) {
+		// Arrange:
+		RdbStorageTraits::TestContext context;
+		RdbStorageTraits::AddElement(context.Added, "eee", 7);
+		RdbStorageTraits::AddElement(context.Copied, "aaa", 1, 10);
+		RdbStorageTraits::AddElement(context.Removed, "ccc", 3);
+		RdbWriteBatch batch;
+
+		// Act:
+		UpdateSet<Types::StorageTraits::KeyTraits>(context.Set, context.deltas(), batch);
+
+		// Assert: db is not updated until batch is written
+		EXPECT_EQ(4u, batch.size());
+		EXPECT_EQ(3u, context.Set.size());
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "aaa", 1));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ccc", 3));
+		EXPECT_FALSE(RdbStorageTraits::Contains(context.Set, "eee", 7));
+
+		// Act:
+		context.Set.database().write(batch);
+
+		// Assert:
+		EXPECT_EQ(3u, context.Set.size());
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "aaa", 1, 10));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ddd", 2));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "eee", 7));
+		EXPECT_FALSE(RdbStorageTraits::Contains(context.Set, "ccc", 3));
+	}
+
+	// endregion
+
+	// region batched update with pruning
+
+	namespace {
+		using PruningBoundaryType = deltaset::PruningBoundary<Types::StorageTraits::StorageType>;
+
+		auto CreatePruningBoundary(const std::string& name) {
+			return PruningBoundaryType(std::make_pair(name, TestValue{ name, 0, 0 }));
+		}
+	}
+
+	TEST(TEST_CLASS, BatchedUpdateWithoutPruningBoundaryDoesNotPrune) {
+		// Arrange:
+		RdbStorageTraits::TestContext context;
+		RdbStorageTraits::AddElement(context.Added, "bbb", 7);
+		RdbWriteBatch batch;
+
+		// Act:
+		auto prunedKeys = UpdateSet<Types::StorageTraits::KeyTraits>(context.Set, context.deltas(), PruningBoundaryType(), batch);
+		context.Set.database().write(batch);
+
+		// Assert:
+		EXPECT_TRUE(prunedKeys.empty());
+		EXPECT_EQ(4u, context.Set.size());
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "aaa", 1));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "bbb", 7));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ccc", 3));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ddd", 2));
+	}
+
+	TEST(TEST_CLASS, BatchedUpdateWithPruningBoundaryPrunesAllElementsLessThanBoundary) {
+		// Arrange:
+		RdbStorageTraits::TestContext context;
+		RdbStorageTraits::AddElement(context.Added, "aab", 4);
+		RdbStorageTraits::AddElement(context.Added, "eee", 7);
+		RdbStorageTraits::AddElement(context.Copied, "aaa", 1, 10);
+		RdbStorageTraits::AddElement(context.Removed, "ddd", 2);
+		RdbWriteBatch batch;
+
+		// Act:
+		auto prunedKeys = UpdateSet<Types::StorageTraits::KeyTraits>(
+				context.Set,
+				context.deltas(),
+				CreatePruningBoundary("ccc"),
+				batch);
+
+		// Assert: db is not updated until batch is written
+		EXPECT_EQ(3u, context.Set.size());
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "aaa", 1));
+
+		// Act:
+		context.Set.database().write(batch);
+
+		// Assert: added element less than boundary is never inserted, but is reported as pruned
+		EXPECT_EQ(std::vector<std::string>({ "aab", "aaa" }), prunedKeys);
+		EXPECT_EQ(2u, context.Set.size());
+		EXPECT_FALSE(RdbStorageTraits::Contains(context.Set, "aaa", 1, 10));
+		EXPECT_FALSE(RdbStorageTraits::Contains(context.Set, "aab", 4));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ccc", 3));
+		EXPECT_FALSE(RdbStorageTraits::Contains(context.Set, "ddd", 2));
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "eee", 7));
+	}
+
+	TEST(TEST_CLASS, BatchedUpdateWithPruningBoundaryCountsPrunedRemovedElementsOnce) {
+		// Arrange:
+		RdbStorageTraits::TestContext context;
+		RdbStorageTraits::AddElement(context.Removed, "aaa", 1);
+		RdbWriteBatch batch;
+
+		// Act:
+		auto prunedKeys = UpdateSet<Types::StorageTraits::KeyTraits>(
+				context.Set,
+				context.deltas(),
+				CreatePruningBoundary("ddd"),
+				batch);
+		context.Set.database().write(batch);
+
+		// Assert:
+		EXPECT_EQ(std::vector<std::string>({ "aaa", "ccc" }), prunedKeys);
+		EXPECT_EQ(1u, context.Set.size());
+		EXPECT_TRUE(RdbStorageTraits::Contains(context.Set, "ddd", 2));
+	}
+
+	// endregion
 }}
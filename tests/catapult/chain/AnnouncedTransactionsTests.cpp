@@ -0,0 +1,236 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/AnnouncedTransactions.h"
+#include "tests/TestHarness.h"
+#include <unordered_set>
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS AnnouncedTransactionsTests
+
+	namespace {
+		AnnouncedTransactionsOptions CreateOptions() {
+			return { 10, 3, utils::TimeSpan::FromMilliseconds(100), utils::TimeSpan::FromMilliseconds(1000) };
+		}
+
+		model::HashRange ToRange(const std::vector<Hash256>& hashes) {
+			return model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+		}
+
+		using HashSet = std::unordered_set<Hash256, utils::ArrayHasher<Hash256>>;
+
+		HashSet ToSet(const std::vector<Hash256>& hashes) {
+			return HashSet(hashes.cbegin(), hashes.cend());
+		}
+
+		class TestContext {
+		public:
+			explicit TestContext(const AnnouncedTransactionsOptions& options = CreateOptions())
+					: m_announced(options, [&knownHashes = m_knownHashes](const auto& hash) {
+						return knownHashes.cend() != knownHashes.find(hash);
+					})
+			{}
+
+		public:
+			auto& announced() {
+				return m_announced;
+			}
+
+			void addKnown(const Hash256& hash) {
+				m_knownHashes.insert(hash);
+			}
+
+		private:
+			HashSet m_knownHashes;
+			AnnouncedTransactions m_announced;
+		};
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, TrackerIsInitiallyEmpty) {
+		// Act:
+		TestContext context;
+
+		// Assert:
+		EXPECT_EQ(0u, context.announced().size());
+	}
+
+	// endregion
+
+	// region add
+
+	TEST(TEST_CLASS, CanAddUnknownHashes) {
+		// Arrange:
+		TestContext context;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+
+		// Act:
+		auto numAdded = context.announced().add(test::GenerateRandomData<Key_Size>(), ToRange(hashes), Timestamp(10));
+
+		// Assert:
+		EXPECT_EQ(3u, numAdded);
+		EXPECT_EQ(3u, context.announced().size());
+	}
+
+	TEST(TEST_CLASS, AddIgnoresKnownAndPreviouslyAnnouncedHashes) {
+		// Arrange:
+		TestContext context;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(4);
+		context.addKnown(hashes[1]);
+		context.announced().add(test::GenerateRandomData<Key_Size>(), ToRange({ hashes[2] }), Timestamp(10));
+
+		// Act:
+		auto numAdded = context.announced().add(test::GenerateRandomData<Key_Size>(), ToRange(hashes), Timestamp(10));
+
+		// Assert:
+		EXPECT_EQ(2u, numAdded);
+		EXPECT_EQ(3u, context.announced().size());
+	}
+
+	TEST(TEST_CLASS, AddDoesNotTrackMoreThanMaxTransactions) {
+		// Arrange:
+		TestContext context;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(12);
+
+		// Act:
+		auto numAdded = context.announced().add(test::GenerateRandomData<Key_Size>(), ToRange(hashes), Timestamp(10));
+
+		// Assert:
+		EXPECT_EQ(10u, numAdded);
+		EXPECT_EQ(10u, context.announced().size());
+	}
+
+	// endregion
+
+	// region startRequest
+
+	TEST(TEST_CLASS, StartRequestReturnsOnlyHashesAnnouncedByPeer) {
+		// Arrange:
+		TestContext context;
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		context.announced().add(key1, ToRange({ hashes[0], hashes[1] }), Timestamp(10));
+		context.announced().add(key2, ToRange({ hashes[2] }), Timestamp(10));
+
+		// Act:
+		auto requestHashes = context.announced().startRequest(key1, Timestamp(20));
+
+		// Assert:
+		EXPECT_EQ(ToSet({ hashes[0], hashes[1] }), ToSet(requestHashes));
+	}
+
+	TEST(TEST_CLASS, StartRequestReturnsAtMostMaxHashesPerRequestAnnouncedFirst) {
+		// Arrange:
+		TestContext context;
+		auto key = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			context.announced().add(key, ToRange({ hashes[i] }), Timestamp(50 - 10 * i));
+
+		// Act:
+		auto requestHashes = context.announced().startRequest(key, Timestamp(60));
+
+		// Assert:
+		EXPECT_EQ(ToSet({ hashes[2], hashes[3], hashes[4] }), ToSet(requestHashes));
+	}
+
+	TEST(TEST_CLASS, StartRequestForgetsHashesThatBecameKnown) {
+		// Arrange:
+		TestContext context;
+		auto key = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		context.announced().add(key, ToRange(hashes), Timestamp(10));
+		context.addKnown(hashes[1]);
+
+		// Act:
+		auto requestHashes = context.announced().startRequest(key, Timestamp(20));
+
+		// Assert:
+		EXPECT_EQ(ToSet({ hashes[0], hashes[2] }), ToSet(requestHashes));
+		EXPECT_EQ(2u, context.announced().size());
+	}
+
+	TEST(TEST_CLASS, StartRequestDoesNotReturnHashesRequestedFromOtherPeerBeforeTimeout) {
+		// Arrange:
+		TestContext context;
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2);
+		context.announced().add(key1, ToRange(hashes), Timestamp(10));
+		context.announced().add(key2, ToRange(hashes), Timestamp(10));
+		context.announced().startRequest(key1, Timestamp(20));
+
+		// Act:
+		auto requestHashes1 = context.announced().startRequest(key2, Timestamp(119));
+		auto requestHashes2 = context.announced().startRequest(key2, Timestamp(120));
+
+		// Assert:
+		EXPECT_TRUE(requestHashes1.empty());
+		EXPECT_EQ(ToSet(hashes), ToSet(requestHashes2));
+	}
+
+	// endregion
+
+	// region completeRequest
+
+	TEST(TEST_CLASS, CompleteRequestForgetsHashesWithoutRemainingAnnouncers) {
+		// Arrange:
+		TestContext context;
+		auto key1 = test::GenerateRandomData<Key_Size>();
+		auto key2 = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		context.announced().add(key1, ToRange(hashes), Timestamp(10));
+		context.announced().add(key2, ToRange({ hashes[1] }), Timestamp(10));
+		auto requestHashes = context.announced().startRequest(key1, Timestamp(20));
+
+		// Act:
+		context.announced().completeRequest(key1, requestHashes);
+
+		// Assert: only the hash announced by key2 is still tracked
+		EXPECT_EQ(1u, context.announced().size());
+		EXPECT_TRUE(context.announced().startRequest(key1, Timestamp(200)).empty());
+		EXPECT_EQ(std::vector<Hash256>({ hashes[1] }), context.announced().startRequest(key2, Timestamp(200)));
+	}
+
+	// endregion
+
+	// region prune
+
+	TEST(TEST_CLASS, PruneForgetsHashesAnnouncedBeforeLifetime) {
+		// Arrange:
+		TestContext context;
+		auto key = test::GenerateRandomData<Key_Size>();
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		for (auto i = 0u; i < hashes.size(); ++i)
+			context.announced().add(key, ToRange({ hashes[i] }), Timestamp(100 * (i + 1)));
+
+		// Act:
+		context.announced().prune(Timestamp(1200));
+
+		// Assert:
+		EXPECT_EQ(2u, context.announced().size());
+		EXPECT_EQ(ToSet({ hashes[1], hashes[2] }), ToSet(context.announced().startRequest(key, Timestamp(1200))));
+	}
+
+	// endregion
+}}
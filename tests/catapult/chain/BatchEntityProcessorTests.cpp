@@ -30,12 +30,28 @@ namespace catapult { namespace chain {
 #define TEST_CLASS BatchEntityProcessorTests
 
 	namespace {
+		struct PrefetcherParams {
+		public:
+			size_t NumPublisherCalls;
+			size_t NumValidatorCalls;
+			size_t NumObserverCalls;
+			bool IsPassedMarkedCache;
+		};
+
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext() : m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
+			enum class PrefetchMode { Disabled, Enabled };
+
+		public:
+			explicit ProcessorTestContext(PrefetchMode prefetchMode = PrefetchMode::Disabled)
+					: m_processor(createProcessor(prefetchMode))
 			{}
 
 		public:
+			const auto& prefetcherParams() const {
+				return m_prefetcherParams;
+			}
+
 			const auto& statefulValidatorParams() const {
 				return m_executionConfig.pValidator->params();
 			}
@@ -146,9 +162,26 @@ namespace catapult { namespace chain {
 				assertObserverEntities(entityInfos);
 			}
 
+		private:
+			BatchEntityProcessor createProcessor(PrefetchMode prefetchMode) {
+				if (PrefetchMode::Enabled == prefetchMode) {
+					m_executionConfig.Config.Prefetcher = [this](const auto&, auto& cache) {
+						m_prefetcherParams.push_back(PrefetcherParams{
+							m_executionConfig.pNotificationPublisher->params().size(),
+							m_executionConfig.pValidator->params().size(),
+							m_executionConfig.pObserver->params().size(),
+							test::IsMarkedCache(cache)
+						});
+					};
+				}
+
+				return CreateBatchEntityProcessor(m_executionConfig.Config);
+			}
+
 		private:
 			test::MockExecutionConfiguration m_executionConfig;
 			state::CatapultState m_state;
+			std::vector<PrefetcherParams> m_prefetcherParams;
 			BatchEntityProcessor m_processor;
 		};
 
@@ -267,4 +300,46 @@ namespace catapult { namespace chain {
 		context.assertContexts(Height(248), Timestamp(725));
 		context.assertEntityInfos(entityInfos);
 	}
+
+	// region prefetch
+
+	TEST(TEST_CLASS, PrefetcherIsNotCalledForZeroEntities) {
+		// Arrange:
+		ProcessorTestContext context(ProcessorTestContext::PrefetchMode::Enabled);
+		model::WeakEntityInfos entityInfos;
+
+		// Act:
+		auto result = context.process(Height(246), Timestamp(721), entityInfos);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Neutral, result);
+		EXPECT_TRUE(context.prefetcherParams().empty());
+		context.assertCounters(0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, PrefetcherIsCalledOnceBeforeValidationAndObservation) {
+		// Arrange:
+		ProcessorTestContext context(ProcessorTestContext::PrefetchMode::Enabled);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		auto result = context.process(Height(247), Timestamp(723), entityInfos);
+
+		// Assert: prefetcher was called after all entities were published once but before any validator or observer call
+		EXPECT_EQ(ValidationResult::Success, result);
+		ASSERT_EQ(1u, context.prefetcherParams().size());
+
+		const auto& params = context.prefetcherParams()[0];
+		EXPECT_EQ(4u, params.NumPublisherCalls);
+		EXPECT_EQ(0u, params.NumValidatorCalls);
+		EXPECT_EQ(0u, params.NumObserverCalls);
+		EXPECT_TRUE(params.IsPassedMarkedCache);
+
+		// - each entity is published once (the recorded notifications are used for both prefetch and processing)
+		context.assertCounters(4, 8, 8);
+		context.assertContexts(Height(247), Timestamp(723));
+	}
+
+	// endregion
 }}
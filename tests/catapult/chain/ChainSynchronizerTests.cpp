@@ -23,6 +23,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -93,24 +94,32 @@ namespace catapult { namespace chain {
 			std::shared_ptr<MockPacketIo> pIo;
 			std::shared_ptr<MockChainApi> pChainApi;
 			size_t BlockRangeConsumerCalls;
+			std::vector<Hash256> ConsumedBlockHashes;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
 		};
 
 		enum class ConsumerMode { Normal, Full };
 
-		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
+		std::shared_ptr<MockChainApi> CreateLocalChainApi(const TestContext& context) {
 			auto pVerifiableBlock = test::GenerateVerifiableBlockAtHeight(Default_Height);
-			auto pLocal = std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock), context.LocalHashes);
+			return std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock), context.LocalHashes);
+		}
 
+		CompletionAwareBlockRangeConsumerFunc CreateBlockRangeConsumer(TestContext& context, ConsumerMode mode) {
 			auto& blockConsumerCalls = context.BlockRangeConsumerCalls;
-			auto blockRangeConsumer = [mode, &blockConsumerCalls, &context](const auto&, const auto& processingComplete) {
+			return [mode, &blockConsumerCalls, &context](const auto& range, const auto& processingComplete) {
 				++blockConsumerCalls;
+				for (const auto& block : range)
+					context.ConsumedBlockHashes.push_back(CalculateHash(block));
+
 				context.ProcessingComplete = processingComplete;
 				return ConsumerMode::Normal == mode ? blockConsumerCalls : 0;
 			};
+		}
 
-			return CreateChainSynchronizer(pLocal, context.Config, blockRangeConsumer);
+		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
+			return CreateChainSynchronizer(CreateLocalChainApi(context), context.Config, CreateBlockRangeConsumer(context, mode));
 		}
 
 		void AssertSync(const TestContext& context, size_t numBlockConsumerCalls) {
@@ -325,6 +334,283 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region hash-first synchronization
+
+	namespace {
+		constexpr Height Hash_First_Start_Height(Default_Height);
+
+		class HashFirstTestContext {
+		public:
+			HashFirstTestContext(size_t numBlocks, size_t numDownloadPeers, size_t forkDepth = 0)
+					: m_context(CreateDefaultTestContext(9 - forkDepth, 10, forkDepth)) {
+				// common block has height 19 - forkDepth, so blocks are pulled starting at height 20 - forkDepth
+				auto startHeight = Hash_First_Start_Height - Height(forkDepth);
+				std::vector<Hash256> hashes;
+				for (auto i = 0u; i < numBlocks; ++i) {
+					m_blocks.push_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+					hashes.push_back(CalculateHash(*m_blocks.back()));
+				}
+
+				m_hashes = hashes;
+				auto hashRange = HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+				m_context.pChainApi->setHashesFrom(startHeight, hashRange);
+				addBlocks(*m_context.pChainApi);
+
+				for (auto i = 0u; i < numDownloadPeers; ++i) {
+					m_downloadPeers.push_back(std::make_shared<MockChainApi>(ChainScore(11), Default_Height));
+					addBlocks(*m_downloadPeers.back());
+				}
+			}
+
+		public:
+			auto& context() {
+				return m_context;
+			}
+
+			auto& syncedPeer() {
+				return *m_context.pChainApi;
+			}
+
+			auto& downloadPeer(size_t index) {
+				return *m_downloadPeers[index];
+			}
+
+			void removeDownloadPeerBlocks(size_t index) {
+				m_downloadPeers[index] = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+			}
+
+			std::vector<Hash256> hashes(size_t count) const {
+				return std::vector<Hash256>(m_hashes.cbegin(), m_hashes.cbegin() + static_cast<int64_t>(count));
+			}
+
+		public:
+			NodeInteractionResult sync() {
+				auto downloadPeers = m_downloadPeers;
+				auto synchronizer = CreateChainSynchronizer(
+						CreateLocalChainApi(m_context),
+						m_context.Config,
+						[downloadPeers]() {
+							return std::vector<std::shared_ptr<const api::RemoteChainApi>>(downloadPeers.cbegin(), downloadPeers.cend());
+						},
+						CreateBlockRangeConsumer(m_context, ConsumerMode::Normal));
+				return synchronizer(*m_context.pChainApi).get();
+			}
+
+		private:
+			void addBlocks(MockChainApi& chainApi) {
+				for (const auto& pBlock : m_blocks)
+					chainApi.addBlock(test::CopyBlock(*pBlock));
+			}
+
+		private:
+			TestContext m_context;
+			std::vector<std::unique_ptr<Block>> m_blocks;
+			std::vector<Hash256> m_hashes;
+			std::vector<std::shared_ptr<MockChainApi>> m_downloadPeers;
+		};
+
+		void AssertBlocksFromRequest(
+				const MockChainApi& chainApi,
+				Height expectedHeight,
+				uint32_t expectedNumBlocks,
+				uint32_t expectedNumBytes = 23) {
+			ASSERT_EQ(1u, chainApi.blocksFromRequests().size());
+			const auto& params = chainApi.blocksFromRequests()[0];
+			EXPECT_EQ(expectedHeight, params.first);
+			EXPECT_EQ(expectedNumBlocks, params.second.NumBlocks);
+			EXPECT_EQ(expectedNumBytes, params.second.NumBytes);
+		}
+	}
+
+	TEST(TEST_CLASS, HashFirst_CanPullAllBlocksFromSyncedPeer) {
+		// Arrange:
+		HashFirstTestContext context(9, 0);
+		context.syncedPeer().setNumBlocksPerBlocksFromRequest({ 9 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(std::vector<Height>({ Height(11), Hash_First_Start_Height }), context.syncedPeer().hashesFromRequests());
+		AssertBlocksFromRequest(context.syncedPeer(), Hash_First_Start_Height, 9);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(context.hashes(9), context.context().ConsumedBlockHashes);
+	}
+
+	TEST(TEST_CLASS, HashFirst_CanPullDisjointRangesFromMultiplePeers) {
+		// Arrange:
+		HashFirstTestContext context(9, 2);
+		for (auto* pChainApi : { &context.syncedPeer(), &context.downloadPeer(0), &context.downloadPeer(1) })
+			pChainApi->setNumBlocksPerBlocksFromRequest({ 3 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: all blocks are consumed in order by a single consumer call and the byte budget is split across the ranges
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertBlocksFromRequest(context.syncedPeer(), Height(20), 3, 7);
+		AssertBlocksFromRequest(context.downloadPeer(0), Height(23), 3, 7);
+		AssertBlocksFromRequest(context.downloadPeer(1), Height(26), 3, 7);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(context.hashes(9), context.context().ConsumedBlockHashes);
+	}
+
+	TEST(TEST_CLASS, HashFirst_DoesNotUseMoreDownloadPeersThanBlocks) {
+		// Arrange:
+		HashFirstTestContext context(2, 3);
+		context.syncedPeer().setNumBlocksPerBlocksFromRequest({ 1 });
+		context.downloadPeer(0).setNumBlocksPerBlocksFromRequest({ 1 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertBlocksFromRequest(context.syncedPeer(), Height(20), 1, 11);
+		AssertBlocksFromRequest(context.downloadPeer(0), Height(21), 1, 11);
+		EXPECT_TRUE(context.downloadPeer(1).blocksFromRequests().empty());
+		EXPECT_TRUE(context.downloadPeer(2).blocksFromRequests().empty());
+		EXPECT_EQ(context.hashes(2), context.context().ConsumedBlockHashes);
+	}
+
+	TEST(TEST_CLASS, HashFirst_DoesNotPullMoreBlocksThanCanBeRolledBack) {
+		// Arrange: rewrite limit is 9
+		HashFirstTestContext context(12, 0);
+		context.syncedPeer().setNumBlocksPerBlocksFromRequest({ 9 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertBlocksFromRequest(context.syncedPeer(), Hash_First_Start_Height, 9);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(context.hashes(9), context.context().ConsumedBlockHashes);
+	}
+
+	TEST(TEST_CLASS, HashFirst_NeutralInteractionIfSyncedPeerReturnsNoHashes) {
+		// Arrange:
+		HashFirstTestContext context(0, 2);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_TRUE(context.syncedPeer().blocksFromRequests().empty());
+		EXPECT_TRUE(context.downloadPeer(0).blocksFromRequests().empty());
+		context.context().assertNoCalls();
+	}
+
+	TEST(TEST_CLASS, HashFirst_FailedInteractionIfSyncedPeerReturnsException) {
+		// Arrange:
+		HashFirstTestContext context(9, 2);
+		context.syncedPeer().setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert: download peers are queried in parallel but their blocks cannot be consumed
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_EQ(1u, context.downloadPeer(0).blocksFromRequests().size());
+		EXPECT_EQ(1u, context.downloadPeer(1).blocksFromRequests().size());
+		context.context().assertNoCalls();
+	}
+
+	TEST(TEST_CLASS, HashFirst_FailedInteractionIfSyncedPeerReturnsUnexpectedBlocks) {
+		// Arrange: the synced peer returns random blocks that do not match its hashes
+		HashFirstTestContext context(9, 0);
+		context.syncedPeer().setHashesFrom(Hash_First_Start_Height, test::GenerateRandomHashes(9));
+		context.syncedPeer().setNumBlocksPerBlocksFromRequest({ 9 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		context.context().assertNoCalls();
+	}
+
+	namespace {
+		template<typename TArrange>
+		void AssertOnlyContiguousBlocksAreConsumed(size_t numExpectedBlocks, TArrange arrange) {
+			// Arrange:
+			HashFirstTestContext context(9, 2);
+			for (auto* pChainApi : { &context.syncedPeer(), &context.downloadPeer(0), &context.downloadPeer(1) })
+				pChainApi->setNumBlocksPerBlocksFromRequest({ 3 });
+
+			arrange(context);
+
+			// Act:
+			auto result = context.sync();
+
+			// Assert:
+			EXPECT_EQ(NodeInteractionResult::Success, result);
+			AssertSync(context.context(), 1);
+			EXPECT_EQ(context.hashes(numExpectedBlocks), context.context().ConsumedBlockHashes);
+		}
+	}
+
+	TEST(TEST_CLASS, HashFirst_OnlyContiguousBlocksAreConsumedIfDownloadPeerReturnsException) {
+		// Assert: blocks returned by the second download peer are discarded
+		AssertOnlyContiguousBlocksAreConsumed(3, [](auto& context) {
+			context.downloadPeer(0).setError(MockChainApi::EntryPoint::Blocks_From);
+		});
+	}
+
+	TEST(TEST_CLASS, HashFirst_OnlyContiguousBlocksAreConsumedIfDownloadPeerReturnsUnexpectedBlocks) {
+		// Assert: blocks returned by the second download peer are discarded
+		AssertOnlyContiguousBlocksAreConsumed(3, [](auto& context) {
+			context.removeDownloadPeerBlocks(0);
+			context.downloadPeer(0).setNumBlocksPerBlocksFromRequest({ 3 });
+		});
+	}
+
+	TEST(TEST_CLASS, HashFirst_OnlyContiguousBlocksAreConsumedIfDownloadPeerReturnsPartialRange) {
+		// Assert: partial range is consumed but blocks returned by the second download peer are discarded
+		AssertOnlyContiguousBlocksAreConsumed(5, [](auto& context) {
+			context.downloadPeer(0).setNumBlocksPerBlocksFromRequest({ 2 });
+		});
+	}
+
+	TEST(TEST_CLASS, HashFirst_SuccessfulInteractionIfContiguousBlocksCoverForkDepth) {
+		// Arrange: common block has height 16 (fork depth 3)
+		HashFirstTestContext context(9, 2, 3);
+		for (auto* pChainApi : { &context.syncedPeer(), &context.downloadPeer(0), &context.downloadPeer(1) })
+			pChainApi->setNumBlocksPerBlocksFromRequest({ 3 });
+
+		context.downloadPeer(0).setError(MockChainApi::EntryPoint::Blocks_From);
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		AssertBlocksFromRequest(context.syncedPeer(), Height(17), 3, 7);
+		AssertSync(context.context(), 1);
+		EXPECT_EQ(context.hashes(3), context.context().ConsumedBlockHashes);
+	}
+
+	TEST(TEST_CLASS, HashFirst_FailedInteractionIfContiguousBlocksDoNotCoverForkDepth) {
+		// Arrange: common block has height 16 (fork depth 3) but the synced peer only returns two blocks
+		HashFirstTestContext context(9, 2, 3);
+		for (auto* pChainApi : { &context.downloadPeer(0), &context.downloadPeer(1) })
+			pChainApi->setNumBlocksPerBlocksFromRequest({ 3 });
+
+		context.syncedPeer().setNumBlocksPerBlocksFromRequest({ 2 });
+
+		// Act:
+		auto result = context.sync();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		AssertBlocksFromRequest(context.syncedPeer(), Height(17), 3, 7);
+		context.context().assertNoCalls();
+	}
+
+	// endregion
+
 	// region unprocessed elements
 
 	namespace {
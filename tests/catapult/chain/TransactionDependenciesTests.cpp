@@ -0,0 +1,237 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/chain/TransactionDependencies.h"
+#include "catapult/model/Address.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
+#include "tests/test/core/NotificationTestUtils.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace chain {
+
+#define TEST_CLASS TransactionDependenciesTests
+
+	namespace {
+		constexpr auto Network_Identifier = model::NetworkIdentifier::Mijin_Test;
+
+		model::NotificationType MakeNotificationType(model::NotificationChannel channel, model::FacilityCode facilityCode) {
+			return model::MakeNotificationType(channel, facilityCode, 0x0001);
+		}
+
+		TransactionDependencies CreateFromNotification(const model::Notification& notification) {
+			TransactionDependencies dependencies;
+			dependencies.add(notification, Network_Identifier);
+			return dependencies;
+		}
+
+		TransactionDependencies CreateFromAddress(const Address& address) {
+			TransactionDependencies dependencies;
+			dependencies.add(address);
+			return dependencies;
+		}
+
+		TransactionDependencies CreateFromMosaicTransfer(MosaicId mosaicId) {
+			auto sender = test::GenerateRandomData<Key_Size>();
+			auto recipient = test::GenerateRandomData<Address_Decoded_Size>();
+			return CreateFromNotification(model::BalanceTransferNotification(sender, recipient, mosaicId, Amount(100)));
+		}
+	}
+
+	// region empty
+
+	TEST(TEST_CLASS, DependenciesAreInitiallyEmpty) {
+		// Act:
+		TransactionDependencies dependencies;
+
+		// Assert:
+		EXPECT_TRUE(dependencies.empty());
+		EXPECT_FALSE(dependencies.affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, CoreNotificationsWithoutDependenciesAreIgnored) {
+		// Act:
+		auto dependencies = CreateFromNotification(model::EntityNotification(Network_Identifier));
+
+		// Assert:
+		EXPECT_TRUE(dependencies.empty());
+	}
+
+	// endregion
+
+	// region accounts
+
+	TEST(TEST_CLASS, AccountAddressNotificationAddsAddressDependency) {
+		// Arrange:
+		auto address = test::GenerateRandomData<Address_Decoded_Size>();
+
+		// Act:
+		auto dependencies = CreateFromNotification(model::AccountAddressNotification(address));
+
+		// Assert:
+		EXPECT_FALSE(dependencies.empty());
+		EXPECT_TRUE(CreateFromAddress(address).affects(dependencies));
+		EXPECT_FALSE(CreateFromAddress(test::GenerateRandomData<Address_Decoded_Size>()).affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, AccountPublicKeyNotificationAddsAddressDependency) {
+		// Arrange:
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto dependencies = CreateFromNotification(model::AccountPublicKeyNotification(publicKey));
+
+		// Assert: public keys are converted to addresses
+		EXPECT_TRUE(CreateFromAddress(model::PublicKeyToAddress(publicKey, Network_Identifier)).affects(dependencies));
+		EXPECT_FALSE(CreateFromAddress(model::PublicKeyToAddress(publicKey, model::NetworkIdentifier::Public)).affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, BalanceTransferNotificationAddsAccountAndMosaicDependencies) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+		auto recipient = test::GenerateRandomData<Address_Decoded_Size>();
+
+		// Act:
+		auto dependencies = CreateFromNotification(model::BalanceTransferNotification(sender, recipient, MosaicId(123), Amount(100)));
+
+		// Assert:
+		EXPECT_TRUE(CreateFromAddress(model::PublicKeyToAddress(sender, Network_Identifier)).affects(dependencies));
+		EXPECT_TRUE(CreateFromAddress(recipient).affects(dependencies));
+		EXPECT_TRUE(CreateFromMosaicTransfer(MosaicId(123)).affects(dependencies));
+		EXPECT_FALSE(CreateFromMosaicTransfer(MosaicId(124)).affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, BalanceReserveNotificationAddsAccountAndMosaicDependencies) {
+		// Arrange:
+		auto sender = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto dependencies = CreateFromNotification(model::BalanceReserveNotification(sender, MosaicId(123), Amount(100)));
+
+		// Assert:
+		EXPECT_TRUE(CreateFromAddress(model::PublicKeyToAddress(sender, Network_Identifier)).affects(dependencies));
+		EXPECT_TRUE(CreateFromMosaicTransfer(MosaicId(123)).affects(dependencies));
+	}
+
+	// endregion
+
+	// region facilities
+
+	TEST(TEST_CLASS, ObserverNotificationAffectsDependenciesReferencingSameFacility) {
+		// Arrange:
+		using model::NotificationChannel;
+		auto changes = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::Observer, model::FacilityCode::Lock)));
+
+		// Act + Assert:
+		for (auto channel : { NotificationChannel::Validator, NotificationChannel::Observer, NotificationChannel::All }) {
+			auto notification = test::CreateNotification(MakeNotificationType(channel, model::FacilityCode::Lock));
+			auto dependencies = CreateFromNotification(notification);
+
+			EXPECT_FALSE(dependencies.empty()) << utils::to_underlying_type(channel);
+			EXPECT_TRUE(changes.affects(dependencies)) << utils::to_underlying_type(channel);
+		}
+	}
+
+	TEST(TEST_CLASS, ObserverNotificationDoesNotAffectDependenciesReferencingOtherFacility) {
+		// Arrange:
+		using model::NotificationChannel;
+		auto changes = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::All, model::FacilityCode::Lock)));
+		auto dependencies = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::All, model::FacilityCode::Multisig)));
+
+		// Act + Assert:
+		EXPECT_FALSE(changes.affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, ValidatorNotificationDoesNotAffectDependenciesReferencingSameFacility) {
+		// Arrange: validator only notifications do not modify state
+		using model::NotificationChannel;
+		auto changes = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::Validator, model::FacilityCode::Lock)));
+		auto dependencies = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::All, model::FacilityCode::Lock)));
+
+		// Act + Assert:
+		EXPECT_FALSE(changes.affects(dependencies));
+	}
+
+	TEST(TEST_CLASS, MosaicAndNamespaceChangesAffectAllMosaicDependencies) {
+		// Arrange:
+		using model::NotificationChannel;
+		auto dependencies = CreateFromMosaicTransfer(MosaicId(123));
+
+		// Act + Assert:
+		for (auto facilityCode : { model::FacilityCode::Mosaic, model::FacilityCode::Namespace }) {
+			auto changes = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::All, facilityCode)));
+			EXPECT_TRUE(changes.affects(dependencies)) << utils::to_underlying_type(facilityCode);
+		}
+
+		auto lockChanges = CreateFromNotification(test::CreateNotification(MakeNotificationType(NotificationChannel::All, model::FacilityCode::Lock)));
+		EXPECT_FALSE(lockChanges.affects(dependencies));
+	}
+
+	// endregion
+
+	// region add
+
+	TEST(TEST_CLASS, CanAddAllDependencies) {
+		// Arrange:
+		auto address1 = test::GenerateRandomData<Address_Decoded_Size>();
+		auto address2 = test::GenerateRandomData<Address_Decoded_Size>();
+		auto dependencies = CreateFromAddress(address1);
+
+		// Act:
+		dependencies.add(CreateFromAddress(address2));
+		dependencies.add(CreateFromMosaicTransfer(MosaicId(123)));
+
+		// Assert:
+		EXPECT_TRUE(CreateFromAddress(address1).affects(dependencies));
+		EXPECT_TRUE(CreateFromAddress(address2).affects(dependencies));
+		EXPECT_TRUE(CreateFromMosaicTransfer(MosaicId(123)).affects(dependencies));
+	}
+
+	namespace {
+		class SignerPublisher : public model::NotificationPublisher {
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				const auto& transaction = entityInfo.cast<mocks::MockTransaction>().entity();
+				sub.notify(model::AccountPublicKeyNotification(transaction.Signer));
+				sub.notify(test::CreateNotification(mocks::Mock_Validator_1_Notification));
+			}
+		};
+	}
+
+	TEST(TEST_CLASS, CanAddAllDependenciesOfEntity) {
+		// Arrange:
+		auto pTransaction = mocks::CreateMockTransaction(0);
+		pTransaction->Version = model::MakeVersion(Network_Identifier, 1);
+		auto signerAddress = model::PublicKeyToAddress(pTransaction->Signer, Network_Identifier);
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		TransactionDependencies dependencies;
+
+		// Act:
+		dependencies.add(model::WeakEntityInfo(*pTransaction, hash), SignerPublisher());
+
+		// Assert: network of entity is used for address conversion
+		EXPECT_TRUE(CreateFromAddress(signerAddress).affects(dependencies));
+		EXPECT_TRUE(CreateFromNotification(test::CreateNotification(mocks::Mock_All_1_Notification)).affects(dependencies));
+	}
+
+	// endregion
+}}
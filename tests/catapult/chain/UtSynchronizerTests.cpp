@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/chain/UtSynchronizer.h"
+#include "catapult/chain/AnnouncedTransactions.h"
 #include "tests/catapult/chain/test/MockTransactionApi.h"
 #include "tests/test/core/TransactionTestUtils.h"
 #include "tests/test/other/EntitiesSynchronizerTestUtils.h"
@@ -88,4 +89,311 @@ namespace catapult { namespace chain {
 	}
 
 	DEFINE_ENTITIES_SYNCHRONIZER_TESTS(UtSynchronizer)
+
+	// region announced
+
+#define TEST_CLASS AnnouncedUtSynchronizerTests
+
+	namespace {
+		class AnnouncedTestContext {
+		public:
+			explicit AnnouncedTestContext(uint32_t numResponseTransactions)
+					: m_pAnnounced(std::make_shared<AnnouncedTransactions>(
+							AnnouncedTransactionsOptions{ 100, 10, utils::TimeSpan::FromSeconds(1), utils::TimeSpan::FromMinutes(1) },
+							[](const auto&) { return false; }))
+					, m_remotePublicKey(test::GenerateRandomData<Key_Size>())
+					, m_api(test::CreateTransactionEntityRange(numResponseTransactions))
+					, m_synchronizer(CreateAnnouncedUtSynchronizer(
+							m_pAnnounced,
+							[]() { return Timestamp(100); },
+							[&ranges = m_consumedRanges](auto&& range) { ranges.push_back(std::move(range)); }))
+			{}
+
+		public:
+			auto& announced() {
+				return *m_pAnnounced;
+			}
+
+			const auto& remotePublicKey() const {
+				return m_remotePublicKey;
+			}
+
+			auto& api() {
+				return m_api;
+			}
+
+			const auto& consumedRanges() const {
+				return m_consumedRanges;
+			}
+
+		public:
+			void announce(const std::vector<Hash256>& hashes) {
+				auto range = model::HashRange::CopyFixed(reinterpret_cast<const uint8_t*>(hashes.data()), hashes.size());
+				m_pAnnounced->add(m_remotePublicKey, range, Timestamp(90));
+			}
+
+			NodeInteractionResult synchronize() {
+				return m_synchronizer(m_api, m_remotePublicKey).get();
+			}
+
+		private:
+			std::shared_ptr<AnnouncedTransactions> m_pAnnounced;
+			Key m_remotePublicKey;
+			MockRemoteApi m_api;
+			std::vector<model::AnnotatedTransactionRange> m_consumedRanges;
+			AnnouncedUtSynchronizer m_synchronizer;
+		};
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenNoTransactionsHaveBeenAnnouncedByPeer) {
+		// Arrange:
+		AnnouncedTestContext context(3);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_TRUE(context.api().utByHashRequests().empty());
+		EXPECT_TRUE(context.consumedRanges().empty());
+	}
+
+	TEST(TEST_CLASS, SuccessInteractionWhenAnnouncedTransactionsArePulled) {
+		// Arrange:
+		AnnouncedTestContext context(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		context.announce(hashes);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		ASSERT_EQ(1u, context.api().utByHashRequests().size());
+		EXPECT_EQ(3u, context.api().utByHashRequests()[0].size());
+
+		ASSERT_EQ(1u, context.consumedRanges().size());
+		EXPECT_EQ(3u, context.consumedRanges()[0].Range.size());
+		EXPECT_EQ(context.remotePublicKey(), context.consumedRanges()[0].SourcePublicKey);
+
+		// - the peer is not asked again
+		EXPECT_EQ(0u, context.announced().size());
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenNoAnnouncedTransactionsArePulled) {
+		// Arrange:
+		AnnouncedTestContext context(0);
+		context.announce(test::GenerateRandomDataVector<Hash256>(3));
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_EQ(1u, context.api().utByHashRequests().size());
+		EXPECT_TRUE(context.consumedRanges().empty());
+		EXPECT_EQ(0u, context.announced().size());
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenRemoteApiThrows) {
+		// Arrange:
+		AnnouncedTestContext context(3);
+		context.announce(test::GenerateRandomDataVector<Hash256>(3));
+		context.api().setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_By_Hash);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_EQ(1u, context.api().utByHashRequests().size());
+		EXPECT_TRUE(context.consumedRanges().empty());
+		EXPECT_EQ(0u, context.announced().size());
+	}
+
+	// endregion
+
+	// region sketch
+
+#undef TEST_CLASS
+#define TEST_CLASS UtSketchSynchronizerTests
+
+	namespace {
+		class SketchTestContext {
+		public:
+			explicit SketchTestContext(uint32_t numResponseTransactions)
+					: m_localSketch(cache::Max_Sketch_Num_Cells)
+					, m_remoteSketch(cache::Max_Sketch_Num_Cells)
+					, m_api(test::CreateTransactionEntityRange(numResponseTransactions))
+					, m_synchronizer(CreateUtSketchSynchronizer(
+							[&localSketch = m_localSketch](auto numCells) { return localSketch.fold(numCells); },
+							[]() { return model::ShortHashRange(); },
+							[&ranges = m_consumedRanges](auto&& range) { ranges.push_back(std::move(range)); }))
+			{}
+
+		public:
+			auto& api() {
+				return m_api;
+			}
+
+			const auto& consumedRanges() const {
+				return m_consumedRanges;
+			}
+
+		public:
+			void addLocal(const std::vector<Hash256>& hashes) {
+				for (const auto& hash : hashes)
+					m_localSketch.insert(hash);
+			}
+
+			void addRemote(const std::vector<Hash256>& hashes) {
+				for (const auto& hash : hashes)
+					m_remoteSketch.insert(hash);
+
+				m_api.setSketch(m_remoteSketch);
+			}
+
+			NodeInteractionResult synchronize() {
+				return m_synchronizer(m_api).get();
+			}
+
+		private:
+			cache::UtSketch m_localSketch;
+			cache::UtSketch m_remoteSketch;
+			MockRemoteApi m_api;
+			std::vector<model::AnnotatedTransactionRange> m_consumedRanges;
+			RemoteNodeSynchronizer<api::RemoteTransactionApi> m_synchronizer;
+		};
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenLocalAndRemoteTransactionsMatch) {
+		// Arrange:
+		SketchTestContext context(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		context.addLocal(hashes);
+		context.addRemote(hashes);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_EQ(std::vector<uint32_t>({ cache::Min_Sketch_Num_Cells }), context.api().utSketchRequests());
+		EXPECT_TRUE(context.api().utByHashRequests().empty());
+		EXPECT_TRUE(context.api().utRequests().empty());
+		EXPECT_TRUE(context.consumedRanges().empty());
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenOnlyLocalHasUnknownTransactions) {
+		// Arrange:
+		SketchTestContext context(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		context.addLocal(hashes);
+		context.addRemote({ hashes[0], hashes[2], hashes[4] });
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Neutral, result);
+		EXPECT_EQ(1u, context.api().utSketchRequests().size());
+		EXPECT_TRUE(context.api().utByHashRequests().empty());
+		EXPECT_TRUE(context.api().utRequests().empty());
+		EXPECT_TRUE(context.consumedRanges().empty());
+	}
+
+	TEST(TEST_CLASS, SuccessInteractionWhenRemoteHasUnknownTransactions) {
+		// Arrange:
+		SketchTestContext context(3);
+		auto sharedHashes = test::GenerateRandomDataVector<Hash256>(5);
+		auto remoteHashes = test::GenerateRandomDataVector<Hash256>(3);
+		context.addLocal(sharedHashes);
+		context.addLocal(test::GenerateRandomDataVector<Hash256>(2));
+		context.addRemote(sharedHashes);
+		context.addRemote(remoteHashes);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert: only hashes missing locally are requested
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(1u, context.api().utSketchRequests().size());
+		EXPECT_TRUE(context.api().utRequests().empty());
+
+		ASSERT_EQ(1u, context.api().utByHashRequests().size());
+		const auto& requestedHashes = context.api().utByHashRequests()[0];
+		EXPECT_EQ(utils::HashSet(remoteHashes.cbegin(), remoteHashes.cend()), utils::HashSet(requestedHashes.cbegin(), requestedHashes.cend()));
+
+		ASSERT_EQ(1u, context.consumedRanges().size());
+		EXPECT_EQ(3u, context.consumedRanges()[0].Range.size());
+	}
+
+	TEST(TEST_CLASS, SuccessInteractionWhenDifferenceCannotBeDecodedAndFallbackPullReturnsTransactions) {
+		// Arrange: difference is larger than the number of requested cells
+		SketchTestContext context(3);
+		context.addRemote(test::GenerateRandomDataVector<Hash256>(2 * cache::Min_Sketch_Num_Cells));
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Success, result);
+		EXPECT_EQ(1u, context.api().utSketchRequests().size());
+		EXPECT_TRUE(context.api().utByHashRequests().empty());
+		EXPECT_EQ(1u, context.api().utRequests().size());
+
+		ASSERT_EQ(1u, context.consumedRanges().size());
+		EXPECT_EQ(3u, context.consumedRanges()[0].Range.size());
+	}
+
+	TEST(TEST_CLASS, SketchSizeIsAdjustedToDifference) {
+		// Arrange:
+		SketchTestContext context(3);
+		auto hashes = test::GenerateRandomDataVector<Hash256>(2 * cache::Min_Sketch_Num_Cells);
+		context.addRemote(hashes);
+
+		// Act: sketch grows after decode failure and shrinks after difference disappears
+		context.synchronize();
+		context.synchronize();
+		context.addLocal(hashes);
+		context.synchronize();
+		context.synchronize();
+
+		// Assert:
+		auto minNumCells = cache::Min_Sketch_Num_Cells;
+		EXPECT_EQ(std::vector<uint32_t>({ minNumCells, 2 * minNumCells, 4 * minNumCells, minNumCells }), context.api().utSketchRequests());
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenSketchRequestThrows) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.addRemote(test::GenerateRandomDataVector<Hash256>(3));
+		context.api().setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_Sketch);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_TRUE(context.api().utByHashRequests().empty());
+		EXPECT_TRUE(context.api().utRequests().empty());
+		EXPECT_TRUE(context.consumedRanges().empty());
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenDifferenceRequestThrows) {
+		// Arrange:
+		SketchTestContext context(3);
+		context.addRemote(test::GenerateRandomDataVector<Hash256>(3));
+		context.api().setError(MockRemoteApi::EntryPoint::Unconfirmed_Transactions_By_Hash);
+
+		// Act:
+		auto result = context.synchronize();
+
+		// Assert:
+		EXPECT_EQ(NodeInteractionResult::Failure, result);
+		EXPECT_EQ(1u, context.api().utByHashRequests().size());
+		EXPECT_TRUE(context.consumedRanges().empty());
+	}
+
+	// endregion
 }}
@@ -22,6 +22,7 @@
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/MemoryUtCache.h"
 #include "catapult/chain/ChainResults.h"
+#include "catapult/chain/TransactionDependencies.h"
 #include "catapult/model/TransactionStatus.h"
 #include "tests/catapult/chain/test/MockExecutionConfiguration.h"
 #include "tests/test/cache/UtTestUtils.h"
@@ -433,6 +434,15 @@ namespace catapult { namespace chain {
 
 			// endregion
 
+		public:
+			size_t numValidatorCalls() const {
+				return m_executionConfig.pValidator->params().size();
+			}
+
+			size_t numObserverCalls() const {
+				return m_executionConfig.pObserver->params().size();
+			}
+
 		private:
 			test::MockExecutionConfiguration m_executionConfig;
 			cache::CatapultCache m_cache;
@@ -963,4 +973,162 @@ namespace catapult { namespace chain {
 	}
 
 	// endregion
+
+	// region update (block disruptor) - incremental revalidation
+
+	namespace {
+		TransactionDependencies CreateAddressDependencies() {
+			TransactionDependencies dependencies;
+			dependencies.add(test::GenerateRandomData<Address_Decoded_Size>());
+			return dependencies;
+		}
+
+		TransactionDependencies CreateMockNotificationDependencies() {
+			// mock notifications are published on all channels, so the mock facility is modified
+			TransactionDependencies dependencies;
+			dependencies.add(test::CreateNotification(static_cast<model::NotificationType>(-1)), model::NetworkIdentifier::Mijin_Test);
+			return dependencies;
+		}
+
+		struct IncrementalUpdateResult {
+			size_t NumValidatorCalls;
+			size_t NumObserverCalls;
+		};
+
+		IncrementalUpdateResult RunIncrementalUpdate(
+				UpdaterTestContext& context,
+				const std::vector<model::TransactionInfo>& utInfos,
+				const TransactionDependencies& changedDependencies) {
+			auto numValidatorCalls = context.numValidatorCalls();
+			auto numObserverCalls = context.numObserverCalls();
+			context.updater().update({}, utInfos, changedDependencies);
+			return { context.numValidatorCalls() - numValidatorCalls, context.numObserverCalls() - numObserverCalls };
+		}
+	}
+
+	TEST(TEST_CLASS, UnaffectedTransactionsAreReappliedWithoutRevalidation) {
+		// Arrange: add 3 (unexpired) transactions via the updater so that their dependencies are known
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 32);
+		context.updater().update(originalTransactionData.UtInfos);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateAddressDependencies());
+
+		// Assert: all transactions were kept and observed but none were validated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		EXPECT_EQ(0u, result.NumValidatorCalls);
+		EXPECT_EQ(6u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, AffectedTransactionsAreRevalidated) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 32);
+		context.updater().update(originalTransactionData.UtInfos);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateMockNotificationDependencies());
+
+		// Assert:
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		EXPECT_EQ(6u, result.NumValidatorCalls);
+		EXPECT_EQ(6u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, ExpiredTransactionsAreRevalidated) {
+		// Arrange: only the last transaction has a deadline (1024) after the current time (987)
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 30);
+		context.updater().update(originalTransactionData.UtInfos);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateAddressDependencies());
+
+		// Assert:
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		EXPECT_EQ(4u, result.NumValidatorCalls);
+		EXPECT_EQ(6u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, TransactionsWithUnknownDependenciesAreRevalidated) {
+		// Arrange: add 3 transactions directly to the cache so that their dependencies are unknown
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 32);
+		test::AddAll(context.transactionsCache(), originalTransactionData.UtInfos);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateAddressDependencies());
+
+		// Assert:
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		EXPECT_EQ(6u, result.NumValidatorCalls);
+		EXPECT_EQ(6u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, TransactionsAffectedByRevertedTransactionsAreRevalidated) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 32);
+		context.updater().update(originalTransactionData.UtInfos);
+
+		// - prepare 2 reverted transactions, which share the mock facility dependency with the original transactions
+		auto transactionData = CreateTransactionData(2, 40);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, transactionData.UtInfos, CreateAddressDependencies());
+
+		// Assert:
+		EXPECT_EQ(5u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), originalTransactionData.Hashes);
+		test::AssertContainsAll(context.transactionsCache(), transactionData.Hashes);
+		EXPECT_EQ(10u, result.NumValidatorCalls);
+		EXPECT_EQ(10u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, TransactionsFollowingDroppedTransactionAreRevalidated) {
+		// Arrange: the first two transactions are expired and the last one is not
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 30);
+		context.updater().update(originalTransactionData.UtInfos);
+
+		// - fail revalidation of the first (expired) transaction
+		context.setValidationResult(ValidationResult::Failure, originalTransactionData.Hashes[0], 1);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateAddressDependencies());
+
+		// Assert: the last transaction was revalidated because it shares the mock facility dependency with the dropped transaction
+		//   E[0] V0; E[1] V1,O1,V2,O2; E[2] V3,O3,V4,O4
+		EXPECT_EQ(2u, context.transactionsCache().view().size());
+		test::AssertContainsAll(context.transactionsCache(), Select(originalTransactionData.Hashes, { 1, 2 }));
+		EXPECT_EQ(5u, result.NumValidatorCalls);
+		EXPECT_EQ(4u, result.NumObserverCalls);
+	}
+
+	TEST(TEST_CLASS, DependenciesOfConfirmedTransactionsAreNotRetained) {
+		// Arrange:
+		UpdaterTestContext context;
+		auto originalTransactionData = CreateTransactionData(3, 32);
+		const auto& originalHashes = originalTransactionData.Hashes;
+		context.updater().update(originalTransactionData.UtInfos);
+		context.updater().update({ &originalHashes[1] }, {}, CreateAddressDependencies());
+
+		// - re-add the confirmed transaction directly to the cache
+		std::vector<model::TransactionInfo> confirmedTransactionInfos;
+		confirmedTransactionInfos.push_back(originalTransactionData.UtInfos[1].copy());
+		test::AddAll(context.transactionsCache(), confirmedTransactionInfos);
+
+		// Act:
+		auto result = RunIncrementalUpdate(context, {}, CreateAddressDependencies());
+
+		// Assert: only the re-added transaction (with unknown dependencies) was revalidated
+		EXPECT_EQ(3u, context.transactionsCache().view().size());
+		EXPECT_EQ(2u, result.NumValidatorCalls);
+		EXPECT_EQ(6u, result.NumObserverCalls);
+	}
+
+	// endregion
 }}
@@ -79,7 +79,14 @@ namespace catapult { namespace mocks {
 			m_apiDelay = delay;
 		}
 
+		/// Sets the \a hashes to return from a hashes-from request at \a height.
+		void setHashesFrom(Height height, const model::HashRange& hashes) {
+			m_hashesFromHeights.erase(height);
+			m_hashesFromHeights.emplace(height, model::HashRange::CopyRange(hashes));
+		}
+
 		/// Adds a block (\a pBlock) to the block map.
+		/// \note Blocks in the block map are returned by blocks-from requests in place of randomly generated blocks.
 		void addBlock(std::unique_ptr<model::Block>&& pBlock) {
 			auto height = pBlock->Height;
 			m_blocks.emplace(height, std::move(pBlock));
@@ -129,7 +136,8 @@ namespace catapult { namespace mocks {
 			if (shouldRaiseException(EntryPoint::Hashes_From))
 				return CreateFutureException<model::HashRange>("hashes from error has been set");
 
-			return CreateFutureResponse(model::HashRange::CopyRange(m_hashes));
+			auto iter = m_hashesFromHeights.find(height);
+			return CreateFutureResponse(model::HashRange::CopyRange(m_hashesFromHeights.cend() != iter ? iter->second : m_hashes));
 		}
 
 		/// Returns the configured last block and throws if the error entry point is set to Last_Block.
@@ -185,7 +193,9 @@ namespace catapult { namespace mocks {
 			std::vector<std::unique_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
 			for (auto i = 0u; i < numBlocks; ++i) {
-				blocks.push_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+				auto height = startHeight + Height(i);
+				auto iter = m_blocks.find(height);
+				blocks.push_back(m_blocks.cend() != iter ? test::CopyBlock(*iter->second) : test::GenerateVerifiableBlockAtHeight(height));
 				rawBlocks.push_back(blocks[i].get());
 			}
 
@@ -212,6 +222,7 @@ namespace catapult { namespace mocks {
 		model::ChainScore m_score;
 		EntryPoint m_errorEntryPoint;
 		model::HashRange m_hashes;
+		std::map<Height, model::HashRange> m_hashesFromHeights;
 		std::map<Height, std::shared_ptr<model::Block>> m_blocks;
 
 		mutable std::vector<Height> m_blockAtRequests;
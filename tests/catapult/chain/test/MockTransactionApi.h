@@ -29,13 +29,16 @@ namespace catapult { namespace mocks {
 	public:
 		enum class EntryPoint {
 			None,
-			Unconfirmed_Transactions
+			Unconfirmed_Transactions,
+			Unconfirmed_Transactions_By_Hash,
+			Unconfirmed_Transactions_Sketch
 		};
 
 	public:
 		/// Creates a transaction api around a range of \a transactions.
 		explicit MockTransactionApi(const model::TransactionRange& transactions)
 				: m_transactions(model::TransactionRange::CopyRange(transactions))
+				, m_sketch(cache::Max_Sketch_Num_Cells)
 				, m_errorEntryPoint(EntryPoint::None)
 		{}
 
@@ -45,11 +48,26 @@ namespace catapult { namespace mocks {
 			m_errorEntryPoint = entryPoint;
 		}
 
+		/// Sets the sketch returned by unconfirmed transactions sketch requests to \a sketch.
+		void setSketch(const cache::UtSketch& sketch) {
+			m_sketch = sketch;
+		}
+
 		/// Returns the vector of short hash ranges that were passed to the unconfirmed transactions requests.
 		const std::vector<model::ShortHashRange>& utRequests() const {
 			return m_utRequests;
 		}
 
+		/// Returns the vector of hash ranges that were passed to the unconfirmed transactions by hash requests.
+		const std::vector<model::HashRange>& utByHashRequests() const {
+			return m_utByHashRequests;
+		}
+
+		/// Returns the vector of numbers of cells that were passed to the unconfirmed transactions sketch requests.
+		const std::vector<uint32_t>& utSketchRequests() const {
+			return m_utSketchRequests;
+		}
+
 	public:
 		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to Unconfirmed_Transactions.
 		/// \note The \a knownShortHashes parameter is captured.
@@ -61,6 +79,30 @@ namespace catapult { namespace mocks {
 			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactions));
 		}
 
+		/// Returns the configured unconfirmed transactions and throws if the error entry point is set to
+		/// Unconfirmed_Transactions_By_Hash.
+		/// \note The \a hashes parameter is captured.
+		thread::future<model::TransactionRange> unconfirmedTransactionsByHash(model::HashRange&& hashes) const override {
+			m_utByHashRequests.push_back(std::move(hashes));
+			if (shouldRaiseException(EntryPoint::Unconfirmed_Transactions_By_Hash))
+				return CreateFutureException<model::TransactionRange>("unconfirmed transactions by hash error has been set");
+
+			return thread::make_ready_future(model::TransactionRange::CopyRange(m_transactions));
+		}
+
+		/// Returns the cells of the configured sketch folded to \a numCells cells and throws if the error entry point is set to
+		/// Unconfirmed_Transactions_Sketch.
+		/// \note The \a numCells parameter is captured.
+		thread::future<cache::UtSketchCellRange> unconfirmedTransactionsSketch(uint32_t numCells) const override {
+			m_utSketchRequests.push_back(numCells);
+			if (shouldRaiseException(EntryPoint::Unconfirmed_Transactions_Sketch))
+				return CreateFutureException<cache::UtSketchCellRange>("unconfirmed transactions sketch error has been set");
+
+			auto sketch = m_sketch.fold(numCells);
+			const auto& cells = sketch.cells();
+			return thread::make_ready_future(cache::UtSketchCellRange::CopyFixed(reinterpret_cast<const uint8_t*>(cells.data()), cells.size()));
+		}
+
 	private:
 		bool shouldRaiseException(EntryPoint entryPoint) const {
 			return m_errorEntryPoint == entryPoint;
@@ -73,7 +115,10 @@ namespace catapult { namespace mocks {
 
 	private:
 		model::TransactionRange m_transactions;
+		cache::UtSketch m_sketch;
 		EntryPoint m_errorEntryPoint;
 		mutable std::vector<model::ShortHashRange> m_utRequests;
+		mutable std::vector<model::HashRange> m_utByHashRequests;
+		mutable std::vector<uint32_t> m_utSketchRequests;
 	};
 }}
@@ -72,12 +72,18 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.ShouldAllowAddressReuse);
 			EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 			EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+			EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
 
 			EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
 
 			EXPECT_EQ(400u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(1u, config.MaxBlockDownloadPeers);
+			EXPECT_EQ(16u, config.BlockLoadPrefetchDepth);
+			EXPECT_EQ(100u, config.BlockLoadCommitInterval);
+			EXPECT_EQ(4u, config.StateStorageWorkerThreads);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.BlockStorageCacheSize);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -102,6 +108,10 @@ namespace catapult { namespace config {
 			EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 			EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 			EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+			EXPECT_FALSE(config.ShouldBatchVerifySignatures);
+			EXPECT_FALSE(config.ShouldIncrementallyRevalidateTransactions);
+			EXPECT_FALSE(config.ShouldAnnounceTransactions);
+			EXPECT_FALSE(config.ShouldReconcileTransactions);
 
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.OutgoingSecurityMode);
 			EXPECT_EQ(ionet::ConnectionSecurityMode::None, config.IncomingSecurityModes);
@@ -118,6 +128,21 @@ namespace catapult { namespace config {
 			EXPECT_EQ(10u, config.IncomingConnections.MaxConnectionAge);
 			EXPECT_EQ(512u, config.IncomingConnections.BacklogSize);
 
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.CacheDatabase.BlockCacheSize);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.CacheDatabase.WriteBufferSize);
+			EXPECT_EQ(10u, config.CacheDatabase.BloomFilterBitsPerKey);
+			EXPECT_EQ(cache::RdbCompactionStyle::Level, config.CacheDatabase.CompactionStyle);
+			EXPECT_EQ(cache::RdbCompressionType::None, config.CacheDatabase.Compression);
+			EXPECT_FALSE(config.CacheDatabase.ShouldEnableStatistics);
+			EXPECT_EQ(100'000u, config.CacheDatabase.HotEntryCacheSize);
+
+			ASSERT_EQ(1u, config.CacheDatabase.ColumnFamilyOptions.size());
+			const auto& columnFamilyOptions = config.CacheDatabase.ColumnFamilyOptions.at("AccountStateCache:key_lookup");
+			EXPECT_EQ(utils::FileSize::FromMegabytes(16), columnFamilyOptions.WriteBufferSize);
+			EXPECT_EQ(16u, columnFamilyOptions.BloomFilterBitsPerKey);
+			EXPECT_EQ(cache::RdbCompactionStyle::Level, columnFamilyOptions.CompactionStyle);
+			EXPECT_EQ(cache::RdbCompressionType::None, columnFamilyOptions.Compression);
+
 			auto expectedExtensions = std::unordered_set<std::string>{
 				"extension.eventsource", "extension.harvesting", "extension.syncsource",
 				"extension.diagnostics", "extension.filechain", "extension.hashcache", "extension.networkheight",
@@ -38,12 +38,18 @@ namespace catapult { namespace config {
 							{ "shouldAllowAddressReuse", "true" },
 							{ "shouldUseSingleThreadPool", "true" },
 							{ "shouldUseCacheDatabaseStorage", "true" },
+							{ "shouldUseSegmentedBlockStorage", "true" },
 
 							{ "shouldEnableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
 
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxBlockDownloadPeers", "4" },
+							{ "blockLoadPrefetchDepth", "8" },
+							{ "blockLoadCommitInterval", "50" },
+							{ "stateStorageWorkerThreads", "3" },
+							{ "blockStorageCacheSize", "12MB" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -68,6 +74,10 @@ namespace catapult { namespace config {
 							{ "shouldAbortWhenDispatcherIsFull", "true" },
 							{ "shouldAuditDispatcherInputs", "true" },
 							{ "shouldPrecomputeTransactionAddresses", "true" },
+							{ "shouldBatchVerifySignatures", "true" },
+							{ "shouldIncrementallyRevalidateTransactions", "true" },
+							{ "shouldAnnounceTransactions", "true" },
+							{ "shouldReconcileTransactions", "true" },
 
 							{ "outgoingSecurityMode", "Signed" },
 							{ "incomingSecurityModes", "None, Signed" }
@@ -97,6 +107,27 @@ namespace catapult { namespace config {
 							{ "backlogSize", "21" }
 						}
 					},
+					{
+						"cache_database",
+						{
+							{ "blockCacheSize", "128MB" },
+							{ "writeBufferSize", "32MB" },
+							{ "bloomFilterBitsPerKey", "12" },
+							{ "compactionStyle", "Universal" },
+							{ "compression", "Lz4" },
+							{ "shouldEnableStatistics", "true" },
+							{ "hotEntryCacheSize", "4321" }
+						}
+					},
+					{
+						"cache_database:AlphaCache:key_lookup",
+						{
+							{ "writeBufferSize", "16MB" },
+							{ "bloomFilterBitsPerKey", "14" },
+							{ "compactionStyle", "Level" },
+							{ "compression", "Zstd" }
+						}
+					},
 					{
 						"extensions",
 						{
@@ -119,12 +150,18 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAllowAddressReuse);
 				EXPECT_FALSE(config.ShouldUseSingleThreadPool);
 				EXPECT_FALSE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_FALSE(config.ShouldUseSegmentedBlockStorage);
 
 				EXPECT_FALSE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxBlockDownloadPeers);
+				EXPECT_EQ(0u, config.BlockLoadPrefetchDepth);
+				EXPECT_EQ(0u, config.BlockLoadCommitInterval);
+				EXPECT_EQ(0u, config.StateStorageWorkerThreads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockStorageCacheSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -149,6 +186,10 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_FALSE(config.ShouldAuditDispatcherInputs);
 				EXPECT_FALSE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_FALSE(config.ShouldBatchVerifySignatures);
+				EXPECT_FALSE(config.ShouldIncrementallyRevalidateTransactions);
+				EXPECT_FALSE(config.ShouldAnnounceTransactions);
+				EXPECT_FALSE(config.ShouldReconcileTransactions);
 
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.OutgoingSecurityMode);
 				EXPECT_EQ(static_cast<ionet::ConnectionSecurityMode>(0), config.IncomingSecurityModes);
@@ -165,6 +206,15 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.IncomingConnections.MaxConnectionAge);
 				EXPECT_EQ(0u, config.IncomingConnections.BacklogSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(0u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_EQ(cache::RdbCompactionStyle::Level, config.CacheDatabase.CompactionStyle);
+				EXPECT_EQ(cache::RdbCompressionType::None, config.CacheDatabase.Compression);
+				EXPECT_FALSE(config.CacheDatabase.ShouldEnableStatistics);
+				EXPECT_EQ(0u, config.CacheDatabase.HotEntryCacheSize);
+				EXPECT_TRUE(config.CacheDatabase.ColumnFamilyOptions.empty());
+
 				EXPECT_TRUE(config.Extensions.empty());
 			}
 
@@ -175,12 +225,18 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAllowAddressReuse);
 				EXPECT_TRUE(config.ShouldUseSingleThreadPool);
 				EXPECT_TRUE(config.ShouldUseCacheDatabaseStorage);
+				EXPECT_TRUE(config.ShouldUseSegmentedBlockStorage);
 
 				EXPECT_TRUE(config.ShouldEnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
 
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(4u, config.MaxBlockDownloadPeers);
+				EXPECT_EQ(8u, config.BlockLoadPrefetchDepth);
+				EXPECT_EQ(50u, config.BlockLoadCommitInterval);
+				EXPECT_EQ(3u, config.StateStorageWorkerThreads);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(12), config.BlockStorageCacheSize);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -205,6 +261,10 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.ShouldAbortWhenDispatcherIsFull);
 				EXPECT_TRUE(config.ShouldAuditDispatcherInputs);
 				EXPECT_TRUE(config.ShouldPrecomputeTransactionAddresses);
+				EXPECT_TRUE(config.ShouldBatchVerifySignatures);
+				EXPECT_TRUE(config.ShouldIncrementallyRevalidateTransactions);
+				EXPECT_TRUE(config.ShouldAnnounceTransactions);
+				EXPECT_TRUE(config.ShouldReconcileTransactions);
 
 				EXPECT_EQ(ionet::ConnectionSecurityMode::Signed, config.OutgoingSecurityMode);
 				EXPECT_EQ(ionet::ConnectionSecurityMode::None | ionet::ConnectionSecurityMode::Signed, config.IncomingSecurityModes);
@@ -221,6 +281,21 @@ namespace catapult { namespace config {
 				EXPECT_EQ(13u, config.IncomingConnections.MaxConnectionAge);
 				EXPECT_EQ(21u, config.IncomingConnections.BacklogSize);
 
+				EXPECT_EQ(utils::FileSize::FromMegabytes(128), config.CacheDatabase.BlockCacheSize);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.CacheDatabase.WriteBufferSize);
+				EXPECT_EQ(12u, config.CacheDatabase.BloomFilterBitsPerKey);
+				EXPECT_EQ(cache::RdbCompactionStyle::Universal, config.CacheDatabase.CompactionStyle);
+				EXPECT_EQ(cache::RdbCompressionType::Lz4, config.CacheDatabase.Compression);
+				EXPECT_TRUE(config.CacheDatabase.ShouldEnableStatistics);
+				EXPECT_EQ(4321u, config.CacheDatabase.HotEntryCacheSize);
+
+				ASSERT_EQ(1u, config.CacheDatabase.ColumnFamilyOptions.size());
+				const auto& columnFamilyOptions = config.CacheDatabase.ColumnFamilyOptions.at("AlphaCache:key_lookup");
+				EXPECT_EQ(utils::FileSize::FromMegabytes(16), columnFamilyOptions.WriteBufferSize);
+				EXPECT_EQ(14u, columnFamilyOptions.BloomFilterBitsPerKey);
+				EXPECT_EQ(cache::RdbCompactionStyle::Level, columnFamilyOptions.CompactionStyle);
+				EXPECT_EQ(cache::RdbCompressionType::Zstd, columnFamilyOptions.Compression);
+
 				EXPECT_EQ(std::unordered_set<std::string>({ "Alpha", "gamma" }), config.Extensions);
 			}
 		};
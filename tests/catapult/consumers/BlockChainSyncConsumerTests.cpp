@@ -208,14 +208,22 @@ namespace catapult { namespace consumers {
 
 		struct TransactionsChangeParams {
 		public:
-			TransactionsChangeParams(const HashSet& addedTransactionHashes, const HashSet& revertedTransactionHashes)
+			TransactionsChangeParams(
+					const HashSet& addedTransactionHashes,
+					const HashSet& revertedTransactionHashes,
+					const model::AddressSet& changedAddresses,
+					size_t numAddedBlockElements)
 					: AddedTransactionHashes(addedTransactionHashes)
 					, RevertedTransactionHashes(revertedTransactionHashes)
+					, ChangedAddresses(changedAddresses)
+					, NumAddedBlockElements(numAddedBlockElements)
 			{}
 
 		public:
 			const HashSet AddedTransactionHashes;
 			const HashSet RevertedTransactionHashes;
+			const model::AddressSet ChangedAddresses;
+			const size_t NumAddedBlockElements;
 		};
 
 		class MockTransactionsChange : public test::ParamsCapture<TransactionsChangeParams> {
@@ -223,7 +231,9 @@ namespace catapult { namespace consumers {
 			void operator()(const TransactionsChangeInfo& changeInfo) const {
 				TransactionsChangeParams params(
 						CopyHashes(changeInfo.AddedTransactionHashes),
-						CopyHashes(changeInfo.RevertedTransactionInfos));
+						CopyHashes(changeInfo.RevertedTransactionInfos),
+						changeInfo.ChangedAddresses,
+						changeInfo.AddedBlockElements.size());
 				const_cast<MockTransactionsChange*>(this)->push(std::move(params));
 			}
 
@@ -255,7 +265,7 @@ namespace catapult { namespace consumers {
 
 		struct ConsumerTestContext {
 		public:
-			ConsumerTestContext()
+			explicit ConsumerTestContext(bool shouldCollectChangedAddresses = false)
 					: Cache(test::CreateCatapultCacheWithMarkerAccount())
 					, Storage(std::make_unique<mocks::MockMemoryBasedStorage>()) {
 				State.LastRecalculationHeight = Initial_Last_Recalculation_Height;
@@ -276,6 +286,7 @@ namespace catapult { namespace consumers {
 				handlers.TransactionsChange = [this](const auto& changeInfo) {
 					return TransactionsChange(changeInfo);
 				};
+				handlers.ShouldCollectChangedAddresses = shouldCollectChangedAddresses;
 
 				Consumer = CreateBlockChainSyncConsumer(Cache, State, Storage, Max_Rollback_Blocks, handlers);
 			}
@@ -807,36 +818,60 @@ namespace catapult { namespace consumers {
 		}
 	}
 
-	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotification) {
-		// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
-		ConsumerTestContext context;
-		context.seedStorage(Height(7), 3);
-		auto input = CreateInput(Height(8), 4);
+	namespace {
+		void AssertCanSyncCompatibleChainsWithTransactionNotification(
+				bool shouldCollectChangedAddresses,
+				const consumer<const TransactionsChangeParams&, const cache::CatapultCache&>& assertChangedAddresses) {
+			// Arrange: create a local storage with blocks 1-7 and a remote storage with blocks 8-11
+			ConsumerTestContext context(shouldCollectChangedAddresses);
+			context.seedStorage(Height(7), 3);
+			auto input = CreateInput(Height(8), 4);
+
+			// - add transactions to the input
+			InputTransactionBuilder builder(input);
+			builder.addRandom(0, 1);
+			builder.addRandom(2, 3);
+			builder.addRandom(3, 2);
 
-		// - add transactions to the input
-		InputTransactionBuilder builder(input);
-		builder.addRandom(0, 1);
-		builder.addRandom(2, 3);
-		builder.addRandom(3, 2);
+			// Act:
+			auto result = context.Consumer(input);
 
-		// Act:
-		auto result = context.Consumer(input);
+			// Assert:
+			test::AssertContinued(result);
+			EXPECT_EQ(0u, context.UndoBlock.params().size());
+			context.assertDifficultyCheckerInvocation(input);
+			context.assertProcessorInvocation(input);
+			context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
 
-		// Assert:
-		test::AssertContinued(result);
-		EXPECT_EQ(0u, context.UndoBlock.params().size());
-		context.assertDifficultyCheckerInvocation(input);
-		context.assertProcessorInvocation(input);
-		context.assertStored(input, model::ChainScore(4 * (Base_Difficulty - 1)));
+			// - the change notification had 6 added and 0 reverted
+			ASSERT_EQ(1u, context.TransactionsChange.params().size());
+			const auto& txChangeParams = context.TransactionsChange.params()[0];
 
-		// - the change notification had 6 added and 0 reverted
-		ASSERT_EQ(1u, context.TransactionsChange.params().size());
-		const auto& txChangeParams = context.TransactionsChange.params()[0];
+			EXPECT_EQ(6u, txChangeParams.AddedTransactionHashes.size());
+			AssertHashesAreEqual(builder.hashes(), txChangeParams.AddedTransactionHashes);
 
-		EXPECT_EQ(6u, txChangeParams.AddedTransactionHashes.size());
-		AssertHashesAreEqual(builder.hashes(), txChangeParams.AddedTransactionHashes);
+			EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+
+			// - all input blocks were added
+			EXPECT_EQ(4u, txChangeParams.NumAddedBlockElements);
+			assertChangedAddresses(txChangeParams, context.Cache);
+		}
+	}
+
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotification) {
+		// Assert: changed addresses are not collected
+		AssertCanSyncCompatibleChainsWithTransactionNotification(false, [](const auto& txChangeParams, const auto&) {
+			EXPECT_TRUE(txChangeParams.ChangedAddresses.empty());
+		});
+	}
 
-		EXPECT_TRUE(txChangeParams.RevertedTransactionHashes.empty());
+	TEST(TEST_CLASS, CanSyncCompatibleChains_TransactionNotificationWithChangedAddresses) {
+		// Assert: the account added by the processor was changed
+		AssertCanSyncCompatibleChainsWithTransactionNotification(true, [](const auto& txChangeParams, const auto& catapultCache) {
+			auto networkIdentifier = catapultCache.template sub<cache::AccountStateCache>().networkIdentifier();
+			auto sentinelAddress = model::PublicKeyToAddress(Sentinel_Processor_Public_Key, networkIdentifier);
+			EXPECT_EQ(model::AddressSet{ sentinelAddress }, txChangeParams.ChangedAddresses);
+		});
 	}
 
 	TEST(TEST_CLASS, CanSyncIncompatibleChains_TransactionNotification) {
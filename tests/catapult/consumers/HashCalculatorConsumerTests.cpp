@@ -27,6 +27,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/TestHarness.h"
@@ -317,6 +318,94 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region parallel hash calculation
+
+	namespace {
+		std::shared_ptr<thread::IoServiceThreadPool> CreatePool() {
+			return test::CreateStartedIoServiceThreadPool(4);
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities_Parallel) {
+		// Assert:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		test::AssertPassthroughForEmptyInput(CreateBlockHashCalculatorConsumer(registry, CreatePool()));
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactions_Parallel) {
+		// Arrange: use more transactions than threads
+		auto registry = CustomBuffersTraits::CreateTransactionRegistry();
+		auto input = CreateBlockConsumerInput(registry, 5, 7);
+		auto& blockElements = input.blocks();
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(registry, CreatePool())(blockElements);
+
+		// Assert: transaction elements are in the same order as the transactions in each block
+		test::AssertContinued(result);
+		ASSERT_EQ(5u, blockElements.size());
+		for (const auto& blockElement : blockElements) {
+			AssertCorrectHashes(blockElement, 7);
+
+			auto i = 0u;
+			for (const auto& transaction : blockElement.Block.Transactions()) {
+				EXPECT_EQ(&transaction, &blockElement.Transactions[i].Transaction) << "transaction at " << i;
+				++i;
+			}
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, ExceptionIsPropagatedIfMalformedTransactionIsProcessed_Parallel) {
+		// Arrange: make the size of the third transaction invalid
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(3, 4);
+		auto& blockElements = input.blocks();
+
+		const auto* pTransaction = reinterpret_cast<const mocks::MockTransaction*>(&blockElements[1].Block + 1) + 2;
+		const_cast<mocks::MockTransaction*>(pTransaction)->Size = 2 * sizeof(mocks::MockTransaction) + 1;
+
+		// Act + Assert: transaction iteration throws an exception
+		EXPECT_THROW(CreateBlockHashCalculatorConsumer(registry, CreatePool())(blockElements), catapult_runtime_error);
+	}
+
+	TEST(BLOCK_TEST_CLASS, MultipleEntitiesAreSkippedIfAnyBlockTransactionsHashDoesNotMatch_Parallel) {
+		// Arrange: corrupt the block transactions hash
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(3, 4);
+		auto& blockElements = input.blocks();
+		const_cast<model::Block&>(blockElements[1].Block).BlockTransactionsHash[0] ^= 0xFF;
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(registry, CreatePool())(blockElements);
+
+		// Assert: the elements were skipped because a block transactions hash didn't match
+		test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities_Parallel) {
+		// Assert:
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		test::AssertPassthroughForEmptyInput(CreateTransactionHashCalculatorConsumer(registry, CreatePool()));
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntities_Parallel) {
+		// Arrange: use more transactions than threads
+		auto registry = CustomBuffersTraits::CreateTransactionRegistry();
+		auto input = CreateTransactionConsumerInput(11);
+		auto& transactionElements = input.transactions();
+
+		// Act:
+		auto result = CreateTransactionHashCalculatorConsumer(registry, CreatePool())(transactionElements);
+
+		// Assert:
+		test::AssertContinued(result);
+		EXPECT_EQ(11u, transactionElements.size());
+		for (const auto& transactionElement : transactionElements)
+			AssertCorrectHash(transactionElement);
+	}
+
+	// endregion
+
 	// region dependent hash calculation
 
 	namespace {
@@ -88,9 +88,10 @@ namespace catapult { namespace consumers {
 			// Act:
 			auto result = context.Consumer(input);
 
-			// Assert: the consumer detached the input
+			// Assert: the consumer shared the input
 			test::AssertConsumed(result);
-			EXPECT_TRUE(input.empty());
+			EXPECT_FALSE(input.empty());
+			EXPECT_THROW(input.detachBlockRange(), catapult_runtime_error);
 
 			// - the block was passed to the callback (backed by original memory)
 			const auto& params = context.NewBlockSink.params();
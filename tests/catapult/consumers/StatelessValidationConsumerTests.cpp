@@ -561,4 +561,130 @@ namespace catapult { namespace consumers {
 	}
 
 	// endregion
+
+	// region batch signature verification
+
+	namespace {
+		class MockBatchSignatureVerifier : public BatchSignatureVerifier {
+		public:
+			explicit MockBatchSignatureVerifier(bool result)
+					: m_result(result)
+					, m_numVerifyCalls(0)
+			{}
+
+		public:
+			size_t numVerifyCalls() const {
+				return m_numVerifyCalls;
+			}
+
+		public:
+			thread::future<bool> verify(const model::WeakEntityInfos&) const override {
+				++m_numVerifyCalls;
+				return thread::make_ready_future(bool(m_result));
+			}
+
+		private:
+			bool m_result;
+			mutable size_t m_numVerifyCalls;
+		};
+
+		class PassthroughEntityValidator : public stateless::EntityValidator {
+		public:
+			const std::string& name() const override {
+				static std::string name("PassthroughEntityValidator");
+				return name;
+			}
+
+			ValidationResult validate(const model::WeakEntityInfo&) const override {
+				return ValidationResult::Success;
+			}
+		};
+
+		auto CreateAggregateValidator(size_t numValidators) {
+			ValidatorVectorT<> validators;
+			for (auto i = 0u; i < numValidators; ++i)
+				validators.push_back(std::make_unique<PassthroughEntityValidator>());
+
+			return std::make_shared<stateless::AggregateEntityValidator>(std::move(validators));
+		}
+
+		// full validator has 3 sub validators and signatureless validator has 2 sub validators,
+		// so the dispatched validator can be identified by the number of validation functions
+		constexpr auto Num_Full_Validation_Functions = 3u;
+		constexpr auto Num_Signatureless_Validation_Functions = 2u;
+
+		struct BatchBlockTestContext {
+		public:
+			explicit BatchBlockTestContext(bool batchVerifyResult)
+					: pVerifier(std::make_shared<MockBatchSignatureVerifier>(batchVerifyResult))
+					, pPolicy(std::make_shared<MockParallelShortCircuitValidationPolicy>())
+					, Consumer(CreateBlockStatelessValidationConsumer(
+							CreateAggregateValidator(Num_Full_Validation_Functions),
+							CreateAggregateValidator(Num_Signatureless_Validation_Functions),
+							pVerifier,
+							pPolicy,
+							RequiresAllPredicate))
+			{}
+
+		public:
+			std::shared_ptr<MockBatchSignatureVerifier> pVerifier;
+			std::shared_ptr<MockParallelShortCircuitValidationPolicy> pPolicy;
+			disruptor::ConstBlockConsumer Consumer;
+		};
+
+		struct BatchTransactionTestContext {
+		public:
+			explicit BatchTransactionTestContext(bool batchVerifyResult)
+					: pVerifier(std::make_shared<MockBatchSignatureVerifier>(batchVerifyResult))
+					, pPolicy(std::make_shared<MockParallelAllValidationPolicy>())
+					, Consumer(CreateTransactionStatelessValidationConsumer(
+							CreateAggregateValidator(Num_Full_Validation_Functions),
+							CreateAggregateValidator(Num_Signatureless_Validation_Functions),
+							pVerifier,
+							pPolicy,
+							[](const auto&, const auto&, auto) {}))
+			{}
+
+		public:
+			std::shared_ptr<MockBatchSignatureVerifier> pVerifier;
+			std::shared_ptr<MockParallelAllValidationPolicy> pPolicy;
+			disruptor::TransactionConsumer Consumer;
+		};
+
+		template<typename TTestContext, typename TTraits>
+		void AssertBatchSignatureVerification(bool batchVerifyResult, size_t numExpectedValidationFunctions) {
+			// Arrange:
+			TTestContext context(batchVerifyResult);
+			auto elements = TTraits::CreateMultipleEntityElements();
+
+			// Act:
+			auto result = context.Consumer(elements);
+
+			// Assert:
+			test::AssertContinued(result);
+			EXPECT_EQ(1u, context.pVerifier->numVerifyCalls());
+
+			const auto& params = context.pPolicy->params();
+			ASSERT_EQ(1u, params.size());
+			EXPECT_EQ(numExpectedValidationFunctions, params[0].NumValidationFunctions);
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, BatchModeUsesSignaturelessValidatorWhenBatchVerificationSucceeds) {
+		AssertBatchSignatureVerification<BatchBlockTestContext, BlockTraits>(true, Num_Signatureless_Validation_Functions);
+	}
+
+	TEST(BLOCK_TEST_CLASS, BatchModeUsesFullValidatorWhenBatchVerificationFails) {
+		AssertBatchSignatureVerification<BatchBlockTestContext, BlockTraits>(false, Num_Full_Validation_Functions);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, BatchModeUsesSignaturelessValidatorWhenBatchVerificationSucceeds) {
+		AssertBatchSignatureVerification<BatchTransactionTestContext, TransactionTraits>(true, Num_Signatureless_Validation_Functions);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, BatchModeUsesFullValidatorWhenBatchVerificationFails) {
+		AssertBatchSignatureVerification<BatchTransactionTestContext, TransactionTraits>(false, Num_Full_Validation_Functions);
+	}
+
+	// endregion
 }}
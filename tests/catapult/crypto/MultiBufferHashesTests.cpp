@@ -0,0 +1,167 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/MultiBufferHashes.h"
+#include "catapult/crypto/Hashes.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS MultiBufferHashesTests
+
+	namespace {
+		// sizes around the sha3-512 (72) and sha3-256 (136) rates
+		constexpr size_t Message_Sizes[] = { 0, 1, 32, 64, 71, 72, 73, 135, 136, 137, 143, 144, 145, 271, 272, 273, 1000 };
+
+		struct Sha3_256_Traits {
+			using HashType = Hash256;
+			using BuilderType = Sha3_256_Builder;
+
+			static void HashMulti(const RawBuffer* pBuffers, size_t numBuffersPerMessage, HashType* pHashes, size_t numMessages) {
+				Sha3_256_Multi(pBuffers, numBuffersPerMessage, pHashes, numMessages);
+			}
+		};
+
+		struct Sha3_512_Traits {
+			using HashType = Hash512;
+			using BuilderType = Sha3_512_Builder;
+
+			static void HashMulti(const RawBuffer* pBuffers, size_t numBuffersPerMessage, HashType* pHashes, size_t numMessages) {
+				Sha3_512_Multi(pBuffers, numBuffersPerMessage, pHashes, numMessages);
+			}
+		};
+
+		template<typename TTraits>
+		typename TTraits::HashType CalculateExpectedHash(const RawBuffer* pBuffers, size_t numBuffers) {
+			typename TTraits::HashType hash;
+			typename TTraits::BuilderType builder;
+			for (auto i = 0u; i < numBuffers; ++i)
+				builder.update(pBuffers[i]);
+
+			builder.final(hash);
+			return hash;
+		}
+
+		template<typename TTraits>
+		void AssertMultiHashesMatchSingleHashes(const std::vector<RawBuffer>& buffers, size_t numBuffersPerMessage) {
+			// Arrange:
+			auto numMessages = buffers.size() / numBuffersPerMessage;
+			std::vector<typename TTraits::HashType> hashes(numMessages);
+
+			// Act:
+			TTraits::HashMulti(buffers.data(), numBuffersPerMessage, hashes.data(), numMessages);
+
+			// Assert:
+			for (auto i = 0u; i < numMessages; ++i) {
+				auto expectedHash = CalculateExpectedHash<TTraits>(&buffers[i * numBuffersPerMessage], numBuffersPerMessage);
+				EXPECT_EQ(expectedHash, hashes[i]) << "message at " << i << " (" << numMessages << " messages)";
+			}
+		}
+	}
+
+#define MULTI_HASH_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME##_Sha3_256) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Sha3_256_Traits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_Sha3_512) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<Sha3_512_Traits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	MULTI_HASH_TRAITS_BASED_TEST(CanHashZeroMessages) {
+		// Arrange:
+		typename TTraits::HashType hash{};
+
+		// Act:
+		TTraits::HashMulti(nullptr, 1, &hash, 0);
+
+		// Assert: hash was not modified
+		EXPECT_EQ(typename TTraits::HashType(), hash);
+	}
+
+	MULTI_HASH_TRAITS_BASED_TEST(CanHashMessagesWithSameSize) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(9 * 1000);
+
+		for (auto size : Message_Sizes) {
+			for (auto numMessages = 1u; numMessages <= 9; ++numMessages) {
+				std::vector<RawBuffer> buffers;
+				for (auto i = 0u; i < numMessages; ++i)
+					buffers.push_back({ data.data() + i * size, size });
+
+				// Assert:
+				AssertMultiHashesMatchSingleHashes<TTraits>(buffers, 1);
+			}
+		}
+	}
+
+	MULTI_HASH_TRAITS_BASED_TEST(CanHashMessagesWithDifferentSizes) {
+		// Arrange:
+		auto data = test::GenerateRandomVector(1000);
+
+		std::vector<RawBuffer> buffers;
+		for (auto size : Message_Sizes)
+			buffers.push_back({ data.data(), size });
+
+		// - reverse the messages too so that the longest message is in different lanes
+		auto reversedBuffers = buffers;
+		std::reverse(reversedBuffers.begin(), reversedBuffers.end());
+
+		// Assert:
+		AssertMultiHashesMatchSingleHashes<TTraits>(buffers, 1);
+		AssertMultiHashesMatchSingleHashes<TTraits>(reversedBuffers, 1);
+	}
+
+	MULTI_HASH_TRAITS_BASED_TEST(CanHashMessagesComposedOfMultipleBuffers) {
+		// Arrange: split each message into three buffers (including empty buffers)
+		auto data = test::GenerateRandomVector(1000);
+
+		std::vector<RawBuffer> buffers;
+		for (auto size : Message_Sizes) {
+			buffers.push_back({ data.data(), size / 3 });
+			buffers.push_back({ data.data() + size / 3, size / 4 });
+			buffers.push_back({ data.data() + size / 3 + size / 4, size - size / 3 - size / 4 });
+		}
+
+		// Assert:
+		AssertMultiHashesMatchSingleHashes<TTraits>(buffers, 3);
+	}
+
+	MULTI_HASH_TRAITS_BASED_TEST(HashesCanOverlapBuffersOfSameOrPrecedingMessages) {
+		// Arrange: pair consecutive hashes like a merkle tree level
+		std::vector<typename TTraits::HashType> hashes(9);
+		for (auto& hash : hashes)
+			test::FillWithRandomData(hash);
+
+		std::vector<RawBuffer> buffers;
+		for (auto i = 0u; i < hashes.size(); i += 2) {
+			buffers.push_back(hashes[i]);
+			buffers.push_back(hashes[std::min<size_t>(i + 1, hashes.size() - 1)]);
+		}
+
+		std::vector<typename TTraits::HashType> expectedHashes;
+		for (auto i = 0u; i < buffers.size(); i += 2)
+			expectedHashes.push_back(CalculateExpectedHash<TTraits>(&buffers[i], 2));
+
+		// Act:
+		TTraits::HashMulti(buffers.data(), 2, hashes.data(), expectedHashes.size());
+
+		// Assert:
+		for (auto i = 0u; i < expectedHashes.size(); ++i)
+			EXPECT_EQ(expectedHashes[i], hashes[i]) << "message at " << i;
+	}
+}}
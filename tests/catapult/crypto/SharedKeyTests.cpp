@@ -0,0 +1,98 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/crypto/SharedKey.h"
+#include "catapult/crypto/KeyPair.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace crypto {
+
+#define TEST_CLASS SharedKeyTests
+
+	TEST(TEST_CLASS, SharedKeyIsDeterministic) {
+		// Arrange:
+		auto keyPair = test::GenerateKeyPair();
+		auto otherPublicKey = test::GenerateKeyPair().publicKey();
+
+		// Act:
+		auto sharedKey1 = DeriveSharedKey(keyPair, otherPublicKey);
+		auto sharedKey2 = DeriveSharedKey(keyPair, otherPublicKey);
+
+		// Assert:
+		EXPECT_EQ(sharedKey1, sharedKey2);
+	}
+
+	TEST(TEST_CLASS, SharedKeyIsSameForBothParties) {
+		// Arrange:
+		auto keyPair1 = test::GenerateKeyPair();
+		auto keyPair2 = test::GenerateKeyPair();
+
+		// Act:
+		auto sharedKey1 = DeriveSharedKey(keyPair1, keyPair2.publicKey());
+		auto sharedKey2 = DeriveSharedKey(keyPair2, keyPair1.publicKey());
+
+		// Assert:
+		EXPECT_EQ(sharedKey1, sharedKey2);
+		EXPECT_NE(Key(), sharedKey1);
+	}
+
+	TEST(TEST_CLASS, SharedKeyIsDifferentForDifferentParties) {
+		// Arrange:
+		auto keyPair = test::GenerateKeyPair();
+		auto otherPublicKey1 = test::GenerateKeyPair().publicKey();
+		auto otherPublicKey2 = test::GenerateKeyPair().publicKey();
+
+		// Act:
+		auto sharedKey1 = DeriveSharedKey(keyPair, otherPublicKey1);
+		auto sharedKey2 = DeriveSharedKey(keyPair, otherPublicKey2);
+
+		// Assert:
+		EXPECT_NE(sharedKey1, sharedKey2);
+	}
+
+	TEST(TEST_CLASS, SharedKeyMatchesTestVector) {
+		// Arrange:
+		auto keyPair = KeyPair::FromString("A2F0B4A5E9C7D3F1A88B2E5C0D7F6E1B3C4A59687D2E1F0A9B8C7D6E5F4A3B2C");
+#ifdef SIGNATURE_SCHEME_NIS1
+		auto otherPublicKey = test::ToArray<Key_Size>("7FFCED27040E8FDBCDC96AFD243BAC2A6735685F07DBA951549FC85777BBE322");
+		auto expectedSharedKey = std::string("236D7E09DF2DA2D132C3ADA4DABE0A0876ABB8C0D42AFDFF32FA2359F376A7C0");
+#else
+		auto otherPublicKey = test::ToArray<Key_Size>("99E8B4F5CD92607B0A67FE0D8CFCC0DB976EEE60E7429346C6C17BB2AEF28CA2");
+		auto expectedSharedKey = std::string("378CF84F70BEA63EC939C366D46DA66021829BF2712EC4311C3078BC4745608C");
+#endif
+
+		// Act:
+		auto sharedKey = DeriveSharedKey(keyPair, otherPublicKey);
+
+		// Assert:
+		EXPECT_EQ(expectedSharedKey, test::ToHexString(sharedKey));
+	}
+
+	TEST(TEST_CLASS, CannotDeriveSharedKeyFromInvalidPublicKey) {
+		// Arrange: y = 2 does not correspond to any point on the curve
+		auto keyPair = test::GenerateKeyPair();
+		Key invalidPublicKey{};
+		invalidPublicKey[0] = 2;
+
+		// Act + Assert:
+		EXPECT_THROW(DeriveSharedKey(keyPair, invalidPublicKey), catapult_invalid_argument);
+	}
+}}
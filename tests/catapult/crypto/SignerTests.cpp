@@ -19,9 +19,15 @@
 **/
 
 #include "catapult/crypto/Signer.h"
+#include "catapult/crypto/Hashes.h"
 #include "tests/TestHarness.h"
 #include <numeric>
 
+extern "C" {
+#include <ref10/ge.h>
+#include <ref10/sc.h>
+}
+
 namespace catapult { namespace crypto {
 
 #define TEST_CLASS SignerTests
@@ -390,4 +396,305 @@ namespace catapult { namespace crypto {
 			EXPECT_EQ(properSignature, result);
 		}
 	}
+
+	// region VerifyMulti
+
+	namespace {
+		struct SignatureInputs {
+		public:
+			explicit SignatureInputs(size_t count) {
+				for (auto i = 0u; i < count; ++i) {
+					KeyPairs.push_back(KeyPair::FromPrivate(PrivateKey::Generate(test::RandomByte)));
+					Payloads.push_back(test::GenerateRandomVector(100 + i));
+					Signatures.push_back(SignPayload(KeyPairs.back(), Payloads.back()));
+				}
+			}
+
+		public:
+			std::vector<SignatureInput> toSignatureInputs() const {
+				std::vector<SignatureInput> signatureInputs;
+				for (auto i = 0u; i < KeyPairs.size(); ++i)
+					signatureInputs.push_back({ KeyPairs[i].publicKey(), Payloads[i], Signatures[i] });
+
+				return signatureInputs;
+			}
+
+		public:
+			std::vector<KeyPair> KeyPairs;
+			std::vector<std::vector<uint8_t>> Payloads;
+			std::vector<Signature> Signatures;
+		};
+
+		bool VerifyMulti(const SignatureInputs& inputs) {
+			auto signatureInputs = inputs.toSignatureInputs();
+			return crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size());
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesAreProvided) {
+		// Act:
+		auto isVerified = crypto::VerifyMulti(nullptr, 0);
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		for (auto count : { 1u, 2u, 5u, 64u }) {
+			// Arrange:
+			SignatureInputs inputs(count);
+
+			// Act:
+			auto isVerified = VerifyMulti(inputs);
+
+			// Assert:
+			EXPECT_TRUE(isVerified) << "count " << count;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsForTestVectors) {
+		// Arrange:
+		auto input = GetTestVectorsInput();
+		std::vector<KeyPair> keyPairs;
+		std::vector<std::vector<uint8_t>> payloads;
+		std::vector<Signature> signatures;
+		for (auto i = 0u; i < input.InputData.size(); ++i) {
+			keyPairs.push_back(KeyPair::FromString(input.PrivateKeys[i]));
+			payloads.push_back(test::ToVector(input.InputData[i]));
+			signatures.push_back(test::ToArray<Signature_Size>(input.ExpectedSignatures[i]));
+		}
+
+		std::vector<SignatureInput> signatureInputs;
+		for (auto i = 0u; i < keyPairs.size(); ++i)
+			signatureInputs.push_back({ keyPairs[i].publicKey(), payloads[i], signatures[i] });
+
+		// Act:
+		auto isVerified = crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size());
+
+		// Assert:
+		EXPECT_TRUE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnySignatureIsModified) {
+		// Arrange:
+		SignatureInputs inputs(10);
+		for (auto position : { 0u, 17u, 31u, 32u, 45u, 63u }) {
+			auto signatures = inputs.Signatures;
+			inputs.Signatures[7][position] ^= 0xFF;
+
+			// Act:
+			auto isVerified = VerifyMulti(inputs);
+
+			// Assert:
+			EXPECT_FALSE(isVerified) << "position " << position;
+			inputs.Signatures = signatures;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnyPayloadIsModified) {
+		// Arrange:
+		SignatureInputs inputs(10);
+		inputs.Payloads[3][50] ^= 0xFF;
+
+		// Act:
+		auto isVerified = VerifyMulti(inputs);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnySignatureIsNotCanonical) {
+		// Arrange:
+		SignatureInputs inputs(10);
+		ScalarAddGroupOrder(inputs.Signatures[5].data() + Signature_Size / 2);
+
+		// Act:
+		auto isVerified = VerifyMulti(inputs);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenAnyPublicKeyIsZero) {
+		// Arrange:
+		SignatureInputs inputs(10);
+		auto& hackPublic = const_cast<Key&>(inputs.KeyPairs[2].publicKey());
+		std::fill(hackPublic.begin(), hackPublic.end(), static_cast<uint8_t>(0));
+
+		// Act:
+		auto isVerified = VerifyMulti(inputs);
+
+		// Assert:
+		EXPECT_FALSE(isVerified);
+	}
+
+	// endregion
+
+	// region VerifyMulti - small order components
+
+	namespace {
+		using EncodedPoint = std::array<uint8_t, Signature_Size / 2>;
+		using Scalar = std::array<uint8_t, Signature_Size / 2>;
+
+		// (0, -1), which has order 2
+		const auto Order_2_Point = test::ToArray<Signature_Size / 2>("ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f");
+
+		// point with order 8
+		const auto Order_8_Point = test::ToArray<Signature_Size / 2>("26e8958fc2b227b045c3f489f2ef98f0d5dfac05d3c63339b13802886d53fc05");
+
+		// (0, 1), which is the neutral element
+		const auto Neutral_Element = test::ToArray<Signature_Size / 2>("0100000000000000000000000000000000000000000000000000000000000000");
+
+		Scalar GenerateRandomScalar() {
+			Hash512 buffer;
+			test::FillWithRandomData(buffer);
+			sc_reduce(buffer.data());
+
+			Scalar scalar;
+			std::memcpy(scalar.data(), buffer.data(), scalar.size());
+			return scalar;
+		}
+
+		ge_p3 DecodePoint(const EncodedPoint& encodedPoint) {
+			ge_p3 point;
+			if (0 != ge_frombytes_negate_vartime(&point, encodedPoint.data()))
+				CATAPULT_THROW_INVALID_ARGUMENT("point could not be decoded");
+
+			// undo negation
+			fe_neg(point.X, point.X);
+			fe_neg(point.T, point.T);
+			return point;
+		}
+
+		EncodedPoint MultiplyBaseAndAdd(const Scalar& scalar, const EncodedPoint& encodedSmallOrderPoint) {
+			// scalar * B + small order point
+			ge_p3 product;
+			ge_scalarmult_base(&product, scalar.data());
+
+			auto smallOrderPoint = DecodePoint(encodedSmallOrderPoint);
+			ge_cached cachedSmallOrderPoint;
+			ge_p3_to_cached(&cachedSmallOrderPoint, &smallOrderPoint);
+
+			ge_p1p1 sum;
+			ge_add(&sum, &product, &cachedSmallOrderPoint);
+
+			ge_p3 result;
+			ge_p1p1_to_p3(&result, &sum);
+
+			EncodedPoint encodedResult;
+			ge_p3_tobytes(encodedResult.data(), &result);
+			return encodedResult;
+		}
+
+		struct SmallOrderSignatureInput {
+			Key PublicKey;
+			std::vector<uint8_t> Payload;
+			catapult::Signature Signature;
+		};
+
+		// creates a signature with nonce r and private scalar a, where the encoded nonce and public key contain the
+		// respective small order points
+		SmallOrderSignatureInput CreateSmallOrderSignatureInput(
+				const EncodedPoint& nonceSmallOrderPoint,
+				const EncodedPoint& keySmallOrderPoint) {
+			auto r = GenerateRandomScalar();
+			auto a = GenerateRandomScalar();
+
+			SmallOrderSignatureInput input;
+			input.Payload = test::GenerateRandomVector(100);
+			input.PublicKey = MultiplyBaseAndAdd(a, keySmallOrderPoint);
+			auto encodedR = MultiplyBaseAndAdd(r, nonceSmallOrderPoint);
+
+			// h = H(encodedR || public || data) mod group order
+			Hash512 h;
+			Sha3_512_Builder sha3_h;
+			sha3_h.update({ encodedR, input.PublicKey, input.Payload });
+			sha3_h.final(h);
+			sc_reduce(h.data());
+
+			// S = (r + h * a) mod group order
+			std::memcpy(input.Signature.data(), encodedR.data(), encodedR.size());
+			sc_muladd(input.Signature.data() + Signature_Size / 2, h.data(), a.data(), r.data());
+			return input;
+		}
+
+		bool VerifyMultiWithValidSignatures(const SmallOrderSignatureInput& smallOrderInput) {
+			SignatureInputs inputs(4);
+			auto signatureInputs = inputs.toSignatureInputs();
+			signatureInputs.push_back({ smallOrderInput.PublicKey, smallOrderInput.Payload, smallOrderInput.Signature });
+			return crypto::VerifyMulti(signatureInputs.data(), signatureInputs.size());
+		}
+
+		void AssertVerifyMultiRejectsSmallOrderComponentInR(const EncodedPoint& smallOrderPoint) {
+			for (auto i = 0u; i < 20; ++i) {
+				// Arrange: S * B - h * A = R - T, which is never equal to R
+				auto input = CreateSmallOrderSignatureInput(smallOrderPoint, Neutral_Element);
+				ASSERT_FALSE(Verify(input.PublicKey, input.Payload, input.Signature));
+
+				// Act:
+				auto isVerified = VerifyMultiWithValidSignatures(input);
+
+				// Assert:
+				EXPECT_FALSE(isVerified) << "attempt " << i;
+			}
+		}
+
+		void AssertVerifyMultiMatchesVerifyForSmallOrderComponentInA(const EncodedPoint& smallOrderPoint) {
+			auto numAccepted = 0u;
+			auto numRejected = 0u;
+			for (auto i = 0u; i < 500 && (0 == numAccepted || 0 == numRejected); ++i) {
+				// Arrange: S * B - h * A = R - h * T, which is equal to R only for some h
+				auto input = CreateSmallOrderSignatureInput(Neutral_Element, smallOrderPoint);
+				auto isVerifiedIndividually = Verify(input.PublicKey, input.Payload, input.Signature);
+				++(isVerifiedIndividually ? numAccepted : numRejected);
+
+				// Act:
+				auto isVerified = VerifyMultiWithValidSignatures(input);
+
+				// Assert:
+				EXPECT_EQ(isVerifiedIndividually, isVerified) << "attempt " << i;
+			}
+
+			// Sanity: both outcomes were checked
+			EXPECT_NE(0u, numAccepted);
+			EXPECT_NE(0u, numRejected);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsSignatureWithOrder2ComponentInR) {
+		// Assert:
+		AssertVerifyMultiRejectsSmallOrderComponentInR(Order_2_Point);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsSignatureWithOrder8ComponentInR) {
+		// Assert:
+		AssertVerifyMultiRejectsSmallOrderComponentInR(Order_8_Point);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiMatchesVerifyForSignatureWithOrder2ComponentInPublicKey) {
+		// Assert:
+		AssertVerifyMultiMatchesVerifyForSmallOrderComponentInA(Order_2_Point);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiMatchesVerifyForSignatureWithOrder8ComponentInPublicKey) {
+		// Assert:
+		AssertVerifyMultiMatchesVerifyForSmallOrderComponentInA(Order_8_Point);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiRejectsSignatureWithSmallOrderPublicKey) {
+		// Arrange: public key is the small order point itself
+		for (const auto& smallOrderPoint : { Order_2_Point, Order_8_Point }) {
+			auto input = CreateSmallOrderSignatureInput(Neutral_Element, smallOrderPoint);
+			auto& publicKey = input.PublicKey;
+			publicKey = smallOrderPoint;
+
+			// Act:
+			auto isVerified = VerifyMultiWithValidSignatures(input);
+
+			// Assert:
+			EXPECT_EQ(Verify(publicKey, input.Payload, input.Signature), isVerified);
+		}
+	}
+
+	// endregion
 }}
@@ -274,26 +274,114 @@ namespace catapult { namespace deltaset {
 
 	// region iterable
 
-	TEST(TEST_CLASS, StorageBasedCacheIsNeitherIterableNorPrunable) {
+	TEST(TEST_CLASS, StorageBasedCacheIsNotIterable) {
 		// Act:
 		MapTraits::DiffUnderlying::ContainerType container(ConditionalContainerMode::Storage);
 
 		// Assert:
 		EXPECT_FALSE(IsSetIterable(container));
 		EXPECT_THROW(SelectIterableSet(container), catapult_invalid_argument);
-		EXPECT_THROW(SelectPrunableSet(container), catapult_invalid_argument);
 	}
 
-	TEST(TEST_CLASS, MemoryBasedCacheIsBothIterableAndPrunable) {
+	TEST(TEST_CLASS, MemoryBasedCacheIsIterable) {
 		// Act:
 		MapTraits::DiffUnderlying::ContainerType container(ConditionalContainerMode::Memory);
 
 		// Assert:
 		EXPECT_TRUE(IsSetIterable(container));
 		EXPECT_NO_THROW(SelectIterableSet(container));
-		EXPECT_NO_THROW(SelectPrunableSet(container));
-		EXPECT_EQ(&SelectIterableSet(container), &SelectPrunableSet(container));
 	}
 
 	// endregion
+
+	// region prunable
+
+	namespace {
+		struct OrderedSetTraits {
+		private:
+			using ElementType = test::SetElementType<test::MutableElementValueTraits>;
+
+		public:
+			using SetType = std::set<ElementType>;
+			using DeltaElementsWrapper = test::DeltaElementsTestUtils::Wrapper<SetType>;
+			using ContainerType = ConditionalContainer<SetStorageTraits<SetType, SetType>::KeyTraits, SetType, SetType>;
+
+		public:
+			static void AddElement(SetType& set, const std::string& name, unsigned int value) {
+				set.emplace(name, value);
+			}
+
+			static bool Contains(const ContainerType& set, const std::string& name, unsigned int value) {
+				return set.cend() != set.find(test::MutableTestElement(name, value));
+			}
+		};
+
+		template<typename TUpdate>
+		void AssertCanUpdateAndPrune(ConditionalContainerMode mode, TUpdate update) {
+			// Arrange:
+			OrderedSetTraits::ContainerType container(mode);
+
+			OrderedSetTraits::DeltaElementsWrapper seedWrapper;
+			OrderedSetTraits::AddElement(seedWrapper.Added, "alpha", 5);
+			OrderedSetTraits::AddElement(seedWrapper.Added, "beta", 6);
+			OrderedSetTraits::AddElement(seedWrapper.Added, "gamma", 7);
+			container.update(seedWrapper.deltas());
+
+			OrderedSetTraits::DeltaElementsWrapper wrapper;
+			OrderedSetTraits::AddElement(wrapper.Added, "aardvark", 3);
+			OrderedSetTraits::AddElement(wrapper.Added, "delta", 8);
+			OrderedSetTraits::AddElement(wrapper.Removed, "gamma", 7);
+
+			// Act: prune all elements before beta (including newly added elements)
+			update(container, wrapper.deltas(), PruningBoundary<test::MutableTestElement>(test::MutableTestElement("beta", 6)));
+
+			// Assert:
+			EXPECT_EQ(2u, container.size());
+			EXPECT_TRUE(OrderedSetTraits::Contains(container, "beta", 6));
+			EXPECT_TRUE(OrderedSetTraits::Contains(container, "delta", 8));
+		}
+
+		template<typename TUpdate>
+		void AssertCanUpdateWithoutPruning(ConditionalContainerMode mode, TUpdate update) {
+			// Arrange:
+			OrderedSetTraits::ContainerType container(mode);
+
+			OrderedSetTraits::DeltaElementsWrapper wrapper;
+			OrderedSetTraits::AddElement(wrapper.Added, "alpha", 5);
+			OrderedSetTraits::AddElement(wrapper.Added, "gamma", 7);
+
+			// Act:
+			update(container, wrapper.deltas(), PruningBoundary<test::MutableTestElement>());
+
+			// Assert:
+			EXPECT_EQ(2u, container.size());
+			EXPECT_TRUE(OrderedSetTraits::Contains(container, "alpha", 5));
+			EXPECT_TRUE(OrderedSetTraits::Contains(container, "gamma", 7));
+		}
+
+		void UpdateViaMember(
+				OrderedSetTraits::ContainerType& container,
+				const DeltaElements<OrderedSetTraits::SetType>& deltas,
+				const PruningBoundary<test::MutableTestElement>& pruningBoundary) {
+			container.update(deltas, pruningBoundary);
+		}
+
+		void UpdateViaFreeFunction(
+				OrderedSetTraits::ContainerType& container,
+				const DeltaElements<OrderedSetTraits::SetType>& deltas,
+				const PruningBoundary<test::MutableTestElement>& pruningBoundary) {
+			UpdateSet(container, deltas, pruningBoundary);
+		}
+	}
+
+#define PRUNING_TEST(TEST_NAME) \
+	TEST(TEST_CLASS, TEST_NAME##_Storage) { Assert##TEST_NAME(StorageMode, UpdateViaMember); } \
+	TEST(TEST_CLASS, TEST_NAME##_Memory) { Assert##TEST_NAME(MemoryMode, UpdateViaMember); } \
+	TEST(TEST_CLASS, TEST_NAME##ViaFreeFunction_Storage) { Assert##TEST_NAME(StorageMode, UpdateViaFreeFunction); } \
+	TEST(TEST_CLASS, TEST_NAME##ViaFreeFunction_Memory) { Assert##TEST_NAME(MemoryMode, UpdateViaFreeFunction); }
+
+	PRUNING_TEST(CanUpdateAndPrune)
+	PRUNING_TEST(CanUpdateWithoutPruning)
+
+	// endregion
 }}
@@ -34,5 +34,6 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(123u, options.DisruptorSize);
 		EXPECT_EQ(1u, options.ElementTraceInterval);
 		EXPECT_TRUE(options.ShouldThrowIfFull);
+		EXPECT_EQ(ConsumerWaitStrategy::Hybrid, options.WaitStrategy);
 	}
 }}
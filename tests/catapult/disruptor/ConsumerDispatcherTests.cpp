@@ -430,6 +430,47 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
 	}
 
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithMultipleConsumersUsingAnyWaitStrategy) {
+		for (auto waitStrategy : {
+			ConsumerWaitStrategy::Sleep,
+			ConsumerWaitStrategy::Busy_Spin,
+			ConsumerWaitStrategy::Spin_Yield,
+			ConsumerWaitStrategy::Blocking,
+			ConsumerWaitStrategy::Hybrid
+		}) {
+			// Arrange:
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			std::vector<Heights> collectedHeights[3];
+			std::vector<Heights> inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			// Act:
+			ConsumerDispatcher dispatcher(
+					options,
+					{
+						CreateConsumer(collectedHeights[0]),
+						CreateConsumer(collectedHeights[1]),
+						CreateConsumer(collectedHeights[2]),
+					},
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - push multiple elements
+			ProcessAll(dispatcher, std::move(ranges));
+			WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(expectedHeights, collectedHeights[0]) << waitStrategy;
+			EXPECT_EQ(expectedHeights, collectedHeights[1]) << waitStrategy;
+			EXPECT_EQ(expectedHeights, collectedHeights[2]) << waitStrategy;
+			EXPECT_EQ(expectedHeights, inspectedHeights) << waitStrategy;
+		}
+	}
+
 	// endregion
 
 	// region element marking
@@ -507,6 +548,172 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region parallel stages
+
+	namespace {
+		auto CreateNoOpInspector() {
+			return [](const auto&, const auto&) {};
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithEmptyStage) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> consumerStages{ {}, { CreateNoOpConsumer() } };
+
+		// Act + Assert:
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, consumerStages, CreateNoOpInspector()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotCreateDispatcherWithParallelLastStage) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> consumerStages{ { CreateNoOpConsumer() }, { CreateNoOpConsumer(), CreateNoOpConsumer() } };
+
+		// Act + Assert:
+		EXPECT_THROW(ConsumerDispatcher(Test_Dispatcher_Options, consumerStages, CreateNoOpInspector()), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreateDispatcherWithParallelStage) {
+		// Arrange:
+		std::vector<DisruptorConsumerStage> consumerStages{ { CreateNoOpConsumer(), CreateNoOpConsumer() }, { CreateNoOpConsumer() } };
+
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, consumerStages, CreateNoOpInspector());
+
+		// Assert: there is one thread per consumer
+		EXPECT_EQ(3u, dispatcher.size());
+		AssertHasProcessedNoElements(dispatcher);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithParallelStages) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(5);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		std::vector<Heights> collectedHeights[5];
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+
+		// Act:
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				std::vector<DisruptorConsumerStage>{
+					{ CreateConsumer(collectedHeights[0]), CreateConsumer(collectedHeights[1]) },
+					{ CreateConsumer(collectedHeights[2]), CreateConsumer(collectedHeights[3]) },
+					{ CreateConsumer(collectedHeights[4]) }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// - push multiple elements
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+		for (auto i = 0u; i < 5; ++i)
+			EXPECT_EQ(expectedHeights, collectedHeights[i]) << "consumer " << i;
+
+		EXPECT_EQ(expectedHeights, inspectedHeights);
+		EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+	}
+
+	TEST(TEST_CLASS, ConsumersWithinStageProcessElementInParallel) {
+		// Arrange: each consumer waits for the other consumer to start processing the same element
+		test::AutoSetFlag isFirstConsumerProcessing;
+		test::AutoSetFlag isSecondConsumerProcessing;
+		auto createConsumer = [](const auto& pProcessingState, const auto& pOtherProcessingState) {
+			return [pProcessingState, pOtherProcessingState](const auto&) {
+				pProcessingState->set();
+				pOtherProcessingState->wait();
+				return ConsumerResult::Continue();
+			};
+		};
+
+		std::atomic<size_t> numInspectorCalls(0);
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				std::vector<DisruptorConsumerStage>{
+					{
+						createConsumer(isFirstConsumerProcessing.state(), isSecondConsumerProcessing.state()),
+						createConsumer(isSecondConsumerProcessing.state(), isFirstConsumerProcessing.state())
+					},
+					{ CreateNoOpConsumer() }
+				},
+				[&numInspectorCalls](const auto&, const auto&) { ++numInspectorCalls; });
+
+		// Act: processing can only complete if both consumers are processing the element at the same time
+		ProcessAll(dispatcher, test::PrepareRanges(1));
+		WAIT_FOR_ONE(numInspectorCalls);
+
+		// Assert:
+		EXPECT_TRUE(isFirstConsumerProcessing.state()->isSet());
+		EXPECT_TRUE(isSecondConsumerProcessing.state()->isSet());
+	}
+
+	TEST(TEST_CLASS, NextStageWaitsForAllConsumersWithinStage) {
+		// Arrange:
+		test::AutoSetFlag isSlowConsumerUnblocked;
+		std::vector<Heights> collectedHeights;
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				std::vector<DisruptorConsumerStage>{
+					{
+						CreateNoOpConsumer(),
+						[pIsUnblocked = isSlowConsumerUnblocked.state()](const auto&) {
+							pIsUnblocked->wait();
+							return ConsumerResult::Continue();
+						}
+					},
+					{ CreateConsumer(collectedHeights) }
+				},
+				CreateNoOpInspector());
+
+		// Act: push single element
+		ProcessAll(dispatcher, test::PrepareRanges(1));
+		test::Pause();
+
+		// Assert: the element was not passed to the next stage
+		EXPECT_TRUE(collectedHeights.empty());
+
+		// Act: unblock the slow consumer
+		isSlowConsumerUnblocked.state()->set();
+		WAIT_FOR_ONE_EXPR(collectedHeights.size());
+
+		// Assert: the element was passed to the next stage
+		EXPECT_EQ(1u, collectedHeights.size());
+	}
+
+	TEST(TEST_CLASS, ElementsMarkedWithinParallelStageAreSkippedByNextStages) {
+		// Arrange:
+		std::vector<Heights> collectedHeights;
+		std::vector<Heights> inspectedHeights;
+		std::vector<CompletionStatus> inspectedStatuses;
+		auto ranges = test::PrepareRanges(5);
+		auto expectedHeights = GetExpectedHeights(ranges);
+		ConsumerDispatcher dispatcher(
+				Test_Dispatcher_Options,
+				std::vector<DisruptorConsumerStage>{
+					{ CreateNoOpConsumer(), CreateSkipIfFirstBlockIsEvenConsumer() },
+					{ CreateConsumer(collectedHeights) }
+				},
+				CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_VALUE_EXPR(5u, inspectedHeights.size());
+
+		// Assert: elements with even first block heights were skipped by the second stage
+		std::vector<Heights> expectedCollectedHeights;
+		for (const auto& heights : expectedHeights) {
+			if (0 != heights[0].unwrap() % 2)
+				expectedCollectedHeights.push_back(heights);
+		}
+
+		EXPECT_EQ(expectedCollectedHeights, collectedHeights);
+		EXPECT_EQ(expectedHeights, inspectedHeights);
+	}
+
+	// endregion
+
 	// region exception + space exhaution
 
 #ifdef __clang__
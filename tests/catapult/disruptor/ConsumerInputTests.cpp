@@ -164,6 +164,86 @@ namespace catapult { namespace disruptor {
 		EXPECT_THROW(TTraits::DetachRange(input), catapult_runtime_error);
 	}
 
+	// region sharedBlocks
+
+	TEST(TEST_CLASS, CannotShareBlocksFromInputWithoutBlocks) {
+		// Arrange:
+		test::EntitiesVector entities;
+		auto input = TransactionTraits::CreateInput(2, entities);
+
+		// Act + Assert:
+		EXPECT_THROW(input.sharedBlocks(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanShareBlocksFromInput) {
+		// Arrange:
+		test::EntitiesVector entities;
+		auto input = BlockTraits::CreateInput(3, entities);
+		input.blocks()[1].EntityHash = test::GenerateRandomData<Hash256_Size>();
+
+		// Act:
+		auto sharedElements = input.sharedBlocks();
+
+		// Assert: the shared elements are copies of the input elements that reference the original blocks
+		ASSERT_EQ(3u, sharedElements.size());
+		for (auto i = 0u; i < sharedElements.size(); ++i) {
+			EXPECT_NE(&input.blocks()[i], sharedElements[i].get()) << "element at " << i;
+			EXPECT_EQ(entities[i], &sharedElements[i]->Block) << "element at " << i;
+			EXPECT_EQ(input.blocks()[i].EntityHash, sharedElements[i]->EntityHash) << "element at " << i;
+		}
+
+		// - the input is unchanged
+		EXPECT_TRUE(input.hasBlocks());
+	}
+
+	TEST(TEST_CLASS, SharedBlocksOutliveInput) {
+		// Arrange:
+		test::EntitiesVector entities;
+		std::vector<Height> heights;
+		std::vector<std::shared_ptr<const model::BlockElement>> sharedElements;
+		{
+			auto input = BlockTraits::CreateInput(3, entities);
+			for (const auto& element : input.blocks())
+				heights.push_back(element.Block.Height);
+
+			// Act:
+			sharedElements = input.sharedBlocks();
+		}
+
+		// Assert: the shared elements are still valid after the input is destroyed
+		ASSERT_EQ(3u, sharedElements.size());
+		for (auto i = 0u; i < sharedElements.size(); ++i) {
+			EXPECT_EQ(entities[i], &sharedElements[i]->Block) << "element at " << i;
+			EXPECT_EQ(heights[i], sharedElements[i]->Block.Height) << "element at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDetachSharedBlocks) {
+		// Arrange:
+		test::EntitiesVector entities;
+		auto input = BlockTraits::CreateInput(3, entities);
+		auto sharedElements = input.sharedBlocks();
+
+		// Act + Assert:
+		EXPECT_THROW(input.detachBlockRange(), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CanDetachBlocksAfterSharedBlocksAreDestroyed) {
+		// Arrange:
+		test::EntitiesVector entities;
+		auto input = BlockTraits::CreateInput(3, entities);
+		input.sharedBlocks();
+
+		// Act:
+		auto range = input.detachBlockRange();
+
+		// Assert:
+		EXPECT_EQ(3u, range.size());
+		EXPECT_TRUE(input.empty());
+	}
+
+	// endregion
+
 	TEST(TEST_CLASS, CanOutputEmptyConsumerInput) {
 		// Arrange:
 		ConsumerInput input;
@@ -20,6 +20,7 @@
 
 #include "catapult/disruptor/DisruptorBarrier.h"
 #include "tests/TestHarness.h"
+#include <thread>
 
 namespace catapult { namespace disruptor {
 
@@ -45,4 +46,71 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(100u, barrier.level());
 		EXPECT_EQ(2u, barrier.position());
 	}
+
+	TEST(TEST_CLASS, CanAdvanceBarrierToGreaterPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 1);
+
+		// Act:
+		barrier.advanceTo(7);
+
+		// Assert:
+		EXPECT_EQ(7u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, CannotAdvanceBarrierToLesserOrEqualPosition) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+
+		// Act:
+		barrier.advanceTo(3);
+		barrier.advanceTo(5);
+
+		// Assert:
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	// region waitForAdvance
+
+	TEST(TEST_CLASS, WaitForAdvanceReturnsTrueWhenBarrierHasAlreadyAdvanced) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+
+		// Act:
+		auto isAdvanced = barrier.waitForAdvance(4, std::chrono::seconds(10));
+
+		// Assert:
+		EXPECT_TRUE(isAdvanced);
+	}
+
+	TEST(TEST_CLASS, WaitForAdvanceReturnsFalseWhenTimeoutElapses) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+
+		// Act:
+		auto isAdvanced = barrier.waitForAdvance(5, std::chrono::milliseconds(5));
+
+		// Assert:
+		EXPECT_FALSE(isAdvanced);
+		EXPECT_EQ(5u, barrier.position());
+	}
+
+	TEST(TEST_CLASS, WaitForAdvanceIsWokenWhenBarrierIsAdvanced) {
+		// Arrange:
+		DisruptorBarrier barrier(100, 5);
+		std::thread thread([&barrier]() {
+			test::Pause();
+			barrier.advance();
+		});
+
+		// Act: notice that the timeout is much larger than the pause
+		auto isAdvanced = barrier.waitForAdvance(5, std::chrono::seconds(10));
+		thread.join();
+
+		// Assert:
+		EXPECT_TRUE(isAdvanced);
+		EXPECT_EQ(6u, barrier.position());
+	}
+
+	// endregion
 }}
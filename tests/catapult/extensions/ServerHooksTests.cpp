@@ -85,7 +85,7 @@ namespace catapult { namespace extensions {
 
 			static auto CreateConsumerData() {
 				// dangling references are ok because the struct fields are not accessed
-				return consumers::TransactionsChangeInfo({}, {});
+				return consumers::TransactionsChangeInfo({}, {}, {}, {});
 			}
 		};
 
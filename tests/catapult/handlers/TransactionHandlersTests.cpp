@@ -19,6 +19,7 @@
 **/
 
 #include "catapult/handlers/TransactionHandlers.h"
+#include "catapult/api/SketchPackets.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -125,4 +126,147 @@ namespace catapult { namespace handlers {
 	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactions)
 
 	// endregion
+
+	// region PushTransactionHashesHandler
+
+	namespace {
+		struct PushTransactionHashesTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Push_Transaction_Hashes;
+			static constexpr auto Data_Size = Hash256_Size;
+
+			static constexpr size_t AdditionalPacketSize(size_t) {
+				return 0u;
+			}
+
+			static void PreparePacket(ionet::ByteBuffer&, size_t) {
+			}
+
+			static auto CreateRegistry() {
+				// note that int is used as a placeholder transaction registy
+				// because a real one is not needed by RegisterPushTransactionHashesHandler
+				return 7;
+			}
+
+			static auto RegisterHandler(ionet::ServerPacketHandlers& handlers, int, const TransactionHashRangeHandler& rangeHandler) {
+				return RegisterPushTransactionHashesHandler(handlers, rangeHandler);
+			}
+		};
+	}
+
+	DEFINE_PUSH_HANDLER_TESTS(TEST_CLASS, PushTransactionHashes)
+
+	// endregion
+
+	// region PullTransactionsByHashHandler
+
+	namespace {
+		struct PullTransactionsByHashTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Pull_Transactions_By_Hash;
+			static constexpr auto RegisterHandler = RegisterPullTransactionsByHashHandler;
+			using ResponseType = UnconfirmedTransactions;
+			static constexpr auto Valid_Request_Payload_Size = Hash256_Size;
+
+			using RetrieverParamType = utils::HashSet;
+
+			static auto ExtractFromPacket(const ionet::Packet& packet, size_t numRequestEntities) {
+				RetrieverParamType extracted;
+				auto pData = reinterpret_cast<const Hash256*>(packet.Data());
+				for (auto i = 0u; i < numRequestEntities; ++i)
+					extracted.insert(*pData++);
+
+				return extracted;
+			}
+
+			using ResponseContext = PullTransactionsTraits::ResponseContext;
+		};
+	}
+
+	DEFINE_PULL_HANDLER_TESTS(TEST_CLASS, PullTransactionsByHash)
+
+	// endregion
+
+	// region PullTransactionsSketchHandler
+
+	namespace {
+		auto CreateSketchRequestPacket(uint32_t numCells) {
+			auto pPacket = ionet::CreateSharedPacket<api::PullTransactionsSketchRequest>();
+			pPacket->NumCells = numCells;
+			return pPacket;
+		}
+
+		void AssertSketchRequestIsRejected(const ionet::Packet& packet) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			auto numRetrieverCalls = 0u;
+			RegisterPullTransactionsSketchHandler(handlers, [&numRetrieverCalls](auto numCells) {
+				++numRetrieverCalls;
+				return cache::UtSketch(numCells);
+			});
+
+			// Act:
+			ionet::ServerPacketHandlerContext context({}, "");
+			EXPECT_TRUE(handlers.process(packet, context));
+
+			// Assert:
+			EXPECT_EQ(0u, numRetrieverCalls);
+			test::AssertNoResponse(context);
+		}
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		auto pPacket = CreateSketchRequestPacket(3 * 4);
+		++pPacket->Size;
+
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*pPacket);
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToRequestWithInvalidNumberOfCells) {
+		// Act + Assert:
+		for (auto numCells : { 0u, 3u * 4 + 1, 3u * 5, 4u * 4 })
+			AssertSketchRequestIsRejected(*CreateSketchRequestPacket(numCells));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_DoesNotRespondToRequestWithTooManyCells) {
+		// Act + Assert:
+		AssertSketchRequestIsRejected(*CreateSketchRequestPacket(2 * cache::Max_Sketch_Num_Cells));
+	}
+
+	TEST(TEST_CLASS, PullTransactionsSketchHandler_WritesSketchCellsInResponseToValidRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		std::vector<uint32_t> retrieverNumCells;
+		RegisterPullTransactionsSketchHandler(handlers, [&hashes, &retrieverNumCells](auto numCells) {
+			retrieverNumCells.push_back(numCells);
+			cache::UtSketch sketch(numCells);
+			for (const auto& hash : hashes)
+				sketch.insert(hash);
+
+			return sketch;
+		});
+
+		// Act:
+		ionet::ServerPacketHandlerContext context({}, "");
+		EXPECT_TRUE(handlers.process(*CreateSketchRequestPacket(3 * 64), context));
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint32_t>({ 3 * 64 }), retrieverNumCells);
+
+		auto cellsSize = 3 * 64 * sizeof(cache::UtSketch::Cell);
+		test::AssertPacketHeader(context, sizeof(ionet::PacketHeader) + cellsSize, ionet::PacketType::Pull_Transactions_Sketch);
+
+		// - the response can be decoded
+		const auto* pCells = reinterpret_cast<const cache::UtSketch::Cell*>(test::GetSingleBufferData(context));
+		cache::UtSketch sketch(std::vector<cache::UtSketch::Cell>(pCells, pCells + 3 * 64));
+
+		std::vector<Hash256> positiveKeys;
+		std::vector<Hash256> negativeKeys;
+		EXPECT_TRUE(sketch.decode(positiveKeys, negativeKeys));
+		EXPECT_EQ(utils::HashSet(hashes.cbegin(), hashes.cend()), utils::HashSet(positiveKeys.cbegin(), positiveKeys.cend()));
+		EXPECT_TRUE(negativeKeys.empty());
+	}
+
+	// endregion
 }}
@@ -101,6 +101,28 @@ namespace catapult { namespace io {
 
 	namespace {
 		constexpr uint32_t Delegation_Chain_Size = 15;
+
+		struct BlockElementHolder {
+		public:
+			explicit BlockElementHolder(std::unique_ptr<model::Block>&& pBlockParam)
+					: pBlock(std::move(pBlockParam))
+					, Element(test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>()))
+			{}
+
+		public:
+			std::unique_ptr<model::Block> pBlock;
+			model::BlockElement Element;
+		};
+
+		auto CreateSharedBlockElements(Height startHeight, size_t count) {
+			std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+			for (auto i = 0u; i < count; ++i) {
+				auto pHolder = std::make_shared<BlockElementHolder>(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+				blockElements.push_back(std::shared_ptr<const model::BlockElement>(pHolder, &pHolder->Element));
+			}
+
+			return blockElements;
+		}
 	}
 
 	// region chainHeight
@@ -237,12 +259,7 @@ namespace catapult { namespace io {
 		auto pStorage = mocks::CreateMemoryBasedStorage(Delegation_Chain_Size);
 		auto pStorageRaw = pStorage.get();
 		BlockStorageCache cache(std::move(pStorage));
-		std::vector<std::unique_ptr<model::Block>> blocks;
-		std::vector<model::BlockElement> blockElements;
-		for (auto i = 0u; i < Num_Block_Elements; ++i) {
-			blocks.push_back(test::GenerateVerifiableBlockAtHeight(Height(Delegation_Chain_Size + i + 1)));
-			blockElements.push_back(test::BlockToBlockElement(*blocks.back(), test::GenerateRandomData<Hash256_Size>()));
-		}
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), Num_Block_Elements);
 
 		// Act:
 		cache.modifier().saveBlocks(blockElements);
@@ -252,16 +269,16 @@ namespace catapult { namespace io {
 		EXPECT_EQ(expectedChainHeight, cache.view().chainHeight());
 		for (auto i = 0u; i < Num_Block_Elements; ++i) {
 			auto pCacheBlockElement = cache.view().loadBlockElement(Height(Delegation_Chain_Size + i + 1));
-			EXPECT_EQ(blockElements[i].Block, pCacheBlockElement->Block);
-			EXPECT_EQ(blockElements[i].EntityHash, pCacheBlockElement->EntityHash);
+			EXPECT_EQ(blockElements[i]->Block, pCacheBlockElement->Block);
+			EXPECT_EQ(blockElements[i]->EntityHash, pCacheBlockElement->EntityHash);
 		}
 
 		// - underlying storage is updated
 		EXPECT_EQ(expectedChainHeight, pStorageRaw->chainHeight());
 		for (auto i = 0u; i < Num_Block_Elements; ++i) {
 			auto pStorageBlockElement = pStorageRaw->loadBlockElement(Height(Delegation_Chain_Size + i + 1));
-			EXPECT_EQ(blockElements[i].Block, pStorageBlockElement->Block);
-			EXPECT_EQ(blockElements[i].EntityHash, pStorageBlockElement->EntityHash);
+			EXPECT_EQ(blockElements[i]->Block, pStorageBlockElement->Block);
+			EXPECT_EQ(blockElements[i]->EntityHash, pStorageBlockElement->EntityHash);
 		}
 	}
 
@@ -270,16 +287,10 @@ namespace catapult { namespace io {
 		constexpr size_t Num_Block_Elements = 3;
 		auto pStorage = mocks::CreateMemoryBasedStorage(Delegation_Chain_Size);
 		BlockStorageCache cache(std::move(pStorage));
-		std::vector<std::unique_ptr<model::Block>> blocks;
-		std::vector<model::BlockElement> blockElements;
-		for (auto i = 0u; i < Num_Block_Elements; ++i) {
-			blocks.push_back(test::GenerateVerifiableBlockAtHeight(Height(Delegation_Chain_Size + i + 1)));
-			blockElements.push_back(test::BlockToBlockElement(*blocks.back(), test::GenerateRandomData<Hash256_Size>()));
-		}
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), Num_Block_Elements);
 
-		// - swap heights of two blocks
-		blocks[1]->Height = Height(Delegation_Chain_Size + 3);
-		blocks[2]->Height = Height(Delegation_Chain_Size + 2);
+		// - swap two blocks
+		std::swap(blockElements[1], blockElements[2]);
 
 		// Act + Assert:
 		EXPECT_THROW(cache.modifier().saveBlocks(blockElements), catapult_invalid_argument);
@@ -292,7 +303,7 @@ namespace catapult { namespace io {
 		BlockStorageCache cache(std::move(pStorage));
 
 		// Act:
-		cache.modifier().saveBlocks(std::vector<model::BlockElement>());
+		cache.modifier().saveBlocks(std::vector<std::shared_ptr<const model::BlockElement>>());
 
 		// Assert:
 		auto expectedChainHeight = Height(Delegation_Chain_Size);
@@ -322,6 +333,238 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region caching
+
+	namespace {
+		constexpr auto Block_Size = sizeof(model::BlockHeader);
+
+		auto CreateCacheWithCapacity(size_t numBlocks) {
+			auto maxCacheSize = utils::FileSize::FromBytes(numBlocks * Block_Size);
+			return std::make_unique<BlockStorageCache>(mocks::CreateMemoryBasedStorage(Delegation_Chain_Size), maxCacheSize);
+		}
+
+		bool IsCached(const BlockStorageCache& cache, const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+			// cached block elements are returned without being copied
+			return pBlockElement == cache.view().loadBlockElement(pBlockElement->Block.Height);
+		}
+
+		auto CreateBlockElementsSharingBuffer(Height startHeight, size_t count) {
+			auto pHolders = std::make_shared<std::vector<BlockElementHolder>>();
+			pHolders->reserve(count);
+			for (auto i = 0u; i < count; ++i)
+				pHolders->emplace_back(test::GenerateVerifiableBlockAtHeight(startHeight + Height(i)));
+
+			std::vector<std::shared_ptr<const model::BlockElement>> blockElements;
+			for (const auto& holder : *pHolders)
+				blockElements.push_back(std::shared_ptr<const model::BlockElement>(pHolders, &holder.Element));
+
+			return blockElements;
+		}
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCachesBlockElementsWithoutCopying) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(10);
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 5);
+
+		// Act:
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Assert:
+		auto statistics = pCache->statistics();
+		EXPECT_EQ(5u, statistics.NumCachedElements);
+		EXPECT_EQ(5 * Block_Size, statistics.CachedBlocksSize);
+
+		for (const auto& pBlockElement : blockElements)
+			EXPECT_TRUE(IsCached(*pCache, pBlockElement)) << pBlockElement->Block.Height;
+	}
+
+	TEST(TEST_CLASS, SaveBlockCachesCopyOfBlockElement) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(10);
+		auto pBlock = test::GenerateVerifiableBlockAtHeight(Height(Delegation_Chain_Size + 1));
+		auto blockElement = test::BlockToBlockElement(*pBlock, test::GenerateRandomData<Hash256_Size>());
+
+		// Act:
+		pCache->modifier().saveBlock(blockElement);
+		auto pCacheBlockElement = pCache->view().loadBlockElement(Height(Delegation_Chain_Size + 1));
+
+		// Assert:
+		EXPECT_EQ(1u, pCache->statistics().NumCachedElements);
+		EXPECT_NE(&blockElement, pCacheBlockElement.get());
+		EXPECT_NE(pBlock.get(), &pCacheBlockElement->Block);
+		test::AssertEqual(blockElement, *pCacheBlockElement);
+	}
+
+	TEST(TEST_CLASS, CacheEvictsLeastRecentlyUsedBlockElementsWhenFull) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(3);
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 3);
+		pCache->modifier().saveBlocks(blockElements);
+
+		// - use the oldest block element
+		EXPECT_TRUE(IsCached(*pCache, blockElements[0]));
+
+		// Act:
+		auto newBlockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 4), 1);
+		pCache->modifier().saveBlocks(newBlockElements);
+
+		// Assert: the least recently used block element was evicted
+		EXPECT_EQ(3u, pCache->statistics().NumCachedElements);
+		EXPECT_TRUE(IsCached(*pCache, blockElements[0]));
+		EXPECT_FALSE(IsCached(*pCache, blockElements[1]));
+		EXPECT_TRUE(IsCached(*pCache, blockElements[2]));
+		EXPECT_TRUE(IsCached(*pCache, newBlockElements[0]));
+	}
+
+	TEST(TEST_CLASS, CacheAlwaysRetainsMostRecentlySavedBlockElement) {
+		// Arrange: create a cache that cannot hold any block element
+		auto pCache = CreateCacheWithCapacity(0);
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 3);
+
+		// Act:
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Assert:
+		EXPECT_EQ(1u, pCache->statistics().NumCachedElements);
+		EXPECT_FALSE(IsCached(*pCache, blockElements[0]));
+		EXPECT_FALSE(IsCached(*pCache, blockElements[1]));
+		EXPECT_TRUE(IsCached(*pCache, blockElements[2]));
+	}
+
+	TEST(TEST_CLASS, SaveBlocksAccountsForSharedBufferUntilAllElementsAreEvicted) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(5);
+		auto blockElements = CreateBlockElementsSharingBuffer(Height(Delegation_Chain_Size + 1), 3);
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Act:
+		pCache->modifier().dropBlocksAfter(Height(Delegation_Chain_Size + 1));
+
+		// Assert: the remaining block element retains the whole buffer
+		auto statistics = pCache->statistics();
+		EXPECT_EQ(1u, statistics.NumCachedElements);
+		EXPECT_EQ(3 * Block_Size, statistics.CachedBlocksSize);
+		EXPECT_TRUE(IsCached(*pCache, blockElements[0]));
+	}
+
+	TEST(TEST_CLASS, SaveBlocksEvictsAllElementsSharingBufferBeforeReleasingIt) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(4);
+		auto blockElements = CreateBlockElementsSharingBuffer(Height(Delegation_Chain_Size + 1), 3);
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Act:
+		auto newBlockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 4), 2);
+		pCache->modifier().saveBlocks(newBlockElements);
+
+		// Assert: evicting a single element of the buffer does not release any memory
+		auto statistics = pCache->statistics();
+		EXPECT_EQ(2u, statistics.NumCachedElements);
+		EXPECT_EQ(2 * Block_Size, statistics.CachedBlocksSize);
+		for (const auto& pBlockElement : blockElements)
+			EXPECT_FALSE(IsCached(*pCache, pBlockElement)) << pBlockElement->Block.Height;
+
+		for (const auto& pBlockElement : newBlockElements)
+			EXPECT_TRUE(IsCached(*pCache, pBlockElement)) << pBlockElement->Block.Height;
+	}
+
+	TEST(TEST_CLASS, SaveBlocksCachesCopiesOfMostRecentElementsWhenSharedBufferIsLargerThanCache) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(2);
+		auto blockElements = CreateBlockElementsSharingBuffer(Height(Delegation_Chain_Size + 1), 5);
+
+		// Act:
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Assert: only copies of the most recent block elements that fit are cached
+		auto statistics = pCache->statistics();
+		EXPECT_EQ(2u, statistics.NumCachedElements);
+		EXPECT_EQ(2 * Block_Size, statistics.CachedBlocksSize);
+		EXPECT_EQ(Height(Delegation_Chain_Size + 5), pCache->view().chainHeight());
+
+		for (auto i = 3u; i < blockElements.size(); ++i) {
+			auto pCacheBlockElement = pCache->view().loadBlockElement(blockElements[i]->Block.Height);
+			EXPECT_NE(blockElements[i], pCacheBlockElement);
+			test::AssertEqual(*blockElements[i], *pCacheBlockElement);
+		}
+
+		EXPECT_EQ(2u, pCache->statistics().NumHits);
+	}
+
+	TEST(TEST_CLASS, StatisticsTrackCacheHitsAndMisses) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(3);
+		pCache->modifier().saveBlocks(CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 3));
+
+		// Act: load two cached and three uncached blocks
+		for (auto height : { 1u, 2u, 16u, 17u, 3u })
+			pCache->view().loadBlock(Height(height));
+
+		auto statistics = pCache->statistics();
+
+		// Assert:
+		EXPECT_EQ(3u, statistics.NumCachedElements);
+		EXPECT_EQ(3 * Block_Size, statistics.CachedBlocksSize);
+		EXPECT_EQ(2u, statistics.NumHits);
+		EXPECT_EQ(3u, statistics.NumMisses);
+	}
+
+	TEST(TEST_CLASS, DropBlocksAfterRemovesCachedBlockElementsAboveHeight) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(5);
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 5);
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Act:
+		pCache->modifier().dropBlocksAfter(Height(Delegation_Chain_Size + 2));
+
+		// Assert:
+		auto statistics = pCache->statistics();
+		EXPECT_EQ(2u, statistics.NumCachedElements);
+		EXPECT_EQ(2 * Block_Size, statistics.CachedBlocksSize);
+		EXPECT_TRUE(IsCached(*pCache, blockElements[0]));
+		EXPECT_TRUE(IsCached(*pCache, blockElements[1]));
+	}
+
+	TEST(TEST_CLASS, LoadHashesFromReturnsHashesWhenAllAreCached) {
+		// Arrange:
+		auto pCache = CreateCacheWithCapacity(5);
+		auto blockElements = CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 5);
+		pCache->modifier().saveBlocks(blockElements);
+
+		// Act:
+		auto hashes = pCache->view().loadHashesFrom(Height(Delegation_Chain_Size + 2), 10);
+
+		// Assert:
+		ASSERT_EQ(4u, hashes.size());
+
+		auto i = 1u;
+		for (const auto& hash : hashes) {
+			EXPECT_EQ(blockElements[i]->EntityHash, hash) << "hash at " << i;
+			++i;
+		}
+	}
+
+	TEST(TEST_CLASS, LoadHashesFromReturnsHashesWhenSomeAreNotCached) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBasedStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), utils::FileSize::FromBytes(5 * Block_Size));
+		cache.modifier().saveBlocks(CreateSharedBlockElements(Height(Delegation_Chain_Size + 1), 5));
+
+		// Act:
+		auto cacheHashes = cache.view().loadHashesFrom(Height(Delegation_Chain_Size - 2), 8);
+		auto storageHashes = pStorageRaw->loadHashesFrom(Height(Delegation_Chain_Size - 2), 8);
+
+		// Assert:
+		ASSERT_EQ(8u, storageHashes.size());
+		ASSERT_EQ(8u, cacheHashes.size());
+		EXPECT_TRUE(std::equal(storageHashes.cbegin(), storageHashes.cend(), cacheHashes.cbegin()));
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
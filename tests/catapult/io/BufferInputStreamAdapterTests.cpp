@@ -0,0 +1,95 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS BufferInputStreamAdapterTests
+
+	TEST(TEST_CLASS, EofIsInitiallySetOnlyForEmptyBuffer) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+
+		// Act + Assert:
+		EXPECT_TRUE(BufferInputStreamAdapter(RawBuffer()).eof());
+		EXPECT_FALSE(BufferInputStreamAdapter(buffer).eof());
+	}
+
+	TEST(TEST_CLASS, CanReadAllDataWithSingleRead) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result(buffer.size());
+
+		// Act:
+		input.read(result);
+
+		// Assert:
+		EXPECT_EQ(buffer, result);
+		EXPECT_TRUE(input.eof());
+	}
+
+	TEST(TEST_CLASS, CanReadAllDataWithMultipleReads) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result1(100);
+		std::vector<uint8_t> result2(23);
+
+		// Act:
+		input.read(result1);
+		auto isEofAfterFirstRead = input.eof();
+		input.read(result2);
+
+		// Assert:
+		EXPECT_EQ(std::vector<uint8_t>(buffer.cbegin(), buffer.cbegin() + 100), result1);
+		EXPECT_EQ(std::vector<uint8_t>(buffer.cbegin() + 100, buffer.cend()), result2);
+		EXPECT_FALSE(isEofAfterFirstRead);
+		EXPECT_TRUE(input.eof());
+	}
+
+	TEST(TEST_CLASS, CannotReadMoreThanBufferSize) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result(buffer.size() + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(input.read(result), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, FailedReadDoesNotAdvancePosition) {
+		// Arrange:
+		auto buffer = test::GenerateRandomVector(123);
+		BufferInputStreamAdapter input(buffer);
+		std::vector<uint8_t> result1(124);
+		std::vector<uint8_t> result2(123);
+
+		// Act:
+		EXPECT_THROW(input.read(result1), catapult_file_io_error);
+		input.read(result2);
+
+		// Assert:
+		EXPECT_EQ(buffer, result2);
+		EXPECT_TRUE(input.eof());
+	}
+}}
@@ -0,0 +1,313 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/SegmentedFileStorage.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/RawFile.h"
+#include "tests/catapult/io/test/BlockStorageTestUtils.h"
+#include "tests/test/core/StorageTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
+
+using catapult::test::TempDirectoryGuard;
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS SegmentedFileStorageTests
+
+	namespace {
+		constexpr auto Index_Entry_Size = 48u;
+		constexpr auto Chain_Height_Offset = 8u;
+
+		std::string GetIndexPath(const std::string& baseDirectory) {
+			return baseDirectory + "/segments.idx";
+		}
+
+		std::string GetSegmentPath(const std::string& baseDirectory, uint32_t segmentId) {
+			std::stringstream pathBuilder;
+			pathBuilder << baseDirectory << "/" << std::setw(5) << std::setfill('0') << segmentId << ".seg";
+			return pathBuilder.str();
+		}
+
+		void FakeHeight(const std::string& destination, Height height) {
+			// append zeroed index entries for all blocks after the nemesis block and update the chain height
+			RawFile indexFile(GetIndexPath(destination), OpenMode::Read_Append);
+			indexFile.seek(indexFile.size());
+			indexFile.write(std::vector<uint8_t>((height.unwrap() - 2) * Index_Entry_Size));
+
+			indexFile.seek(Chain_Height_Offset);
+			Write(indexFile, height - Height(1));
+		}
+
+		template<uint64_t Max_Segment_Size>
+		struct SegmentedTraitsT {
+			using Guard = TempDirectoryGuard;
+			using StorageType = SegmentedFileStorage;
+
+			static std::unique_ptr<StorageType> OpenStorage(const std::string& destination) {
+				return std::make_unique<StorageType>(destination, utils::FileSize::FromBytes(Max_Segment_Size));
+			}
+
+			static std::unique_ptr<StorageType> PrepareStorage(const std::string& destination, Height height = Height()) {
+				// import the nemesis block from the one-file-per-block seed
+				test::PrepareStorage(destination);
+				{
+					FileBasedStorage seedStorage(destination);
+					ImportBlocks(seedStorage, *OpenStorage(destination));
+				}
+
+				if (Height() != height)
+					FakeHeight(destination, height);
+
+				return OpenStorage(destination);
+			}
+		};
+
+		using SegmentedTraits = SegmentedTraitsT<16 * 1024>;
+
+		// every block is stored in its own segment
+		using SingleBlockSegmentedTraits = SegmentedTraitsT<1>;
+	}
+
+	DEFINE_PREPARED_BLOCK_STORAGE_TESTS(SegmentedTraits)
+
+	// region import
+
+	TEST(TEST_CLASS, CanImportNemesisBlockFromSeedStorage) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+		FileBasedStorage seedStorage(tempDir.name());
+		SegmentedFileStorage storage(tempDir.name());
+
+		// Sanity:
+		EXPECT_EQ(Height(0), storage.chainHeight());
+
+		// Act:
+		auto numImportedBlocks = ImportBlocks(seedStorage, storage);
+
+		// Assert:
+		EXPECT_EQ(1u, numImportedBlocks);
+		EXPECT_EQ(Height(1), storage.chainHeight());
+		test::AssertEqual(*seedStorage.loadBlockElement(Height(1)), *storage.loadBlockElement(Height(1)));
+		EXPECT_TRUE(model::VerifyBlockHeaderSignature(storage.loadBlockElement(Height(1))->Block));
+	}
+
+	TEST(TEST_CLASS, ImportOnlyCopiesBlocksAboveDestinationChainHeight) {
+		// Arrange:
+		auto pSourceStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(10);
+		TempDirectoryGuard destinationDir("../temp.destination.dir");
+		SegmentedFileStorage destinationStorage(destinationDir.name());
+		for (auto height = Height(1); height <= Height(4); height = height + Height(1))
+			destinationStorage.saveBlock(*pSourceStorage->loadBlockElement(height));
+
+		// Act:
+		auto numImportedBlocks = ImportBlocks(*pSourceStorage, destinationStorage);
+
+		// Assert:
+		EXPECT_EQ(6u, numImportedBlocks);
+		EXPECT_EQ(Height(10), destinationStorage.chainHeight());
+		for (auto height = Height(1); height <= Height(10); height = height + Height(1))
+			test::AssertEqual(*pSourceStorage->loadBlockElement(height), *destinationStorage.loadBlockElement(height));
+	}
+
+	// endregion
+
+	// region persistence
+
+	TEST(TEST_CLASS, CanReadSavedBlocksAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactionsAtHeight(Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactionsAtHeight(Height(3));
+		auto element1 = test::CreateBlockElementForSaveTests(*pBlock1);
+		auto element2 = test::CreateBlockElementForSaveTests(*pBlock2);
+		{
+			auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element1);
+			pStorage->saveBlock(element2);
+		}
+
+		// Act:
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+		auto hashes = pStorage->loadHashesFrom(Height(2), 10);
+
+		// Assert:
+		EXPECT_EQ(Height(3), pStorage->chainHeight());
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+
+		ASSERT_EQ(2u, hashes.size());
+		EXPECT_EQ(element1.EntityHash, *hashes.cbegin());
+		EXPECT_EQ(element2.EntityHash, *++hashes.cbegin());
+	}
+
+	TEST(TEST_CLASS, DroppedBlocksAreNotVisibleAcrossDifferentStorageInstances) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(6));
+		auto expectedBlockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		{
+			auto pStorage = SegmentedTraits::PrepareStorage(tempDir.name());
+			test::SeedBlocks(*pStorage, 10);
+
+			// Act: drop blocks and save a different block at the next height
+			pStorage->dropBlocksAfter(Height(5));
+			pStorage->saveBlock(expectedBlockElement);
+		}
+
+		auto pStorage = SegmentedTraits::OpenStorage(tempDir.name());
+
+		// Assert:
+		EXPECT_EQ(Height(6), pStorage->chainHeight());
+		test::AssertEqual(expectedBlockElement, *pStorage->loadBlockElement(Height(6)));
+		EXPECT_THROW(pStorage->loadBlockElement(Height(7)), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CannotDropBlocksAfterHeightGreaterThanChainHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->dropBlocksAfter(Height(6)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region memory mapping
+
+	TEST(TEST_CLASS, LoadedBlocksOutliveStorage) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(5);
+		auto pBlock = test::GenerateBlockWithTransactionsAtHeight(Height(6));
+		auto expectedBlockElement = test::CreateBlockElementForSaveTests(*pBlock);
+		pStorage->saveBlock(expectedBlockElement);
+
+		// Act: destroy the storage after loading
+		auto pLoadedBlock = pStorage->loadBlock(Height(6));
+		auto pLoadedBlockElement = pStorage->loadBlockElement(Height(6));
+		pStorage.pStorage.reset();
+
+		// Assert: the mapped segment is still accessible
+		EXPECT_EQ(*pBlock, *pLoadedBlock);
+		test::AssertEqual(expectedBlockElement, *pLoadedBlockElement);
+	}
+
+	TEST(TEST_CLASS, LoadedBlocksAreUnaffectedBySubsequentSaves) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SegmentedTraits>(5);
+		auto pLoadedBlock = pStorage->loadBlock(Height(5));
+		auto blockCopy = test::CopyBlock(*pLoadedBlock);
+
+		// Act: append blocks to the same segment, which requires it to be remapped
+		test::SeedBlocks(*pStorage, Height(6), Height(8));
+		auto pLoadedNextBlock = pStorage->loadBlock(Height(8));
+
+		// Assert:
+		EXPECT_EQ(*blockCopy, *pLoadedBlock);
+		EXPECT_EQ(Height(8), pLoadedNextBlock->Height);
+	}
+
+	// endregion
+
+	// region segments
+
+	TEST(TEST_CLASS, SegmentsAreRolledOverWhenFull) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SingleBlockSegmentedTraits>(5);
+		const auto& directory = pStorage.pTempDirectoryGuard->name();
+
+		// Assert: each block is in its own segment
+		for (auto segmentId = 0u; segmentId < 5; ++segmentId)
+			EXPECT_TRUE(boost::filesystem::exists(GetSegmentPath(directory, segmentId))) << "segment " << segmentId;
+
+		EXPECT_FALSE(boost::filesystem::exists(GetSegmentPath(directory, 5)));
+
+		for (auto height = Height(1); height <= Height(5); height = height + Height(1))
+			EXPECT_EQ(height, pStorage->loadBlock(height)->Height);
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_DeletesSegmentsContainingOnlyPrunedBlocks) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SingleBlockSegmentedTraits>(10);
+		const auto& directory = pStorage.pTempDirectoryGuard->name();
+
+		// Act: prune will remove segments containing blocks 2-7
+		pStorage->pruneBlocksBefore(Height(8));
+
+		// Assert:
+		EXPECT_EQ(Height(10), pStorage->chainHeight());
+		for (auto segmentId = 0u; segmentId < 10; ++segmentId) {
+			auto isPruned = 1 <= segmentId && segmentId <= 6;
+			EXPECT_EQ(!isPruned, boost::filesystem::exists(GetSegmentPath(directory, segmentId))) << "segment " << segmentId;
+		}
+
+		EXPECT_TRUE(!!pStorage->loadBlockElement(Height(1)));
+		EXPECT_THROW(pStorage->loadBlockElement(Height(5)), catapult_runtime_error);
+		EXPECT_TRUE(!!pStorage->loadBlockElement(Height(8)));
+		EXPECT_EQ(3u, pStorage->loadHashesFrom(Height(5), 3).size());
+	}
+
+	TEST(TEST_CLASS, PruneBlocksBefore_ThrowsAtHeightAfterChainHeight) {
+		// Arrange:
+		auto pStorage = test::PrepareStorageWithBlocks<SingleBlockSegmentedTraits>(5);
+
+		// Act + Assert:
+		EXPECT_THROW(pStorage->pruneBlocksBefore(Height(10)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region format
+
+	namespace {
+		void CorruptIndexHeader(const std::string& directory, size_t offset, uint16_t value) {
+			RawFile indexFile(GetIndexPath(directory), OpenMode::Read_Append);
+			indexFile.seek(offset);
+			indexFile.write({ reinterpret_cast<const uint8_t*>(&value), sizeof(uint16_t) });
+		}
+	}
+
+	TEST(TEST_CLASS, CannotOpenStorageWithInvalidIndexMagic) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		SegmentedTraits::PrepareStorage(tempDir.name());
+		CorruptIndexHeader(tempDir.name(), 0, 0x1234);
+
+		// Act + Assert:
+		EXPECT_THROW(SegmentedTraits::OpenStorage(tempDir.name()), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotOpenStorageWithUnsupportedIndexVersion) {
+		// Arrange:
+		TempDirectoryGuard tempDir;
+		SegmentedTraits::PrepareStorage(tempDir.name());
+		CorruptIndexHeader(tempDir.name(), 4, SegmentedFileStorage::Format_Version + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(SegmentedTraits::OpenStorage(tempDir.name()), catapult_runtime_error);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/StringOutputStream.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS StringOutputStreamTests
+
+	namespace {
+		std::string ToString(const std::vector<uint8_t>& buffer) {
+			return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+		}
+	}
+
+	TEST(TEST_CLASS, StreamIsInitiallyEmpty) {
+		// Act:
+		StringOutputStream output(100);
+
+		// Assert:
+		EXPECT_EQ(0u, output.str().size());
+		EXPECT_LE(100u, output.str().capacity());
+	}
+
+	TEST(TEST_CLASS, CanWriteSingleBuffer) {
+		// Arrange:
+		StringOutputStream output;
+		auto buffer = test::GenerateRandomVector(123);
+
+		// Act:
+		output.write(buffer);
+
+		// Assert:
+		EXPECT_EQ(ToString(buffer), output.str());
+	}
+
+	TEST(TEST_CLASS, CanWriteMultipleBuffers) {
+		// Arrange:
+		StringOutputStream output;
+		auto buffer1 = test::GenerateRandomVector(123);
+		auto buffer2 = test::GenerateRandomVector(50);
+
+		// Act:
+		output.write(buffer1);
+		output.write(buffer2);
+
+		// Assert:
+		EXPECT_EQ(ToString(buffer1) + ToString(buffer2), output.str());
+	}
+
+	TEST(TEST_CLASS, FlushDoesNotChangeWrittenData) {
+		// Arrange:
+		StringOutputStream output;
+		auto buffer = test::GenerateRandomVector(123);
+		output.write(buffer);
+
+		// Act:
+		output.flush();
+
+		// Assert:
+		EXPECT_EQ(ToString(buffer), output.str());
+	}
+}}
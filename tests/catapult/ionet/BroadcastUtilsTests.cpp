@@ -134,6 +134,45 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region transaction announcements
+
+	TEST(TEST_CLASS, CanCreateAnnouncementPayload_None) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+
+		// Act:
+		auto payload = CreateAnnouncementPayload(transactionInfos);
+
+		// Assert:
+		test::AssertPacketHeader(payload, sizeof(PacketHeader), PacketType::Push_Transaction_Hashes);
+		EXPECT_TRUE(payload.buffers().empty());
+	}
+
+	TEST(TEST_CLASS, CanCreateAnnouncementPayload_Multiple) {
+		// Arrange:
+		std::vector<model::TransactionInfo> transactionInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			auto pTransaction = std::shared_ptr<model::Transaction>(test::GenerateRandomTransaction());
+			transactionInfos.push_back(model::TransactionInfo(pTransaction, test::GenerateRandomData<Hash256_Size>()));
+		}
+
+		// Act:
+		auto payload = CreateAnnouncementPayload(transactionInfos);
+
+		// Assert: a single buffer is present composed of all hashes
+		test::AssertPacketHeader(payload, sizeof(PacketHeader) + 3 * Hash256_Size, PacketType::Push_Transaction_Hashes);
+		ASSERT_EQ(1u, payload.buffers().size());
+
+		const auto& buffer = payload.buffers()[0];
+		ASSERT_EQ(3 * Hash256_Size, buffer.Size);
+
+		const auto* pHash = reinterpret_cast<const Hash256*>(buffer.pData);
+		for (auto i = 0u; i < transactionInfos.size(); ++i, ++pHash)
+			EXPECT_EQ(transactionInfos[i].EntityHash, *pHash) << "hash at " << i;
+	}
+
+	// endregion
+
 	// region cosignatures
 
 	namespace {
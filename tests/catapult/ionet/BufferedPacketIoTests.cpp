@@ -19,7 +19,10 @@
 **/
 
 #include "catapult/ionet/BufferedPacketIo.h"
+#include "catapult/ionet/BatchPacketWriter.h"
 #include "catapult/ionet/PacketSocket.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
 #include "tests/test/net/SocketTestUtils.h"
 
 namespace catapult { namespace ionet {
@@ -51,4 +54,166 @@ namespace catapult { namespace ionet {
 		// Assert:
 		test::AssertReadCanReadMultipleSimultaneousPayloadsWithoutInterleaving(Transform);
 	}
+
+	// region write coalescing
+
+	namespace {
+		class MockBatchPacketWriter : public BatchPacketWriter {
+		public:
+			void writeMultiple(const std::vector<PacketPayload>& payloads, const PacketIo::WriteCallback& callback) override {
+				std::vector<uint32_t> payloadSizes;
+				for (const auto& payload : payloads)
+					payloadSizes.push_back(payload.header().Size);
+
+				BatchPayloadSizes.push_back(payloadSizes);
+				Callbacks.push_back(callback);
+			}
+
+		public:
+			std::vector<std::vector<uint32_t>> BatchPayloadSizes;
+			std::vector<PacketIo::WriteCallback> Callbacks;
+		};
+
+		struct CoalescingTestContext {
+		public:
+			CoalescingTestContext()
+					: Strand(Service)
+					, pBatchWriter(std::make_shared<MockBatchPacketWriter>())
+					, pIo(CreateBufferedPacketIo(std::make_shared<mocks::MockPacketIo>(), pBatchWriter, Strand))
+			{}
+
+		public:
+			void write(uint32_t packetSize) {
+				pIo->write(PacketPayload(test::CreateRandomPacket(packetSize - sizeof(Packet), PacketType::Undefined)), [this](auto code) {
+					WriteCodes.push_back(code);
+				});
+			}
+
+			void completeBatch(size_t index, SocketOperationCode code) {
+				pBatchWriter->Callbacks[index](code);
+				runAll();
+			}
+
+			void runAll() {
+				Service.reset();
+				Service.run();
+			}
+
+		public:
+			boost::asio::io_service Service;
+			boost::asio::strand Strand;
+			std::shared_ptr<MockBatchPacketWriter> pBatchWriter;
+			std::shared_ptr<PacketIo> pIo;
+			std::vector<SocketOperationCode> WriteCodes;
+		};
+	}
+
+	TEST(TEST_CLASS, WriteDelegatesSingleWriteToBatchWriter) {
+		// Arrange:
+		CoalescingTestContext context;
+
+		// Act:
+		context.write(100);
+		context.runAll();
+		context.completeBatch(0, SocketOperationCode::Success);
+
+		// Assert:
+		using BatchPayloadSizes = std::vector<std::vector<uint32_t>>;
+		EXPECT_EQ(BatchPayloadSizes({ { 100 } }), context.pBatchWriter->BatchPayloadSizes);
+		EXPECT_EQ(std::vector<SocketOperationCode>({ SocketOperationCode::Success }), context.WriteCodes);
+	}
+
+	TEST(TEST_CLASS, WriteCoalescesAllWritesQueuedWhileWriteIsInProgress) {
+		// Arrange: start a write and queue three more while it is in progress
+		CoalescingTestContext context;
+		for (auto packetSize : { 100u, 110u, 120u, 130u })
+			context.write(packetSize);
+
+		context.runAll();
+
+		// Sanity: only the first write has been started
+		using BatchPayloadSizes = std::vector<std::vector<uint32_t>>;
+		EXPECT_EQ(BatchPayloadSizes({ { 100 } }), context.pBatchWriter->BatchPayloadSizes);
+
+		// Act:
+		context.completeBatch(0, SocketOperationCode::Success);
+
+		// Assert: all queued writes were started with a single batch write
+		EXPECT_EQ(BatchPayloadSizes({ { 100 }, { 110, 120, 130 } }), context.pBatchWriter->BatchPayloadSizes);
+		EXPECT_EQ(std::vector<SocketOperationCode>({ SocketOperationCode::Success }), context.WriteCodes);
+	}
+
+	TEST(TEST_CLASS, WriteCompletesAllCoalescedWritesWithBatchResult) {
+		// Arrange:
+		CoalescingTestContext context;
+		for (auto packetSize : { 100u, 110u, 120u, 130u })
+			context.write(packetSize);
+
+		context.runAll();
+		context.completeBatch(0, SocketOperationCode::Success);
+
+		// Act:
+		context.completeBatch(1, SocketOperationCode::Write_Error);
+
+		// Assert: no further batches were started and all writes in the second batch failed
+		EXPECT_EQ(2u, context.pBatchWriter->BatchPayloadSizes.size());
+		EXPECT_EQ(std::vector<SocketOperationCode>({
+			SocketOperationCode::Success,
+			SocketOperationCode::Write_Error,
+			SocketOperationCode::Write_Error,
+			SocketOperationCode::Write_Error
+		}), context.WriteCodes);
+	}
+
+	TEST(TEST_CLASS, WriteRetriesMalformedCoalescedWritesIndividually) {
+		// Arrange:
+		CoalescingTestContext context;
+		for (auto packetSize : { 100u, 110u, 120u, 130u })
+			context.write(packetSize);
+
+		context.runAll();
+		context.completeBatch(0, SocketOperationCode::Success);
+
+		// Act: reject the coalesced batch as malformed
+		context.completeBatch(1, SocketOperationCode::Malformed_Data);
+
+		// Assert: no coalesced write completed and the first write was retried on its own
+		using BatchPayloadSizes = std::vector<std::vector<uint32_t>>;
+		EXPECT_EQ(BatchPayloadSizes({ { 100 }, { 110, 120, 130 }, { 110 } }), context.pBatchWriter->BatchPayloadSizes);
+		EXPECT_EQ(std::vector<SocketOperationCode>({ SocketOperationCode::Success }), context.WriteCodes);
+	}
+
+	TEST(TEST_CLASS, WriteOnlyFailsMalformedWritesWhenRetryingCoalescedWrites) {
+		// Arrange: queue another write while the retries are in progress
+		CoalescingTestContext context;
+		for (auto packetSize : { 100u, 110u, 120u, 130u })
+			context.write(packetSize);
+
+		context.runAll();
+		context.completeBatch(0, SocketOperationCode::Success);
+		context.completeBatch(1, SocketOperationCode::Malformed_Data);
+		context.write(140);
+		context.runAll();
+
+		// Act: only the second retried write is malformed
+		context.completeBatch(2, SocketOperationCode::Success);
+		context.completeBatch(3, SocketOperationCode::Malformed_Data);
+		context.completeBatch(4, SocketOperationCode::Success);
+		context.completeBatch(5, SocketOperationCode::Success);
+
+		// Assert: retries were written in order before the newly queued write
+		using BatchPayloadSizes = std::vector<std::vector<uint32_t>>;
+		EXPECT_EQ(
+				BatchPayloadSizes({ { 100 }, { 110, 120, 130 }, { 110 }, { 120 }, { 130 }, { 140 } }),
+				context.pBatchWriter->BatchPayloadSizes);
+		EXPECT_EQ(std::vector<SocketOperationCode>({
+			SocketOperationCode::Success,
+			SocketOperationCode::Success,
+			SocketOperationCode::Malformed_Data,
+			SocketOperationCode::Success,
+			SocketOperationCode::Success
+		}), context.WriteCodes);
+	}
+
+	// endregion
 }}
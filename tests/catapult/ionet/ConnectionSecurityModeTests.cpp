@@ -30,6 +30,8 @@ namespace catapult { namespace ionet {
 		// Assert:
 		test::AssertParse("None", ConnectionSecurityMode::None, TryParseValue);
 		test::AssertParse("Signed", ConnectionSecurityMode::Signed, TryParseValue);
+		test::AssertParse("Mac", ConnectionSecurityMode::Mac, TryParseValue);
 		test::AssertParse("None,Signed", ConnectionSecurityMode::None | ConnectionSecurityMode::Signed, TryParseValue);
+		test::AssertParse("Signed,Mac", ConnectionSecurityMode::Signed | ConnectionSecurityMode::Mac, TryParseValue);
 	}
 }}
@@ -258,4 +258,53 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region signature sharing
+
+	TEST(TEST_CLASS, SignatureSharingIsDisabledByDefault) {
+		// Act:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+
+		// Assert:
+		EXPECT_FALSE(!!payload.sharedSignature());
+	}
+
+	TEST(TEST_CLASS, CanEnableSignatureSharing) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+
+		// Act:
+		payload.enableSignatureSharing();
+
+		// Assert:
+		EXPECT_TRUE(!!payload.sharedSignature());
+	}
+
+	TEST(TEST_CLASS, SharedSignatureIsSharedByAllCopies) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		payload.enableSignatureSharing();
+
+		// Act:
+		auto payloadCopy1 = payload;
+		auto payloadCopy2 = payload;
+
+		// Assert:
+		EXPECT_EQ(payload.sharedSignature(), payloadCopy1.sharedSignature());
+		EXPECT_EQ(payload.sharedSignature(), payloadCopy2.sharedSignature());
+	}
+
+	TEST(TEST_CLASS, SharedSignatureIsNotPropagatedToMergedPayload) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		payload.enableSignatureSharing();
+
+		// Act:
+		auto mergedPayload = PacketPayload::Merge(CreatePacketPointer(50), payload);
+
+		// Assert: the merged payload has different content, so it must not share the signature
+		EXPECT_FALSE(!!mergedPayload.sharedSignature());
+	}
+
+	// endregion
 }}
@@ -22,6 +22,7 @@
 #include "catapult/ionet/IoTypes.h"
 #include "catapult/ionet/Node.h"
 #include "catapult/ionet/Packet.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
 #include "catapult/ionet/WorkingBuffer.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "tests/test/core/ThreadPoolTestUtils.h"
@@ -120,6 +121,26 @@ namespace catapult { namespace ionet {
 		AssertWriteSuccess(payload, packetBytes);
 	}
 
+	TEST(TEST_CLASS, WriteSucceedsWhenSocketWriteSucceeds_MultiBufferPayload) {
+		// Arrange: set up payloads
+		auto packetBytes = test::GenerateRandomPacketBuffer(sizeof(Packet) + 3 * 20);
+		PacketPayloadBuilder builder(reinterpret_cast<const Packet&>(packetBytes[0]).Type);
+		for (auto i = 0u; i < 3; ++i) {
+			std::array<uint8_t, 20> value;
+			std::memcpy(value.data(), &packetBytes[sizeof(Packet) + i * 20], value.size());
+			builder.appendValue(value);
+		}
+
+		auto payload = builder.build();
+
+		// Sanity:
+		EXPECT_EQ(sizeof(Packet) + 3 * 20, payload.header().Size);
+		EXPECT_EQ(3u, payload.buffers().size());
+
+		// Assert:
+		AssertWriteSuccess(payload, packetBytes);
+	}
+
 	TEST(TEST_CLASS, WriteFailsWhenSocketWriteFails) {
 		// Arrange: set up payloads
 		auto payload = CreateSmallWritePayload();
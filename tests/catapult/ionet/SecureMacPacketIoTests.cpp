@@ -0,0 +1,573 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/SecureMacPacketIo.h"
+#include "catapult/ionet/PacketPayloadFactory.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/PacketIoTestUtils.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/mocks/MockPacketIo.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS SecureMacPacketIoTests
+
+	namespace {
+		constexpr auto Secure_Mac_Header_Size = sizeof(PacketHeader) + sizeof(uint64_t) + Hash256_Size;
+
+		std::vector<std::shared_ptr<Packet>> CreateSecureMacPackets(
+				const crypto::KeyPair& keyPair,
+				const Key& remoteKey,
+				const Hash256& sessionId,
+				const std::vector<uint32_t>& childPayloadSizes) {
+			auto pMockIo = std::make_shared<mocks::MockPacketIo>();
+			auto pIo = CreateSecureMacPacketIo(pMockIo, CreateSecureMacSession(keyPair, remoteKey, sessionId), 10'000);
+
+			std::vector<std::shared_ptr<Packet>> packets;
+			for (auto i = 0u; i < childPayloadSizes.size(); ++i) {
+				pMockIo->queueWrite(SocketOperationCode::Success);
+				pIo->write(PacketPayload(test::CreateRandomPacket(childPayloadSizes[i], PacketType::Push_Transactions)), [](auto) {});
+
+				const auto& writtenPacket = pMockIo->writtenPacketAt<Packet>(i);
+				auto pPacket = utils::MakeSharedWithSize<Packet>(writtenPacket.Size);
+				std::memcpy(static_cast<void*>(pPacket.get()), &writtenPacket, writtenPacket.Size);
+				packets.push_back(pPacket);
+			}
+
+			return packets;
+		}
+
+		struct TestContext {
+		public:
+			explicit TestContext(uint32_t maxMacPacketDataSize = std::numeric_limits<uint32_t>::max())
+					: pMockPacketIo(std::make_shared<mocks::MockPacketIo>())
+					, KeyPair(test::GenerateKeyPair())
+					, RemoteKeyPair(test::GenerateKeyPair())
+					, SessionId(test::GenerateRandomData<Hash256_Size>())
+					, pSession(CreateSecureMacSession(KeyPair, RemoteKeyPair.publicKey(), SessionId))
+					, pSecureIo(CreateSecureMacPacketIo(pMockPacketIo, pSession, maxMacPacketDataSize))
+					, pSecureBatchReader(CreateSecureMacBatchPacketReader(pMockPacketIo, pSession))
+			{}
+
+		public:
+			std::vector<std::shared_ptr<Packet>> createRemotePackets(const std::vector<uint32_t>& childPayloadSizes) const {
+				return CreateSecureMacPackets(RemoteKeyPair, KeyPair.publicKey(), SessionId, childPayloadSizes);
+			}
+
+			void queueReads(const std::vector<std::shared_ptr<Packet>>& packets) {
+				for (const auto& pPacket : packets)
+					pMockPacketIo->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+			}
+
+		public:
+			std::shared_ptr<mocks::MockPacketIo> pMockPacketIo;
+			crypto::KeyPair KeyPair;
+			crypto::KeyPair RemoteKeyPair;
+			Hash256 SessionId;
+			std::shared_ptr<SecureMacSession> pSession;
+			std::shared_ptr<PacketIo> pSecureIo;
+			std::shared_ptr<BatchPacketReader> pSecureBatchReader;
+		};
+
+		// note: GetSecureMac* helpers assume a secure mac packet
+
+		uint64_t& GetSecureMacSequence(Packet& packet) {
+			return reinterpret_cast<uint64_t&>(*(&packet + 1));
+		}
+
+		Hash256& GetSecureMacMac(Packet& packet) {
+			return reinterpret_cast<Hash256&>(*(reinterpret_cast<uint8_t*>(&packet) + sizeof(PacketHeader) + sizeof(uint64_t)));
+		}
+
+		Packet& GetSecureMacChildPacket(Packet& packet) {
+			return reinterpret_cast<Packet&>(*(reinterpret_cast<uint8_t*>(&packet) + Secure_Mac_Header_Size));
+		}
+	}
+
+	// region CreateSecureMacSession
+
+	TEST(TEST_CLASS, CannotCreateSessionWithInvalidRemoteKey) {
+		// Arrange: y = 2 does not correspond to any point on the curve
+		Key invalidRemoteKey{};
+		invalidRemoteKey[0] = 2;
+
+		// Act + Assert:
+		EXPECT_THROW(CreateSecureMacSession(test::GenerateKeyPair(), invalidRemoteKey, Hash256()), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region PacketIo - write
+
+	namespace {
+		template<typename TAction>
+		void RunWritePayloadTest(
+				TestContext&& context,
+				const std::vector<std::shared_ptr<model::VerifiableEntity>>& entities,
+				uint32_t numEntitiesBytes,
+				TAction action) {
+			// Arrange:
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+			auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+			// Act:
+			SocketOperationCode writeCode;
+			context.pSecureIo->write(payload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+
+			auto& writtenPacket = const_cast<Packet&>(context.pMockPacketIo->writtenPacketAt<Packet>(0));
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Success, writeCode);
+
+			ASSERT_EQ(Secure_Mac_Header_Size + sizeof(PacketHeader) + numEntitiesBytes, writtenPacket.Size);
+			EXPECT_EQ(PacketType::Secure_Mac, writtenPacket.Type);
+			EXPECT_EQ(1u, GetSecureMacSequence(writtenPacket));
+
+			const auto& childPacket = GetSecureMacChildPacket(writtenPacket);
+			ASSERT_EQ(sizeof(PacketHeader) + numEntitiesBytes, childPacket.Size);
+			EXPECT_EQ(PacketType::Push_Transactions, childPacket.Type);
+
+			// - the remote can authenticate the packet
+			auto pRemoteMockIo = std::make_shared<mocks::MockPacketIo>();
+			auto pRemoteSession = CreateSecureMacSession(context.RemoteKeyPair, context.KeyPair.publicKey(), context.SessionId);
+			pRemoteMockIo->queueRead(SocketOperationCode::Success, [&writtenPacket](const auto*) {
+				auto pPacket = utils::MakeSharedWithSize<Packet>(writtenPacket.Size);
+				std::memcpy(static_cast<void*>(pPacket.get()), &writtenPacket, writtenPacket.Size);
+				return pPacket;
+			});
+
+			SocketOperationCode readCode;
+			CreateSecureMacPacketIo(pRemoteMockIo, pRemoteSession, 10'000)->read([&readCode](auto code, const auto*) {
+				readCode = code;
+			});
+			EXPECT_EQ(SocketOperationCode::Success, readCode);
+
+			action(childPacket);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithNoBuffers) {
+		// Act:
+		RunWritePayloadTest(TestContext(), {}, 0, [](const auto&) {});
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithSingleBuffer) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+
+		// Act:
+		RunWritePayloadTest(TestContext(), entities, 126, [&entities](const auto& childPacket) {
+			// Assert:
+			EXPECT_TRUE(0 == std::memcmp(entities[0].get(), childPacket.Data(), entities[0]->Size));
+		});
+	}
+
+	TEST(TEST_CLASS, WriteAuthenticatesPayloadWithMultipleBuffers) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{
+			test::CreateRandomEntityWithSize<>(126),
+			test::CreateRandomEntityWithSize<>(212),
+			test::CreateRandomEntityWithSize<>(134),
+		};
+
+		// Act:
+		RunWritePayloadTest(TestContext(), entities, 126 + 212 + 134, [&entities](const auto& childPacket) {
+			// Assert:
+			EXPECT_TRUE(0 == std::memcmp(entities[0].get(), childPacket.Data(), entities[0]->Size));
+			EXPECT_TRUE(0 == std::memcmp(entities[1].get(), childPacket.Data() + 126, entities[1]->Size));
+			EXPECT_TRUE(0 == std::memcmp(entities[2].get(), childPacket.Data() + 126 + 212, entities[2]->Size));
+		});
+	}
+
+	TEST(TEST_CLASS, WriteAssignsIncreasingSequenceNumbersAcrossIos) {
+		// Arrange: create a second io sharing the same session
+		TestContext context;
+		auto pSecureIo2 = CreateSecureMacPacketIo(context.pMockPacketIo, context.pSession, 10'000);
+
+		// Act:
+		for (const auto& pIo : { context.pSecureIo, pSecureIo2, context.pSecureIo }) {
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+			pIo->write(PacketPayload(test::CreateRandomPacket(50, PacketType::Push_Transactions)), [](auto) {});
+		}
+
+		// Assert:
+		ASSERT_EQ(3u, context.pMockPacketIo->numWrites());
+		for (auto i = 0u; i < 3; ++i) {
+			auto& writtenPacket = const_cast<Packet&>(context.pMockPacketIo->writtenPacketAt<Packet>(i));
+			EXPECT_EQ(i + 1, GetSecureMacSequence(writtenPacket)) << "packet at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, WriteForwardsInnerWriteError) {
+		// Arrange: set a write error
+		TestContext context;
+		context.pMockPacketIo->queueWrite(SocketOperationCode::Write_Error);
+
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+		// Act:
+		SocketOperationCode writeCode;
+		context.pSecureIo->write(payload, [&writeCode](auto code) {
+			writeCode = code;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Write_Error, writeCode);
+	}
+
+	namespace {
+		void AssertMalformedDataWrite(TestContext&& context, const PacketPayload& payload) {
+			// Arrange:
+			context.pMockPacketIo->queueWrite(SocketOperationCode::Success);
+
+			// Act:
+			SocketOperationCode writeCode;
+			context.pSecureIo->write(payload, [&writeCode](auto code) {
+				writeCode = code;
+			});
+
+			// Assert:
+			EXPECT_EQ(SocketOperationCode::Malformed_Data, writeCode);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteFailsWhenPacketPayloadIsUnset) {
+		// Arrange:
+		AssertMalformedDataWrite(TestContext(), PacketPayload());
+	}
+
+	TEST(TEST_CLASS, WriteFailsWhenPacketPayloadExceedsMaxPacketDataSize) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{ test::CreateRandomEntityWithSize<>(126) };
+		auto payload = PacketPayloadFactory::FromEntities(PacketType::Push_Transactions, entities);
+
+		// Assert:
+		AssertMalformedDataWrite(TestContext(126 - 1), payload);
+	}
+
+	// endregion
+
+	// region PacketIo - read, BatchPacketReader - readMultiple (single packet)
+
+	namespace {
+		struct ReadCallbackParams {
+			bool IsPacketValid;
+			SocketOperationCode ReadCode;
+			std::vector<uint8_t> ReadPacketBytes;
+		};
+
+		PacketIo::ReadCallback CreateReadCaptureCallback(ReadCallbackParams& capture) {
+			return [&capture](auto code, const auto* pReadPacket) {
+				capture.ReadCode = code;
+				capture.IsPacketValid = !!pReadPacket;
+				if (capture.IsPacketValid)
+					capture.ReadPacketBytes = test::CopyPacketToBuffer(*pReadPacket);
+			};
+		}
+
+		struct PacketIoReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureIo->read(callback);
+			}
+		};
+
+		struct BatchPacketReaderReadTraits {
+			static void Read(const TestContext& context, const PacketIo::ReadCallback& callback) {
+				context.pSecureBatchReader->readMultiple(callback);
+			}
+		};
+	}
+
+#define READ_TRAITS_BASED_TEST(TEST_NAME) \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
+	TEST(TEST_CLASS, TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<PacketIoReadTraits>(); } \
+	TEST(TEST_CLASS, TEST_NAME##_BatchReader) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<BatchPacketReaderReadTraits>(); } \
+	template<typename TTraits> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
+
+	READ_TRAITS_BASED_TEST(ReadForwardsInnerReadError) {
+		// Arrange:
+		TestContext context;
+		context.pMockPacketIo->queueRead(SocketOperationCode::Read_Error, nullptr);
+
+		// Act:
+		ReadCallbackParams capture;
+		TTraits::Read(context, CreateReadCaptureCallback(capture));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Read_Error, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	namespace {
+		template<typename TReadTraits, typename TMutator>
+		void RunFailedReadTest(SocketOperationCode expectedReadCode, uint32_t childPayloadSize, TMutator mutator) {
+			// Arrange: create an (authenticated) packet
+			TestContext context;
+			auto pPacket = context.createRemotePackets({ childPayloadSize })[0];
+
+			// - mutate the packet or its data
+			mutator(*pPacket, GetSecureMacChildPacket(*pPacket));
+
+			// - queue the read
+			context.queueReads({ pPacket });
+
+			// Act:
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+
+			// Assert:
+			EXPECT_EQ(expectedReadCode, capture.ReadCode);
+			EXPECT_FALSE(capture.IsPacketValid);
+		}
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketTypeIsWrong) {
+		// Assert: packet type must be Secure_Mac
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](auto& packet, const auto&) {
+			packet.Type = PacketType::Secure_Signed;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooSmall) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 0, [](auto& packet, auto& childPacket) {
+			--packet.Size;
+			--childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooLargeRelativeToChildPacketSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](const auto&, auto& childPacket) {
+			--childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSizeIsTooSmallRelativeToChildPacketSize) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Malformed_Data, 123, [](const auto&, auto& childPacket) {
+			++childPacket.Size;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketMacDoesNotVerify) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Security_Error, 123, [](auto& packet, const auto&) {
+			GetSecureMacMac(packet)[Hash256_Size / 2] ^= 0xFF;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenEnvelopePacketSequenceIsModified) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Security_Error, 123, [](auto& packet, const auto&) {
+			++GetSecureMacSequence(packet);
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenChildPacketIsModified) {
+		// Assert:
+		RunFailedReadTest<TTraits>(SocketOperationCode::Security_Error, 123, [](const auto&, auto& childPacket) {
+			const_cast<uint8_t&>(childPacket.Data()[0]) ^= 0xFF;
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadFailsWhenPacketIsFromDifferentSession) {
+		// Arrange: create a packet in a different session between the same peers
+		TestContext context;
+		auto otherSessionId = test::GenerateRandomData<Hash256_Size>();
+		context.queueReads(CreateSecureMacPackets(context.RemoteKeyPair, context.KeyPair.publicKey(), otherSessionId, { 123 }));
+
+		// Act:
+		ReadCallbackParams capture;
+		TTraits::Read(context, CreateReadCaptureCallback(capture));
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Security_Error, capture.ReadCode);
+		EXPECT_FALSE(capture.IsPacketValid);
+	}
+
+	namespace {
+		template<typename TReadTraits, typename TAction>
+		void RunReadSuccessPayloadTest(uint32_t childPayloadSize, TAction action) {
+			// Arrange: create an (authenticated) packet
+			TestContext context;
+			auto pPacket = context.createRemotePackets({ childPayloadSize })[0];
+			const auto& childPacket = GetSecureMacChildPacket(*pPacket);
+
+			// - queue the read
+			context.queueReads({ pPacket });
+
+			// Act:
+			ReadCallbackParams capture;
+			TReadTraits::Read(context, CreateReadCaptureCallback(capture));
+
+			// Assert:
+			ASSERT_EQ(SocketOperationCode::Success, capture.ReadCode);
+
+			const auto& readPacket = reinterpret_cast<const Packet&>(*capture.ReadPacketBytes.data());
+			ASSERT_EQ(sizeof(PacketHeader) + childPayloadSize, readPacket.Size);
+			EXPECT_EQ(PacketType::Push_Transactions, readPacket.Type);
+
+			EXPECT_TRUE(0 == std::memcmp(childPacket.Data(), readPacket.Data(), childPayloadSize));
+			action(readPacket);
+		}
+	}
+
+	READ_TRAITS_BASED_TEST(ReadSucceedsWhenReadingEmptyPacketWithValidMac) {
+		// Assert:
+		RunReadSuccessPayloadTest<TTraits>(0u, [](const auto& readPacket) {
+			// Sanity:
+			EXPECT_FALSE(!!readPacket.Data());
+		});
+	}
+
+	READ_TRAITS_BASED_TEST(ReadSucceedsWhenReadingNonEmptyPacketWithValidMac) {
+		// Assert:
+		RunReadSuccessPayloadTest<TTraits>(234u, [](const auto& readPacket) {
+			// Sanity:
+			EXPECT_TRUE(!!readPacket.Data());
+		});
+	}
+
+	// endregion
+
+	// region PacketIo - replay protection
+
+	namespace {
+		std::vector<SocketOperationCode> ReadAll(TestContext& context, const std::vector<std::shared_ptr<Packet>>& packets) {
+			context.queueReads(packets);
+
+			std::vector<SocketOperationCode> readCodes;
+			for (auto i = 0u; i < packets.size(); ++i) {
+				context.pSecureIo->read([&readCodes](auto code, const auto*) {
+					readCodes.push_back(code);
+				});
+			}
+
+			return readCodes;
+		}
+	}
+
+	TEST(TEST_CLASS, ReadFailsWhenPacketIsReplayed) {
+		// Arrange:
+		TestContext context;
+		auto packets = context.createRemotePackets({ 123, 234 });
+
+		// Act: replay the first packet after both packets have been read
+		auto readCodes = ReadAll(context, { packets[0], packets[1], packets[0], packets[1] });
+
+		// Assert:
+		auto expectedReadCodes = std::vector<SocketOperationCode>{
+			SocketOperationCode::Success, SocketOperationCode::Success,
+			SocketOperationCode::Security_Error, SocketOperationCode::Security_Error
+		};
+		EXPECT_EQ(expectedReadCodes, readCodes);
+	}
+
+	TEST(TEST_CLASS, ReadSucceedsWhenPacketsAreReorderedWithinWindow) {
+		// Arrange:
+		TestContext context;
+		auto packets = context.createRemotePackets(std::vector<uint32_t>(64, 50));
+
+		// Act: read the last packet first
+		std::vector<std::shared_ptr<Packet>> reorderedPackets{ packets.back() };
+		reorderedPackets.insert(reorderedPackets.end(), packets.cbegin(), packets.cend() - 1);
+		auto readCodes = ReadAll(context, reorderedPackets);
+
+		// Assert:
+		EXPECT_EQ(std::vector<SocketOperationCode>(64, SocketOperationCode::Success), readCodes);
+	}
+
+	TEST(TEST_CLASS, ReadFailsWhenPacketsAreReorderedOutsideWindow) {
+		// Arrange:
+		TestContext context;
+		auto packets = context.createRemotePackets(std::vector<uint32_t>(65, 50));
+
+		// Act: read the last packet first
+		auto readCodes = ReadAll(context, { packets.back(), packets[1], packets[0] });
+
+		// Assert: the first packet is too old to be accepted
+		auto expectedReadCodes = std::vector<SocketOperationCode>{
+			SocketOperationCode::Success, SocketOperationCode::Success, SocketOperationCode::Security_Error
+		};
+		EXPECT_EQ(expectedReadCodes, readCodes);
+	}
+
+	// endregion
+
+	// region PacketIo - round trip
+
+	TEST(TEST_CLASS, CanRoundtripWriteAndRead) {
+		// Arrange: the writer should emulate the remote so keys match for write and read
+		TestContext context;
+		auto pSession = CreateSecureMacSession(context.KeyPair, context.KeyPair.publicKey(), context.SessionId);
+		auto pSecureIo = CreateSecureMacPacketIo(context.pMockPacketIo, pSession, 10'000);
+
+		// Act + Assert:
+		test::AssertCanRoundtripPackets(*context.pMockPacketIo, *pSecureIo);
+	}
+
+	// endregion
+
+	// region BatchPacketReader - readMultiple (multiple packets)
+
+	TEST(TEST_CLASS, ReadSuccessWhenReadingMultiplePackets) {
+		// Arrange: create two (authenticated) packets
+		TestContext context;
+
+		constexpr auto Data1_Size = 123u;
+		constexpr auto Data2_Size = 222u;
+		auto packets = context.createRemotePackets({ Data1_Size, Data2_Size });
+		const auto& childPacket1 = GetSecureMacChildPacket(*packets[0]);
+		const auto& childPacket2 = GetSecureMacChildPacket(*packets[1]);
+
+		// - queue the read of both packets
+		context.queueReads(packets);
+
+		// Act:
+		std::vector<ReadCallbackParams> captures;
+		context.pSecureBatchReader->readMultiple([&captures](auto code, const auto* pReadPacket) {
+			ReadCallbackParams capture;
+			CreateReadCaptureCallback(capture)(code, pReadPacket);
+			captures.push_back(capture);
+		});
+
+		// Assert: both packets were read
+		ASSERT_EQ(2u, captures.size());
+		ASSERT_EQ(SocketOperationCode::Success, captures[0].ReadCode);
+		ASSERT_EQ(SocketOperationCode::Success, captures[1].ReadCode);
+
+		const auto& readPacket1 = reinterpret_cast<const Packet&>(*captures[0].ReadPacketBytes.data());
+		ASSERT_EQ(sizeof(PacketHeader) + Data1_Size, readPacket1.Size);
+		EXPECT_TRUE(0 == std::memcmp(childPacket1.Data(), readPacket1.Data(), Data1_Size));
+
+		const auto& readPacket2 = reinterpret_cast<const Packet&>(*captures[1].ReadPacketBytes.data());
+		ASSERT_EQ(sizeof(PacketHeader) + Data2_Size, readPacket2.Size);
+		EXPECT_TRUE(0 == std::memcmp(childPacket2.Data(), readPacket2.Data(), Data2_Size));
+	}
+
+	// endregion
+}}
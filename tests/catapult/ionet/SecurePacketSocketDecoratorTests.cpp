@@ -134,7 +134,8 @@ namespace catapult { namespace ionet {
 					: pMockPacketSocket(std::make_shared<MockPacketSocket>())
 					, KeyPair(test::GenerateKeyPair())
 					, RemoteKey(KeyPair.publicKey()) // use same public key so secure packets can be signed and verified
-					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, maxPacketDataSize))
+					, SessionId(test::GenerateRandomData<Hash256_Size>())
+					, pSecureSocket(Secure(pMockPacketSocket, securityMode, KeyPair, RemoteKey, SessionId, maxPacketDataSize))
 			{}
 
 		public:
@@ -150,6 +151,7 @@ namespace catapult { namespace ionet {
 			std::shared_ptr<MockPacketSocket> pMockPacketSocket;
 			crypto::KeyPair KeyPair;
 			Key RemoteKey;
+			Hash256 SessionId;
 			std::shared_ptr<PacketSocket> pSecureSocket;
 		};
 
@@ -192,6 +194,7 @@ namespace catapult { namespace ionet {
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)(); \
 	TEST(TEST_CLASS, SecurityModeNone##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::None>(); } \
 	TEST(TEST_CLASS, SecurityModeSigned##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Signed>(); } \
+	TEST(TEST_CLASS, SecurityModeMac##TEST_NAME) { TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)<ConnectionSecurityMode::Mac>(); } \
 	template<ConnectionSecurityMode SecurityMode> void TRAITS_TEST_NAME(TEST_CLASS, TEST_NAME)()
 
 	// region ConnectionSecurityMode - common
@@ -326,4 +329,73 @@ namespace catapult { namespace ionet {
 	}
 
 	// endregion
+
+	// region ConnectionSecurityMode - Mac
+
+	TEST(TEST_CLASS, SecurityModeMac_DecoratesSocket) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac);
+
+		// Act + Assert
+		EXPECT_NE(context.pMockPacketSocket, context.pSecureSocket);
+	}
+
+	TEST(TEST_CLASS, SecurityModeMac_WritesSecurePackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.normalIoView(), PacketType::Secure_Mac, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeMac_WritesSecureBufferedPackets) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac);
+
+		// Act + Assert:
+		AssertNormalPacketWriteCode(context.bufferedIoView(), PacketType::Secure_Mac, PacketType::Pull_Transactions);
+	}
+
+	TEST(TEST_CLASS, SecurityModeMac_EnforcesMaxPacketDataSizeOnWrite) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac, 99);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+
+		// Act + Assert:
+		AssertMalformedDataWrite(context.normalIoView(), payload);
+	}
+
+	TEST(TEST_CLASS, SecurityModeMac_EnforcesMaxPacketDataSizeOnBufferedWrite) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac, 99);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions));
+
+		// Act + Assert:
+		AssertMalformedDataWrite(context.bufferedIoView(), payload);
+	}
+
+	TEST(TEST_CLASS, SecurityModeMac_SharesSequenceNumbersAcrossBufferedIo) {
+		// Arrange:
+		TestContext context(ConnectionSecurityMode::Mac);
+		auto normalView = context.normalIoView();
+		auto bufferedView = context.bufferedIoView();
+
+		// Act: write one packet via each io
+		for (auto* pView : { &normalView, &bufferedView }) {
+			pView->MockIo.queueWrite(SocketOperationCode::Success);
+			pView->Io.write(PacketPayload(test::CreateRandomPacket(100, PacketType::Pull_Transactions)), [](auto) {});
+		}
+
+		// Assert: both packets are tagged with different sequence numbers
+		auto getSequence = [](const auto& view) {
+			const auto& writtenPacket = view.MockIo.template writtenPacketAt<Packet>(0);
+			return reinterpret_cast<const uint64_t&>(*writtenPacket.Data());
+		};
+		EXPECT_EQ(1u, getSequence(normalView));
+		EXPECT_EQ(2u, getSequence(bufferedView));
+	}
+
+	// endregion
 }}
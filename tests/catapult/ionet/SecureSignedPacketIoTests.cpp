@@ -200,6 +200,87 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region PacketIo - write (shared signature)
+
+	namespace {
+		const Signature& GetWrittenSignature(const mocks::MockPacketIo& mockIo, size_t index) {
+			return reinterpret_cast<const Signature&>(*(&mockIo.writtenPacketAt<Packet>(index) + 1));
+		}
+
+		const Packet& GetWrittenChildPacket(const mocks::MockPacketIo& mockIo, size_t index) {
+			const auto* pSignatureBytes = reinterpret_cast<const uint8_t*>(&GetWrittenSignature(mockIo, index));
+			return reinterpret_cast<const Packet&>(*(pSignatureBytes + Signature_Size));
+		}
+
+		Signature WriteAndGetSignature(PacketIo& io, mocks::MockPacketIo& mockIo, const PacketPayload& payload) {
+			mockIo.queueWrite(SocketOperationCode::Success);
+			io.write(payload, [](auto) {});
+			return GetWrittenSignature(mockIo, mockIo.numWrites() - 1);
+		}
+	}
+
+	TEST(TEST_CLASS, WriteSignsPayloadOnceWhenSignatureSharingIsEnabled) {
+		// Arrange: create two ios with the same key pair
+		TestContext context;
+		auto pSecureIo2 = CreateSecureSignedPacketIo(context.pMockPacketIo, context.KeyPair, context.RemoteKey, 1000);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Push_Transactions));
+		payload.enableSignatureSharing();
+
+		// Act:
+		auto signature1 = WriteAndGetSignature(*context.pSecureIo, *context.pMockPacketIo, payload);
+		auto signature2 = WriteAndGetSignature(*pSecureIo2, *context.pMockPacketIo, payload);
+
+		// Assert: both ios wrote the shared signature
+		const auto& sharedSignature = *payload.sharedSignature();
+		EXPECT_EQ(context.KeyPair.publicKey(), sharedSignature.SignerPublicKey);
+		EXPECT_EQ(sharedSignature.Signature, signature1);
+		EXPECT_EQ(sharedSignature.Signature, signature2);
+
+		EXPECT_EQ(SignPacket(context.KeyPair, GetWrittenChildPacket(*context.pMockPacketIo, 0)), signature1);
+	}
+
+	TEST(TEST_CLASS, WriteReusesSharedSignatureCalculatedWithSameKey) {
+		// Arrange: seed the shared signature with a random signature
+		TestContext context;
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Push_Transactions));
+		payload.enableSignatureSharing();
+
+		auto seededSignature = test::GenerateRandomData<Signature_Size>();
+		auto& sharedSignature = *payload.sharedSignature();
+		std::call_once(sharedSignature.CalculatedFlag, [&sharedSignature, &context, &seededSignature]() {
+			sharedSignature.SignerPublicKey = context.KeyPair.publicKey();
+			sharedSignature.Signature = seededSignature;
+		});
+
+		// Act:
+		auto signature = WriteAndGetSignature(*context.pSecureIo, *context.pMockPacketIo, payload);
+
+		// Assert: the payload was not signed again
+		EXPECT_EQ(seededSignature, signature);
+	}
+
+	TEST(TEST_CLASS, WriteIgnoresSharedSignatureCalculatedWithDifferentKey) {
+		// Arrange: sign the payload with a different key pair first
+		TestContext context;
+		auto pOtherSecureIo = CreateSecureSignedPacketIo(context.pMockPacketIo, context.RemoteKeyPair, context.RemoteKey, 1000);
+
+		auto payload = PacketPayload(test::CreateRandomPacket(100, PacketType::Push_Transactions));
+		payload.enableSignatureSharing();
+		auto otherSignature = WriteAndGetSignature(*pOtherSecureIo, *context.pMockPacketIo, payload);
+
+		// Act:
+		auto signature = WriteAndGetSignature(*context.pSecureIo, *context.pMockPacketIo, payload);
+
+		// Assert: the shared signature is unchanged and the payload was signed with the io key pair
+		EXPECT_EQ(context.RemoteKeyPair.publicKey(), payload.sharedSignature()->SignerPublicKey);
+		EXPECT_EQ(otherSignature, payload.sharedSignature()->Signature);
+
+		EXPECT_EQ(SignPacket(context.KeyPair, GetWrittenChildPacket(*context.pMockPacketIo, 1)), signature);
+	}
+
+	// endregion
+
 	// region PacketIo - read, BatchPacketReader - readMultiple (single packet)
 
 	namespace {
@@ -360,5 +360,55 @@ namespace catapult { namespace model {
 		EXPECT_NE(transactionElement.EntityHash, transactionElement.MerkleComponentHash);
 	}
 
+	namespace {
+		void AssertBulkUpdateHashesMatchesSingleUpdateHashes(size_t numTransactions) {
+			// Arrange:
+			auto pPlugin = mocks::CreateMockTransactionPluginWithCustomBuffers(
+					mocks::OffsetRange{ 6, 10 },
+					std::vector<mocks::OffsetRange>{ { 7, 11 }, { 4, 7 }, { 12, 20 } });
+			auto registry = TransactionRegistry();
+			registry.registerPlugin(std::move(pPlugin));
+
+			std::vector<std::unique_ptr<Transaction>> transactions;
+			std::vector<TransactionElement> expectedTransactionElements;
+			std::vector<TransactionElement> transactionElements;
+			for (auto i = 0u; i < numTransactions; ++i) {
+				transactions.push_back(test::GenerateRandomTransaction());
+				expectedTransactionElements.emplace_back(*transactions.back());
+				transactionElements.emplace_back(*transactions.back());
+				UpdateHashes(registry, expectedTransactionElements.back());
+			}
+
+			std::vector<TransactionElement*> transactionElementPointers;
+			for (auto& transactionElement : transactionElements)
+				transactionElementPointers.push_back(&transactionElement);
+
+			// Act:
+			UpdateHashes(registry, transactionElementPointers.data(), transactionElementPointers.size());
+
+			// Assert:
+			for (auto i = 0u; i < numTransactions; ++i) {
+				EXPECT_EQ(expectedTransactionElements[i].EntityHash, transactionElements[i].EntityHash) << "transaction at " << i;
+				EXPECT_EQ(expectedTransactionElements[i].MerkleComponentHash, transactionElements[i].MerkleComponentHash)
+						<< "transaction at " << i;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateZeroTransactionElements) {
+		// Assert:
+		AssertBulkUpdateHashesMatchesSingleUpdateHashes(0);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateSingleTransactionElement) {
+		// Assert:
+		AssertBulkUpdateHashesMatchesSingleUpdateHashes(1);
+	}
+
+	TEST(TEST_CLASS, UpdateHashes_CanUpdateMultipleTransactionElements) {
+		// Assert:
+		AssertBulkUpdateHashesMatchesSingleUpdateHashes(9);
+	}
+
 	// endregion
 }}
@@ -0,0 +1,286 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/NotificationTape.h"
+#include "catapult/model/NotificationPublisher.h"
+#include "tests/test/core/mocks/MockNotificationSubscriber.h"
+#include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/TestHarness.h"
+#include <cstddef>
+#include <cstring>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS NotificationTapeTests
+
+	namespace {
+		struct TestAccounts {
+		public:
+			TestAccounts()
+					: Address(test::GenerateRandomData<Address_Decoded_Size>())
+					, PublicKey(test::GenerateRandomData<Key_Size>())
+			{}
+
+		public:
+			catapult::Address Address;
+			Key PublicKey;
+		};
+
+		void RecordAll(NotificationTape& tape, const TestAccounts& accounts) {
+			tape.notify(AccountAddressNotification(accounts.Address));
+			tape.notify(AccountPublicKeyNotification(accounts.PublicKey));
+			tape.notify(BalanceTransferNotification(accounts.PublicKey, accounts.Address, MosaicId(123), Amount(234)));
+			tape.notify(EntityNotification(NetworkIdentifier::Mijin_Test));
+		}
+
+		std::vector<NotificationType> GetAllNotificationTypes() {
+			return {
+				Core_Register_Account_Address_Notification,
+				Core_Register_Account_Public_Key_Notification,
+				Core_Balance_Transfer_Notification,
+				Core_Entity_Notification
+			};
+		}
+
+		void AssertReplayedNotifications(
+				const mocks::MockNotificationSubscriber& sub,
+				const TestAccounts& accounts,
+				const std::vector<NotificationType>& expectedTypes) {
+			EXPECT_EQ(expectedTypes, sub.notificationTypes());
+			EXPECT_TRUE(sub.contains(accounts.Address));
+			EXPECT_TRUE(sub.contains(accounts.PublicKey));
+			EXPECT_TRUE(sub.contains(accounts.PublicKey, accounts.Address, MosaicId(123), Amount(234)));
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, TapeIsInitiallyEmpty) {
+		// Act:
+		NotificationTape tape;
+
+		// Assert:
+		EXPECT_TRUE(tape.empty());
+		EXPECT_EQ(0u, tape.size());
+	}
+
+	TEST(TEST_CLASS, CanRecordNotifications) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+
+		// Act:
+		RecordAll(tape, accounts);
+
+		// Assert:
+		EXPECT_FALSE(tape.empty());
+		EXPECT_EQ(4u, tape.size());
+	}
+
+	TEST(TEST_CLASS, CannotRecordNotificationWithIncorrectSize) {
+		// Arrange:
+		NotificationTape tape;
+		auto notification = Notification(Core_Entity_Notification, sizeof(Notification) - 1);
+
+		// Act + Assert:
+		EXPECT_THROW(tape.notify(notification), catapult_invalid_argument);
+		EXPECT_TRUE(tape.empty());
+	}
+
+	TEST(TEST_CLASS, CanClearTape) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+		RecordAll(tape, accounts);
+
+		// Act:
+		tape.clear();
+
+		// Assert:
+		EXPECT_TRUE(tape.empty());
+		EXPECT_EQ(0u, tape.size());
+	}
+
+	TEST(TEST_CLASS, CanReuseTapeAfterClear) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts1;
+		TestAccounts accounts2;
+		RecordAll(tape, accounts1);
+		tape.clear();
+
+		// Act:
+		RecordAll(tape, accounts2);
+		mocks::MockNotificationSubscriber sub;
+		tape.replay(sub);
+
+		// Assert:
+		EXPECT_EQ(4u, tape.size());
+		AssertReplayedNotifications(sub, accounts2, GetAllNotificationTypes());
+		EXPECT_FALSE(sub.contains(accounts1.Address));
+	}
+
+	// endregion
+
+	// region replay
+
+	TEST(TEST_CLASS, CanReplayNotificationsInRecordingOrder) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+		RecordAll(tape, accounts);
+
+		// Act:
+		mocks::MockNotificationSubscriber sub;
+		tape.replay(sub);
+
+		// Assert:
+		AssertReplayedNotifications(sub, accounts, GetAllNotificationTypes());
+	}
+
+	TEST(TEST_CLASS, CanReplayNotificationsInReverseRecordingOrder) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+		RecordAll(tape, accounts);
+
+		// Act:
+		mocks::MockNotificationSubscriber sub;
+		tape.replayReverse(sub);
+
+		// Assert:
+		auto expectedTypes = GetAllNotificationTypes();
+		std::reverse(expectedTypes.begin(), expectedTypes.end());
+		AssertReplayedNotifications(sub, accounts, expectedTypes);
+	}
+
+	TEST(TEST_CLASS, CanReplayNotificationsMultipleTimes) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+		RecordAll(tape, accounts);
+
+		for (auto i = 0u; i < 3; ++i) {
+			// Act:
+			mocks::MockNotificationSubscriber sub;
+			tape.replay(sub);
+
+			// Assert:
+			AssertReplayedNotifications(sub, accounts, GetAllNotificationTypes());
+		}
+	}
+
+	namespace {
+		template<size_t Payload_Size>
+		struct PayloadNotification : public Notification {
+		public:
+			explicit PayloadNotification(uint8_t seed) : Notification(Core_Entity_Notification, sizeof(PayloadNotification)) {
+				for (auto i = 0u; i < Payload_Size; ++i)
+					Payload[i] = static_cast<uint8_t>(seed + i);
+			}
+
+		public:
+			uint8_t Payload[Payload_Size];
+		};
+	}
+
+	TEST(TEST_CLASS, ReplayedNotificationsAreAlignedCopies) {
+		// Arrange: use notifications with sizes that are not multiples of the record alignment
+		NotificationTape tape;
+		PayloadNotification<3> notification1(11);
+		PayloadNotification<17> notification2(22);
+		PayloadNotification<1> notification3(33);
+		std::vector<const Notification*> notifications{ &notification1, &notification2, &notification3 };
+		for (const auto* pNotification : notifications)
+			tape.notify(*pNotification);
+
+		// Act:
+		std::vector<const Notification*> replayedNotifications;
+		tape.forEach([&replayedNotifications](const auto& notification) {
+			replayedNotifications.push_back(&notification);
+		});
+
+		// Assert:
+		ASSERT_EQ(3u, replayedNotifications.size());
+		for (auto i = 0u; i < notifications.size(); ++i) {
+			const auto* pReplayedNotification = replayedNotifications[i];
+			EXPECT_NE(notifications[i], pReplayedNotification) << i;
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pReplayedNotification) % alignof(std::max_align_t)) << i;
+
+			ASSERT_EQ(notifications[i]->Size, pReplayedNotification->Size) << i;
+			EXPECT_EQ(0, std::memcmp(notifications[i], pReplayedNotification, notifications[i]->Size)) << i;
+		}
+	}
+
+	// endregion
+
+	// region record
+
+	namespace {
+		class CountingNotificationPublisher : public NotificationPublisher {
+		public:
+			explicit CountingNotificationPublisher(const TestAccounts& accounts)
+					: m_accounts(accounts)
+					, m_numPublishCalls(0)
+			{}
+
+		public:
+			size_t numPublishCalls() const {
+				return m_numPublishCalls;
+			}
+
+		public:
+			void publish(const WeakEntityInfo&, NotificationSubscriber& sub) const override {
+				++m_numPublishCalls;
+				sub.notify(AccountAddressNotification(m_accounts.Address));
+				sub.notify(AccountPublicKeyNotification(m_accounts.PublicKey));
+			}
+
+		private:
+			const TestAccounts& m_accounts;
+			mutable size_t m_numPublishCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, CanRecordNotificationsPublishedForEntities) {
+		// Arrange:
+		NotificationTape tape;
+		TestAccounts accounts;
+		CountingNotificationPublisher publisher(accounts);
+		auto pTransaction = mocks::CreateMockTransaction(0);
+
+		// Act:
+		tape.record(publisher, WeakEntityInfo(*pTransaction));
+		tape.record(publisher, WeakEntityInfo(*pTransaction));
+
+		mocks::MockNotificationSubscriber sub;
+		tape.replay(sub);
+		tape.replayReverse(sub);
+
+		// Assert: entities were only published once each
+		EXPECT_EQ(2u, publisher.numPublishCalls());
+		EXPECT_EQ(4u, tape.size());
+		EXPECT_EQ(8u, sub.numNotifications());
+		EXPECT_EQ(4u, sub.numAddresses());
+		EXPECT_EQ(4u, sub.numKeys());
+	}
+
+	// endregion
+}}
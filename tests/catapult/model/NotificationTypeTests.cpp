@@ -129,6 +129,20 @@ namespace catapult { namespace model {
 
 	// endregion
 
+	// region GetNotificationSource
+
+	TEST(TEST_CLASS, CanGetNotificationSourceFromNotificationType) {
+		// Arrange:
+		auto type = MakeNotificationType(NotificationChannel::Observer, 0xAB, 0x9876);
+
+		// Act + Assert:
+		EXPECT_EQ(0x00AB9876u, GetNotificationSource(type));
+		EXPECT_EQ(0x00AB9876u, GetNotificationSource(MakeNotificationType(NotificationChannel::All, 0xAB, 0x9876)));
+		EXPECT_EQ(0x00000000u, GetNotificationSource(MakeNotificationType(NotificationChannel::All, 0, 0)));
+	}
+
+	// endregion
+
 	// region AreEqualExcludingChannel
 
 	TEST(TEST_CLASS, AreEqualExcludingChannelReturnsTrueIfAndOnlyIfTypesHaveSameFacilityAndCode) {
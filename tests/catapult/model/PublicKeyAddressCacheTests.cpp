@@ -0,0 +1,262 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/model/PublicKeyAddressCache.h"
+#include "catapult/model/Address.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+
+namespace catapult { namespace model {
+
+#define TEST_CLASS PublicKeyAddressCacheTests
+
+	namespace {
+		constexpr auto Network_Identifier = NetworkIdentifier::Mijin_Test;
+
+		std::vector<Key> GenerateRandomKeys(size_t count) {
+			std::vector<Key> keys;
+			for (auto i = 0u; i < count; ++i)
+				keys.push_back(test::GenerateRandomData<Key_Size>());
+
+			return keys;
+		}
+
+		void AssertStatistics(const PublicKeyAddressCache& cache, size_t size, uint64_t numHits, uint64_t numMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(size, statistics.Size);
+			EXPECT_EQ(numHits, statistics.NumHits);
+			EXPECT_EQ(numMisses, statistics.NumMisses);
+		}
+	}
+
+	// region basic
+
+	TEST(TEST_CLASS, CacheIsInitiallyEmpty) {
+		// Act:
+		PublicKeyAddressCache cache(Network_Identifier, 10);
+
+		// Assert:
+		EXPECT_EQ(Network_Identifier, cache.networkIdentifier());
+		AssertStatistics(cache, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, CanCalculateAddressOfUncachedKey) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 10);
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto address = cache.toAddress(publicKey);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(publicKey, Network_Identifier), address);
+		AssertStatistics(cache, 1, 0, 1);
+	}
+
+	TEST(TEST_CLASS, CanRetrieveAddressOfCachedKey) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 10);
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		cache.toAddress(publicKey);
+
+		// Act:
+		auto address1 = cache.toAddress(publicKey);
+		auto address2 = cache.toAddress(publicKey);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(publicKey, Network_Identifier), address1);
+		EXPECT_EQ(PublicKeyToAddress(publicKey, Network_Identifier), address2);
+		AssertStatistics(cache, 1, 2, 1);
+	}
+
+	TEST(TEST_CLASS, AddressesAreCalculatedForCacheNetwork) {
+		// Arrange:
+		PublicKeyAddressCache cache(NetworkIdentifier::Public_Test, 10);
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		auto address = cache.toAddress(publicKey);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(publicKey, NetworkIdentifier::Public_Test), address);
+		EXPECT_NE(PublicKeyToAddress(publicKey, Network_Identifier), address);
+	}
+
+	// endregion
+
+	// region eviction
+
+	TEST(TEST_CLASS, CacheSizeIsBounded) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 10);
+		auto keys = GenerateRandomKeys(25);
+
+		// Act:
+		for (const auto& key : keys)
+			cache.toAddress(key);
+
+		// Assert:
+		AssertStatistics(cache, 10, 0, 25);
+	}
+
+	TEST(TEST_CLASS, ShardedCacheSizeIsBounded) {
+		// Arrange: large caches are split into multiple shards
+		PublicKeyAddressCache cache(Network_Identifier, 1000);
+		auto keys = GenerateRandomKeys(5000);
+
+		// Act:
+		for (const auto& key : keys)
+			cache.toAddress(key);
+
+		// Assert: every shard is full
+		AssertStatistics(cache, 1000, 0, 5000);
+	}
+
+	TEST(TEST_CLASS, UnusedAddressesAreEvictedBeforeRecentlyUsedAddresses) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 3);
+		auto keys = GenerateRandomKeys(4);
+		for (auto i = 0u; i < 3; ++i)
+			cache.toAddress(keys[i]);
+
+		// - use the first key so that the second key is least recently used
+		cache.toAddress(keys[0]);
+
+		// Act: add a fourth key
+		cache.toAddress(keys[3]);
+
+		// Assert: the first key is still cached but the second one was evicted
+		AssertStatistics(cache, 3, 1, 4);
+		cache.toAddress(keys[0]);
+		AssertStatistics(cache, 3, 2, 4);
+		cache.toAddress(keys[1]);
+		AssertStatistics(cache, 3, 2, 5);
+	}
+
+	TEST(TEST_CLASS, RecentlyUsedAddressesAreOnlyRetainedForOneEvictionPass) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 2);
+		auto keys = GenerateRandomKeys(4);
+		cache.toAddress(keys[0]);
+		cache.toAddress(keys[1]);
+
+		// - use both keys so that the next eviction needs to pass over both of them
+		cache.toAddress(keys[0]);
+		cache.toAddress(keys[1]);
+
+		// Act: add two more keys
+		cache.toAddress(keys[2]);
+		cache.toAddress(keys[3]);
+
+		// Assert: both used keys were evicted after being passed over once
+		AssertStatistics(cache, 2, 2, 4);
+		cache.toAddress(keys[2]);
+		cache.toAddress(keys[3]);
+		AssertStatistics(cache, 2, 4, 4);
+	}
+
+	TEST(TEST_CLASS, CacheRetainsAtLeastOneAddress) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 0);
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+
+		// Act:
+		cache.toAddress(publicKey);
+		cache.toAddress(publicKey);
+
+		// Assert:
+		AssertStatistics(cache, 1, 1, 1);
+	}
+
+	// endregion
+
+	// region thread safety
+
+	TEST(TEST_CLASS, CanCalculateAddressesConcurrently) {
+		// Arrange:
+		PublicKeyAddressCache cache(Network_Identifier, 1000);
+		auto keys = GenerateRandomKeys(100);
+		auto numThreads = test::Num_Default_Lock_Threads;
+
+		// Act: every thread looks up all keys
+		std::vector<std::vector<Address>> threadAddresses(numThreads);
+		boost::thread_group threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.create_thread([&cache, &keys, &addresses = threadAddresses[i]]() {
+				for (const auto& key : keys)
+					addresses.push_back(cache.toAddress(key));
+			});
+		}
+
+		threads.join_all();
+
+		// Assert:
+		for (auto i = 0u; i < numThreads; ++i) {
+			ASSERT_EQ(keys.size(), threadAddresses[i].size()) << "thread " << i;
+			for (auto j = 0u; j < keys.size(); ++j)
+				EXPECT_EQ(PublicKeyToAddress(keys[j], Network_Identifier), threadAddresses[i][j]) << "thread " << i << " key " << j;
+		}
+
+		// - every key is calculated at least once, but concurrent misses of the same key can be calculated more than once
+		auto statistics = cache.statistics();
+		EXPECT_EQ(keys.size(), statistics.Size);
+		EXPECT_EQ(numThreads * keys.size(), statistics.NumHits + statistics.NumMisses);
+		EXPECT_LE(keys.size(), statistics.NumMisses);
+	}
+
+	// endregion
+
+	// region process-wide cache
+
+	TEST(TEST_CLASS, ProcessWideCacheIsSharedPerNetwork) {
+		// Act:
+		auto& cache1 = GetPublicKeyAddressCache(NetworkIdentifier::Mijin_Test);
+		auto& cache2 = GetPublicKeyAddressCache(NetworkIdentifier::Public_Test);
+		auto& cache3 = GetPublicKeyAddressCache(NetworkIdentifier::Mijin_Test);
+
+		// Assert:
+		EXPECT_EQ(NetworkIdentifier::Mijin_Test, cache1.networkIdentifier());
+		EXPECT_EQ(NetworkIdentifier::Public_Test, cache2.networkIdentifier());
+		EXPECT_NE(&cache1, &cache2);
+		EXPECT_EQ(&cache1, &cache3);
+	}
+
+	TEST(TEST_CLASS, CachedPublicKeyToAddressUsesProcessWideCache) {
+		// Arrange:
+		const auto& cache = GetPublicKeyAddressCache(Network_Identifier);
+		auto publicKey = test::GenerateRandomData<Key_Size>();
+		auto initialStatistics = cache.statistics();
+
+		// Act:
+		auto address1 = CachedPublicKeyToAddress(publicKey, Network_Identifier);
+		auto address2 = CachedPublicKeyToAddress(publicKey, Network_Identifier);
+
+		// Assert:
+		EXPECT_EQ(PublicKeyToAddress(publicKey, Network_Identifier), address1);
+		EXPECT_EQ(PublicKeyToAddress(publicKey, Network_Identifier), address2);
+
+		auto statistics = cache.statistics();
+		EXPECT_EQ(initialStatistics.NumHits + 1, statistics.NumHits);
+		EXPECT_EQ(initialStatistics.NumMisses + 1, statistics.NumMisses);
+	}
+
+	// endregion
+}}
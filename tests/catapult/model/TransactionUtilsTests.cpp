@@ -22,6 +22,7 @@
 #include "catapult/model/Address.h"
 #include "catapult/model/NotificationPublisher.h"
 #include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/NotificationTape.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/TestHarness.h"
 
@@ -105,4 +106,119 @@ namespace catapult { namespace model {
 		// Assert:
 		EXPECT_TRUE(addresses.empty());
 	}
+
+	// region ExtractAccountReferences
+
+	namespace {
+		auto CreateMockTransactionWithRandomAccounts() {
+			return mocks::CreateMockTransactionWithSignerAndRecipient(
+					test::GenerateRandomData<Key_Size>(),
+					test::GenerateRandomData<Key_Size>());
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractAccountReferencesExtractsAddressesFromAddressNotifications) {
+		// Arrange:
+		auto pTransaction = CreateMockTransactionWithRandomAccounts();
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Address);
+
+		// Act:
+		AccountReferences references;
+		ExtractAccountReferences(WeakEntityInfo(*pTransaction), notificationPublisher, references);
+
+		// Assert:
+		EXPECT_EQ(2u, references.Addresses.size());
+		EXPECT_TRUE(references.Addresses.cend() != references.Addresses.find(PublicKeyToAddress(pTransaction->Signer, Network_Identifier)));
+		EXPECT_TRUE(references.Addresses.cend() != references.Addresses.find(PublicKeyToAddress(pTransaction->Recipient, Network_Identifier)));
+		EXPECT_TRUE(references.PublicKeys.empty());
+	}
+
+	TEST(TEST_CLASS, ExtractAccountReferencesExtractsPublicKeysFromPublicKeyNotifications) {
+		// Arrange:
+		auto pTransaction = CreateMockTransactionWithRandomAccounts();
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Public_Key);
+
+		// Act:
+		AccountReferences references;
+		ExtractAccountReferences(WeakEntityInfo(*pTransaction), notificationPublisher, references);
+
+		// Assert:
+		EXPECT_TRUE(references.Addresses.empty());
+		EXPECT_EQ(2u, references.PublicKeys.size());
+		EXPECT_TRUE(references.PublicKeys.cend() != references.PublicKeys.find(pTransaction->Signer));
+		EXPECT_TRUE(references.PublicKeys.cend() != references.PublicKeys.find(pTransaction->Recipient));
+	}
+
+	TEST(TEST_CLASS, ExtractAccountReferencesDoesNotExtractReferencesFromOtherNotifications) {
+		// Arrange:
+		auto pTransaction = CreateMockTransactionWithRandomAccounts();
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Other);
+
+		// Act:
+		AccountReferences references;
+		ExtractAccountReferences(WeakEntityInfo(*pTransaction), notificationPublisher, references);
+
+		// Assert:
+		EXPECT_TRUE(references.Addresses.empty());
+		EXPECT_TRUE(references.PublicKeys.empty());
+	}
+
+	TEST(TEST_CLASS, ExtractAccountReferencesAccumulatesReferencesAcrossEntities) {
+		// Arrange:
+		auto pTransaction1 = CreateMockTransactionWithRandomAccounts();
+		auto pTransaction2 = CreateMockTransactionWithRandomAccounts();
+		pTransaction2->Recipient = pTransaction1->Signer;
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Public_Key);
+
+		// Act:
+		AccountReferences references;
+		ExtractAccountReferences(WeakEntityInfo(*pTransaction1), notificationPublisher, references);
+		ExtractAccountReferences(WeakEntityInfo(*pTransaction2), notificationPublisher, references);
+
+		// Assert: shared key is only present once
+		EXPECT_EQ(3u, references.PublicKeys.size());
+	}
+
+	// endregion
+
+	// region notification tape
+
+	// note: address mode is not used because its notifications reference addresses that do not outlive publish
+
+	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromRecordedNotifications) {
+		// Arrange:
+		auto pTransaction1 = CreateMockTransactionWithRandomAccounts();
+		auto pTransaction2 = CreateMockTransactionWithRandomAccounts();
+		NotificationTape tape;
+		tape.record(MockNotificationPublisher(MockNotificationPublisher::Mode::Public_Key), WeakEntityInfo(*pTransaction1));
+		tape.record(MockNotificationPublisher(MockNotificationPublisher::Mode::Other), WeakEntityInfo(*pTransaction2));
+
+		// Act:
+		auto addresses = ExtractAddresses(tape, Network_Identifier);
+
+		// Assert:
+		EXPECT_EQ(2u, addresses.size());
+		EXPECT_TRUE(addresses.cend() != addresses.find(PublicKeyToAddress(pTransaction1->Signer, Network_Identifier)));
+		EXPECT_TRUE(addresses.cend() != addresses.find(PublicKeyToAddress(pTransaction1->Recipient, Network_Identifier)));
+	}
+
+	TEST(TEST_CLASS, ExtractAccountReferencesExtractsReferencesFromRecordedNotifications) {
+		// Arrange:
+		auto pTransaction1 = CreateMockTransactionWithRandomAccounts();
+		auto pTransaction2 = CreateMockTransactionWithRandomAccounts();
+		pTransaction2->Recipient = pTransaction1->Signer;
+		NotificationTape tape;
+		tape.record(MockNotificationPublisher(MockNotificationPublisher::Mode::Public_Key), WeakEntityInfo(*pTransaction1));
+		tape.record(MockNotificationPublisher(MockNotificationPublisher::Mode::Public_Key), WeakEntityInfo(*pTransaction2));
+
+		// Act:
+		AccountReferences references;
+		ExtractAccountReferences(tape, references);
+
+		// Assert: shared key is only present once
+		EXPECT_TRUE(references.Addresses.empty());
+		EXPECT_EQ(3u, references.PublicKeys.size());
+	}
+
+	// endregion
 }}
@@ -200,4 +200,33 @@ namespace catapult { namespace net {
 	}
 
 	// endregion
+
+	// region CalculateSessionId
+
+	TEST(TEST_CLASS, CalculateSessionIdIsDeterministic) {
+		// Arrange:
+		auto serverChallenge = test::GenerateRandomData<64>();
+		auto clientChallenge = test::GenerateRandomData<64>();
+
+		// Act:
+		auto sessionId1 = CalculateSessionId(serverChallenge, clientChallenge);
+		auto sessionId2 = CalculateSessionId(serverChallenge, clientChallenge);
+
+		// Assert:
+		EXPECT_EQ(sessionId1, sessionId2);
+	}
+
+	TEST(TEST_CLASS, CalculateSessionIdDependsOnBothChallenges) {
+		// Arrange:
+		auto serverChallenge = test::GenerateRandomData<64>();
+		auto clientChallenge = test::GenerateRandomData<64>();
+		auto sessionId = CalculateSessionId(serverChallenge, clientChallenge);
+
+		// Act + Assert:
+		EXPECT_NE(sessionId, CalculateSessionId(test::GenerateRandomData<64>(), clientChallenge));
+		EXPECT_NE(sessionId, CalculateSessionId(serverChallenge, test::GenerateRandomData<64>()));
+		EXPECT_NE(sessionId, CalculateSessionId(clientChallenge, serverChallenge));
+	}
+
+	// endregion
 }}
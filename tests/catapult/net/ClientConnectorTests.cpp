@@ -432,6 +432,22 @@ namespace catapult { namespace net {
 		});
 	}
 
+	TEST(TEST_CLASS, SecurityModeMacWritesSecurePackets) {
+		// Arrange:
+		ConnectionSettings settings;
+		settings.OutgoingSecurityMode = ionet::ConnectionSecurityMode::Mac;
+		settings.IncomingSecurityModes = ionet::ConnectionSecurityMode::Mac;
+
+		// Act:
+		RunSecurityModeTest(settings, false, [](const auto& state) {
+			// Assert:
+			EXPECT_EQ(PeerConnectResult::Accepted, state.AcceptResult);
+			EXPECT_NE(state.pServerSocket, state.pAcceptedServerSocket);
+
+			AssertWrittenPacketType(state, ionet::PacketType::Secure_Mac, ionet::PacketType::Chain_Info);
+		});
+	}
+
 	TEST(TEST_CLASS, UnsupportedSecurityModeIsRejected) {
 		// Arrange:
 		ConnectionSettings settings;
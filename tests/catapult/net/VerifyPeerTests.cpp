@@ -535,6 +535,10 @@ namespace catapult { namespace net {
 			EXPECT_EQ(VerifyResult::Success, clientResult);
 			EXPECT_EQ(serverKeyPair.publicKey(), verifiedServerPeerInfo.PublicKey);
 			EXPECT_EQ(securityMode, verifiedServerPeerInfo.SecurityMode);
+
+			// - both peers agree on the session
+			EXPECT_NE(Hash256(), verifiedClientPeerInfo.SessionId);
+			EXPECT_EQ(verifiedClientPeerInfo.SessionId, verifiedServerPeerInfo.SessionId);
 		}
 	}
 
@@ -548,5 +552,10 @@ namespace catapult { namespace net {
 		AssertVerifyClientAndVerifyServerCanMutuallyValidate(ionet::ConnectionSecurityMode::Signed, Default_Allowed_Security_Mode_Mask);
 	}
 
+	TEST(TEST_CLASS, VerifyClientAndVerifyServerCanMutuallyValidate_Mac) {
+		// Assert:
+		AssertVerifyClientAndVerifyServerCanMutuallyValidate(ionet::ConnectionSecurityMode::Mac, ionet::ConnectionSecurityMode::Mac);
+	}
+
 	// endregion
 }}
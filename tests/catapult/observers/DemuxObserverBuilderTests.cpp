@@ -250,5 +250,62 @@ namespace catapult { namespace observers {
 		});
 	}
 
+	namespace {
+		Breadcrumbs ObserveWithInterleavedObservers(const model::Notification& notification, NotifyMode mode) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			DemuxObserverBuilder builder;
+
+			state::CatapultState state;
+			cache::CatapultCache cache({});
+			auto cacheDelta = cache.createDelta();
+			auto context = test::CreateObserverContext(cacheDelta, state, Height(123), mode);
+
+			builder
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all1"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "key1"))
+				.add(CreateBreadcrumbObserver<model::AccountAddressNotification>(breadcrumbs, "address1"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all2"))
+				.add(CreateBreadcrumbObserver<model::AccountPublicKeyNotification>(breadcrumbs, "key2"))
+				.add(CreateBreadcrumbObserver(breadcrumbs, "all3"));
+			auto pObserver = builder.build();
+
+			// Act:
+			test::ObserveNotification<model::Notification>(*pObserver, notification, context);
+
+			// Assert:
+			Breadcrumbs expectedNames{ "all1", "key1", "address1", "all2", "key2", "all3" };
+			EXPECT_EQ(expectedNames, pObserver->names());
+			return breadcrumbs;
+		}
+	}
+
+	TEST(TEST_CLASS, MatchingAndUniversalObserversAreNotifiedInRegistrationOrderOnCommit) {
+		// Act:
+		auto breadcrumbs = ObserveWithInterleavedObservers(model::AccountPublicKeyNotification(Key()), NotifyMode::Commit);
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "all1", "key1", "all2", "key2", "all3" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
+	TEST(TEST_CLASS, MatchingAndUniversalObserversAreNotifiedInReverseRegistrationOrderOnRollback) {
+		// Act:
+		auto breadcrumbs = ObserveWithInterleavedObservers(model::AccountPublicKeyNotification(Key()), NotifyMode::Rollback);
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "all3", "key2", "all2", "key1", "all1" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
+	TEST(TEST_CLASS, OnlyUniversalObserversAreNotifiedForUnregisteredNotificationType) {
+		// Act:
+		auto breadcrumbs = ObserveWithInterleavedObservers(model::EntityNotification(model::NetworkIdentifier::Zero), NotifyMode::Commit);
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "all1", "all2", "all3" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
 	// endregion
 }}
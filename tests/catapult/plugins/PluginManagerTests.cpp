@@ -23,8 +23,10 @@
 #include "tests/test/cache/SimpleCache.h"
 #include "tests/test/core/mocks/MockNotificationSubscriber.h"
 #include "tests/test/core/mocks/MockTransaction.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/test/plugins/ValidatorTestUtils.h"
 #include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
 
 namespace catapult { namespace plugins {
 
@@ -39,6 +41,8 @@ namespace catapult { namespace plugins {
 		// Assert:
 		EXPECT_FALSE(config.PreferCacheDatabase);
 		EXPECT_TRUE(config.CacheDatabaseDirectory.empty());
+		EXPECT_EQ(utils::FileSize(), config.CacheDatabaseOptions.BlockCacheSize);
+		EXPECT_FALSE(config.CacheDatabaseOptions.ShouldEnableStatistics);
 	}
 
 	TEST(TEST_CLASS, CanCreateManager) {
@@ -57,23 +61,86 @@ namespace catapult { namespace plugins {
 		EXPECT_EQ("abc", manager.storageConfig().CacheDatabaseDirectory);
 	}
 
+	namespace {
+		StorageConfiguration CreateStorageConfigurationWithCacheDatabase(const std::string& directory) {
+			auto storageConfig = StorageConfiguration();
+			storageConfig.PreferCacheDatabase = true;
+			storageConfig.CacheDatabaseDirectory = directory;
+			storageConfig.CacheDatabaseOptions.BloomFilterBitsPerKey = 17;
+			return storageConfig;
+		}
+	}
+
+	TEST(TEST_CLASS, CacheDatabaseIsNotOpenedByConstructor) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("abc");
+
+		// Act:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), CreateStorageConfigurationWithCacheDatabase("abc"));
+
+		// Assert:
+		EXPECT_FALSE(!!manager.cacheDatabase());
+		EXPECT_FALSE(boost::filesystem::exists("abc"));
+	}
+
+	TEST(TEST_CLASS, CannotCreateCacheConfigurationBeforeOpeningCacheDatabase) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("abc");
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), CreateStorageConfigurationWithCacheDatabase("abc"));
+
+		// Act + Assert:
+		EXPECT_THROW(manager.cacheConfig("foo"), catapult_runtime_error);
+		EXPECT_FALSE(!!manager.cacheDatabase());
+	}
+
+	TEST(TEST_CLASS, CannotOpenCacheDatabaseMultipleTimes) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard("abc");
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), CreateStorageConfigurationWithCacheDatabase("abc"));
+		manager.openCacheDatabase();
+
+		// Act + Assert:
+		EXPECT_THROW(manager.openCacheDatabase(), catapult_runtime_error);
+	}
+
 	TEST(TEST_CLASS, CanCreateCacheConfiguration) {
 		// Arrange:
-		auto storageConfig = StorageConfiguration();
-		storageConfig.PreferCacheDatabase = true;
-		storageConfig.CacheDatabaseDirectory = "abc";
+		test::TempDirectoryGuard dbDirGuard("abc");
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), CreateStorageConfigurationWithCacheDatabase("abc"));
 
 		// Act:
-		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), storageConfig);
+		manager.openCacheDatabase();
 
 		// Assert: cache configuration is constructed appropriately
 		auto cacheConfig1 = manager.cacheConfig("foo");
 		EXPECT_TRUE(cacheConfig1.ShouldUseCacheDatabase);
-		EXPECT_EQ("abc/foo", cacheConfig1.CacheDatabaseDirectory);
+		EXPECT_TRUE(!!cacheConfig1.pSharedCacheDatabase);
+		EXPECT_EQ("foo", cacheConfig1.SharedCacheDatabaseName);
+		EXPECT_EQ(17u, cacheConfig1.CacheDatabaseOptions.BloomFilterBitsPerKey);
 
 		auto cacheConfig2 = manager.cacheConfig("bar");
 		EXPECT_TRUE(cacheConfig2.ShouldUseCacheDatabase);
-		EXPECT_EQ("abc/bar", cacheConfig2.CacheDatabaseDirectory);
+		EXPECT_TRUE(!!cacheConfig2.pSharedCacheDatabase);
+		EXPECT_EQ("bar", cacheConfig2.SharedCacheDatabaseName);
+		EXPECT_EQ(17u, cacheConfig2.CacheDatabaseOptions.BloomFilterBitsPerKey);
+
+		// - all caches share the same database
+		EXPECT_EQ(cacheConfig1.pSharedCacheDatabase, cacheConfig2.pSharedCacheDatabase);
+		EXPECT_EQ(cacheConfig1.pSharedCacheDatabase.get(), manager.cacheDatabase());
+	}
+
+	TEST(TEST_CLASS, CanCreateCacheConfigurationWithoutDatabase) {
+		// Arrange:
+		PluginManager manager(model::BlockChainConfiguration::Uninitialized(), StorageConfiguration());
+
+		// Act: opening the database has no effect when a cache database is not preferred
+		manager.openCacheDatabase();
+		auto cacheConfig = manager.cacheConfig("foo");
+
+		// Assert:
+		EXPECT_FALSE(cacheConfig.ShouldUseCacheDatabase);
+		EXPECT_FALSE(!!cacheConfig.pSharedCacheDatabase);
+		EXPECT_FALSE(!!manager.cacheDatabase());
 	}
 
 	// endregion
@@ -45,4 +45,45 @@ namespace catapult { namespace state {
 			EXPECT_EQ(model::ImportanceHeight(0), pair.Height);
 		}
 	}
+
+	TEST(TEST_CLASS, CanMakeSharedAccountState) {
+		// Arrange:
+		auto address = test::GenerateRandomAddress();
+
+		// Act:
+		auto pState = MakeSharedAccountState(address, Height(1234));
+
+		// Assert:
+		ASSERT_TRUE(!!pState);
+		EXPECT_EQ(address, pState->Address);
+		EXPECT_EQ(Height(1234), pState->AddressHeight);
+		EXPECT_EQ(Height(0), pState->PublicKeyHeight);
+		EXPECT_EQ(0u, pState->Balances.size());
+	}
+
+	TEST(TEST_CLASS, CanMakeSharedAccountStateCopy) {
+		// Arrange:
+		AccountState state(test::GenerateRandomAddress(), Height(1234));
+		state.PublicKey = test::GenerateRandomData<Key_Size>();
+		state.PublicKeyHeight = Height(2345);
+		state.Balances.credit(MosaicId(1), Amount(100));
+		state.Balances.credit(MosaicId(2), Amount(200));
+
+		// Act:
+		auto pState = MakeSharedAccountState(state);
+
+		// Assert: the copy is independent of the original
+		ASSERT_TRUE(!!pState);
+		EXPECT_NE(&state, pState.get());
+		EXPECT_EQ(state.Address, pState->Address);
+		EXPECT_EQ(Height(1234), pState->AddressHeight);
+		EXPECT_EQ(state.PublicKey, pState->PublicKey);
+		EXPECT_EQ(Height(2345), pState->PublicKeyHeight);
+		EXPECT_EQ(2u, pState->Balances.size());
+		EXPECT_EQ(Amount(100), pState->Balances.get(MosaicId(1)));
+		EXPECT_EQ(Amount(200), pState->Balances.get(MosaicId(2)));
+
+		state.Balances.credit(MosaicId(2), Amount(50));
+		EXPECT_EQ(Amount(200), pState->Balances.get(MosaicId(2)));
+	}
 }}
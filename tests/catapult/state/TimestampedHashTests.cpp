@@ -135,4 +135,34 @@ namespace catapult { namespace state {
 	}
 
 	// endregion
+
+	// region hasher
+
+	TEST(TEST_CLASS, HasherHashesOnlyHash) {
+		// Arrange:
+		auto hash = test::GenerateRandomData<Hash256_Size>();
+		TimestampedHashHasher hasher;
+
+		// Act:
+		auto result1 = hasher(TimestampedHash(Timestamp(123), hash));
+		auto result2 = hasher(TimestampedHash(Timestamp(234), hash));
+
+		// Assert:
+		EXPECT_EQ(reinterpret_cast<const size_t&>(hash[0]), result1);
+		EXPECT_EQ(result1, result2);
+	}
+
+	TEST(TEST_CLASS, HasherReturnsDifferentResultsForDifferentHashes) {
+		// Arrange:
+		TimestampedHashHasher hasher;
+
+		// Act:
+		auto result1 = hasher(TimestampedHash(Timestamp(123), test::GenerateRandomData<Hash256_Size>()));
+		auto result2 = hasher(TimestampedHash(Timestamp(123), test::GenerateRandomData<Hash256_Size>()));
+
+		// Assert:
+		EXPECT_NE(result1, result2);
+	}
+
+	// endregion
 }}
@@ -23,9 +23,12 @@
 #include "catapult/ionet/Node.h"
 #include "catapult/model/ChainScore.h"
 #include "tests/catapult/subscribers/test/UnsupportedSubscribers.h"
+#include "tests/test/core/StorageTestUtils.h"
 #include "tests/test/core/TransactionInfoTestUtils.h"
 #include "tests/test/core/TransactionTestUtils.h"
+#include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
+#include <boost/filesystem.hpp>
 
 namespace catapult { namespace subscribers {
 
@@ -149,6 +152,25 @@ namespace catapult { namespace subscribers {
 		manager.fileStorage();
 	}
 
+	TEST(TEST_CLASS, CanCreateManagerWithSegmentedFileStorage) {
+		// Arrange: seed the data directory with a nemesis block stored one file per block
+		test::TempDirectoryGuard tempDir;
+		test::PrepareStorage(tempDir.name());
+
+		auto config = CreateConfiguration();
+		const_cast<bool&>(config.Node.ShouldUseSegmentedBlockStorage) = true;
+		const_cast<std::string&>(config.User.DataDirectory) = tempDir.name();
+
+		// Act:
+		SubscriptionManager manager(config);
+		const auto& fileStorage = manager.fileStorage();
+
+		// Assert: the nemesis block was imported into segmented storage
+		EXPECT_EQ(Height(1), fileStorage.chainHeight());
+		EXPECT_EQ(Height(1), fileStorage.loadBlock(Height(1))->Height);
+		EXPECT_TRUE(boost::filesystem::exists(tempDir.name() + "/segments.idx"));
+	}
+
 	// endregion
 
 	// region single aggregate creation
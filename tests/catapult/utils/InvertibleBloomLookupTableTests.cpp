@@ -0,0 +1,264 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/InvertibleBloomLookupTable.h"
+#include "catapult/utils/ArraySet.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS InvertibleBloomLookupTableTests
+
+	namespace {
+		using Table = InvertibleBloomLookupTable<Hash256>;
+
+		// decoding is probabilistic, so use enough cells to make failures negligible
+		constexpr size_t Num_Cells = 3 * 512;
+
+		Table CreateTable(size_t numCells, const std::vector<Hash256>& hashes) {
+			Table table(numCells);
+			for (const auto& hash : hashes)
+				table.insert(hash);
+
+			return table;
+		}
+
+		HashSet ToSet(const std::vector<Hash256>& hashes) {
+			return HashSet(hashes.cbegin(), hashes.cend());
+		}
+
+		void AssertDecode(const Table& table, const std::vector<Hash256>& expectedPositive, const std::vector<Hash256>& expectedNegative) {
+			// Act:
+			std::vector<Hash256> positiveKeys;
+			std::vector<Hash256> negativeKeys;
+			auto isDecoded = table.decode(positiveKeys, negativeKeys);
+
+			// Assert:
+			EXPECT_TRUE(isDecoded);
+			EXPECT_EQ(expectedPositive.size(), positiveKeys.size());
+			EXPECT_EQ(ToSet(expectedPositive), ToSet(positiveKeys));
+			EXPECT_EQ(expectedNegative.size(), negativeKeys.size());
+			EXPECT_EQ(ToSet(expectedNegative), ToSet(negativeKeys));
+		}
+	}
+
+	// region number of cells
+
+	TEST(TEST_CLASS, IsValidNumCellsReturnsTrueOnlyForMultiplesOfPartitionCountByPowerOfTwo) {
+		// Assert:
+		for (auto numCells : { 3u, 6u, 12u, 24u, 3u * 1024 })
+			EXPECT_TRUE(Table::IsValidNumCells(numCells)) << numCells;
+
+		for (auto numCells : { 0u, 1u, 2u, 4u, 9u, 18u, 3u * 1023 })
+			EXPECT_FALSE(Table::IsValidNumCells(numCells)) << numCells;
+	}
+
+	TEST(TEST_CLASS, CalculateNumCellsReturnsSmallestValidNumCellsNotLessThanMinimum) {
+		// Assert:
+		EXPECT_EQ(3u, Table::CalculateNumCells(0));
+		EXPECT_EQ(3u, Table::CalculateNumCells(3));
+		EXPECT_EQ(6u, Table::CalculateNumCells(4));
+		EXPECT_EQ(12u, Table::CalculateNumCells(7));
+		EXPECT_EQ(12u, Table::CalculateNumCells(12));
+		EXPECT_EQ(24u, Table::CalculateNumCells(13));
+	}
+
+	// endregion
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateEmptyTableWithMinimumNumberOfCells) {
+		// Act:
+		Table table(10);
+
+		// Assert:
+		EXPECT_EQ(12u, table.numCells());
+		EXPECT_EQ(12u, table.cells().size());
+		AssertDecode(table, {}, {});
+	}
+
+	TEST(TEST_CLASS, CanCreateTableAroundValidCells) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(3);
+		auto cells = CreateTable(Num_Cells, hashes).cells();
+
+		// Act:
+		Table table(std::move(cells));
+
+		// Assert:
+		EXPECT_EQ(Num_Cells, table.numCells());
+		AssertDecode(table, hashes, {});
+	}
+
+	TEST(TEST_CLASS, CannotCreateTableAroundInvalidNumberOfCells) {
+		// Act + Assert:
+		EXPECT_THROW(Table(std::vector<Table::Cell>()), catapult_invalid_argument);
+		EXPECT_THROW(Table(std::vector<Table::Cell>(9)), catapult_invalid_argument);
+	}
+
+	// endregion
+
+	// region insert / erase
+
+	TEST(TEST_CLASS, CanDecodeInsertedKeys) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+
+		// Act:
+		auto table = CreateTable(Num_Cells, hashes);
+
+		// Assert:
+		AssertDecode(table, hashes, {});
+	}
+
+	TEST(TEST_CLASS, CanDecodeErasedKeys) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		Table table(Num_Cells);
+
+		// Act:
+		for (const auto& hash : hashes)
+			table.erase(hash);
+
+		// Assert:
+		AssertDecode(table, {}, hashes);
+	}
+
+	TEST(TEST_CLASS, EraseCancelsInsert) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(10);
+		auto table = CreateTable(Num_Cells, hashes);
+
+		// Act:
+		for (auto i = 0u; i < 8; ++i)
+			table.erase(hashes[i]);
+
+		// Assert:
+		AssertDecode(table, { hashes[8], hashes[9] }, {});
+	}
+
+	// endregion
+
+	// region subtract
+
+	TEST(TEST_CLASS, CannotSubtractTablesWithDifferentNumberOfCells) {
+		// Arrange:
+		Table table1(12);
+		Table table2(24);
+
+		// Act + Assert:
+		EXPECT_THROW(table1.subtract(table2), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanDecodeDifferenceOfLargeSets) {
+		// Arrange: 1000 common keys, 20 keys only in first table and 15 keys only in second table
+		auto commonHashes = test::GenerateRandomDataVector<Hash256>(1000);
+		auto firstHashes = test::GenerateRandomDataVector<Hash256>(20);
+		auto secondHashes = test::GenerateRandomDataVector<Hash256>(15);
+
+		auto table1 = CreateTable(2 * Num_Cells, commonHashes);
+		auto table2 = CreateTable(2 * Num_Cells, commonHashes);
+		for (const auto& hash : firstHashes)
+			table1.insert(hash);
+
+		for (const auto& hash : secondHashes)
+			table2.insert(hash);
+
+		// Act:
+		table1.subtract(table2);
+
+		// Assert:
+		AssertDecode(table1, firstHashes, secondHashes);
+	}
+
+	TEST(TEST_CLASS, CannotDecodeDifferenceLargerThanTable) {
+		// Arrange:
+		auto table1 = CreateTable(12, test::GenerateRandomDataVector<Hash256>(50));
+		auto table2 = CreateTable(12, test::GenerateRandomDataVector<Hash256>(50));
+		table1.subtract(table2);
+
+		// Act:
+		std::vector<Hash256> positiveKeys;
+		std::vector<Hash256> negativeKeys;
+		auto isDecoded = table1.decode(positiveKeys, negativeKeys);
+
+		// Assert:
+		EXPECT_FALSE(isDecoded);
+	}
+
+	// endregion
+
+	// region fold
+
+	TEST(TEST_CLASS, CannotFoldIntoInvalidOrLargerNumberOfCells) {
+		// Arrange:
+		Table table(24);
+
+		// Act + Assert:
+		EXPECT_THROW(table.fold(9), catapult_invalid_argument);
+		EXPECT_THROW(table.fold(48), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanFoldIntoSameNumberOfCells) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(5);
+		auto table = CreateTable(Num_Cells, hashes);
+
+		// Act:
+		auto foldedTable = table.fold(Num_Cells);
+
+		// Assert:
+		EXPECT_EQ(Num_Cells, foldedTable.numCells());
+		AssertDecode(foldedTable, hashes, {});
+	}
+
+	TEST(TEST_CLASS, FoldedTableIsEqualToTableCreatedWithFewerCells) {
+		// Arrange:
+		auto hashes = test::GenerateRandomDataVector<Hash256>(100);
+		auto table = CreateTable(3 * 1024, hashes);
+		auto expectedTable = CreateTable(48, hashes);
+
+		// Act:
+		auto foldedTable = table.fold(48);
+
+		// Assert:
+		ASSERT_EQ(48u, foldedTable.numCells());
+		EXPECT_TRUE(0 == std::memcmp(expectedTable.cells().data(), foldedTable.cells().data(), 48 * sizeof(Table::Cell)));
+	}
+
+	TEST(TEST_CLASS, CanDecodeDifferenceOfFoldedTables) {
+		// Arrange:
+		auto commonHashes = test::GenerateRandomDataVector<Hash256>(500);
+		auto firstHashes = test::GenerateRandomDataVector<Hash256>(10);
+		auto table1 = CreateTable(8 * Num_Cells, commonHashes);
+		auto table2 = CreateTable(8 * Num_Cells, commonHashes);
+		for (const auto& hash : firstHashes)
+			table1.insert(hash);
+
+		// Act:
+		auto foldedTable = table1.fold(Num_Cells);
+		foldedTable.subtract(table2.fold(Num_Cells));
+
+		// Assert:
+		AssertDecode(foldedTable, firstHashes, {});
+	}
+
+	// endregion
+}}
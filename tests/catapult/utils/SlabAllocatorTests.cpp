@@ -0,0 +1,230 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/SlabAllocator.h"
+#include "tests/test/nodeps/LockTestUtils.h"
+#include "tests/TestHarness.h"
+#include <boost/thread.hpp>
+#include <list>
+#include <set>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS SlabAllocatorTests
+
+	namespace {
+		void AssertStatistics(
+				const SlabPool& pool,
+				size_t expectedNumSlabs,
+				size_t expectedNumAllocatedBlocks,
+				uint64_t expectedNumTotalAllocations) {
+			auto statistics = pool.statistics();
+			EXPECT_EQ(expectedNumSlabs, statistics.NumSlabs);
+			EXPECT_EQ(expectedNumAllocatedBlocks, statistics.NumAllocatedBlocks);
+			EXPECT_EQ(expectedNumTotalAllocations, statistics.NumTotalAllocations);
+		}
+	}
+
+	// region SlabPool
+
+	TEST(TEST_CLASS, PoolIsInitiallyEmpty) {
+		// Act:
+		SlabPool pool(32, 4);
+
+		// Assert:
+		EXPECT_EQ(32u, pool.statistics().BlockSize);
+		AssertStatistics(pool, 0, 0, 0);
+	}
+
+	TEST(TEST_CLASS, BlockSizeIsRoundedUpToAlignment) {
+		// Act:
+		SlabPool pool1(1, 4);
+		SlabPool pool2(alignof(std::max_align_t) + 1, 4);
+
+		// Assert:
+		EXPECT_EQ(alignof(std::max_align_t), pool1.statistics().BlockSize);
+		EXPECT_EQ(2 * alignof(std::max_align_t), pool2.statistics().BlockSize);
+	}
+
+	TEST(TEST_CLASS, CanAllocateBlocksFromSingleSlab) {
+		// Arrange:
+		SlabPool pool(32, 4);
+
+		// Act:
+		std::set<void*> blocks;
+		for (auto i = 0u; i < 4; ++i)
+			blocks.insert(pool.allocate());
+
+		// Assert: all blocks are distinct and suitably aligned
+		EXPECT_EQ(4u, blocks.size());
+		for (const auto* pBlock : blocks)
+			EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(pBlock) % alignof(std::max_align_t));
+
+		AssertStatistics(pool, 1, 4, 4);
+	}
+
+	TEST(TEST_CLASS, AllocationAddsSlabWhenAllSlabsAreFull) {
+		// Arrange:
+		SlabPool pool(32, 4);
+
+		// Act:
+		std::set<void*> blocks;
+		for (auto i = 0u; i < 9; ++i)
+			blocks.insert(pool.allocate());
+
+		// Assert:
+		EXPECT_EQ(9u, blocks.size());
+		AssertStatistics(pool, 3, 9, 9);
+	}
+
+	TEST(TEST_CLASS, DeallocatedBlocksAreReused) {
+		// Arrange:
+		SlabPool pool(32, 4);
+		auto* pBlock1 = pool.allocate();
+		auto* pBlock2 = pool.allocate();
+
+		// Act:
+		pool.deallocate(pBlock1);
+		pool.deallocate(pBlock2);
+		auto* pBlock3 = pool.allocate();
+		auto* pBlock4 = pool.allocate();
+
+		// Assert: most recently freed blocks are reused first and no new slab is allocated
+		EXPECT_EQ(pBlock2, pBlock3);
+		EXPECT_EQ(pBlock1, pBlock4);
+		AssertStatistics(pool, 1, 2, 4);
+	}
+
+	TEST(TEST_CLASS, DeallocatingNullptrHasNoEffect) {
+		// Arrange:
+		SlabPool pool(32, 4);
+		pool.allocate();
+
+		// Act:
+		pool.deallocate(nullptr);
+
+		// Assert:
+		AssertStatistics(pool, 1, 1, 1);
+	}
+
+	TEST(TEST_CLASS, CanAllocateAndDeallocateConcurrently) {
+		// Arrange:
+		constexpr auto Num_Blocks_Per_Thread = 1000u;
+		SlabPool pool(sizeof(uint64_t), 64);
+		auto numThreads = test::Num_Default_Lock_Threads;
+
+		// Act: every thread tags all of its blocks, checks that the tags are unchanged and frees half of them
+		std::atomic<size_t> numCorruptBlocks(0);
+		boost::thread_group threads;
+		for (auto i = 0u; i < numThreads; ++i) {
+			threads.create_thread([&pool, &numCorruptBlocks, i]() {
+				std::vector<uint64_t*> blocks;
+				for (auto j = 0u; j < Num_Blocks_Per_Thread; ++j) {
+					blocks.push_back(static_cast<uint64_t*>(pool.allocate()));
+					*blocks.back() = i * Num_Blocks_Per_Thread + j;
+				}
+
+				for (auto j = 0u; j < Num_Blocks_Per_Thread; ++j) {
+					if (i * Num_Blocks_Per_Thread + j != *blocks[j])
+						++numCorruptBlocks;
+
+					if (0 == j % 2)
+						pool.deallocate(blocks[j]);
+				}
+			});
+		}
+
+		threads.join_all();
+
+		// Assert:
+		auto statistics = pool.statistics();
+		EXPECT_EQ(0u, numCorruptBlocks);
+		EXPECT_EQ(numThreads * Num_Blocks_Per_Thread / 2, statistics.NumAllocatedBlocks);
+		EXPECT_EQ(numThreads * Num_Blocks_Per_Thread, statistics.NumTotalAllocations);
+	}
+
+	// endregion
+
+	// region SlabAllocator
+
+	namespace {
+		struct SlabAllocatorTestObject {
+			uint64_t Value;
+			uint8_t Padding[40];
+		};
+	}
+
+	TEST(TEST_CLASS, SlabAllocatorAllocatesSingleObjectsFromSlabPool) {
+		// Arrange:
+		SlabAllocator<SlabAllocatorTestObject> allocator;
+		auto initialStatistics = GetSlabPool<SlabAllocatorTestObject>().statistics();
+
+		// Act:
+		auto* pObject = allocator.allocate(1);
+		auto statistics = GetSlabPool<SlabAllocatorTestObject>().statistics();
+		allocator.deallocate(pObject, 1);
+		auto finalStatistics = GetSlabPool<SlabAllocatorTestObject>().statistics();
+
+		// Assert:
+		EXPECT_EQ(initialStatistics.NumAllocatedBlocks + 1, statistics.NumAllocatedBlocks);
+		EXPECT_EQ(initialStatistics.NumTotalAllocations + 1, statistics.NumTotalAllocations);
+		EXPECT_EQ(initialStatistics.NumAllocatedBlocks, finalStatistics.NumAllocatedBlocks);
+	}
+
+	TEST(TEST_CLASS, SlabAllocatorAllocatesArraysFromHeap) {
+		// Arrange:
+		SlabAllocator<SlabAllocatorTestObject> allocator;
+		auto initialStatistics = GetSlabPool<SlabAllocatorTestObject>().statistics();
+
+		// Act:
+		auto* pObjects = allocator.allocate(3);
+		auto statistics = GetSlabPool<SlabAllocatorTestObject>().statistics();
+		allocator.deallocate(pObjects, 3);
+
+		// Assert:
+		EXPECT_EQ(initialStatistics.NumTotalAllocations, statistics.NumTotalAllocations);
+	}
+
+	TEST(TEST_CLASS, SlabAllocatorsAreInterchangeable) {
+		// Act + Assert:
+		EXPECT_TRUE(SlabAllocator<int>() == SlabAllocator<int>());
+		EXPECT_TRUE(SlabAllocator<int>() == SlabAllocator<SlabAllocatorTestObject>());
+		EXPECT_FALSE(SlabAllocator<int>() != SlabAllocator<SlabAllocatorTestObject>());
+	}
+
+	TEST(TEST_CLASS, SlabAllocatorCanBeUsedByStandardContainers) {
+		// Arrange:
+		std::list<uint64_t, SlabAllocator<uint64_t>> values;
+
+		// Act:
+		for (auto i = 0u; i < 100; ++i)
+			values.push_back(i * i);
+
+		// Assert:
+		ASSERT_EQ(100u, values.size());
+		auto i = 0u;
+		for (auto value : values) {
+			EXPECT_EQ(i * i, value) << i;
+			++i;
+		}
+	}
+
+	// endregion
+}}
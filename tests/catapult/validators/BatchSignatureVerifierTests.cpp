@@ -0,0 +1,181 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/validators/BatchSignatureVerifier.h"
+#include "catapult/crypto/Signer.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/thread/IoServiceThreadPool.h"
+#include "tests/test/core/AddressTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace validators {
+
+#define TEST_CLASS BatchSignatureVerifierTests
+
+	namespace {
+		constexpr auto Num_Entities = 20u;
+
+		// region SignaturePublisher
+
+		struct SignatureData {
+		public:
+			explicit SignatureData(const crypto::KeyPair& keyPair)
+					: Signer(keyPair.publicKey())
+					, Payload(test::GenerateRandomVector(50))
+			{
+				crypto::Sign(keyPair, Payload, Signature);
+			}
+
+		public:
+			Key Signer;
+			std::vector<uint8_t> Payload;
+			catapult::Signature Signature;
+		};
+
+		class SignaturePublisher : public model::NotificationPublisher {
+		public:
+			explicit SignaturePublisher(size_t numSignaturesPerEntity) {
+				auto keyPair = test::GenerateKeyPair();
+				for (auto i = 0u; i < Num_Entities; ++i) {
+					m_signatureDataGroups.emplace_back();
+					for (auto j = 0u; j < numSignaturesPerEntity; ++j)
+						m_signatureDataGroups.back().emplace_back(keyPair);
+				}
+			}
+
+		public:
+			void corruptSignature(size_t entityIndex, size_t signatureIndex) {
+				m_signatureDataGroups[entityIndex][signatureIndex].Signature[0] ^= 0xFF;
+			}
+
+		public:
+			void publish(const model::WeakEntityInfo& entityInfo, model::NotificationSubscriber& sub) const override {
+				// entity index is stored in first byte of hash
+				for (const auto& signatureData : m_signatureDataGroups[entityInfo.hash()[0]]) {
+					// publish an unrelated notification that should be ignored
+					sub.notify(model::AccountPublicKeyNotification(signatureData.Signer));
+					sub.notify(model::SignatureNotification(signatureData.Signer, signatureData.Signature, signatureData.Payload));
+				}
+			}
+
+		private:
+			std::vector<std::vector<SignatureData>> m_signatureDataGroups;
+		};
+
+		// endregion
+
+		// region TestContext
+
+		class TestContext {
+		public:
+			explicit TestContext(size_t numSignaturesPerEntity)
+					: m_pPool(test::CreateStartedIoServiceThreadPool(4))
+					, m_entities(Num_Entities)
+					, m_hashes(Num_Entities) {
+				auto pPublisher = std::make_unique<SignaturePublisher>(numSignaturesPerEntity);
+				m_pPublisher = pPublisher.get();
+				m_pVerifier = CreateBatchSignatureVerifier(std::move(pPublisher), m_pPool);
+
+				for (auto i = 0u; i < Num_Entities; ++i) {
+					m_hashes[i][0] = static_cast<uint8_t>(i);
+					m_entityInfos.emplace_back(m_entities[i], m_hashes[i]);
+				}
+			}
+
+			~TestContext() {
+				// shutdown order is important
+				// 1. wait for all verification operations to finish so that the only pointer is m_pVerifier
+				// 2. m_pPool->join waits for threads to complete but must finish before m_pVerifier is destroyed
+				test::WaitForUnique(m_pVerifier, "m_pVerifier");
+				m_pPool->join();
+			}
+
+		public:
+			SignaturePublisher& publisher() {
+				return *m_pPublisher;
+			}
+
+		public:
+			bool verify() {
+				return m_pVerifier->verify(m_entityInfos).get();
+			}
+
+		private:
+			std::shared_ptr<thread::IoServiceThreadPool> m_pPool;
+			std::vector<model::VerifiableEntity> m_entities;
+			std::vector<Hash256> m_hashes;
+			model::WeakEntityInfos m_entityInfos;
+			SignaturePublisher* m_pPublisher;
+			std::shared_ptr<const BatchSignatureVerifier> m_pVerifier;
+		};
+
+		// endregion
+	}
+
+	TEST(TEST_CLASS, VerifySucceedsWhenNoSignaturesArePublished) {
+		// Arrange:
+		TestContext context(0);
+
+		// Act:
+		auto result = context.verify();
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, VerifySucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		TestContext context(3);
+
+		// Act:
+		auto result = context.verify();
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, VerifyFailsWhenAnySignatureIsInvalid) {
+		// Arrange: corrupt signatures at beginning, middle and end
+		for (auto entityIndex : { 0u, Num_Entities / 2, Num_Entities - 1 }) {
+			TestContext context(3);
+			context.publisher().corruptSignature(entityIndex, 1);
+
+			// Act:
+			auto result = context.verify();
+
+			// Assert:
+			EXPECT_FALSE(result) << "corrupt entity at " << entityIndex;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyFailsWhenMultipleSignaturesAreInvalid) {
+		// Arrange:
+		TestContext context(3);
+		context.publisher().corruptSignature(2, 0);
+		context.publisher().corruptSignature(7, 2);
+
+		// Act:
+		auto result = context.verify();
+
+		// Assert:
+		EXPECT_FALSE(result);
+	}
+}}
@@ -260,5 +260,54 @@ namespace catapult { namespace validators {
 		});
 	}
 
+	namespace {
+		Breadcrumbs ValidateWithInterleavedValidators(const model::Notification& notification) {
+			// Arrange:
+			Breadcrumbs breadcrumbs;
+			stateful::DemuxValidatorBuilder builder;
+
+			auto cache = test::CreateEmptyCatapultCache();
+			auto cacheView = cache.createView();
+			auto context = test::CreateValidatorContext(Height(123), cacheView.toReadOnly());
+
+			builder
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all1"))
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "key1"))
+				.add(CreateBreadcrumbValidator<model::AccountAddressNotification>(breadcrumbs, "address1"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all2"))
+				.add(CreateBreadcrumbValidator<model::AccountPublicKeyNotification>(breadcrumbs, "key2"))
+				.add(CreateBreadcrumbValidator(breadcrumbs, "all3"));
+			auto pValidator = builder.build([](auto) { return false; });
+
+			// Act:
+			auto result = test::ValidateNotification<model::Notification>(*pValidator, notification, context);
+
+			// Assert:
+			EXPECT_EQ(ValidationResult::Success, result);
+
+			Breadcrumbs expectedNames{ "all1", "key1", "address1", "all2", "key2", "all3" };
+			EXPECT_EQ(expectedNames, pValidator->names());
+			return breadcrumbs;
+		}
+	}
+
+	TEST(TEST_CLASS, MatchingAndUniversalValidatorsAreInvokedInRegistrationOrder) {
+		// Act:
+		auto breadcrumbs = ValidateWithInterleavedValidators(model::AccountPublicKeyNotification(Key()));
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "all1", "key1", "all2", "key2", "all3" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
+	TEST(TEST_CLASS, OnlyUniversalValidatorsAreInvokedForUnregisteredNotificationType) {
+		// Act:
+		auto breadcrumbs = ValidateWithInterleavedValidators(model::EntityNotification(model::NetworkIdentifier::Zero));
+
+		// Assert:
+		Breadcrumbs expectedSelectedNames{ "all1", "all2", "all3" };
+		EXPECT_EQ(expectedSelectedNames, breadcrumbs);
+	}
+
 	// endregion
 }}
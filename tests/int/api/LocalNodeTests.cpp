@@ -72,7 +72,7 @@ namespace catapult { namespace local {
 
 	TEST(TEST_CLASS, AllPeriodicTasksAreScheduled) {
 		// Assert:
-		test::AssertLocalNodeSchedulesTasks<TestContext>(7);
+		test::AssertLocalNodeSchedulesTasks<TestContext>(8);
 	}
 
 	TEST(TEST_CLASS, AllCounterGroupsAreRegistered) {
@@ -87,7 +87,7 @@ namespace catapult { namespace local {
 
 	TEST(TEST_CLASS, AllPeriodicTasksAreScheduled) {
 		// Assert:
-		test::AssertLocalNodeSchedulesTasks<TestContext>(9);
+		test::AssertLocalNodeSchedulesTasks<TestContext>(10);
 	}
 
 	TEST(TEST_CLASS, AllCounterGroupsAreRegistered) {
@@ -21,10 +21,56 @@
 #include "tools/ToolMain.h"
 #include "tools/ToolKeys.h"
 #include "tools/ToolThreadUtils.h"
+#include "catapult/cache_db/RdbColumnContainer.h"
+#include "catapult/cache_db/RocksDatabase.h"
 #include "catapult/crypto/Signer.h"
+#include "catapult/disruptor/ConsumerDispatcher.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/RawFile.h"
+#include "catapult/io/SegmentedFileStorage.h"
+#include "catapult/ionet/PacketIo.h"
+#include "catapult/ionet/SecureMacPacketIo.h"
+#include "catapult/ionet/SecureSignedPacketIo.h"
+#include "catapult/local/MemoryCounters.h"
+#include "catapult/model/Block.h"
+#include "catapult/model/NotificationTape.h"
+#include "catapult/state/AccountState.h"
 #include "catapult/thread/IoServiceThreadPool.h"
 #include "catapult/thread/ParallelFor.h"
+#include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/MemoryUtils.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/validators/AggregateValidatorBuilder.h"
+#include "catapult/validators/DemuxValidatorBuilder.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <thread>
+
+namespace {
+	// all heap allocations are counted so that benchmarks can report allocation counts
+	std::atomic<uint64_t> Num_Heap_Allocations(0);
+}
+
+void* operator new(size_t size) {
+	++Num_Heap_Allocations;
+	auto* pMemory = std::malloc(0 == size ? 1 : size);
+	if (!pMemory)
+		throw std::bad_alloc();
+
+	return pMemory;
+}
+
+void operator delete(void* pMemory) noexcept {
+	std::free(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept {
+	std::free(pMemory);
+}
 
 namespace catapult { namespace tools { namespace benchmark {
 
@@ -35,6 +81,297 @@ namespace catapult { namespace tools { namespace benchmark {
 			bool IsVerified = false;
 		};
 
+		disruptor::ConsumerInput CreateDispatcherInput() {
+			auto pBlock = std::make_unique<model::Block>();
+			pBlock->Size = sizeof(model::Block);
+			return disruptor::ConsumerInput(model::BlockRange::FromEntity(std::move(pBlock)));
+		}
+
+		constexpr auto Cache_Database_Directory = "benchmark.cachedb";
+		constexpr auto Num_Cache_Database_Commits = 10u;
+
+		using CacheDatabaseDeltas = std::vector<std::pair<Hash256, std::string>>;
+
+		CacheDatabaseDeltas GenerateCacheDatabaseDeltas(size_t numElements, size_t valueSize) {
+			CacheDatabaseDeltas deltas(numElements);
+			for (auto& pair : deltas) {
+				std::generate_n(pair.first.begin(), pair.first.size(), []() { return static_cast<uint8_t>(std::rand()); });
+				pair.second.resize(valueSize);
+				std::generate_n(pair.second.begin(), pair.second.size(), []() { return static_cast<char>(std::rand()); });
+			}
+
+			return deltas;
+		}
+
+		void LogLatencies(std::vector<uint64_t>& latencies) {
+			std::sort(latencies.begin(), latencies.end());
+			auto percentile = [&latencies](size_t percent) {
+				return latencies[(latencies.size() - 1) * percent / 100];
+			};
+
+			CATAPULT_LOG(info)
+					<< "latency (us): min " << latencies.front()
+					<< ", p50 " << percentile(50)
+					<< ", p99 " << percentile(99)
+					<< ", max " << latencies.back();
+		}
+
+		constexpr auto Block_Storage_Directory = "benchmark.blocks";
+		constexpr auto Num_Block_Storage_Transactions = 10u;
+		constexpr auto Num_Hashes_Per_Request = 100u;
+
+		std::unique_ptr<model::Block> GenerateBlockStorageBlock(Height height, uint32_t transactionSize) {
+			auto size = static_cast<uint32_t>(sizeof(model::Block) + Num_Block_Storage_Transactions * transactionSize);
+			auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
+			std::memset(static_cast<void*>(pBlock.get()), 0, size);
+			pBlock->Size = size;
+			pBlock->Height = height;
+
+			auto* pTransactionData = reinterpret_cast<uint8_t*>(pBlock.get() + 1);
+			for (auto i = 0u; i < Num_Block_Storage_Transactions; ++i, pTransactionData += transactionSize) {
+				std::generate_n(pTransactionData, transactionSize, []() { return static_cast<uint8_t>(std::rand()); });
+				reinterpret_cast<model::Transaction*>(pTransactionData)->Size = transactionSize;
+			}
+
+			return pBlock;
+		}
+
+		model::BlockElement ToBlockStorageBlockElement(const model::Block& block) {
+			auto blockElement = model::BlockElement(block);
+			blockElement.EntityHash[0] = static_cast<uint8_t>(block.Height.unwrap());
+			for (const auto& transaction : block.Transactions())
+				blockElement.Transactions.push_back(model::TransactionElement(transaction));
+
+			return blockElement;
+		}
+
+		void PrepareBlockStorageDirectory(bool isSegmented) {
+			boost::filesystem::remove_all(Block_Storage_Directory);
+			boost::filesystem::create_directories(Block_Storage_Directory);
+			if (isSegmented)
+				return;
+
+			// file-based storage expects the hash file to be seeded with (at least) the nemesis block hash
+			boost::filesystem::path hashFilePath = Block_Storage_Directory;
+			hashFilePath /= "00000";
+			boost::filesystem::create_directories(hashFilePath);
+			hashFilePath /= "hashes.dat";
+
+			io::RawFile hashFile(hashFilePath.generic_string(), io::OpenMode::Read_Write);
+			hashFile.write(std::vector<uint8_t>(2 * Hash256_Size));
+		}
+
+		std::unique_ptr<io::PrunableBlockStorage> CreateBlockStorage(bool isSegmented) {
+			if (isSegmented)
+				return std::make_unique<io::SegmentedFileStorage>(Block_Storage_Directory);
+
+			return std::make_unique<io::FileBasedStorage>(Block_Storage_Directory);
+		}
+
+		void LogThroughput(const utils::StackLogger& stopwatch, size_t numOperations) {
+			auto elapsedMillis = stopwatch.millis();
+			auto opsPerSecond = 0 == elapsedMillis ? 0 : numOperations * 1000u / elapsedMillis;
+			CATAPULT_LOG(info)
+					<< (0 == opsPerSecond ? "???" : std::to_string(opsPerSecond)) << " ops/s "
+					<< "(elapsed time " << elapsedMillis << "ms, " << numOperations << " ops)";
+		}
+
+		// notification mix is modeled after a block containing plugin transactions:
+		// - every registered notification type has a few validators (similar to the number of plugin validators per type)
+		// - a few validators are registered for all notifications
+		// - some published notifications (e.g. observer-only ones) do not have any typed validators
+		constexpr auto Num_Dispatch_Notification_Types = 48u;
+		constexpr auto Num_Dispatch_Unregistered_Notification_Types = 8u;
+		constexpr auto Num_Dispatch_Validators_Per_Type = 2u;
+		constexpr auto Num_Dispatch_Universal_Validators = 4u;
+		constexpr auto Num_Dispatch_Transactions = 100u;
+		constexpr auto Num_Dispatch_Notifications_Per_Transaction = 8u;
+
+		constexpr model::NotificationType MakeDispatchNotificationType(uint16_t code) {
+			auto facility = model::FacilityCode::Core;
+			return model::MakeNotificationType(model::NotificationChannel::Validator, facility, static_cast<uint16_t>(0x1000 + code));
+		}
+
+		template<uint16_t Code>
+		struct DispatchNotification : public model::Notification {
+		public:
+			static constexpr auto Notification_Type = MakeDispatchNotificationType(Code);
+		};
+
+		template<typename TNotification>
+		class DispatchValidator : public validators::stateless::NotificationValidatorT<TNotification> {
+		public:
+			DispatchValidator(const std::string& name, size_t& numValidations)
+					: m_name(name)
+					, m_numValidations(numValidations)
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_name;
+			}
+
+			validators::ValidationResult validate(const TNotification&) const override {
+				++m_numValidations;
+				return validators::ValidationResult::Success;
+			}
+
+		private:
+			std::string m_name;
+			size_t& m_numValidations;
+		};
+
+		/// Validator that filters notifications by scanning predicates (emulates dispatch without a type table).
+		template<typename TNotification>
+		class LinearDispatchValidator : public validators::stateless::NotificationValidatorT<model::Notification> {
+		public:
+			explicit LinearDispatchValidator(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator)
+					: m_pValidator(std::move(pValidator))
+			{}
+
+		public:
+			const std::string& name() const override {
+				return m_pValidator->name();
+			}
+
+			validators::ValidationResult validate(const model::Notification& notification) const override {
+				if (!model::AreEqualExcludingChannel(TNotification::Notification_Type, notification.Type))
+					return validators::ValidationResult::Success;
+
+				return m_pValidator->validate(static_cast<const TNotification&>(notification));
+			}
+
+		private:
+			validators::stateless::NotificationValidatorPointerT<TNotification> m_pValidator;
+		};
+
+		struct LinearDispatchBuilder {
+		public:
+			template<typename TNotification>
+			void add(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator) {
+				Builder.add(std::make_unique<LinearDispatchValidator<TNotification>>(std::move(pValidator)));
+			}
+
+			void add(validators::stateless::NotificationValidatorPointerT<model::Notification>&& pValidator) {
+				Builder.add(std::move(pValidator));
+			}
+
+		public:
+			validators::AggregateValidatorBuilder<model::Notification> Builder;
+		};
+
+		struct TableDispatchBuilder {
+		public:
+			template<typename TNotification>
+			void add(validators::stateless::NotificationValidatorPointerT<TNotification>&& pValidator) {
+				Builder.add(std::move(pValidator));
+			}
+
+		public:
+			validators::stateless::DemuxValidatorBuilder Builder;
+		};
+
+		template<typename TNotification, typename TBuilder>
+		void AddDispatchValidator(TBuilder& builder, const std::string& name, size_t& numValidations) {
+			builder.add(validators::stateless::NotificationValidatorPointerT<TNotification>(
+					std::make_unique<DispatchValidator<TNotification>>(name, numValidations)));
+		}
+
+		template<uint16_t Num_Codes>
+		struct TypedDispatchValidatorsAdder {
+			template<typename TBuilder>
+			static void Add(TBuilder& builder, size_t& numValidations) {
+				TypedDispatchValidatorsAdder<Num_Codes - 1>::Add(builder, numValidations);
+
+				constexpr uint16_t Code = Num_Codes - 1;
+				for (auto i = 0u; i < Num_Dispatch_Validators_Per_Type; ++i)
+					AddDispatchValidator<DispatchNotification<Code>>(builder, std::to_string(Code), numValidations);
+			}
+		};
+
+		template<>
+		struct TypedDispatchValidatorsAdder<0> {
+			template<typename TBuilder>
+			static void Add(TBuilder&, size_t&)
+			{}
+		};
+
+		template<typename TBuilder>
+		auto BuildDispatchValidator(TBuilder&& builder, size_t& numValidations) {
+			for (auto i = 0u; i < Num_Dispatch_Universal_Validators; ++i) {
+				AddDispatchValidator<model::Notification>(builder, "universal", numValidations);
+
+				// interleave universal validators with typed validators like plugins do
+				if (0 == i)
+					TypedDispatchValidatorsAdder<Num_Dispatch_Notification_Types>::Add(builder, numValidations);
+			}
+
+			return builder.Builder.build([](auto) { return false; });
+		}
+
+		model::NotificationTape GenerateDispatchNotifications() {
+			model::NotificationTape tape;
+			auto numTypes = Num_Dispatch_Notification_Types + Num_Dispatch_Unregistered_Notification_Types;
+			for (auto i = 0u; i < Num_Dispatch_Transactions; ++i) {
+				for (auto j = 0u; j < Num_Dispatch_Notifications_Per_Transaction; ++j) {
+					auto code = static_cast<uint16_t>((i * Num_Dispatch_Notifications_Per_Transaction + j) % numTypes);
+					tape.notify(model::Notification(MakeDispatchNotificationType(code), sizeof(model::Notification)));
+				}
+			}
+
+			return tape;
+		}
+
+		constexpr auto Num_Account_State_Mosaics = 3u;
+
+		struct MemoryUsage {
+			uint64_t NumHeapAllocations;
+			uint64_t ResidentSetSizeMegabytes;
+		};
+
+		MemoryUsage GetMemoryUsage() {
+			std::vector<utils::DiagnosticCounter> counters;
+			local::AddMemoryCounters(counters);
+
+			auto iter = std::find_if(counters.cbegin(), counters.cend(), [](const auto& counter) {
+				return "MEM CUR RSS" == counter.id().name();
+			});
+			return { Num_Heap_Allocations, counters.cend() == iter ? 0 : iter->value() };
+		}
+
+		void LogMemoryUsage(const MemoryUsage& start, const MemoryUsage& end) {
+			CATAPULT_LOG(info)
+					<< "heap allocations " << (end.NumHeapAllocations - start.NumHeapAllocations)
+					<< ", rss growth " << (end.ResidentSetSizeMegabytes - start.ResidentSetSizeMegabytes) << "MB";
+		}
+
+		/// Packet io that returns written packets in order on subsequent reads.
+		class LoopbackPacketIo : public ionet::PacketIo {
+		public:
+			void write(const ionet::PacketPayload& payload, const WriteCallback& callback) override {
+				std::vector<uint8_t> packetBuffer(payload.header().Size);
+				auto* pData = packetBuffer.data();
+				std::memcpy(pData, &payload.header(), sizeof(ionet::PacketHeader));
+				pData += sizeof(ionet::PacketHeader);
+				for (const auto& buffer : payload.buffers()) {
+					std::memcpy(pData, buffer.pData, buffer.Size);
+					pData += buffer.Size;
+				}
+
+				m_packetBuffers.push_back(std::move(packetBuffer));
+				callback(ionet::SocketOperationCode::Success);
+			}
+
+			void read(const ReadCallback& callback) override {
+				auto packetBuffer = std::move(m_packetBuffers.front());
+				m_packetBuffers.pop_front();
+				callback(ionet::SocketOperationCode::Success, reinterpret_cast<const ionet::Packet*>(packetBuffer.data()));
+			}
+
+		private:
+			std::deque<std::vector<uint8_t>> m_packetBuffers;
+		};
+
 		class BenchmarkTool : public Tool {
 		public:
 			std::string name() const override {
@@ -42,6 +379,9 @@ namespace catapult { namespace tools { namespace benchmark {
 			}
 
 			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("benchmark,b",
+						OptionsValue<std::string>(m_benchmarkName)->default_value("signature"),
+						"the benchmark to run (signature, dispatcher, cachedb, blockstorage, packetsecurity, notificationdispatch, accountstate)");
 				optionsBuilder("num threads,t",
 						OptionsValue<uint32_t>(m_numThreads)->default_value(0),
 						"the number of threads");
@@ -54,12 +394,39 @@ namespace catapult { namespace tools { namespace benchmark {
 				optionsBuilder("data size,s",
 						OptionsValue<uint32_t>(m_dataSize)->default_value(148),
 						"the size of the data to generate");
+				optionsBuilder("num stages,n",
+						OptionsValue<uint32_t>(m_numStages)->default_value(4),
+						"the number of dispatcher stages (dispatcher benchmark)");
 			}
 
 			int run(const Options&) override {
 				m_numThreads = 0 != m_numThreads ? m_numThreads : std::thread::hardware_concurrency();
 				m_numPartitions = 0 != m_numPartitions ? m_numPartitions : m_numThreads;
 
+				if ("signature" == m_benchmarkName) {
+					runSignatureBenchmark();
+				} else if ("dispatcher" == m_benchmarkName) {
+					runDispatcherBenchmark();
+				} else if ("cachedb" == m_benchmarkName) {
+					runCacheDatabaseBenchmark();
+				} else if ("blockstorage" == m_benchmarkName) {
+					runBlockStorageBenchmark();
+				} else if ("packetsecurity" == m_benchmarkName) {
+					runPacketSecurityBenchmark();
+				} else if ("notificationdispatch" == m_benchmarkName) {
+					runNotificationDispatchBenchmark();
+				} else if ("accountstate" == m_benchmarkName) {
+					runAccountStateBenchmark();
+				} else {
+					CATAPULT_LOG(error) << "unknown benchmark: " << m_benchmarkName;
+					return -1;
+				}
+
+				return 0;
+			}
+
+		private:
+			void runSignatureBenchmark() const {
 				CATAPULT_LOG(info)
 						<< "num threads (" << m_numThreads
 						<< "), num partitions (" << m_numPartitions
@@ -86,11 +453,310 @@ namespace catapult { namespace tools { namespace benchmark {
 					if (!entry.IsVerified)
 						CATAPULT_LOG(warning) << "could not verify data!";
 				});
+			}
 
-				return 0;
+			void runDispatcherBenchmark() const {
+				CATAPULT_LOG(info) << "num stages (" << m_numStages << "), num elements (" << m_opsPerPartition << ")";
+
+				for (auto waitStrategy : {
+					disruptor::ConsumerWaitStrategy::Sleep,
+					disruptor::ConsumerWaitStrategy::Busy_Spin,
+					disruptor::ConsumerWaitStrategy::Spin_Yield,
+					disruptor::ConsumerWaitStrategy::Blocking,
+					disruptor::ConsumerWaitStrategy::Hybrid
+				}) {
+					CATAPULT_LOG(info) << "wait strategy (" << waitStrategy << ")";
+					auto latencies = measureDispatcherLatencies(waitStrategy);
+					LogLatencies(latencies);
+				}
+			}
+
+			std::vector<uint64_t> measureDispatcherLatencies(disruptor::ConsumerWaitStrategy waitStrategy) const {
+				auto options = disruptor::ConsumerDispatcherOptions("benchmark dispatcher", 1024);
+				options.ElementTraceInterval = 0;
+				options.WaitStrategy = waitStrategy;
+
+				std::vector<disruptor::DisruptorConsumer> consumers(m_numStages, [](const auto&) {
+					return disruptor::ConsumerResult::Continue();
+				});
+				disruptor::ConsumerDispatcher dispatcher(options, consumers);
+
+				// push elements one at a time so that each measurement is the end-to-end latency of a single element
+				std::vector<uint64_t> latencies;
+				utils::StackLogger stopwatch("Dispatcher", utils::LogLevel::Info);
+				for (auto i = 0u; i < m_opsPerPartition; ++i) {
+					std::atomic_bool isComplete(false);
+					auto startTime = std::chrono::steady_clock::now();
+					dispatcher.processElement(CreateDispatcherInput(), [&isComplete](auto, const auto&) {
+						isComplete = true;
+					});
+
+					while (!isComplete)
+						std::this_thread::yield();
+
+					auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+					latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count()));
+				}
+
+				return latencies;
+			}
+
+			void runCacheDatabaseBenchmark() const {
+				CATAPULT_LOG(info)
+						<< "num commits (" << Num_Cache_Database_Commits
+						<< "), elements / commit (" << m_opsPerPartition
+						<< "), data size (" << m_dataSize << ")";
+
+				for (auto isBatched : { false, true }) {
+					CATAPULT_LOG(info) << (isBatched ? "batched writes" : "individual writes");
+					auto latencies = measureCacheDatabaseCommitLatencies(isBatched);
+					LogLatencies(latencies);
+				}
+			}
+
+			std::vector<uint64_t> measureCacheDatabaseCommitLatencies(bool isBatched) const {
+				boost::filesystem::remove_all(Cache_Database_Directory);
+
+				std::vector<uint64_t> latencies;
+				{
+					cache::RocksDatabase database(Cache_Database_Directory, {});
+					cache::RdbColumnContainer container(database, 0);
+
+					utils::StackLogger stopwatch(isBatched ? "Batched Commit" : "Individual Commit", utils::LogLevel::Info);
+					for (auto i = 0u; i < Num_Cache_Database_Commits; ++i) {
+						// each commit writes a fresh delta that is similar to the one produced by a large block
+						auto deltas = GenerateCacheDatabaseDeltas(m_opsPerPartition, m_dataSize);
+
+						auto startTime = std::chrono::steady_clock::now();
+						if (isBatched) {
+							cache::RdbWriteBatch batch;
+							for (const auto& pair : deltas)
+								container.insert(batch, pair.first, pair.second);
+
+							container.saveSize(batch, container.size() + deltas.size());
+							database.write(batch);
+						} else {
+							for (const auto& pair : deltas)
+								container.insert(pair.first, pair.second);
+
+							container.saveSize(container.size() + deltas.size());
+						}
+
+						auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+						latencies.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count()));
+					}
+				}
+
+				boost::filesystem::remove_all(Cache_Database_Directory);
+				return latencies;
+			}
+
+			void runBlockStorageBenchmark() const {
+				auto transactionSize = std::max<uint32_t>(m_dataSize, sizeof(model::Transaction));
+				CATAPULT_LOG(info)
+						<< "num blocks (" << m_opsPerPartition
+						<< "), transactions / block (" << Num_Block_Storage_Transactions
+						<< "), transaction size (" << transactionSize << ")";
+
+				// file-based storage implicitly contains a nemesis block, so block 1 is only saved into segmented storage
+				std::vector<std::unique_ptr<model::Block>> blocks;
+				for (auto i = 0u; i <= m_opsPerPartition; ++i)
+					blocks.push_back(GenerateBlockStorageBlock(Height(i + 1), transactionSize));
+
+				for (auto isSegmented : { false, true }) {
+					CATAPULT_LOG(info) << (isSegmented ? "segmented storage" : "file-based storage");
+					PrepareBlockStorageDirectory(isSegmented);
+
+					{
+						auto pStorage = CreateBlockStorage(isSegmented);
+						utils::StackLogger stopwatch("Save", utils::LogLevel::Info);
+						for (auto iter = blocks.cbegin() + (isSegmented ? 0 : 1); blocks.cend() != iter; ++iter)
+							pStorage->saveBlock(ToBlockStorageBlockElement(**iter));
+
+						LogThroughput(stopwatch, m_opsPerPartition);
+					}
+
+					measureBlockStorageReplay(isSegmented);
+				}
+
+				boost::filesystem::remove_all(Block_Storage_Directory);
+			}
+
+			void measureBlockStorageReplay(bool isSegmented) const {
+				{
+					// replay every block in a fresh storage, similar to what happens during node startup
+					utils::StackLogger stopwatch("Startup Replay", utils::LogLevel::Info);
+					auto pStorage = CreateBlockStorage(isSegmented);
+					auto chainHeight = pStorage->chainHeight();
+					size_t numTransactions = 0;
+					for (auto height = Height(2); height <= chainHeight; height = height + Height(1))
+						numTransactions += pStorage->loadBlockElement(height)->Transactions.size();
+
+					LogThroughput(stopwatch, m_opsPerPartition);
+					CATAPULT_LOG(debug) << "replayed " << numTransactions << " transactions";
+				}
+
+				{
+					utils::StackLogger stopwatch("Load Hashes", utils::LogLevel::Info);
+					auto pStorage = CreateBlockStorage(isSegmented);
+					auto chainHeight = pStorage->chainHeight();
+					size_t numHashes = 0;
+					for (auto height = Height(1); height <= chainHeight; height = height + Height(Num_Hashes_Per_Request))
+						numHashes += pStorage->loadHashesFrom(height, Num_Hashes_Per_Request).size();
+
+					LogThroughput(stopwatch, numHashes);
+				}
+			}
+
+			void runPacketSecurityBenchmark() const {
+				auto numPackets = m_numPartitions * m_opsPerPartition;
+				CATAPULT_LOG(info) << "num packets (" << numPackets << "), data size (" << m_dataSize << ")";
+
+				auto keyPair = GenerateRandomKeyPair();
+				auto remoteKeyPair = GenerateRandomKeyPair();
+				Hash256 sessionId;
+				std::generate_n(sessionId.begin(), sessionId.size(), []() { return static_cast<uint8_t>(std::rand()); });
+
+				auto pPacket = ionet::CreateSharedPacket<ionet::Packet>(m_dataSize);
+				pPacket->Type = ionet::PacketType::Push_Transactions;
+				std::generate_n(pPacket->Data(), m_dataSize, []() { return static_cast<uint8_t>(std::rand()); });
+
+				// writer and reader emulate the two ends of a single connection
+				auto pLoopbackIo = std::make_shared<LoopbackPacketIo>();
+				{
+					CATAPULT_LOG(info) << "signed packets";
+					auto pWriter = ionet::CreateSecureSignedPacketIo(pLoopbackIo, keyPair, remoteKeyPair.publicKey(), m_dataSize);
+					auto pReader = ionet::CreateSecureSignedPacketIo(pLoopbackIo, remoteKeyPair, keyPair.publicKey(), m_dataSize);
+					measurePacketRoundtrips(*pWriter, *pReader, pPacket, numPackets);
+				}
+
+				{
+					CATAPULT_LOG(info) << "mac packets";
+					auto pWriterSession = ionet::CreateSecureMacSession(keyPair, remoteKeyPair.publicKey(), sessionId);
+					auto pReaderSession = ionet::CreateSecureMacSession(remoteKeyPair, keyPair.publicKey(), sessionId);
+					auto pWriter = ionet::CreateSecureMacPacketIo(pLoopbackIo, pWriterSession, m_dataSize);
+					auto pReader = ionet::CreateSecureMacPacketIo(pLoopbackIo, pReaderSession, m_dataSize);
+					measurePacketRoundtrips(*pWriter, *pReader, pPacket, numPackets);
+				}
+			}
+
+			void measurePacketRoundtrips(
+					ionet::PacketIo& writer,
+					ionet::PacketIo& reader,
+					const std::shared_ptr<ionet::Packet>& pPacket,
+					size_t numPackets) const {
+				size_t numFailures = 0;
+				utils::StackLogger stopwatch("Write + Read", utils::LogLevel::Info);
+				for (auto i = 0u; i < numPackets; ++i) {
+					writer.write(ionet::PacketPayload(pPacket), [&numFailures](auto code) {
+						if (ionet::SocketOperationCode::Success != code)
+							++numFailures;
+					});
+					reader.read([&numFailures](auto code, const auto*) {
+						if (ionet::SocketOperationCode::Success != code)
+							++numFailures;
+					});
+				}
+
+				LogThroughput(stopwatch, numPackets);
+				if (0 != numFailures)
+					CATAPULT_LOG(warning) << numFailures << " packet operations failed!";
+			}
+
+			void runNotificationDispatchBenchmark() const {
+				CATAPULT_LOG(info)
+						<< "num blocks (" << m_opsPerPartition
+						<< "), transactions / block (" << Num_Dispatch_Transactions
+						<< "), notifications / transaction (" << Num_Dispatch_Notifications_Per_Transaction
+						<< "), notification types (" << Num_Dispatch_Notification_Types << ")";
+
+				auto tape = GenerateDispatchNotifications();
+
+				{
+					CATAPULT_LOG(info) << "linear dispatch";
+					size_t numValidations = 0;
+					auto pValidator = BuildDispatchValidator(LinearDispatchBuilder(), numValidations);
+					measureNotificationDispatch(*pValidator, tape, numValidations);
+				}
+
+				{
+					CATAPULT_LOG(info) << "table dispatch";
+					size_t numValidations = 0;
+					auto pValidator = BuildDispatchValidator(TableDispatchBuilder(), numValidations);
+					measureNotificationDispatch(*pValidator, tape, numValidations);
+				}
+			}
+
+			void measureNotificationDispatch(
+					const validators::stateless::AggregateNotificationValidator& validator,
+					const model::NotificationTape& tape,
+					const size_t& numValidations) const {
+				size_t numFailures = 0;
+				utils::StackLogger stopwatch("Validate Notifications", utils::LogLevel::Info);
+				for (auto i = 0u; i < m_opsPerPartition; ++i) {
+					tape.forEach([&validator, &numFailures](const auto& notification) {
+						if (validators::ValidationResult::Success != validator.validate(notification))
+							++numFailures;
+					});
+				}
+
+				LogThroughput(stopwatch, m_opsPerPartition * tape.size());
+				CATAPULT_LOG(info) << "num sub validations (" << numValidations << ")";
+				if (0 != numFailures)
+					CATAPULT_LOG(warning) << numFailures << " notifications failed validation!";
+			}
+
+			void runAccountStateBenchmark() const {
+				auto numAccounts = m_numPartitions * m_opsPerPartition;
+				CATAPULT_LOG(info) << "num accounts (" << numAccounts << "), mosaics / account (" << Num_Account_State_Mosaics << ")";
+
+				// slab pools retain their memory, so the slab run comes first in order to not reuse memory freed by the heap run
+				CATAPULT_LOG(info) << "slab allocated account states";
+				measureAccountStateAllocations(numAccounts, [](const auto&... args) {
+					return state::MakeSharedAccountState(args...);
+				});
+
+				CATAPULT_LOG(info) << "heap allocated account states";
+				measureAccountStateAllocations(numAccounts, [](const auto&... args) {
+					return std::make_shared<state::AccountState>(args...);
+				});
+			}
+
+			template<typename TFactory>
+			void measureAccountStateAllocations(size_t numAccounts, TFactory factory) const {
+				std::vector<std::shared_ptr<state::AccountState>> accountStates;
+				accountStates.reserve(numAccounts);
+				{
+					auto startUsage = GetMemoryUsage();
+					utils::StackLogger stopwatch("Create", utils::LogLevel::Info);
+					Address address;
+					for (auto i = 0u; i < numAccounts; ++i) {
+						std::memcpy(address.data(), &i, sizeof(uint32_t));
+						auto pAccountState = factory(address, Height(i + 1));
+						for (auto j = 1u; j <= Num_Account_State_Mosaics; ++j)
+							pAccountState->Balances.credit(MosaicId(j), Amount(i * j));
+
+						accountStates.push_back(std::move(pAccountState));
+					}
+
+					LogThroughput(stopwatch, numAccounts);
+					LogMemoryUsage(startUsage, GetMemoryUsage());
+				}
+
+				// block execution creates a deep copy of every account state that it modifies
+				std::vector<std::shared_ptr<state::AccountState>> accountStateCopies;
+				accountStateCopies.reserve(numAccounts);
+				{
+					auto startUsage = GetMemoryUsage();
+					utils::StackLogger stopwatch("Copy", utils::LogLevel::Info);
+					for (const auto& pAccountState : accountStates)
+						accountStateCopies.push_back(factory(*pAccountState));
+
+					LogThroughput(stopwatch, numAccounts);
+					LogMemoryUsage(startUsage, GetMemoryUsage());
+				}
 			}
 
-		private:
 			template<typename TAction>
 			uint64_t RunParallel(
 					const char* testName,
@@ -117,6 +783,8 @@ namespace catapult { namespace tools { namespace benchmark {
 			uint32_t m_numPartitions;
 			uint32_t m_opsPerPartition;
 			uint32_t m_dataSize;
+			uint32_t m_numStages;
+			std::string m_benchmarkName;
 		};
 	}
 }}}
@@ -0,0 +1,81 @@
+/**
+*** Copyright (c) 2016-present,
+*** Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp. All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "tools/ToolMain.h"
+#include "catapult/io/FileBasedStorage.h"
+#include "catapult/io/SegmentedFileStorage.h"
+#include "catapult/utils/Logging.h"
+#include "catapult/utils/StackLogger.h"
+#include <boost/filesystem.hpp>
+
+namespace catapult { namespace tools { namespace storageconv {
+
+	namespace {
+		class StorageConverterTool : public Tool {
+		public:
+			std::string name() const override {
+				return "Block Storage Converter Tool";
+			}
+
+			void prepareOptions(OptionsBuilder& optionsBuilder, OptionsPositional&) override {
+				optionsBuilder("source,s",
+						OptionsValue<std::string>(m_sourceDirectory)->required(),
+						"the directory containing blocks stored one file per block");
+				optionsBuilder("destination,d",
+						OptionsValue<std::string>(m_destinationDirectory)->required(),
+						"the directory that will contain blocks stored in segments");
+				optionsBuilder("maxSegmentSize,m",
+						OptionsValue<uint32_t>(m_maxSegmentSizeMb)->default_value(256),
+						"the maximum segment size (in megabytes)");
+			}
+
+			int run(const Options&) override {
+				if (!boost::filesystem::exists(m_destinationDirectory))
+					boost::filesystem::create_directories(m_destinationDirectory);
+
+				io::FileBasedStorage sourceStorage(m_sourceDirectory);
+				io::SegmentedFileStorage destinationStorage(
+						m_destinationDirectory,
+						utils::FileSize::FromMegabytes(m_maxSegmentSizeMb));
+
+				CATAPULT_LOG(info)
+						<< "converting blocks " << destinationStorage.chainHeight() + Height(1)
+						<< " to " << sourceStorage.chainHeight();
+
+				utils::StackLogger stopwatch("Conversion", utils::LogLevel::Info);
+
+				// conversion is incremental, so an interrupted conversion can be resumed
+				auto numImportedBlocks = io::ImportBlocks(sourceStorage, destinationStorage);
+				CATAPULT_LOG(info) << "converted " << numImportedBlocks << " blocks";
+				return 0;
+			}
+
+		private:
+			std::string m_sourceDirectory;
+			std::string m_destinationDirectory;
+			uint32_t m_maxSegmentSizeMb;
+		};
+	}
+}}}
+
+int main(int argc, const char** argv) {
+	catapult::tools::storageconv::StorageConverterTool tool;
+	return catapult::tools::ToolMain(argc, argv, tool);
+}